@@ -0,0 +1,138 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include "ocs2_core/Types.h"
+
+namespace ocs2 {
+
+/** Fixed-size vector with N elements. */
+template <int N>
+using fixed_vector_t = Eigen::Matrix<scalar_t, N, 1>;
+
+/** Fixed-size matrix with R rows and C columns. */
+template <int R, int C>
+using fixed_matrix_t = Eigen::Matrix<scalar_t, R, C>;
+
+/**
+ * Fixed-size counterpart of ScalarFunctionQuadraticApproximation for NX states and NU inputs. The members live on the stack (or
+ * inline in the parent object), so the small products of low-dimensional systems do not go through heap-backed dynamic kernels.
+ *
+ * @note Store these objects in std::vector with Eigen::aligned_allocator.
+ */
+template <int NX, int NU>
+struct ScalarFunctionQuadraticApproximationT {
+  fixed_matrix_t<NX, NX> dfdxx;
+  fixed_matrix_t<NU, NX> dfdux;
+  fixed_matrix_t<NU, NU> dfduu;
+  fixed_vector_t<NX> dfdx;
+  fixed_vector_t<NU> dfdu;
+  scalar_t f = 0.;
+
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  ScalarFunctionQuadraticApproximationT() = default;
+
+  /** Constructs from a dynamic-size approximation, which must have NX states and NU inputs. */
+  explicit ScalarFunctionQuadraticApproximationT(const ScalarFunctionQuadraticApproximation& other)
+      : dfdxx(other.dfdxx), dfdux(other.dfdux), dfduu(other.dfduu), dfdx(other.dfdx), dfdu(other.dfdu), f(other.f) {}
+
+  /** Whether the dynamic-size approximation has NX states and NU inputs. */
+  static bool hasSize(const ScalarFunctionQuadraticApproximation& other) {
+    return other.dfdxx.rows() == NX && other.dfdxx.cols() == NX && other.dfdux.rows() == NU && other.dfdux.cols() == NX &&
+           other.dfduu.rows() == NU && other.dfduu.cols() == NU && other.dfdx.size() == NX && other.dfdu.size() == NU;
+  }
+
+  /** Converts to the dynamic-size approximation. */
+  ScalarFunctionQuadraticApproximation toDynamic() const {
+    ScalarFunctionQuadraticApproximation res;
+    res.dfdxx = dfdxx;
+    res.dfdux = dfdux;
+    res.dfduu = dfduu;
+    res.dfdx = dfdx;
+    res.dfdu = dfdu;
+    res.f = f;
+    return res;
+  }
+
+  ScalarFunctionQuadraticApproximationT& setZero() {
+    dfdxx.setZero();
+    dfdux.setZero();
+    dfduu.setZero();
+    dfdx.setZero();
+    dfdu.setZero();
+    f = 0.;
+    return *this;
+  }
+};
+
+/**
+ * Fixed-size counterpart of VectorFunctionLinearApproximation for a function of dimension NV, NX states, and NU inputs.
+ *
+ * @note Store these objects in std::vector with Eigen::aligned_allocator.
+ */
+template <int NV, int NX, int NU>
+struct VectorFunctionLinearApproximationT {
+  fixed_matrix_t<NV, NX> dfdx;
+  fixed_matrix_t<NV, NU> dfdu;
+  fixed_vector_t<NV> f;
+
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  VectorFunctionLinearApproximationT() = default;
+
+  /** Constructs from a dynamic-size approximation, which must have dimension NV, NX states, and NU inputs. */
+  explicit VectorFunctionLinearApproximationT(const VectorFunctionLinearApproximation& other)
+      : dfdx(other.dfdx), dfdu(other.dfdu), f(other.f) {}
+
+  /** Whether the dynamic-size approximation has dimension NV, NX states, and NU inputs. */
+  static bool hasSize(const VectorFunctionLinearApproximation& other) {
+    return other.dfdx.rows() == NV && other.dfdx.cols() == NX && other.dfdu.rows() == NV && other.dfdu.cols() == NU &&
+           other.f.size() == NV;
+  }
+
+  /** Converts to the dynamic-size approximation. */
+  VectorFunctionLinearApproximation toDynamic() const {
+    VectorFunctionLinearApproximation res;
+    res.dfdx = dfdx;
+    res.dfdu = dfdu;
+    res.f = f;
+    return res;
+  }
+
+  VectorFunctionLinearApproximationT& setZero() {
+    dfdx.setZero();
+    dfdu.setZero();
+    f.setZero();
+    return *this;
+  }
+};
+
+}  // namespace ocs2
@@ -62,6 +62,13 @@ class StateAugmentedLagrangianCollection : public Collection<StateAugmentedLagra
                                                                          const std::vector<Multiplier>& termsMultiplier,
                                                                          const PreComputation& preComp) const;
 
+  /**
+   * Add the state Lagrangian penalties quadratic approximation of the active terms to the state derivatives of the given
+   * approximation, which may also have input derivatives.
+   */
+  virtual void addQuadraticApproximation(scalar_t time, const vector_t& state, const std::vector<Multiplier>& termsMultiplier,
+                                         const PreComputation& preComp, ScalarFunctionQuadraticApproximation& penalty) const;
+
   /** Update Lagrange/penalty multipliers, and the penalty value for each active term. */
   virtual void updateLagrangian(scalar_t time, const vector_t& state, std::vector<LagrangianMetrics>& termsMetrics,
                                 std::vector<Multiplier>& termsMultiplier) const;
@@ -58,6 +58,19 @@ class StateAugmentedLagrangianInterface {
   virtual ScalarFunctionQuadraticApproximation getQuadraticApproximation(scalar_t time, const vector_t& state, const Multiplier& multiplier,
                                                                          const PreComputation& preComp) const = 0;
 
+  /**
+   * Adds the constraint's penalty quadratic approximation to the state derivatives of the given approximation, which may also have
+   * input derivatives. The default implementation adds the result of getQuadraticApproximation(). Override it to accumulate without
+   * creating a temporary approximation.
+   */
+  virtual void addQuadraticApproximation(scalar_t time, const vector_t& state, const Multiplier& multiplier, const PreComputation& preComp,
+                                         ScalarFunctionQuadraticApproximation& penalty) const {
+    const auto termPenalty = getQuadraticApproximation(time, state, multiplier, preComp);
+    penalty.f += termPenalty.f;
+    penalty.dfdx += termPenalty.dfdx;
+    penalty.dfdxx += termPenalty.dfdxx;
+  }
+
   /** Update Lagrange/penalty multipliers and the penalty function value. */
   virtual std::pair<Multiplier, scalar_t> updateLagrangian(scalar_t time, const vector_t& state, const vector_t& constraint,
                                                            const Multiplier& multiplier) const = 0;
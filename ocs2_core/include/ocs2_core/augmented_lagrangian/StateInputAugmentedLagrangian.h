@@ -67,6 +67,9 @@ class StateInputAugmentedLagrangian final : public StateInputAugmentedLagrangian
                                                                  const Multiplier& multiplier,
                                                                  const PreComputation& preComp) const override;
 
+  void addQuadraticApproximation(scalar_t time, const vector_t& state, const vector_t& input, const Multiplier& multiplier,
+                                 const PreComputation& preComp, ScalarFunctionQuadraticApproximation& penalty) const override;
+
   std::pair<Multiplier, scalar_t> updateLagrangian(scalar_t time, const vector_t& /*state*/, const vector_t& /*input*/,
                                                    const vector_t& constraint, const Multiplier& multiplier) const override;
 
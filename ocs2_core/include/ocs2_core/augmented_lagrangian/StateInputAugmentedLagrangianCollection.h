@@ -62,6 +62,11 @@ class StateInputAugmentedLagrangianCollection : public Collection<StateInputAugm
                                                                          const std::vector<Multiplier>& termsMultiplier,
                                                                          const PreComputation& preComp) const;
 
+  /** Add the state-input Lagrangian penalties quadratic approximation of the active terms to the given approximation */
+  virtual void addQuadraticApproximation(scalar_t time, const vector_t& state, const vector_t& input,
+                                         const std::vector<Multiplier>& termsMultiplier, const PreComputation& preComp,
+                                         ScalarFunctionQuadraticApproximation& penalty) const;
+
   /** Update Lagrange/penalty multipliers and the penalty value for each active term. */
   virtual void updateLagrangian(scalar_t time, const vector_t& state, const vector_t& input, std::vector<LagrangianMetrics>& termsMetrics,
                                 std::vector<Multiplier>& termsMultiplier) const;
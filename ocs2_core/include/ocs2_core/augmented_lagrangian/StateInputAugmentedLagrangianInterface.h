@@ -59,6 +59,15 @@ class StateInputAugmentedLagrangianInterface {
                                                                          const Multiplier& lagrangian,
                                                                          const PreComputation& preComp) const = 0;
 
+  /**
+   * Adds the constraint's penalty quadratic approximation to the given approximation. The default implementation adds the result of
+   * getQuadraticApproximation(). Override it to accumulate without creating a temporary approximation.
+   */
+  virtual void addQuadraticApproximation(scalar_t time, const vector_t& state, const vector_t& input, const Multiplier& lagrangian,
+                                         const PreComputation& preComp, ScalarFunctionQuadraticApproximation& penalty) const {
+    penalty += getQuadraticApproximation(time, state, input, lagrangian, preComp);
+  }
+
   /** Update Lagrange/penalty multipliers and the penalty function value. */
   virtual std::pair<Multiplier, scalar_t> updateLagrangian(scalar_t time, const vector_t& state, const vector_t& input,
                                                            const vector_t& constraint, const Multiplier& lagrangian) const = 0;
@@ -33,7 +33,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <Eigen/Core>
 
 // STL
+#include <map>
 #include <string>
+#include <utility>
+#include <vector>
 
 // CppAD
 #include <cppad/cg.hpp>
@@ -45,6 +48,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 namespace ocs2 {
 
+class CppAdModelBatch;
+
 class CppAdInterface {
  public:
   enum class ApproximationOrder { Zero, First, Second };
@@ -55,6 +60,7 @@ class CppAdInterface {
   using ad_function_t = std::function<void(const ad_vector_t&, ad_vector_t&)>;
   using ad_parameterized_function_t = std::function<void(const ad_vector_t&, const ad_vector_t&, ad_vector_t&)>;
   using ad_fun_t = CppAD::ADFun<ad_base_t>;
+  using model_list_t = std::vector<std::pair<CppAdInterface*, ApproximationOrder>>;
 
   /**
    * Constructor for parameterized functions
@@ -82,10 +88,11 @@ class CppAdInterface {
   CppAdInterface(ad_function_t adFunction, size_t variableDim, std::string modelName, std::string folderName = "/tmp/ocs2",
                  std::vector<std::string> compileFlags = {"-O3", "-g", "-march=native", "-mtune=native", "-ffast-math"});
 
-  ~CppAdInterface() = default;
+  /** Destructor. Removes the model from the CppAdModelBatch that it is pending in. */
+  ~CppAdInterface();
 
   /**
-   * Copy constructor. Models are reloaded if available.
+   * Copy constructor. Models are reloaded if available. Throws if the model is still pending in a CppAdModelBatch.
    */
   CppAdInterface(const CppAdInterface& rhs);
 
@@ -100,7 +107,8 @@ class CppAdInterface {
   void loadModels(bool verbose = true);
 
   /**
-   * Creates models, compiles them, and saves them to disk
+   * Creates models, compiles them, and saves them to disk. The object files of the library are compiled concurrently.
+   * While a CppAdModelBatch is active on the current thread, the model is only collected and created by CppAdModelBatch::prepare().
    *
    * @param approximationOrder : Order of derivatives to generate
    * @param verbose : Print out extra information
@@ -108,13 +116,37 @@ class CppAdInterface {
   void createModels(ApproximationOrder approximationOrder = ApproximationOrder::Second, bool verbose = true);
 
   /**
-   * Load models if they are available on disk. Creates a new library otherwise.
+   * Load models if they are available on disk and up to date. Creates a new library otherwise.
+   *
+   * A library is up to date if the hash stored next to it matches the hash of the taped function, the approximation order,
+   * the dimensions, and the compile flags. A library without a stored hash is considered stale.
+   * While a CppAdModelBatch is active on the current thread, the model is only collected and loaded by CppAdModelBatch::prepare().
    *
    * @param approximationOrder : Order of derivatives to generate
    * @param verbose : Print out extra information
    */
   void loadModelsIfAvailable(ApproximationOrder approximationOrder = ApproximationOrder::Second, bool verbose = true);
 
+  /**
+   * Creates the libraries of several independent models. The functions are taped sequentially, since CppAD recording is not
+   * thread-safe, while the libraries are compiled concurrently.
+   *
+   * @param models : The interfaces together with the order of derivatives to generate for each of them.
+   * @param numThreads : Number of libraries that are compiled at the same time.
+   * @param verbose : Print out extra information
+   */
+  static void createModels(const model_list_t& models, size_t numThreads, bool verbose = true);
+
+  /**
+   * Loads the libraries of several independent models if they are available on disk and up to date. The stale or missing
+   * libraries are created concurrently, see createModels(const model_list_t&, size_t, bool).
+   *
+   * @param models : The interfaces together with the order of derivatives to generate for each of them.
+   * @param numThreads : Number of libraries that are compiled at the same time.
+   * @param verbose : Print out extra information
+   */
+  static void loadModelsIfAvailable(const model_list_t& models, size_t numThreads, bool verbose = true);
+
   /**
    * @param x : input vector of size variableDim
    * @param p : parameter vector of size parameterDim
@@ -182,6 +214,60 @@ class CppAdInterface {
    */
   bool isLibraryAvailable() const;
 
+  /**
+   * Checks if library can be found on disk and was generated from a function with the given hash.
+   * @param modelHash : hash of the current function, see getModelHash.
+   * @return isLibraryUpToDate
+   */
+  bool isLibraryUpToDate(const std::string& modelHash) const;
+
+  /**
+   * Records the tape of the function and sets the range dimension.
+   * @param fun : taped ad function
+   */
+  void tapeFunction(ad_fun_t& fun);
+
+  /**
+   * Computes a hash that identifies the generated library. It covers the operation graph of the zero order forward sweep, which
+   * uniquely defines the taped function, as well as the approximation order, the dimensions, and the compile flags. No source code is
+   * generated, such that an up to date library is loaded at the cost of taping the function only.
+   *
+   * @param fun : taped ad function
+   * @param approximationOrder : Order of derivatives to generate
+   * @return hexadecimal hash string
+   */
+  std::string getModelHash(ad_fun_t& fun, ApproximationOrder approximationOrder) const;
+
+  /**
+   * Generates the C source code of the library.
+   * @param fun : taped ad function
+   * @param approximationOrder : Order of derivatives to generate
+   * @return map from the file names to the content of the source files
+   */
+  std::map<std::string, std::string> generateSources(ad_fun_t& fun, ApproximationOrder approximationOrder) const;
+
+  /**
+   * Compiles the sources to a shared library, loads it, and stores the library together with its hash on disk.
+   * Does not call into CppAD and can therefore run concurrently for different models.
+   *
+   * @param sources : Source files of the library, see generateSources.
+   * @param modelHash : hash of the function, see getModelHash.
+   * @param numJobs : Number of compiler processes that are run at the same time.
+   * @param verbose : Print out extra information
+   */
+  void compileLibrary(const std::map<std::string, std::string>& sources, const std::string& modelHash, size_t numJobs, bool verbose);
+
+  /**
+   * Loads or creates the libraries of several models, see loadModelsIfAvailable(const model_list_t&, size_t, bool). While a
+   * CppAdModelBatch is active on the current thread, the models are added to the batch instead.
+   *
+   * @param models : The interfaces together with the order of derivatives to generate for each of them.
+   * @param forceCreate : Whether the library of each model is created even if it is up to date.
+   * @param numThreads : Number of libraries that are compiled at the same time.
+   * @param verbose : Print out extra information
+   */
+  static void prepareModels(const model_list_t& models, const std::vector<bool>& forceCreate, size_t numThreads, bool verbose);
+
   /**
    * Creates a random temporary folder name
    * @return folder name
@@ -240,6 +326,12 @@ class CppAdInterface {
   std::string tmpName_;
   std::string tmpFolder_;
   std::string libraryName_;
+  std::string hashFileName_;
+
+  // The batch in which the model waits to be prepared
+  CppAdModelBatch* modelBatchPtr_ = nullptr;
+
+  friend class CppAdModelBatch;
 };
 
 }  // namespace ocs2
@@ -0,0 +1,105 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+
+#pragma once
+
+#include <thread>
+#include <vector>
+
+#include <ocs2_core/automatic_differentiation/CppAdInterface.h>
+
+namespace ocs2 {
+
+/**
+ * Collects the models of the CppAdInterfaces that are created or loaded on the current thread while the batch is active, e.g., during
+ * the construction of the dynamics, cost, and constraint terms of an optimal control problem. Instead of generating their libraries one
+ * after the other, prepare() loads or compiles all of them at once, such that the independent libraries are compiled concurrently.
+ *
+ * The collected models can neither be evaluated nor copied before prepare() is called. Hence, prepare() has to be called before the
+ * terms are cloned, e.g., by a rollout or a solver. Usage:
+ *
+ *   CppAdModelBatch modelBatch;
+ *   problem.dynamicsPtr.reset(new MySystemDynamicsAD(...));
+ *   problem.costPtr->add("cost", std::make_unique<MyStateInputCostCppAd>(...));
+ *   modelBatch.prepare();
+ *   rolloutPtr.reset(new TimeTriggeredRollout(*problem.dynamicsPtr, rolloutSettings));
+ */
+class CppAdModelBatch {
+ public:
+  /**
+   * Constructor. Activates the batch on the current thread.
+   *
+   * @param [in] numThreads: Number of libraries that are compiled at the same time.
+   */
+  explicit CppAdModelBatch(size_t numThreads = std::thread::hardware_concurrency());
+
+  /** Destructor. Deactivates the batch. Models that are still pending are left without a library. */
+  ~CppAdModelBatch();
+
+  CppAdModelBatch(const CppAdModelBatch&) = delete;
+  CppAdModelBatch& operator=(const CppAdModelBatch&) = delete;
+
+  /** Deactivates the batch and loads or compiles the libraries of all collected models. */
+  void prepare();
+
+  /** Returns the number of collected models that wait for prepare(). */
+  size_t getNumPendingModels() const { return pendingModels_.size(); }
+
+ private:
+  friend class CppAdInterface;
+
+  struct PendingModel {
+    CppAdInterface* adInterfacePtr;
+    CppAdInterface::ApproximationOrder approximationOrder;
+    bool forceCreate;
+  };
+
+  /** Returns the batch that is active on the current thread, nullptr if there is none. */
+  static CppAdModelBatch* getActiveBatch() { return activeBatchPtr_; }
+
+  /** Adds a model to the batch, or updates its request if it is already pending. */
+  void add(CppAdInterface& adInterface, CppAdInterface::ApproximationOrder approximationOrder, bool forceCreate, bool verbose);
+
+  /** Removes a model that is destroyed before the batch is prepared. */
+  void remove(const CppAdInterface& adInterface);
+
+  /** Deactivates the batch if it is active on the current thread. */
+  void deactivate();
+
+  static thread_local CppAdModelBatch* activeBatchPtr_;
+
+  const size_t numThreads_;
+  CppAdModelBatch* previousBatchPtr_;
+  bool isActive_ = true;
+  bool verbose_ = false;
+  std::vector<PendingModel> pendingModels_;
+};
+
+}  // namespace ocs2
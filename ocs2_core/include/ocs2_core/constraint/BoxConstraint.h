@@ -0,0 +1,140 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+
+#pragma once
+
+#include <vector>
+
+#include <ocs2_core/Types.h>
+
+namespace ocs2 {
+
+/**
+ * Box constraints on a vector v, stacked over all active terms of a box constraint collection:
+ *    lowerBound <= v[indices] <= upperBound
+ *
+ * The rows listed in softIndices are soft constraints. Their violation s >= 0 of the lower and the upper bound is penalized with
+ * 0.5 * slackQuadraticPenalty * s^2 + slackLinearPenalty * s.
+ */
+struct BoxConstraintBounds {
+  std::vector<int> indices;
+  vector_t lowerBound;
+  vector_t upperBound;
+  std::vector<int> softIndices;
+  vector_t slackQuadraticPenalty;
+  vector_t slackLinearPenalty;
+
+  /** Number of box constraints */
+  int size() const { return static_cast<int>(indices.size()); }
+
+  /** Number of soft box constraints */
+  int numSoft() const { return static_cast<int>(softIndices.size()); }
+
+  /** Clears all bounds, keeps the allocated memory */
+  void clear();
+};
+
+/**
+ * Box constraint on a subset of the state or input vector: lowerBound <= v[indices] <= upperBound.
+ *
+ * Box constraints are passed to the QP solver in their native form instead of as dense general inequality constraints. A soft box
+ * constraint introduces a slack variable for each bound, which is penalized in the cost.
+ */
+class BoxConstraint {
+ public:
+  /**
+   * Constructor for a hard box constraint.
+   * @param indices : Indices of the constrained entries in the state or input vector. Indices must be unique within
+   *                  and across the terms of a collection.
+   * @param lowerBound : Lower bounds, same size as indices.
+   * @param upperBound : Upper bounds, same size as indices.
+   */
+  BoxConstraint(std::vector<int> indices, vector_t lowerBound, vector_t upperBound);
+
+  /**
+   * Constructor for a soft box constraint.
+   * @param indices : Indices of the constrained entries in the state or input vector. Indices must be unique within
+   *                  and across the terms of a collection.
+   * @param lowerBound : Lower bounds, same size as indices.
+   * @param upperBound : Upper bounds, same size as indices.
+   * @param slackQuadraticPenalty : Quadratic penalty on the bound violation, must be positive.
+   * @param slackLinearPenalty : Linear penalty on the bound violation, must be non-negative.
+   */
+  BoxConstraint(std::vector<int> indices, vector_t lowerBound, vector_t upperBound, scalar_t slackQuadraticPenalty,
+                scalar_t slackLinearPenalty);
+
+  virtual ~BoxConstraint() = default;
+  virtual BoxConstraint* clone() const { return new BoxConstraint(*this); }
+
+  /** Check constraint activity */
+  virtual bool isActive(scalar_t time) const { return true; }
+
+  /** Get the lower bounds at given time */
+  virtual const vector_t& getLowerBound(scalar_t time) const { return lowerBound_; }
+
+  /** Get the upper bounds at given time */
+  virtual const vector_t& getUpperBound(scalar_t time) const { return upperBound_; }
+
+  /** Get the number of constrained entries */
+  size_t getNumConstraints() const { return indices_.size(); }
+
+  /** Get the indices of the constrained entries */
+  const std::vector<int>& getIndices() const { return indices_; }
+
+  /** Whether the box is a soft constraint */
+  bool isSoft() const { return isSoft_; }
+
+  scalar_t getSlackQuadraticPenalty() const { return slackQuadraticPenalty_; }
+  scalar_t getSlackLinearPenalty() const { return slackLinearPenalty_; }
+
+ protected:
+  BoxConstraint(const BoxConstraint& other) = default;
+
+ private:
+  std::vector<int> indices_;
+  vector_t lowerBound_;
+  vector_t upperBound_;
+  bool isSoft_ = false;
+  scalar_t slackQuadraticPenalty_ = 0.0;
+  scalar_t slackLinearPenalty_ = 0.0;
+};
+
+/**
+ * Evaluates the hard box constraints at v, for the convention h(v) >= 0.
+ * @return The stacked values [v[indices] - lowerBound; upperBound - v[indices]] of all hard rows.
+ */
+vector_t getHardBoxConstraintValue(const BoxConstraintBounds& bounds, const vector_t& v);
+
+/**
+ * Evaluates the penalty of the soft box constraints at v, i.e. the cost of the optimal slack variables.
+ */
+scalar_t getSoftBoxConstraintPenalty(const BoxConstraintBounds& bounds, const vector_t& v);
+
+}  // namespace ocs2
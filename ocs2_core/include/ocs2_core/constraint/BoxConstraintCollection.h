@@ -0,0 +1,76 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+
+#pragma once
+
+#include <ocs2_core/Types.h>
+#include <ocs2_core/constraint/BoxConstraint.h>
+#include <ocs2_core/misc/Collection.h>
+
+namespace ocs2 {
+
+/**
+ * Box constraint collection class
+ *
+ * This class collects a variable number of box constraints on the state or the input and provides methods to get the stacked bounds.
+ * Each box constraint can be accessed through its string name and can be activated or deactivated.
+ */
+class BoxConstraintCollection : public Collection<BoxConstraint> {
+ public:
+  BoxConstraintCollection() = default;
+  ~BoxConstraintCollection() override = default;
+  BoxConstraintCollection* clone() const override;
+
+  /**
+   * Adds a box constraint term to the collection, see Collection::add. Throws if the term constrains an entry which is already
+   * constrained by another term of the collection, since the QP solver accepts a single pair of bounds per entry.
+   * @param name: Name stored along with the term.
+   * @param term: Term to be added.
+   */
+  void add(std::string name, std::unique_ptr<BoxConstraint> term);
+
+  /** Returns the number of active box constraints at a given time. */
+  size_t getNumConstraints(scalar_t time) const;
+
+  /** Returns the number of active soft box constraints at a given time. */
+  size_t getNumSoftConstraints(scalar_t time) const;
+
+  /** Get the stacked bounds of all active terms */
+  BoxConstraintBounds getBounds(scalar_t time) const;
+
+  /** Get the stacked bounds of all active terms, reusing the memory of the given bounds. */
+  void getBounds(scalar_t time, BoxConstraintBounds& bounds) const;
+
+ protected:
+  /** Copy constructor */
+  BoxConstraintCollection(const BoxConstraintCollection& other);
+};
+
+}  // namespace ocs2
@@ -62,6 +62,10 @@ class StateInputConstraintCollection : public Collection<StateInputConstraint> {
   virtual VectorFunctionLinearApproximation getLinearApproximation(scalar_t time, const vector_t& state, const vector_t& input,
                                                                    const PreComputation& preComp) const;
 
+  /** Get the constraint linear approximation in place, the memory of the given approximation is reused. */
+  virtual void getLinearApproximation(scalar_t time, const vector_t& state, const vector_t& input, const PreComputation& preComp,
+                                      VectorFunctionLinearApproximation& linearApproximation) const;
+
   /** Get the constraint quadratic approximation */
   virtual VectorFunctionQuadraticApproximation getQuadraticApproximation(scalar_t time, const vector_t& state, const vector_t& input,
                                                                          const PreComputation& preComp) const;
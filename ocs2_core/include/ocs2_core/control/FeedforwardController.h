@@ -106,6 +106,8 @@ class FeedforwardController final : public ControllerBase {
  private:
   void flattenSingle(scalar_t time, std::vector<float>& flatArray) const;
 
+  LinearInterpolation::TimeSegmentHint timeSegmentHint_;
+
  public:
   scalar_array_t timeStamp_;
   vector_array_t uffArray_;
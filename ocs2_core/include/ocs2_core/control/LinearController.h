@@ -29,6 +29,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #pragma once
 
+#include <ocs2_core/FixedSizeTypes.h>
 #include <ocs2_core/Types.h>
 #include <ocs2_core/control/ControllerBase.h>
 #include <ocs2_core/misc/LinearInterpolation.h>
@@ -79,6 +80,15 @@ class LinearController final : public ControllerBase {
 
   vector_t computeInput(scalar_t t, const vector_t& x) override;
 
+  /**
+   * Evaluates computeInput() with a fixed-size kernel for NX states and NU inputs, which avoids the heap-allocated interpolation of the
+   * feedback gain. Time segments with other dimensions are still evaluated with the dynamic-size kernel.
+   */
+  template <int NX, int NU>
+  void useFixedSizeKernel() {
+    inputKernel_ = &fixedSizeInputKernel<NX, NU>;
+  }
+
   void concatenate(const ControllerBase* nextController, int index, int length) override;
 
   int size() const override;
@@ -103,8 +113,20 @@ class LinearController final : public ControllerBase {
                                     const std::vector<std::vector<float> const*>& flatArray2);
 
  private:
+  using input_kernel_t = vector_t (*)(LinearInterpolation::index_alpha_t, const LinearController&, const vector_t&);
+
   void flattenSingle(scalar_t time, std::vector<float>& flatArray) const;
 
+  static vector_t dynamicSizeInputKernel(LinearInterpolation::index_alpha_t indexAlpha, const LinearController& controller,
+                                         const vector_t& x);
+
+  template <int NX, int NU>
+  static vector_t fixedSizeInputKernel(LinearInterpolation::index_alpha_t indexAlpha, const LinearController& controller,
+                                       const vector_t& x);
+
+  input_kernel_t inputKernel_ = &dynamicSizeInputKernel;
+  LinearInterpolation::TimeSegmentHint timeSegmentHint_;
+
  public:
   scalar_array_t timeStamp_;
   vector_array_t biasArray_;
@@ -118,4 +140,30 @@ void swap(LinearController& a, LinearController& b) noexcept;
 
 std::ostream& operator<<(std::ostream& out, const LinearController& controller);
 
+template <int NX, int NU>
+vector_t LinearController::fixedSizeInputKernel(LinearInterpolation::index_alpha_t indexAlpha, const LinearController& controller,
+                                                 const vector_t& x) {
+  const auto& biasArray = controller.biasArray_;
+  const auto& gainArray = controller.gainArray_;
+  const int index = indexAlpha.first;
+  const scalar_t alpha = indexAlpha.second;
+
+  // The interpolation corner cases (a single time stamp or a dimension change between the time stamps) go through the dynamic kernel
+  const auto hasSize = [](const vector_t& bias, const matrix_t& gain) {
+    return bias.size() == NU && gain.rows() == NU && gain.cols() == NX;
+  };
+  if (gainArray.size() < 2 || x.size() != NX || !hasSize(biasArray[index], gainArray[index]) ||
+      !hasSize(biasArray[index + 1], gainArray[index + 1])) {
+    return dynamicSizeInputKernel(indexAlpha, controller, x);
+  }
+
+  // u = alpha * (b[i] + K[i] x) + (1 - alpha) * (b[i+1] + K[i+1] x)
+  const Eigen::Map<const fixed_vector_t<NX>> xMap(x.data());
+  fixed_vector_t<NU> lhs = Eigen::Map<const fixed_vector_t<NU>>(biasArray[index].data());
+  lhs.noalias() += Eigen::Map<const fixed_matrix_t<NU, NX>>(gainArray[index].data()) * xMap;
+  fixed_vector_t<NU> rhs = Eigen::Map<const fixed_vector_t<NU>>(biasArray[index + 1].data());
+  rhs.noalias() += Eigen::Map<const fixed_matrix_t<NU, NX>>(gainArray[index + 1].data()) * xMap;
+  return alpha * lhs + (scalar_t(1.0) - alpha) * rhs;
+}
+
 }  // namespace ocs2
@@ -53,6 +53,10 @@ class QuadraticStateCost : public StateCost {
                                                                  const TargetTrajectories& targetTrajectories,
                                                                  const PreComputation&) const final;
 
+  /** Add cost term quadratic approximation */
+  void addQuadraticApproximation(scalar_t time, const vector_t& state, const TargetTrajectories& targetTrajectories, const PreComputation&,
+                                 ScalarFunctionQuadraticApproximation& cost) const final;
+
  protected:
   QuadraticStateCost(const QuadraticStateCost& rhs) = default;
 
@@ -58,6 +58,10 @@ class QuadraticStateInputCost : public StateInputCost {
                                                                  const TargetTrajectories& targetTrajectories,
                                                                  const PreComputation&) const final;
 
+  /** Add cost term quadratic approximation */
+  void addQuadraticApproximation(scalar_t time, const vector_t& state, const vector_t& input, const TargetTrajectories& targetTrajectories,
+                                 const PreComputation&, ScalarFunctionQuadraticApproximation& cost) const final;
+
  protected:
   QuadraticStateInputCost(const QuadraticStateInputCost& rhs) = default;
 
@@ -56,6 +56,19 @@ class StateCost {
                                                                          const TargetTrajectories& targetTrajectories,
                                                                          const PreComputation& preComp) const = 0;
 
+  /**
+   * Adds the cost term quadratic approximation to the state derivatives of the given approximation, which may also have input
+   * derivatives. The default implementation adds the result of getQuadraticApproximation(). Override it to accumulate without
+   * creating a temporary approximation.
+   */
+  virtual void addQuadraticApproximation(scalar_t time, const vector_t& state, const TargetTrajectories& targetTrajectories,
+                                         const PreComputation& preComp, ScalarFunctionQuadraticApproximation& cost) const {
+    const auto costTermApproximation = getQuadraticApproximation(time, state, targetTrajectories, preComp);
+    cost.f += costTermApproximation.f;
+    cost.dfdx += costTermApproximation.dfdx;
+    cost.dfdxx += costTermApproximation.dfdxx;
+  }
+
  protected:
   StateCost(const StateCost& rhs) = default;
 };
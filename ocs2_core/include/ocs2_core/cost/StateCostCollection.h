@@ -59,6 +59,13 @@ class StateCostCollection : public Collection<StateCost> {
                                                                          const TargetTrajectories& targetTrajectories,
                                                                          const PreComputation& preComp) const;
 
+  /**
+   * Add the state-only cost quadratic approximation of the active terms to the state derivatives of the given approximation, which
+   * may also have input derivatives.
+   */
+  virtual void addQuadraticApproximation(scalar_t time, const vector_t& state, const TargetTrajectories& targetTrajectories,
+                                         const PreComputation& preComp, ScalarFunctionQuadraticApproximation& cost) const;
+
  protected:
   /** Copy constructor */
   StateCostCollection(const StateCostCollection& other);
@@ -56,6 +56,16 @@ class StateInputCost {
                                                                          const TargetTrajectories& targetTrajectories,
                                                                          const PreComputation& preComp) const = 0;
 
+  /**
+   * Adds the cost term quadratic approximation to the given approximation. The default implementation adds the result of
+   * getQuadraticApproximation(). Override it to accumulate without creating a temporary approximation.
+   */
+  virtual void addQuadraticApproximation(scalar_t time, const vector_t& state, const vector_t& input,
+                                         const TargetTrajectories& targetTrajectories, const PreComputation& preComp,
+                                         ScalarFunctionQuadraticApproximation& cost) const {
+    cost += getQuadraticApproximation(time, state, input, targetTrajectories, preComp);
+  }
+
  protected:
   StateInputCost(const StateInputCost& rhs) = default;
 };
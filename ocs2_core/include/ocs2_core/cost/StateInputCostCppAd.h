@@ -68,6 +68,8 @@ class StateInputCostCppAd : public StateInputCost {
   ScalarFunctionQuadraticApproximation getQuadraticApproximation(scalar_t time, const vector_t& state, const vector_t& input,
                                                                  const TargetTrajectories& targetTrajectories,
                                                                  const PreComputation& preComputation) const override;
+  void addQuadraticApproximation(scalar_t time, const vector_t& state, const vector_t& input, const TargetTrajectories& targetTrajectories,
+                                 const PreComputation& preComputation, ScalarFunctionQuadraticApproximation& cost) const override;
 
  protected:
   StateInputCostCppAd(const StateInputCostCppAd& rhs);
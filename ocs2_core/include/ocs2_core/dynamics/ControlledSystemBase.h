@@ -92,6 +92,19 @@ class ControlledSystemBase : public OdeBase {
    */
   virtual vector_t computeFlowMap(scalar_t t, const vector_t& x, const vector_t& u, const PreComputation& preComp) = 0;
 
+  /**
+   * Computes the flow map of a system with exogenous input in place. The default implementation assigns the result of
+   * computeFlowMap(), derived classes can override it to reuse the memory of the given vector.
+   *
+   * @param [in] t: The current time.
+   * @param [in] x: The current state.
+   * @param [in] u: The current input.
+   * @param [in] preComp: pre-computation module, safely ignore this parameter if not used.
+   *                      @see PreComputation class documentation.
+   * @param [out] dxdt: The state time derivative.
+   */
+  virtual void computeFlowMap(scalar_t t, const vector_t& x, const vector_t& u, const PreComputation& preComp, vector_t& dxdt);
+
   /**
    * State map at the transition time
    *
@@ -112,6 +125,14 @@ class ControlledSystemBase : public OdeBase {
    */
   vector_t computeFlowMap(scalar_t t, const vector_t& x, const vector_t& u);
 
+  /**
+   * Computes the flow map of a system with exogenous input in place.
+   *
+   * @note This method calls the internal preComputation request() callback and the virtual
+   *       in-place computeFlowMap() with the preComputation as parameter.
+   */
+  void computeFlowMap(scalar_t t, const vector_t& x, const vector_t& u, vector_t& dxdt);
+
   /**
    * State map at the transition time
    *
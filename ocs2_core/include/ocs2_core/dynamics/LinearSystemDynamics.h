@@ -52,10 +52,15 @@ class LinearSystemDynamics : public SystemDynamicsBase {
 
   vector_t computeFlowMap(scalar_t t, const vector_t& x, const vector_t& u, const PreComputation&) override;
 
+  void computeFlowMap(scalar_t t, const vector_t& x, const vector_t& u, const PreComputation&, vector_t& dxdt) override;
+
   vector_t computeJumpMap(scalar_t t, const vector_t& x, const PreComputation&) override;
 
   VectorFunctionLinearApproximation linearApproximation(scalar_t t, const vector_t& x, const vector_t& u, const PreComputation&) override;
 
+  void linearApproximation(scalar_t t, const vector_t& x, const vector_t& u, const PreComputation&,
+                           VectorFunctionLinearApproximation& approximation) override;
+
   VectorFunctionLinearApproximation jumpMapLinearApproximation(scalar_t t, const vector_t& x, const PreComputation&) override;
 
  protected:
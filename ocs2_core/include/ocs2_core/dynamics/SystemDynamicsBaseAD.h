@@ -72,6 +72,9 @@ class SystemDynamicsBaseAD : public SystemDynamicsBase {
   VectorFunctionLinearApproximation linearApproximation(scalar_t t, const vector_t& x, const vector_t& u,
                                                         const PreComputation& preComputation) final;
 
+  void linearApproximation(scalar_t t, const vector_t& x, const vector_t& u, const PreComputation& preComputation,
+                           VectorFunctionLinearApproximation& approximation) final;
+
   VectorFunctionLinearApproximation jumpMapLinearApproximation(scalar_t t, const vector_t& x, const PreComputation& preComputation) final;
 
   VectorFunctionLinearApproximation guardSurfacesLinearApproximation(scalar_t t, const vector_t& x, const vector_t& u) final;
@@ -30,6 +30,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
 #include <ocs2_core/Types.h>
+#include <ocs2_core/misc/ContiguousTrajectory.h>
 
 namespace ocs2 {
 
@@ -46,6 +47,14 @@ class Observer {
    */
   explicit Observer(vector_array_t* stateTrajectoryPtr = nullptr, scalar_array_t* timeTrajectoryPtr = nullptr);
 
+  /**
+   * Constructor which stores the states in contiguous storage.
+   *
+   * @param stateTrajectoryPtr: A pinter to a contiguous state trajectory container to store resulting state trajectory.
+   * @param timeTrajectoryPtr: A pinter to an time trajectory container to store resulting time trajectory.
+   */
+  Observer(ContiguousVectorArray* stateTrajectoryPtr, scalar_array_t* timeTrajectoryPtr);
+
   /**
    * Default destructor.
    */
@@ -61,6 +70,7 @@ class Observer {
  private:
   scalar_array_t* timeTrajectoryPtr_;
   vector_array_t* stateTrajectoryPtr_;
+  ContiguousVectorArray* contiguousStateTrajectoryPtr_ = nullptr;
 };
 
 }  // namespace ocs2
@@ -59,9 +59,9 @@ SensitivityIntegratorType fromString(const std::string& name);
  * @param x : starting state x_{k}
  * @param u : input u_{k}, assumed constant over the entire interval
  * @param dt : interval duration
- * Returns x_{k+1}
+ * @param [out] xNext : x_{k+1}, its memory is reused if the size does not change.
  */
-using DynamicsDiscretizer = std::function<vector_t(SystemDynamicsBase&, scalar_t, const vector_t&, const vector_t&, scalar_t)>;
+using DynamicsDiscretizer = std::function<void(SystemDynamicsBase&, scalar_t, const vector_t&, const vector_t&, scalar_t, vector_t&)>;
 
 /**
  * Select available integrator based on enum
@@ -76,11 +76,12 @@ DynamicsDiscretizer selectDynamicsDiscretization(SensitivityIntegratorType integ
  * @param x : starting state x_{k}
  * @param u : input u_{k}, assumed constant over the entire interval
  * @param dt : interval duration
- * Returns an approximation of the form:
+ * @param [out] approximation : an approximation of the form
  *      x_{k+1} = A_{k} * dx_{k} + B_{k} * du_{k} + b_{k}
+ * The memory of its members is reused if their sizes do not change.
  */
-using DynamicsSensitivityDiscretizer =
-    std::function<VectorFunctionLinearApproximation(SystemDynamicsBase&, scalar_t, const vector_t&, const vector_t&, scalar_t)>;
+using DynamicsSensitivityDiscretizer = std::function<void(SystemDynamicsBase&, scalar_t, const vector_t&, const vector_t&, scalar_t,
+                                                          VectorFunctionLinearApproximation&)>;
 
 /**
  * Select available integrator based on enum
@@ -40,6 +40,12 @@ namespace ocs2 {
  */
 vector_t eulerDiscretization(SystemDynamicsBase& system, scalar_t t, const vector_t& x, const vector_t& u, scalar_t dt);
 
+/**
+ * Computes the discretized dynamics in place. Uses an Forward euler discretization.
+ * Writes x_{k+1} to xNext.
+ */
+void eulerDiscretization(SystemDynamicsBase& system, scalar_t t, const vector_t& x, const vector_t& u, scalar_t dt, vector_t& xNext);
+
 /**
  * Creates a linear approximation of the discretized dynamics. Uses an Forward euler discretization.
  * Returns an approximation of the form:
@@ -48,12 +54,26 @@ vector_t eulerDiscretization(SystemDynamicsBase& system, scalar_t t, const vecto
 VectorFunctionLinearApproximation eulerSensitivityDiscretization(SystemDynamicsBase& system, scalar_t t, const vector_t& x,
                                                                  const vector_t& u, scalar_t dt);
 
+/**
+ * Creates a linear approximation of the discretized dynamics in place. Uses an Forward euler discretization.
+ * Writes an approximation of the form:
+ *      x_{k+1} = A_{k} * dx_{k} + B_{k} * du_{k} + b_{k}
+ */
+void eulerSensitivityDiscretization(SystemDynamicsBase& system, scalar_t t, const vector_t& x, const vector_t& u, scalar_t dt,
+                                    VectorFunctionLinearApproximation& approximation);
+
 /**
  * Computes the discretized dynamics. Uses an Runge-Kutta 2nd order discretization.
  * Returns x_{k+1}
  */
 vector_t rk2Discretization(SystemDynamicsBase& system, scalar_t t, const vector_t& x, const vector_t& u, scalar_t dt);
 
+/**
+ * Computes the discretized dynamics in place. Uses an Runge-Kutta 2nd order discretization.
+ * Writes x_{k+1} to xNext.
+ */
+void rk2Discretization(SystemDynamicsBase& system, scalar_t t, const vector_t& x, const vector_t& u, scalar_t dt, vector_t& xNext);
+
 /**
  * Creates a linear approximation of the discretized dynamics. Uses an Runge-Kutta 2nd order discretization.
  * Returns an approximation of the form:
@@ -62,12 +82,26 @@ vector_t rk2Discretization(SystemDynamicsBase& system, scalar_t t, const vector_
 VectorFunctionLinearApproximation rk2SensitivityDiscretization(SystemDynamicsBase& system, scalar_t t, const vector_t& x, const vector_t& u,
                                                                scalar_t dt);
 
+/**
+ * Creates a linear approximation of the discretized dynamics in place. Uses an Runge-Kutta 2nd order discretization.
+ * Writes an approximation of the form:
+ *      x_{k+1} = A_{k} * dx_{k} + B_{k} * du_{k} + b_{k}
+ */
+void rk2SensitivityDiscretization(SystemDynamicsBase& system, scalar_t t, const vector_t& x, const vector_t& u, scalar_t dt,
+                                  VectorFunctionLinearApproximation& approximation);
+
 /**
  * Computes the discretized dynamics. Uses an Runge-Kutta 4th order discretization.
  * Returns x_{k+1}
  */
 vector_t rk4Discretization(SystemDynamicsBase& system, scalar_t t, const vector_t& x, const vector_t& u, scalar_t dt);
 
+/**
+ * Computes the discretized dynamics in place. Uses an Runge-Kutta 4th order discretization.
+ * Writes x_{k+1} to xNext.
+ */
+void rk4Discretization(SystemDynamicsBase& system, scalar_t t, const vector_t& x, const vector_t& u, scalar_t dt, vector_t& xNext);
+
 /**
  * Creates a linear approximation of the discretized dynamics. Uses an Runge-Kutta 4th order discretization.
  * Returns an approximation of the form:
@@ -76,4 +110,12 @@ vector_t rk4Discretization(SystemDynamicsBase& system, scalar_t t, const vector_
 VectorFunctionLinearApproximation rk4SensitivityDiscretization(SystemDynamicsBase& system, scalar_t t, const vector_t& x, const vector_t& u,
                                                                scalar_t dt);
 
+/**
+ * Creates a linear approximation of the discretized dynamics in place. Uses an Runge-Kutta 4th order discretization.
+ * Writes an approximation of the form:
+ *      x_{k+1} = A_{k} * dx_{k} + B_{k} * du_{k} + b_{k}
+ */
+void rk4SensitivityDiscretization(SystemDynamicsBase& system, scalar_t t, const vector_t& x, const vector_t& u, scalar_t dt,
+                                  VectorFunctionLinearApproximation& approximation);
+
 }  // namespace ocs2
\ No newline at end of file
@@ -55,6 +55,15 @@ class LoopshapingStateAugmentedLagrangian final : public StateAugmentedLagrangia
                                                                  const std::vector<Multiplier>& termsMultiplier,
                                                                  const PreComputation& preComp) const override;
 
+  /** Adds the loopshaping approximation of getQuadraticApproximation() */
+  void addQuadraticApproximation(scalar_t t, const vector_t& x, const std::vector<Multiplier>& termsMultiplier,
+                                 const PreComputation& preComp, ScalarFunctionQuadraticApproximation& penalty) const override {
+    const auto Phi = getQuadraticApproximation(t, x, termsMultiplier, preComp);
+    penalty.f += Phi.f;
+    penalty.dfdx += Phi.dfdx;
+    penalty.dfdxx += Phi.dfdxx;
+  }
+
   void updateLagrangian(scalar_t t, const vector_t& x, std::vector<LagrangianMetrics>& termsMetrics,
                         std::vector<Multiplier>& termsMultiplier) const override;
 
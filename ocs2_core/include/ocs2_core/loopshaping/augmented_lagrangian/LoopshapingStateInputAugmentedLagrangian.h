@@ -49,6 +49,12 @@ class LoopshapingStateInputAugmentedLagrangian : public StateInputAugmentedLagra
   void updateLagrangian(scalar_t t, const vector_t& x, const vector_t& u, std::vector<LagrangianMetrics>& termsMetrics,
                         std::vector<Multiplier>& termsMultiplier) const final override;
 
+  /** Adds the loopshaping approximation of getQuadraticApproximation() */
+  void addQuadraticApproximation(scalar_t t, const vector_t& x, const vector_t& u, const std::vector<Multiplier>& termsMultiplier,
+                                 const PreComputation& preComp, ScalarFunctionQuadraticApproximation& penalty) const final override {
+    penalty += getQuadraticApproximation(t, x, u, termsMultiplier, preComp);
+  }
+
  protected:
   /** Constructor */
   LoopshapingStateInputAugmentedLagrangian(const StateInputAugmentedLagrangianCollection& lagrangianCollection,
@@ -51,6 +51,9 @@ class LoopshapingStateConstraint final : public StateConstraintCollection {
   VectorFunctionLinearApproximation getLinearApproximation(scalar_t time, const vector_t& state,
                                                            const PreComputation& preComp) const override;
 
+  void getLinearApproximation(scalar_t time, const vector_t& state, const PreComputation& preComp,
+                              VectorFunctionLinearApproximation& linearApproximation) const override;
+
   VectorFunctionQuadraticApproximation getQuadraticApproximation(scalar_t time, const vector_t& state,
                                                                  const PreComputation& preComp) const override;
 
@@ -43,6 +43,10 @@ class LoopshapingStateInputConstraint : public StateInputConstraintCollection {
 
   vector_array_t getValue(scalar_t time, const vector_t& state, const vector_t& input, const PreComputation& preComp) const override;
 
+  using StateInputConstraintCollection::getLinearApproximation;
+  void getLinearApproximation(scalar_t time, const vector_t& state, const vector_t& input, const PreComputation& preComp,
+                              VectorFunctionLinearApproximation& linearApproximation) const override;
+
  protected:
   LoopshapingStateInputConstraint(const StateInputConstraintCollection& systemConstraint,
                                   std::shared_ptr<LoopshapingDefinition> loopshapingDefinition)
@@ -56,6 +56,15 @@ class LoopshapingStateCost final : public StateCostCollection {
                                                                  const TargetTrajectories& targetTrajectories,
                                                                  const PreComputation& preComp) const override;
 
+  /** Adds the loopshaping approximation of getQuadraticApproximation() */
+  void addQuadraticApproximation(scalar_t t, const vector_t& x, const TargetTrajectories& targetTrajectories, const PreComputation& preComp,
+                                 ScalarFunctionQuadraticApproximation& cost) const override {
+    const auto Phi = getQuadraticApproximation(t, x, targetTrajectories, preComp);
+    cost.f += Phi.f;
+    cost.dfdx += Phi.dfdx;
+    cost.dfdxx += Phi.dfdxx;
+  }
+
  private:
   LoopshapingStateCost(const LoopshapingStateCost& other) = default;
 
@@ -47,6 +47,12 @@ class LoopshapingStateInputCost : public StateInputCostCollection {
   scalar_t getValue(scalar_t t, const vector_t& x, const vector_t& u, const TargetTrajectories& targetTrajectories,
                     const PreComputation& preComp) const final;
 
+  /** Adds the loopshaping approximation of getQuadraticApproximation() */
+  void addQuadraticApproximation(scalar_t t, const vector_t& x, const vector_t& u, const TargetTrajectories& targetTrajectories,
+                                 const PreComputation& preComp, ScalarFunctionQuadraticApproximation& cost) const final {
+    cost += getQuadraticApproximation(t, x, u, targetTrajectories, preComp);
+  }
+
  protected:
   /** Constructor */
   LoopshapingStateInputCost(const StateInputCostCollection& systemCost, std::shared_ptr<LoopshapingDefinition> loopshapingDefinition)
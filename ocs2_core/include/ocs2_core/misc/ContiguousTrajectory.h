@@ -0,0 +1,182 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <utility>
+
+#include "ocs2_core/Types.h"
+
+namespace ocs2 {
+
+/**
+ * Contiguous storage of an array of equally sized vectors. The vectors are stored as the columns of a single column-major
+ * matrix, i.e. with a stride of dimension() over size() nodes, such that the whole array lives in one aligned heap block.
+ * Compared to vector_array_t, copying or resizing the array costs one allocation instead of one per node.
+ */
+class ContiguousVectorArray {
+ public:
+  using reference = matrix_t::ColXpr;
+  using const_reference = matrix_t::ConstColXpr;
+
+  /** Default constructor */
+  ContiguousVectorArray() = default;
+
+  /**
+   * Constructor
+   * @param [in] size: The number of nodes.
+   * @param [in] dimension: The dimension of the vectors.
+   */
+  ContiguousVectorArray(size_t size, size_t dimension) : data_(dimension, size), size_(size) {}
+
+  /**
+   * Constructs from an array of vectors. All the vectors should have the same dimension.
+   * @param [in] vectorArray: The array of vectors.
+   */
+  explicit ContiguousVectorArray(const vector_array_t& vectorArray);
+
+  /**
+   * Copies an array of vectors. The memory is only reallocated if the capacity or the dimension is not sufficient.
+   * @param [in] vectorArray: The array of vectors. All the vectors should have the same dimension.
+   */
+  void assign(const vector_array_t& vectorArray);
+
+  /** Converts to an array of vectors. */
+  vector_array_t toVectorArray() const;
+
+  /** The number of nodes. */
+  size_t size() const { return size_; }
+
+  /** Whether the array is empty. */
+  bool empty() const { return size_ == 0; }
+
+  /** The dimension of the vectors. */
+  size_t dimension() const { return static_cast<size_t>(data_.rows()); }
+
+  /** The number of nodes that can be stored without reallocation. */
+  size_t capacity() const { return static_cast<size_t>(data_.cols()); }
+
+  /** Access to the vector of node i. */
+  reference operator[](size_t i) {
+    assert(i < size_);
+    return data_.col(i);
+  }
+  const_reference operator[](size_t i) const {
+    assert(i < size_);
+    return data_.col(i);
+  }
+
+  /** Access to the first and the last vectors. */
+  reference front() { return (*this)[0]; }
+  const_reference front() const { return (*this)[0]; }
+  reference back() { return (*this)[size_ - 1]; }
+  const_reference back() const { return (*this)[size_ - 1]; }
+
+  /** The underlying (dimension x capacity) storage. Only the first size() columns are valid. */
+  const matrix_t& data() const { return data_; }
+
+  /**
+   * Resizes the array. The memory is only reallocated if the capacity or the dimension is not sufficient. The content of the
+   * existing nodes is not preserved if the dimension changes.
+   */
+  void resize(size_t size, size_t dimension);
+
+  /** Reserves memory for the given number of nodes while preserving the content. */
+  void reserve(size_t capacity);
+
+  /** Appends a vector. The first vector of an empty array sets the dimension. */
+  void push_back(const vector_t& v);
+
+  /** Clears the nodes without releasing the memory. */
+  void clear() { size_ = 0; }
+
+  /** Swaps the content with another array. */
+  void swap(ContiguousVectorArray& other) noexcept {
+    data_.swap(other.data_);
+    std::swap(size_, other.size_);
+  }
+
+ private:
+  matrix_t data_;
+  size_t size_ = 0;
+};
+
+/**
+ * A time-indexed state-input trajectory in contiguous storage. The post-event indices mark the first node of each mode
+ * after a switch, i.e. the nodes of mode m are in the range [postEventIndices[m-1], postEventIndices[m]).
+ */
+struct ContiguousTrajectory {
+  scalar_array_t timeTrajectory;
+  ContiguousVectorArray stateTrajectory;
+  ContiguousVectorArray inputTrajectory;
+  size_array_t postEventIndices;
+
+  /** The number of modes in the trajectory, i.e. the number of events plus one. */
+  size_t numModes() const { return postEventIndices.size() + 1; }
+
+  /**
+   * Gets the range of node indices of a mode.
+   * @param [in] modeIndex: The index of the mode in the trajectory, starting from zero.
+   * @return The [begin, end) range of the node indices.
+   */
+  std::pair<size_t, size_t> modeRange(size_t modeIndex) const;
+
+  /**
+   * Gets the index of the mode which contains the given node.
+   * @param [in] nodeIndex: The index of the node.
+   * @return The index of the mode in the trajectory.
+   */
+  size_t modeIndex(size_t nodeIndex) const;
+
+  /** Clears the trajectory without releasing the memory. */
+  void clear() {
+    timeTrajectory.clear();
+    stateTrajectory.clear();
+    inputTrajectory.clear();
+    postEventIndices.clear();
+  }
+
+  /** Swaps the content with another trajectory. */
+  void swap(ContiguousTrajectory& other) noexcept {
+    timeTrajectory.swap(other.timeTrajectory);
+    stateTrajectory.swap(other.stateTrajectory);
+    inputTrajectory.swap(other.inputTrajectory);
+    postEventIndices.swap(other.postEventIndices);
+  }
+};
+
+inline void swap(ContiguousVectorArray& lhs, ContiguousVectorArray& rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+inline void swap(ContiguousTrajectory& lhs, ContiguousTrajectory& rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+}  // namespace ocs2
@@ -124,6 +124,16 @@ void computeConstraintProjection(const matrix_t& Dm, const matrix_t& RmInvUmUmT,
  */
 std::pair<VectorFunctionLinearApproximation, matrix_t> qrConstraintProjection(const VectorFunctionLinearApproximation& constraint);
 
+/**
+ * Computes the linear projection of qrConstraintProjection() in place. The memory of the outputs is reused if their sizes do not change.
+ *
+ * @param [in] constraint : C = dfdx, D = dfdu, e = f;
+ * @param [out] projectionTerms : Projection terms Px = dfdx, Pu = dfdu, Pe = f;
+ * @param [out] pseudoInverse : Left pseudo-inverse of D^T;
+ */
+void qrConstraintProjection(const VectorFunctionLinearApproximation& constraint, VectorFunctionLinearApproximation& projectionTerms,
+                            matrix_t& pseudoInverse);
+
 /**
  * Returns the linear projection
  *  u = Pu * \tilde{u} + Px * x + Pe
@@ -139,6 +149,14 @@ std::pair<VectorFunctionLinearApproximation, matrix_t> qrConstraintProjection(co
 std::pair<VectorFunctionLinearApproximation, matrix_t> luConstraintProjection(const VectorFunctionLinearApproximation& constraint,
                                                                               bool extractPseudoInverse = false);
 
+/**
+ * Computes the linear projection of luConstraintProjection() in place. The memory of the output is reused if its size does not change.
+ *
+ * @param [in] constraint : C = dfdx, D = dfdu, e = f;
+ * @param [out] projectionTerms : Projection terms Px = dfdx, Pu = dfdu, Pe = f;
+ */
+void luConstraintProjection(const VectorFunctionLinearApproximation& constraint, VectorFunctionLinearApproximation& projectionTerms);
+
 /** Computes the rank of a matrix */
 template <typename Derived>
 int rank(const Derived& A) {
@@ -34,6 +34,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <vector>
 
 #include "ocs2_core/Types.h"
+#include "ocs2_core/misc/ContiguousTrajectory.h"
 
 namespace ocs2 {
 namespace LinearInterpolation {
@@ -53,6 +54,26 @@ using remove_cvref_t = typename std::remove_cv<typename std::remove_reference<T>
  */
 index_alpha_t timeSegment(scalar_t enquiryTime, const std::vector<scalar_t>& timeArray);
 
+/**
+ * Caches the interval of the last time segment lookup. For monotone queries, e.g. the integrator substeps of a rollout,
+ * the next interval is found in O(1) in the cached interval or in one of its neighbours; otherwise the lookup falls back to
+ * the binary search. The hint is only a guess which is always verified, therefore it can be reused when the time array changes.
+ */
+struct TimeSegmentHint {
+  int lowerBoundIndex = 0;
+};
+
+/**
+ * Get the interval index and interpolation coefficient alpha. Same as timeSegment(enquiryTime, timeArray) but starts the search
+ * from the given hint and updates it.
+ *
+ * @param [in] enquiryTime: The enquiry time for interpolation.
+ * @param [in] timeArray: interpolation time array.
+ * @param [in, out] hint: The cached interval of the previous query.
+ * @return {index, alpha}
+ */
+index_alpha_t timeSegment(scalar_t enquiryTime, const std::vector<scalar_t>& timeArray, TimeSegmentHint& hint);
+
 /**
  * Directly uses the index and interpolation coefficient provided by the user
  * @note If sizes in data array are not equal, the interpolation will snap to the data
@@ -139,6 +160,29 @@ template <typename Data, class Alloc, class AccessFun>
 auto interpolate(scalar_t enquiryTime, const std::vector<scalar_t>& timeArray, const std::vector<Data, Alloc>& dataArray,
                  AccessFun accessFun) -> remove_cvref_t<typename std::result_of<AccessFun(const std::vector<Data, Alloc>&, size_t)>::type>;
 
+/**
+ * Directly uses the index and interpolation coefficient provided by the user on a contiguous array of vectors.
+ *
+ *  - Single data point implies a constant function
+ *  - Multiple data points are used for linear interpolation and zero order extrapolation
+ *
+ * @param [in] indexAlpha : index and interpolation coefficient (alpha) pair
+ * @param [in] dataArray: contiguous array of vectors
+ * @return The interpolation result
+ */
+vector_t interpolate(index_alpha_t indexAlpha, const ContiguousVectorArray& dataArray);
+
+/**
+ * Linearly interpolates a contiguous array of vectors at the given time. When duplicate values exist the lower range is
+ * selected s.t. ( ]
+ *
+ * @param [in] enquiryTime: The enquiry time for interpolation.
+ * @param [in] timeArray: Times vector
+ * @param [in] dataArray: contiguous array of vectors
+ * @return The interpolation result
+ */
+vector_t interpolate(scalar_t enquiryTime, const std::vector<scalar_t>& timeArray, const ContiguousVectorArray& dataArray);
+
 }  // namespace LinearInterpolation
 }  // namespace ocs2
 
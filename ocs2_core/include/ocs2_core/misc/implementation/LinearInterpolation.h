@@ -66,13 +66,10 @@ const Data& stdAccessFun(const std::vector<Data, Alloc>& vec, size_t ind) {
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
-inline index_alpha_t timeSegment(scalar_t enquiryTime, const std::vector<scalar_t>& timeArray) {
-  // corner cases (no time set OR single time element)
-  if (timeArray.size() <= 1) {
-    return {0, scalar_t(1.0)};
-  }
-
-  const int index = lookup::findIntervalInTimeArray(timeArray, enquiryTime);
+/**
+ * Helper function which computes the index and alpha pair given the interval found by lookup::findIntervalInTimeArray.
+ */
+inline index_alpha_t timeSegmentInInterval(int index, scalar_t enquiryTime, const std::vector<scalar_t>& timeArray) {
   const auto lastInterval = static_cast<int>(timeArray.size() - 1);
   if (index >= 0) {
     if (index < lastInterval) {
@@ -104,6 +101,47 @@ inline index_alpha_t timeSegment(scalar_t enquiryTime, const std::vector<scalar_
   }
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+inline index_alpha_t timeSegment(scalar_t enquiryTime, const std::vector<scalar_t>& timeArray) {
+  // corner cases (no time set OR single time element)
+  if (timeArray.size() <= 1) {
+    return {0, scalar_t(1.0)};
+  }
+
+  return timeSegmentInInterval(lookup::findIntervalInTimeArray(timeArray, enquiryTime), enquiryTime, timeArray);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+inline index_alpha_t timeSegment(scalar_t enquiryTime, const std::vector<scalar_t>& timeArray, TimeSegmentHint& hint) {
+  // corner cases (no time set OR single time element)
+  if (timeArray.size() <= 1) {
+    return {0, scalar_t(1.0)};
+  }
+
+  // k is the result of lookup::findIndexInTimeArray iff timeArray[k-1] < enquiryTime <= timeArray[k]
+  const auto n = static_cast<int>(timeArray.size());
+  const auto isLowerBound = [&](int k) {
+    return 0 <= k && k <= n && (k == 0 || timeArray[k - 1] < enquiryTime) && (k == n || !(timeArray[k] < enquiryTime));
+  };
+
+  int& k = hint.lowerBoundIndex;
+  if (!isLowerBound(k)) {
+    if (isLowerBound(k + 1)) {
+      ++k;
+    } else if (isLowerBound(k - 1)) {
+      --k;
+    } else {
+      k = lookup::findIndexInTimeArray(timeArray, enquiryTime);
+    }
+  }
+
+  return timeSegmentInInterval(k - 1, enquiryTime, timeArray);
+}
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
@@ -153,5 +191,28 @@ auto interpolate(scalar_t enquiryTime, const std::vector<scalar_t>& timeArray, c
   return interpolate(timeSegment(enquiryTime, timeArray), dataArray, accessFun);
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+inline vector_t interpolate(index_alpha_t indexAlpha, const ContiguousVectorArray& dataArray) {
+  assert(dataArray.size() > 0);
+  if (dataArray.size() > 1) {
+    // Normal interpolation case
+    const int index = indexAlpha.first;
+    const scalar_t alpha = indexAlpha.second;
+    return alpha * dataArray[index] + (scalar_t(1.0) - alpha) * dataArray[index + 1];
+  } else {  // dataArray.size() == 1
+    // Time vector has only 1 element -> Constant function
+    return dataArray[0];
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+inline vector_t interpolate(scalar_t enquiryTime, const std::vector<scalar_t>& timeArray, const ContiguousVectorArray& dataArray) {
+  return interpolate(timeSegment(enquiryTime, timeArray), dataArray);
+}
+
 }  // namespace LinearInterpolation
 }  // namespace ocs2
@@ -103,6 +103,32 @@ class MultidimensionalPenalty final {
   ScalarFunctionQuadraticApproximation getQuadraticApproximation(scalar_t t, const VectorFunctionQuadraticApproximation& h,
                                                                  const vector_t* l = nullptr) const;
 
+  /**
+   * Adds the scaled penalty cost quadratic approximation to the given approximation without creating a temporary approximation.
+   * If cost has no input derivatives, only the state derivatives are added.
+   *
+   * @param [in] t: The time that the constraint is evaluated.
+   * @param [in] h: The constraint linear approximation.
+   * @param [in] l: The Lagrange multipliers (can be nullptr).
+   * @param [in] scaling: The scaling factor of the penalty cost.
+   * @param [in, out] cost: The approximation to which the penalty cost quadratic approximation is added.
+   */
+  void addQuadraticApproximation(scalar_t t, const VectorFunctionLinearApproximation& h, const vector_t* l, scalar_t scaling,
+                                 ScalarFunctionQuadraticApproximation& cost) const;
+
+  /**
+   * Adds the scaled penalty cost quadratic approximation to the given approximation without creating a temporary approximation.
+   * If cost has no input derivatives, only the state derivatives are added.
+   *
+   * @param [in] t: The time that the constraint is evaluated.
+   * @param [in] h: The constraint quadratic approximation.
+   * @param [in] l: The Lagrange multipliers (can be nullptr).
+   * @param [in] scaling: The scaling factor of the penalty cost.
+   * @param [in, out] cost: The approximation to which the penalty cost quadratic approximation is added.
+   */
+  void addQuadraticApproximation(scalar_t t, const VectorFunctionQuadraticApproximation& h, const vector_t* l, scalar_t scaling,
+                                 ScalarFunctionQuadraticApproximation& cost) const;
+
   /**
    * Updates the Lagrange multipliers.
    *
@@ -122,7 +148,13 @@ class MultidimensionalPenalty final {
   vector_t initializeMultipliers(size_t numConstraints) const;
 
  private:
-  std::tuple<scalar_t, vector_t, vector_t> getPenaltyValue1stDev2ndDev(scalar_t t, const vector_t& h, const vector_t* l) const;
+  /** Computes the penalty value and the scaled first and second derivatives of the penalty w.r.t. the constraint values. */
+  scalar_t getPenaltyValue1stDev2ndDev(scalar_t t, const vector_t& h, const vector_t* l, scalar_t scaling, vector_t& penaltyDerivative,
+                                       vector_t& penaltySecondDerivative) const;
+
+  /** Adds the terms which only depend on the constraint Jacobians, i.e. the terms shared by the linear and quadratic approximations. */
+  static void addGaussNewtonApproximation(const matrix_t& dhdx, const matrix_t& dhdu, const vector_t& penaltyDerivative,
+                                          const vector_t& penaltySecondDerivative, ScalarFunctionQuadraticApproximation& cost);
 
   std::vector<std::unique_ptr<augmented::AugmentedPenaltyBase>> penaltyPtrArray_;
 };
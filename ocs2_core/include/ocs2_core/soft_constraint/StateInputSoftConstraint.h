@@ -89,6 +89,10 @@ class StateInputSoftConstraint final : public StateInputCost {
                                                                  const TargetTrajectories& /* targetTrajectories */,
                                                                  const PreComputation& preComp) const override;
 
+  void addQuadraticApproximation(scalar_t time, const vector_t& state, const vector_t& input,
+                                 const TargetTrajectories& /* targetTrajectories */, const PreComputation& preComp,
+                                 ScalarFunctionQuadraticApproximation& cost) const override;
+
  private:
   StateInputSoftConstraint(const StateInputSoftConstraint& other);
 
@@ -89,6 +89,9 @@ class StateSoftConstraint final : public StateCost {
                                                                  const TargetTrajectories& /* targetTrajectories */,
                                                                  const PreComputation& preComp) const override;
 
+  void addQuadraticApproximation(scalar_t time, const vector_t& state, const TargetTrajectories& /* targetTrajectories */,
+                                 const PreComputation& preComp, ScalarFunctionQuadraticApproximation& cost) const override;
+
  private:
   StateSoftConstraint(const StateSoftConstraint& other);
 
@@ -0,0 +1,109 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace ocs2 {
+
+/**
+ * A sense-reversing barrier for a fixed number of threads. The waiting threads first poll an atomic flag, which makes it suitable for
+ * persistent workers that synchronize at a high rate over short phases. A thread which has polled for numSpinIterations parks on a
+ * condition variable, such that oversubscribed threads do not starve the threads that still have to arrive.
+ *
+ * Each thread keeps its own sense flag. The flag is initialized to false and passed to every call of arriveAndWait().
+ */
+class SpinBarrier {
+ public:
+  /**
+   * Constructor.
+   * @param [in] numThreads: The number of threads which should arrive at the barrier before it is released.
+   */
+  explicit SpinBarrier(int numThreads) : numThreads_(numThreads), numWaiting_(numThreads) {}
+
+  /**
+   * Blocks until all the threads have arrived. The last arriving thread calls the completion function before releasing the other
+   * threads. Therefore, the completion function can safely modify the data which is shared between the phases.
+   *
+   * @param [in, out] localSense: The sense flag of the calling thread.
+   * @param [in] completion: The function which is called by the last arriving thread.
+   */
+  template <typename Completion>
+  void arriveAndWait(bool& localSense, Completion&& completion) {
+    localSense = !localSense;
+    if (numWaiting_.fetch_sub(1) == 1) {
+      completion();
+      numWaiting_.store(numThreads_, std::memory_order_relaxed);
+      sense_.store(localSense);
+      if (numParked_.load() > 0) {
+        // acquiring the lock guarantees that a thread which has missed the new sense is already waiting
+        { std::lock_guard<std::mutex> lock(parkLock_); }
+        parkCondition_.notify_all();
+      }
+
+    } else {
+      for (int i = 0; i < numSpinIterations; ++i) {
+        if (sense_.load(std::memory_order_acquire) == localSense) {
+          return;
+        }
+        std::this_thread::yield();
+      }
+      std::unique_lock<std::mutex> lock(parkLock_);
+      ++numParked_;
+      parkCondition_.wait(lock, [&] { return sense_.load() == localSense; });
+      --numParked_;
+    }
+  }
+
+  /** Blocks until all the threads have arrived. */
+  void arriveAndWait(bool& localSense) {
+    arriveAndWait(localSense, [] {});
+  }
+
+  /** Get the number of threads. */
+  int numThreads() const { return numThreads_; }
+
+ private:
+  // Number of polls before a waiting thread parks on the condition variable.
+  static constexpr int numSpinIterations = 1024;
+
+  const int numThreads_;
+  // The counter and the flag are padded to a cache line to avoid false sharing between the arriving and the waiting threads.
+  alignas(64) std::atomic_int numWaiting_;
+  alignas(64) std::atomic_bool sense_{false};
+  std::atomic_int numParked_{0};
+  std::mutex parkLock_;
+  std::condition_variable parkCondition_;
+};
+
+}  // namespace ocs2
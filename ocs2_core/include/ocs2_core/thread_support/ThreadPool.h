@@ -29,17 +29,25 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <deque>
+#include <functional>
 #include <future>
+#include <memory>
 #include <mutex>
-#include <queue>
 #include <thread>
 #include <vector>
 
 namespace ocs2 {
 
 /**
- * Thread pool class to execute tasks on multiple threads.
+ * Work-stealing thread pool class to execute tasks on multiple threads.
+ *
+ * Each worker owns a task deque. Tasks submitted from a worker are pushed to its own deque and served in LIFO order, while
+ * idle workers steal the oldest tasks from the other deques. Idle workers spin for a short while before parking on a
+ * condition variable, such that back-to-back parallel regions do not pay for a wake-up.
  */
 class ThreadPool {
  public:
@@ -69,10 +77,14 @@ class ThreadPool {
 
   /**
    * Helper function to run a task N times parallel with the help of the pool.
-   * - 1 task will run in the calling thread with ID = nThreads.
-   * - N-1 tasks will run on the threadpool with ID in [0, nThreads-1].
+   * - The calling thread runs the task with ID = nThreads.
+   * - The pool workers run the task with ID in [0, nThreads-1].
+   *
+   * The N instances are claimed dynamically by the calling thread and by at most nThreads helper tasks. Therefore, the call
+   * returns as soon as all instances are completed, even if some of the workers are busy with other tasks.
    *
    * @note This is a blocking operation, returns when all tasks are completed.
+   * @note If any instance throws, the first exception is rethrown after all instances are completed.
    * @warning Calling runParallel(task, nThreads) does not guarantee that each task will be executed with a different workerIndex.
    *
    * @param [in] taskFunction: task function to run in the pool.
@@ -80,6 +92,63 @@ class ThreadPool {
    */
   void runParallel(std::function<void(int)> taskFunction, int N);
 
+  /**
+   * Helper function to run numPartitions partitions of a task in parallel with a stable assignment of partitions to threads.
+   * - Partition p in [0, numPartitions-2] is queued on the deque of worker (p mod nThreads).
+   * - The last partition runs in the calling thread.
+   *
+   * As long as numPartitions <= nThreads + 1 and the workers are idle, each partition is executed by the same thread on every
+   * call, which keeps the data touched by a partition warm in the caches of that thread. Idle workers may still steal a queued
+   * partition, hence the task is indexed by the partition rather than by the thread.
+   *
+   * @warning The partitions are not guaranteed to run concurrently, e.g., if the workers are busy. Use runGang() for tasks which
+   * synchronize with each other.
+   *
+   * @note This is a blocking operation, returns when all partitions are completed.
+   *
+   * @param [in] partitionTask: The task function. It takes the partition index which can be used to index designated resources.
+   * @param [in] numPartitions: The number of partitions.
+   */
+  void runParallelPartitioned(std::function<void(int)> partitionTask, int numPartitions);
+
+  /**
+   * Helper function to run a task on a gang of threads which are guaranteed to run concurrently, e.g., for tasks which synchronize
+   * with a barrier.
+   * - The calling thread runs the instance 0.
+   * - Up to maxGangSize - 1 helpers are queued on the worker deques. A helper joins the gang when a worker starts it. When called
+   *   from a worker of this pool, that worker is not used as a helper.
+   * - The gang is closed once all the helpers have joined or after maxJoinTime. The helpers starting afterwards return immediately.
+   *
+   * Once the gang is closed, all its members run the task with the same gang size. By default, the call waits for all the helpers,
+   * hence the gang size only depends on maxGangSize and the number of threads. This requires that the other tasks on the pool
+   * eventually release their workers. A finite maxJoinTime bounds the wait instead: the gang then does not wait for a helper which
+   * has not started in time, so it runs on fewer threads when the workers are busy, at the cost of a timing-dependent gang size.
+   *
+   * @note This is a blocking operation, returns when all the instances are completed.
+   * @note If any instance throws, the first exception is rethrown after all instances are completed.
+   *
+   * @param [in] gangTask: The task function. It takes the instance index in [0, gangSize) and the gang size.
+   * @param [in] maxGangSize: The maximum number of threads, including the calling thread.
+   * @param [in] maxJoinTime: The maximum time to wait for the helpers to join. The default value waits without a time limit.
+   * @return The gang size.
+   */
+  int runGang(std::function<void(int, int)> gangTask, int maxGangSize,
+              std::chrono::microseconds maxJoinTime = std::chrono::microseconds::max());
+
+  /**
+   * Helper function to run a loop over the index range [begin, end) in parallel. The range is split into chunks of "grain"
+   * consecutive indices which are claimed dynamically by the calling thread (ID = nThreads) and the pool workers (ID in
+   * [0, nThreads-1]).
+   *
+   * @note This is a blocking operation, returns when all indices are processed.
+   *
+   * @param [in] begin: The first index.
+   * @param [in] end: The index after the last one.
+   * @param [in] grain: The number of consecutive indices processed by a worker at once.
+   * @param [in] taskFunction: The loop body. It takes the loop index and the thread worker index.
+   */
+  void parallelFor(int begin, int end, int grain, const std::function<void(int, int)>& taskFunction);
+
   /** Get the number of threads. */
   size_t numThreads() const { return workerThreads_.size(); }
 
@@ -89,6 +158,12 @@ class ThreadPool {
   template <typename Functor>
   struct Task;
 
+  struct WorkerQueue;
+  struct ParallelRegion;
+  struct ParallelRegionTask;
+  struct Gang;
+  struct GangTask;
+
   /**
    * Thread worker loop
    *
@@ -103,11 +178,41 @@ class ThreadPool {
    */
   void runTask(std::unique_ptr<TaskBase> taskPtr);
 
-  bool stop_{false};  //!< flag telling all threads to stop, protected by taskQueueLock_
+  /**
+   * Pushes a task to the deque of the given worker.
+   *
+   * @param [in] queueIndex: The index of the target worker deque.
+   * @param [in] taskPtr: task object
+   */
+  void pushTask(size_t queueIndex, std::unique_ptr<TaskBase> taskPtr);
+
+  /**
+   * Pops a task from the back of the worker's own deque, otherwise steals one from the front of the other deques.
+   *
+   * @param [in] workerIndex: worker thread index
+   * @return The task object, or nullptr if all deques are empty.
+   */
+  std::unique_ptr<TaskBase> popTask(int workerIndex);
+
+  /** Wakes up the parked workers. */
+  void notifyWorkers(bool all);
+
+  /**
+   * Runs numInstances instances of the region body on the calling thread and the pool workers.
+   *
+   * @param [in] body: The region body. It takes the instance index and the thread worker index.
+   * @param [in] numInstances: The number of instances.
+   */
+  void runParallelRegion(std::function<void(int, int)> body, int numInstances);
+
+  std::atomic_bool stop_{false};         //!< flag telling all threads to stop
+  std::atomic_int numPendingTasks_{0};   //!< number of tasks in all worker deques
+  std::atomic_int numParkedWorkers_{0};  //!< number of workers waiting on parkCondition_
+  std::atomic_size_t nextQueueIndex_{0};  //!< round-robin counter for tasks submitted from outside the pool
 
-  std::queue<std::unique_ptr<TaskBase>> taskQueue_;  // protected by taskQueueLock_
-  std::condition_variable taskQueueCondition_;
-  std::mutex taskQueueLock_;
+  std::vector<std::unique_ptr<WorkerQueue>> workerQueues_;
+  std::condition_variable parkCondition_;
+  std::mutex parkLock_;
 
   std::vector<std::thread> workerThreads_;
 };
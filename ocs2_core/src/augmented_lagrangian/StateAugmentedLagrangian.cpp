@@ -100,6 +100,26 @@ ScalarFunctionQuadraticApproximation StateAugmentedLagrangian::getQuadraticAppro
   }
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void StateAugmentedLagrangian::addQuadraticApproximation(scalar_t time, const vector_t& state, const Multiplier& multiplier,
+                                                         const PreComputation& preComp,
+                                                         ScalarFunctionQuadraticApproximation& penalty) const {
+  switch (constraintPtr_->getOrder()) {
+    case ConstraintOrder::Linear:
+      penalty_.addQuadraticApproximation(time, constraintPtr_->getLinearApproximation(time, state, preComp), &multiplier.lagrangian,
+                                         multiplier.penalty, penalty);
+      break;
+    case ConstraintOrder::Quadratic:
+      penalty_.addQuadraticApproximation(time, constraintPtr_->getQuadraticApproximation(time, state, preComp), &multiplier.lagrangian,
+                                         multiplier.penalty, penalty);
+      break;
+    default:
+      throw std::runtime_error("[StateAugmentedLagrangian] Unknown constraint Order");
+  }
+}
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
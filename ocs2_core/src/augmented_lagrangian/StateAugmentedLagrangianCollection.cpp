@@ -74,35 +74,25 @@ std::vector<LagrangianMetrics> StateAugmentedLagrangianCollection::getValue(scal
 /******************************************************************************************************/
 ScalarFunctionQuadraticApproximation StateAugmentedLagrangianCollection::getQuadraticApproximation(
     scalar_t time, const vector_t& state, const std::vector<Multiplier>& termsMultiplier, const PreComputation& preComp) const {
-  const auto firstActiveItr =
-      std::find_if(terms_.begin(), terms_.end(),
-                   [time](const std::unique_ptr<StateAugmentedLagrangianInterface>& costTerm) { return costTerm->isActive(time); });
-
-  // no active terms (or terms is empty).
-  if (firstActiveItr == terms_.end()) {
-    return ScalarFunctionQuadraticApproximation::Zero(state.size());
-  }
-
-  // initialize with first active term
-  const size_t firstActiveInd = std::distance(terms_.begin(), firstActiveItr);
-  auto penalty = (*firstActiveItr)->getQuadraticApproximation(time, state, termsMultiplier[firstActiveInd], preComp);
+  // the input derivatives are empty
+  auto penalty = ScalarFunctionQuadraticApproximation::Zero(state.size());
+  // qualified call, since the derived collections may implement addQuadraticApproximation() through this method
+  StateAugmentedLagrangianCollection::addQuadraticApproximation(time, state, termsMultiplier, preComp, penalty);
+  return penalty;
+}
 
-  // accumulate terms
-  for (size_t i = firstActiveInd + 1; i < terms_.size(); i++) {
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void StateAugmentedLagrangianCollection::addQuadraticApproximation(scalar_t time, const vector_t& state,
+                                                                   const std::vector<Multiplier>& termsMultiplier,
+                                                                   const PreComputation& preComp,
+                                                                   ScalarFunctionQuadraticApproximation& penalty) const {
+  for (size_t i = 0; i < terms_.size(); i++) {
     if (terms_[i]->isActive(time)) {
-      const auto termPenalty = terms_[i]->getQuadraticApproximation(time, state, termsMultiplier[i], preComp);
-      penalty.f += termPenalty.f;
-      penalty.dfdx += termPenalty.dfdx;
-      penalty.dfdxx += termPenalty.dfdxx;
+      terms_[i]->addQuadraticApproximation(time, state, termsMultiplier[i], preComp, penalty);
     }
   }
-
-  // make sure that input derivatives are empty
-  penalty.dfdu = vector_t();
-  penalty.dfduu = matrix_t();
-  penalty.dfdux = matrix_t();
-
-  return penalty;
 }
 
 /******************************************************************************************************/
@@ -101,6 +101,26 @@ ScalarFunctionQuadraticApproximation StateInputAugmentedLagrangian::getQuadratic
   }
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void StateInputAugmentedLagrangian::addQuadraticApproximation(scalar_t time, const vector_t& state, const vector_t& input,
+                                                              const Multiplier& multiplier, const PreComputation& preComp,
+                                                              ScalarFunctionQuadraticApproximation& penalty) const {
+  switch (constraintPtr_->getOrder()) {
+    case ConstraintOrder::Linear:
+      penalty_.addQuadraticApproximation(time, constraintPtr_->getLinearApproximation(time, state, input, preComp), &multiplier.lagrangian,
+                                         multiplier.penalty, penalty);
+      break;
+    case ConstraintOrder::Quadratic:
+      penalty_.addQuadraticApproximation(time, constraintPtr_->getQuadraticApproximation(time, state, input, preComp),
+                                         &multiplier.lagrangian, multiplier.penalty, penalty);
+      break;
+    default:
+      throw std::runtime_error("[StateInputAugmentedLagrangian] Unknown constraint Order");
+  }
+}
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
@@ -76,27 +76,24 @@ std::vector<LagrangianMetrics> StateInputAugmentedLagrangianCollection::getValue
 ScalarFunctionQuadraticApproximation StateInputAugmentedLagrangianCollection::getQuadraticApproximation(
     scalar_t time, const vector_t& state, const vector_t& input, const std::vector<Multiplier>& termsMultiplier,
     const PreComputation& preComp) const {
-  const auto firstActiveItr =
-      std::find_if(terms_.begin(), terms_.end(),
-                   [time](const std::unique_ptr<StateInputAugmentedLagrangianInterface>& costTerm) { return costTerm->isActive(time); });
-
-  // no active terms (or terms is empty).
-  if (firstActiveItr == terms_.end()) {
-    return ScalarFunctionQuadraticApproximation::Zero(state.size(), input.size());
-  }
-
-  // initialize with first active term
-  const size_t firstActiveInd = std::distance(terms_.begin(), firstActiveItr);
-  auto penalty = (*firstActiveItr)->getQuadraticApproximation(time, state, input, termsMultiplier[firstActiveInd], preComp);
+  auto penalty = ScalarFunctionQuadraticApproximation::Zero(state.size(), input.size());
+  // qualified call, since the derived collections may implement addQuadraticApproximation() through this method
+  StateInputAugmentedLagrangianCollection::addQuadraticApproximation(time, state, input, termsMultiplier, preComp, penalty);
+  return penalty;
+}
 
-  // accumulate terms
-  for (size_t i = firstActiveInd + 1; i < terms_.size(); i++) {
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void StateInputAugmentedLagrangianCollection::addQuadraticApproximation(scalar_t time, const vector_t& state, const vector_t& input,
+                                                                        const std::vector<Multiplier>& termsMultiplier,
+                                                                        const PreComputation& preComp,
+                                                                        ScalarFunctionQuadraticApproximation& penalty) const {
+  for (size_t i = 0; i < terms_.size(); i++) {
     if (terms_[i]->isActive(time)) {
-      penalty += terms_[i]->getQuadraticApproximation(time, state, input, termsMultiplier[i], preComp);
+      terms_[i]->addQuadraticApproximation(time, state, input, termsMultiplier[i], preComp, penalty);
     }
   }
-
-  return penalty;
 }
 
 /******************************************************************************************************/
@@ -29,9 +29,228 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <ocs2_core/automatic_differentiation/CppAdInterface.h>
 
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
 #include <boost/filesystem.hpp>
 
+#include <ocs2_core/automatic_differentiation/CppAdModelBatch.h>
+#include <ocs2_core/thread_support/ThreadPool.h>
+
 namespace ocs2 {
+namespace {
+
+/** 64-bit FNV-1a hash. Unlike std::hash, the result is stable across compilers and standard libraries. */
+uint64_t fnv1aHash(const std::string& data) {
+  uint64_t hash = 14695981039346656037ULL;
+  for (const char c : data) {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+/** Collects the generated sources of all models in a library, the same way the CppADCodeGen library processors do. */
+class SourceCollector : public CppAD::cg::ModelLibraryProcessor<scalar_t> {
+ public:
+  explicit SourceCollector(CppAD::cg::ModelLibraryCSourceGen<scalar_t>& libraryCSourceGen)
+      : CppAD::cg::ModelLibraryProcessor<scalar_t>(libraryCSourceGen) {}
+
+  std::map<std::string, std::string> getSources() {
+    std::map<std::string, std::string> sources;
+    for (const auto& model : modelLibraryHelper_->getModels()) {
+      const auto& modelSources = ModelLibraryProcessor::getSources(*model.second);
+      sources.insert(modelSources.begin(), modelSources.end());
+    }
+    const auto& librarySources = getLibrarySources();
+    sources.insert(librarySources.begin(), librarySources.end());
+    const auto& customSources = modelLibraryHelper_->getCustomSources();
+    sources.insert(customSources.begin(), customSources.end());
+    return sources;
+  }
+};
+
+/**
+ * Runs the commands with at most numJobs child processes at the same time.
+ * @return indices of the commands that failed.
+ */
+std::vector<size_t> runProcesses(const std::string& executable, const std::vector<std::vector<std::string>>& commands, size_t numJobs) {
+  // The pipes of compiler invocations in other threads must not leak into the children, otherwise these invocations wait for them.
+  const int maxFileDescriptor = static_cast<int>(std::min(sysconf(_SC_OPEN_MAX), 4096L));
+
+  std::vector<size_t> failedCommands;
+  std::vector<std::pair<pid_t, size_t>> runningProcesses;
+  size_t nextCommand = 0;
+  while (nextCommand < commands.size() || !runningProcesses.empty()) {
+    while (nextCommand < commands.size() && runningProcesses.size() < numJobs) {
+      std::vector<char*> argv{const_cast<char*>(executable.c_str())};
+      for (const auto& arg : commands[nextCommand]) {
+        argv.push_back(const_cast<char*>(arg.c_str()));
+      }
+      argv.push_back(nullptr);
+
+      const pid_t pid = fork();
+      if (pid == 0) {
+        for (int fd = STDERR_FILENO + 1; fd < maxFileDescriptor; ++fd) {
+          close(fd);
+        }
+        execv(executable.c_str(), argv.data());
+        _exit(EXIT_FAILURE);
+      } else if (pid < 0) {
+        failedCommands.push_back(nextCommand);
+      } else {
+        runningProcesses.emplace_back(pid, nextCommand);
+      }
+      ++nextCommand;
+    }
+
+    bool anyFinished = false;
+    for (auto it = runningProcesses.begin(); it != runningProcesses.end();) {
+      int status = 0;
+      const pid_t result = waitpid(it->first, &status, WNOHANG);
+      if (result == 0 || (result < 0 && errno == EINTR)) {
+        ++it;
+      } else {
+        if (result < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS) {
+          failedCommands.push_back(it->second);
+        }
+        it = runningProcesses.erase(it);
+        anyFinished = true;
+      }
+    }
+    if (!anyFinished && !runningProcesses.empty()) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+  }
+
+  return failedCommands;
+}
+
+/**
+ * Describes the operation graph that the zero order forward sweep of a taped function records, without generating its source code.
+ * Each node is described once by its operation, its info, and its arguments, and is referred to by its position in the code handler.
+ */
+void describeOperationGraph(CppAD::ADFun<ad_base_t>& fun, std::ostream& description) {
+  CppAD::cg::CodeHandler<scalar_t> handler;
+  std::vector<ad_base_t> independents(fun.Domain());
+  handler.makeVariables(independents);
+  const std::vector<ad_base_t> dependents = fun.Forward(0, independents);
+
+  description << std::hexfloat;
+  std::vector<CppAD::cg::OperationNode<scalar_t>*> pendingNodes;
+  for (const auto& dependent : dependents) {
+    if (dependent.isParameter()) {
+      description << "y p " << dependent.getValue() << '\n';
+    } else {
+      description << "y n " << dependent.getOperationNode()->getHandlerPosition() << '\n';
+      pendingNodes.push_back(dependent.getOperationNode());
+    }
+  }
+
+  handler.startNewOperationTreeVisit();
+  while (!pendingNodes.empty()) {
+    auto* node = pendingNodes.back();
+    pendingNodes.pop_back();
+    if (handler.isVisited(*node)) {
+      continue;
+    }
+    handler.markVisited(*node);
+
+    const auto operation = node->getOperationType();
+    description << node->getHandlerPosition() << ' ' << static_cast<int>(operation) << " |";
+    if (operation == CppAD::cg::CGOpCode::AtomicForward || operation == CppAD::cg::CGOpCode::AtomicReverse) {
+      // The atomic function ids depend on the order in which the atomic functions are created
+      description << ' ' << handler.getAtomicFunctionName(node->getInfo()[0]);
+      for (size_t i = 1; i < node->getInfo().size(); i++) {
+        description << ' ' << node->getInfo()[i];
+      }
+    } else {
+      for (const auto info : node->getInfo()) {
+        description << ' ' << info;
+      }
+    }
+    description << " |";
+    for (const auto& argument : node->getArguments()) {
+      if (argument.getOperation() != nullptr) {
+        description << " n " << argument.getOperation()->getHandlerPosition();
+        pendingNodes.push_back(argument.getOperation());
+      } else {
+        description << " p " << *argument.getParameter();
+      }
+    }
+    description << '\n';
+  }
+}
+
+/**
+ * Compiles the sources to a shared library with several compiler processes at the same time. The library is built like
+ * CppAD::cg::GccCompiler::compileSources and buildDynamic do, but only the public configuration of the compiler is used. The sources
+ * are compiled from files in its temporary folder, rather than being piped to the compiler, such that concurrent invocations do not
+ * share any pipes. The object files are removed afterwards.
+ */
+void compileDynamicLibrary(const CppAD::cg::GccCompiler<scalar_t>& compiler, const std::map<std::string, std::string>& sources,
+                           const std::string& library, size_t numJobs) {
+  CppAD::cg::system::createFolder(compiler.getTemporaryFolder());
+  if (compiler.isSaveToDiskFirst()) {
+    CppAD::cg::system::createFolder(compiler.getSourcesFolder());
+  }
+
+  std::vector<std::string> sourceFiles;
+  std::vector<std::string> objectFiles;
+  std::vector<std::vector<std::string>> commands;
+  for (const auto& source : sources) {
+    const std::string sourceFile = CppAD::cg::system::createPath(compiler.getTemporaryFolder(), source.first);
+    const std::string objectFile = sourceFile + ".o";
+    std::ofstream(sourceFile) << source.second;
+    if (compiler.isSaveToDiskFirst()) {
+      std::ofstream(CppAD::cg::system::createPath(compiler.getSourcesFolder(), source.first)) << source.second;
+    }
+    sourceFiles.push_back(sourceFile);
+    objectFiles.push_back(objectFile);
+
+    std::vector<std::string> args{"-x", "c"};
+    args.insert(args.end(), compiler.getCompileFlags().begin(), compiler.getCompileFlags().end());
+    args.insert(args.end(), {"-fPIC", "-c", sourceFile, "-o", objectFile});
+    commands.push_back(std::move(args));
+  }
+
+  auto removeFiles = [](const std::vector<std::string>& files) {
+    for (const auto& file : files) {
+      std::remove(file.c_str());
+    }
+  };
+
+  const auto failedCommands = runProcesses(compiler.getCompilerPath(), commands, std::max<size_t>(1, numJobs));
+  removeFiles(sourceFiles);
+  if (!failedCommands.empty()) {
+    removeFiles(objectFiles);
+    throw std::runtime_error("[CppAdInterface] Failed to compile " + sourceFiles[failedCommands.front()]);
+  }
+
+  // Link the same way as CppAD::cg::GccCompiler::buildDynamic
+  std::string linkerFlags = "-Wl,-soname," + CppAD::cg::system::filenameFromPath(library);
+  for (const auto& flag : compiler.getLinkFlags()) {
+    linkerFlags += "," + flag;
+  }
+  std::vector<std::string> args(compiler.getCompileLibFlags().begin(), compiler.getCompileLibFlags().end());
+  args.insert(args.end(), {linkerFlags, "-o", library});
+  args.insert(args.end(), objectFiles.begin(), objectFiles.end());
+
+  const auto failedLink = runProcesses(compiler.getCompilerPath(), {args}, 1);
+  removeFiles(objectFiles);
+  if (!failedLink.empty()) {
+    throw std::runtime_error("[CppAdInterface] Failed to link " + library);
+  }
+}
+
+}  // unnamed namespace
 
 /******************************************************************************************************/
 /******************************************************************************************************/
@@ -60,6 +279,9 @@ CppAdInterface::CppAdInterface(ad_function_t adFunction, size_t variableDim, std
 /******************************************************************************************************/
 CppAdInterface::CppAdInterface(const CppAdInterface& rhs)
     : CppAdInterface(rhs.adFunction_, rhs.variableDim_, rhs.parameterDim_, rhs.modelName_, rhs.folderName_, rhs.compileFlags_) {
+  if (rhs.modelBatchPtr_ != nullptr) {
+    throw std::runtime_error("[CppAdInterface] The model " + modelName_ + " is copied before its CppAdModelBatch is prepared!");
+  }
   if (isLibraryAvailable()) {
     loadModels(false);
   }
@@ -68,55 +290,17 @@ CppAdInterface::CppAdInterface(const CppAdInterface& rhs)
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
-void CppAdInterface::createModels(ApproximationOrder approximationOrder, bool verbose) {
-  createFolderStructure();
-
-  // set and declare independent variables and start tape recording
-  ad_vector_t xp(variableDim_ + parameterDim_);
-  xp.setOnes();  // Ones are better than zero, to prevent devision by zero in taping
-  CppAD::Independent(xp);
-
-  // Split in variables and parameters
-  ad_vector_t x = xp.segment(0, variableDim_);
-  ad_vector_t p = xp.segment(variableDim_, parameterDim_);
-  // dependent variable vector
-  ad_vector_t y;
-  // the model equation
-  adFunction_(x, p, y);
-  rangeDim_ = y.rows();
-  // create f: xp -> y and stop tape recording
-  ad_fun_t fun(xp, y);
-  // Optimize the operation sequence
-  fun.optimize();
-
-  // generates source code
-  CppAD::cg::ModelCSourceGen<scalar_t> sourceGen(fun, modelName_);
-  setApproximationOrder(approximationOrder, sourceGen, fun);
-
-  // Compiler objects, compile to temporary shared library file to avoid interference between processes
-  CppAD::cg::ModelLibraryCSourceGen<scalar_t> libraryCSourceGen(sourceGen);
-  CppAD::cg::GccCompiler<scalar_t> gccCompiler;
-  CppAD::cg::DynamicModelLibraryProcessor<scalar_t> libraryProcessor(libraryCSourceGen, libraryName_ + tmpName_);
-  setCompilerOptions(gccCompiler);
-
-  if (verbose) {
-    std::cerr << "[CppAdInterface] Compiling Shared Library: "
-              << libraryName_ + tmpName_ + CppAD::cg::system::SystemInfo<>::DYNAMIC_LIB_EXTENSION << std::endl;
+CppAdInterface::~CppAdInterface() {
+  if (modelBatchPtr_ != nullptr) {
+    modelBatchPtr_->remove(*this);
   }
+}
 
-  // Compile and store the library
-  dynamicLib_ = libraryProcessor.createDynamicLibrary(gccCompiler);
-  model_ = dynamicLib_->model(modelName_);
-
-  setSparsityNonzeros();
-
-  // Rename generated library after loading
-  if (verbose) {
-    std::cerr << "[CppAdInterface] Renaming " << libraryName_ + tmpName_ + CppAD::cg::system::SystemInfo<>::DYNAMIC_LIB_EXTENSION << " to "
-              << libraryName_ + CppAD::cg::system::SystemInfo<>::DYNAMIC_LIB_EXTENSION << std::endl;
-  }
-  boost::filesystem::rename(libraryName_ + tmpName_ + CppAD::cg::system::SystemInfo<>::DYNAMIC_LIB_EXTENSION,
-                            libraryName_ + CppAD::cg::system::SystemInfo<>::DYNAMIC_LIB_EXTENSION);
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void CppAdInterface::createModels(ApproximationOrder approximationOrder, bool verbose) {
+  prepareModels({{this, approximationOrder}}, {true}, 1, verbose);
 }
 
 /******************************************************************************************************/
@@ -138,10 +322,80 @@ void CppAdInterface::loadModels(bool verbose) {
 /******************************************************************************************************/
 /******************************************************************************************************/
 void CppAdInterface::loadModelsIfAvailable(ApproximationOrder approximationOrder, bool verbose) {
-  if (isLibraryAvailable()) {
-    loadModels(verbose);
-  } else {
-    createModels(approximationOrder, verbose);
+  prepareModels({{this, approximationOrder}}, {false}, 1, verbose);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void CppAdInterface::createModels(const model_list_t& models, size_t numThreads, bool verbose) {
+  prepareModels(models, std::vector<bool>(models.size(), true), numThreads, verbose);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void CppAdInterface::loadModelsIfAvailable(const model_list_t& models, size_t numThreads, bool verbose) {
+  prepareModels(models, std::vector<bool>(models.size(), false), numThreads, verbose);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void CppAdInterface::prepareModels(const model_list_t& models, const std::vector<bool>& forceCreate, size_t numThreads, bool verbose) {
+  // The models of an active batch are prepared later, together with the other models of the batch.
+  auto* modelBatchPtr = CppAdModelBatch::getActiveBatch();
+  if (modelBatchPtr != nullptr) {
+    for (size_t i = 0; i < models.size(); i++) {
+      modelBatchPtr->add(*models[i].first, models[i].second, forceCreate[i], verbose);
+    }
+    return;
+  }
+
+  struct PendingLibrary {
+    CppAdInterface* adInterfacePtr;
+    std::string modelHash;
+    std::map<std::string, std::string> sources;
+  };
+
+  const auto startTime = std::chrono::steady_clock::now();
+
+  // Taping and source generation use CppAD, which is not thread-safe. Hence, they are done sequentially.
+  std::vector<PendingLibrary> pendingLibraries;
+  for (size_t i = 0; i < models.size(); i++) {
+    const auto& model = models[i];
+    CppAdInterface& adInterface = *model.first;
+    ad_fun_t fun;
+    adInterface.tapeFunction(fun);
+    auto modelHash = adInterface.getModelHash(fun, model.second);
+
+    if (!forceCreate[i] && adInterface.isLibraryUpToDate(modelHash)) {
+      adInterface.loadModels(verbose);
+    } else {
+      if (verbose && !forceCreate[i] && adInterface.isLibraryAvailable()) {
+        std::cerr << "[CppAdInterface] Shared Library is outdated: "
+                  << adInterface.libraryName_ + CppAD::cg::system::SystemInfo<>::DYNAMIC_LIB_EXTENSION << std::endl;
+      }
+      adInterface.createFolderStructure();
+      pendingLibraries.push_back({&adInterface, std::move(modelHash), adInterface.generateSources(fun, model.second)});
+    }
+  }
+
+  // The compiler processes of the independent libraries run concurrently. The hardware threads are shared among the libraries.
+  if (!pendingLibraries.empty()) {
+    const size_t numLibraryThreads = std::max<size_t>(1, std::min(numThreads, pendingLibraries.size()));
+    const size_t numJobs = std::max<size_t>(1, std::thread::hardware_concurrency() / numLibraryThreads);
+    ThreadPool threadPool(numLibraryThreads - 1);
+    threadPool.parallelFor(0, static_cast<int>(pendingLibraries.size()), 1, [&](int i, int /*workerIndex*/) {
+      auto& library = pendingLibraries[i];
+      library.adInterfacePtr->compileLibrary(library.sources, library.modelHash, numJobs, verbose);
+    });
+  }
+
+  if (verbose) {
+    const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - startTime;
+    std::cerr << "[CppAdInterface] Prepared " << models.size() << " model(s) in " << duration.count() << " [s]: "
+              << models.size() - pendingLibraries.size() << " loaded, " << pendingLibraries.size() << " compiled." << std::endl;
   }
 }
 
@@ -297,6 +551,7 @@ void CppAdInterface::setFolderNames() {
   tmpName_ = getUniqueTemporaryName();
   tmpFolder_ = libraryFolder_ + "/" + tmpName_;
   libraryName_ = libraryFolder_ + "/" + modelName_ + "_lib";
+  hashFileName_ = libraryName_ + ".hash";
 }
 
 /******************************************************************************************************/
@@ -306,6 +561,113 @@ bool CppAdInterface::isLibraryAvailable() const {
   return boost::filesystem::exists(libraryName_ + CppAD::cg::system::SystemInfo<>::DYNAMIC_LIB_EXTENSION);
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+bool CppAdInterface::isLibraryUpToDate(const std::string& modelHash) const {
+  if (!isLibraryAvailable()) {
+    return false;
+  }
+  std::ifstream hashFile(hashFileName_);
+  std::string storedHash;
+  return static_cast<bool>(hashFile >> storedHash) && storedHash == modelHash;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void CppAdInterface::tapeFunction(ad_fun_t& fun) {
+  // set and declare independent variables and start tape recording
+  ad_vector_t xp(variableDim_ + parameterDim_);
+  xp.setOnes();  // Ones are better than zero, to prevent devision by zero in taping
+  CppAD::Independent(xp);
+
+  // Split in variables and parameters
+  ad_vector_t x = xp.segment(0, variableDim_);
+  ad_vector_t p = xp.segment(variableDim_, parameterDim_);
+  // dependent variable vector
+  ad_vector_t y;
+  // the model equation
+  adFunction_(x, p, y);
+  rangeDim_ = y.rows();
+  // create f: xp -> y and stop tape recording
+  fun.Dependent(xp, y);
+  // Optimize the operation sequence
+  fun.optimize();
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+std::string CppAdInterface::getModelHash(ad_fun_t& fun, ApproximationOrder approximationOrder) const {
+  std::ostringstream description;
+  description << variableDim_ << ' ' << parameterDim_ << ' ' << rangeDim_ << ' ' << static_cast<int>(approximationOrder) << '\n';
+  for (const auto& flag : compileFlags_) {
+    description << flag << '\n';
+  }
+  // The operation graph defines the function and its derivatives uniquely and is recorded without generating any source code.
+  describeOperationGraph(fun, description);
+
+  std::ostringstream hash;
+  hash << std::hex << std::setw(16) << std::setfill('0') << fnv1aHash(description.str());
+  return hash.str();
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+std::map<std::string, std::string> CppAdInterface::generateSources(ad_fun_t& fun, ApproximationOrder approximationOrder) const {
+  CppAD::cg::ModelCSourceGen<scalar_t> sourceGen(fun, modelName_);
+  setApproximationOrder(approximationOrder, sourceGen, fun);
+  CppAD::cg::ModelLibraryCSourceGen<scalar_t> libraryCSourceGen(sourceGen);
+  return SourceCollector(libraryCSourceGen).getSources();
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void CppAdInterface::compileLibrary(const std::map<std::string, std::string>& sources, const std::string& modelHash, size_t numJobs,
+                                    bool verbose) {
+  const auto startTime = std::chrono::steady_clock::now();
+  const std::string tmpLibraryName = libraryName_ + tmpName_ + CppAD::cg::system::SystemInfo<>::DYNAMIC_LIB_EXTENSION;
+  const std::string libraryName = libraryName_ + CppAD::cg::system::SystemInfo<>::DYNAMIC_LIB_EXTENSION;
+
+  if (verbose) {
+    std::cerr << "[CppAdInterface] Compiling Shared Library: " << tmpLibraryName << std::endl;
+  }
+
+  // Compile to temporary shared library file to avoid interference between processes
+  CppAD::cg::GccCompiler<scalar_t> gccCompiler;
+  setCompilerOptions(gccCompiler);
+  try {
+    compileDynamicLibrary(gccCompiler, sources, tmpLibraryName, numJobs);
+  } catch (...) {
+    gccCompiler.cleanup();
+    throw;
+  }
+  gccCompiler.cleanup();
+
+  dynamicLib_.reset(new CppAD::cg::LinuxDynamicLib<scalar_t>(tmpLibraryName));
+  model_ = dynamicLib_->model(modelName_);
+
+  setSparsityNonzeros();
+
+  // Rename generated library after loading
+  if (verbose) {
+    const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - startTime;
+    std::cerr << "[CppAdInterface] Compiled in " << duration.count() << " [s]. Renaming " << tmpLibraryName << " to " << libraryName
+              << std::endl;
+  }
+  boost::filesystem::rename(tmpLibraryName, libraryName);
+
+  // Store the hash after the library, such that a library never appears up to date before it is complete
+  {
+    std::ofstream hashFile(hashFileName_ + tmpName_);
+    hashFile << modelHash << std::endl;
+  }
+  boost::filesystem::rename(hashFileName_ + tmpName_, hashFileName_);
+}
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
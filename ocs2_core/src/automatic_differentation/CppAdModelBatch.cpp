@@ -0,0 +1,120 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+
+#include <ocs2_core/automatic_differentiation/CppAdModelBatch.h>
+
+#include <algorithm>
+
+namespace ocs2 {
+
+thread_local CppAdModelBatch* CppAdModelBatch::activeBatchPtr_ = nullptr;
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+CppAdModelBatch::CppAdModelBatch(size_t numThreads) : numThreads_(std::max<size_t>(1, numThreads)), previousBatchPtr_(activeBatchPtr_) {
+  activeBatchPtr_ = this;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+CppAdModelBatch::~CppAdModelBatch() {
+  deactivate();
+  for (auto& pendingModel : pendingModels_) {
+    pendingModel.adInterfacePtr->modelBatchPtr_ = nullptr;
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void CppAdModelBatch::prepare() {
+  deactivate();
+
+  CppAdInterface::model_list_t models;
+  std::vector<bool> forceCreate;
+  models.reserve(pendingModels_.size());
+  forceCreate.reserve(pendingModels_.size());
+  for (auto& pendingModel : pendingModels_) {
+    pendingModel.adInterfacePtr->modelBatchPtr_ = nullptr;
+    models.emplace_back(pendingModel.adInterfacePtr, pendingModel.approximationOrder);
+    forceCreate.push_back(pendingModel.forceCreate);
+  }
+  pendingModels_.clear();
+
+  if (!models.empty()) {
+    CppAdInterface::prepareModels(models, forceCreate, numThreads_, verbose_);
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void CppAdModelBatch::add(CppAdInterface& adInterface, CppAdInterface::ApproximationOrder approximationOrder, bool forceCreate,
+                          bool verbose) {
+  verbose_ = verbose_ || verbose;
+
+  if (adInterface.modelBatchPtr_ == this) {
+    // The latest request of a model replaces the earlier ones.
+    auto it = std::find_if(pendingModels_.begin(), pendingModels_.end(),
+                           [&](const PendingModel& pendingModel) { return pendingModel.adInterfacePtr == &adInterface; });
+    it->approximationOrder = approximationOrder;
+    it->forceCreate = forceCreate;
+    return;
+  }
+
+  if (adInterface.modelBatchPtr_ != nullptr) {
+    adInterface.modelBatchPtr_->remove(adInterface);
+  }
+  adInterface.modelBatchPtr_ = this;
+  pendingModels_.push_back({&adInterface, approximationOrder, forceCreate});
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void CppAdModelBatch::remove(const CppAdInterface& adInterface) {
+  pendingModels_.erase(std::remove_if(pendingModels_.begin(), pendingModels_.end(),
+                                      [&](const PendingModel& pendingModel) { return pendingModel.adInterfacePtr == &adInterface; }),
+                       pendingModels_.end());
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void CppAdModelBatch::deactivate() {
+  if (isActive_ && activeBatchPtr_ == this) {
+    activeBatchPtr_ = previousBatchPtr_;
+  }
+  isActive_ = false;
+}
+
+}  // namespace ocs2
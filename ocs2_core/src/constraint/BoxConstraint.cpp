@@ -0,0 +1,119 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+
+#include <ocs2_core/constraint/BoxConstraint.h>
+
+#include <algorithm>
+
+namespace ocs2 {
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void BoxConstraintBounds::clear() {
+  indices.clear();
+  lowerBound.resize(0);
+  upperBound.resize(0);
+  softIndices.clear();
+  slackQuadraticPenalty.resize(0);
+  slackLinearPenalty.resize(0);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+BoxConstraint::BoxConstraint(std::vector<int> indices, vector_t lowerBound, vector_t upperBound)
+    : indices_(std::move(indices)), lowerBound_(std::move(lowerBound)), upperBound_(std::move(upperBound)) {
+  if (lowerBound_.size() != indices_.size() || upperBound_.size() != indices_.size()) {
+    throw std::runtime_error("[BoxConstraint] The size of the bounds does not match the number of indices!");
+  }
+  for (int i = 0; i < indices_.size(); ++i) {
+    if (indices_[i] < 0) {
+      throw std::runtime_error("[BoxConstraint] Indices must be non-negative!");
+    }
+    if (std::find(indices_.begin(), indices_.begin() + i, indices_[i]) != indices_.begin() + i) {
+      throw std::runtime_error("[BoxConstraint] Index " + std::to_string(indices_[i]) + " is repeated!");
+    }
+    if (lowerBound_[i] > upperBound_[i]) {
+      throw std::runtime_error("[BoxConstraint] Lower bound is larger than the upper bound for index " + std::to_string(indices_[i]));
+    }
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+BoxConstraint::BoxConstraint(std::vector<int> indices, vector_t lowerBound, vector_t upperBound, scalar_t slackQuadraticPenalty,
+                             scalar_t slackLinearPenalty)
+    : BoxConstraint(std::move(indices), std::move(lowerBound), std::move(upperBound)) {
+  if (slackQuadraticPenalty <= 0.0 || slackLinearPenalty < 0.0) {
+    throw std::runtime_error("[BoxConstraint] The quadratic slack penalty must be positive and the linear slack penalty non-negative!");
+  }
+  isSoft_ = true;
+  slackQuadraticPenalty_ = slackQuadraticPenalty;
+  slackLinearPenalty_ = slackLinearPenalty;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+vector_t getHardBoxConstraintValue(const BoxConstraintBounds& bounds, const vector_t& v) {
+  const int numHard = bounds.size() - bounds.numSoft();
+  vector_t value(2 * numHard);
+
+  int softRow = 0;
+  int hardRow = 0;
+  for (int i = 0; i < bounds.size(); ++i) {
+    if (softRow < bounds.numSoft() && bounds.softIndices[softRow] == i) {
+      ++softRow;
+    } else {
+      value[hardRow] = v[bounds.indices[i]] - bounds.lowerBound[i];
+      value[numHard + hardRow] = bounds.upperBound[i] - v[bounds.indices[i]];
+      ++hardRow;
+    }
+  }
+  return value;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+scalar_t getSoftBoxConstraintPenalty(const BoxConstraintBounds& bounds, const vector_t& v) {
+  scalar_t penalty = 0.0;
+  for (int j = 0; j < bounds.numSoft(); ++j) {
+    const int i = bounds.softIndices[j];
+    const scalar_t violation = std::max(bounds.lowerBound[i] - v[bounds.indices[i]], 0.0) +
+                               std::max(v[bounds.indices[i]] - bounds.upperBound[i], 0.0);  // at most one side is violated
+    penalty += 0.5 * bounds.slackQuadraticPenalty[j] * violation * violation + bounds.slackLinearPenalty[j] * violation;
+  }
+  return penalty;
+}
+
+}  // namespace ocs2
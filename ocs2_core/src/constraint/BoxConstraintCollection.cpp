@@ -0,0 +1,138 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+
+#include <ocs2_core/constraint/BoxConstraintCollection.h>
+
+#include <algorithm>
+
+namespace ocs2 {
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+BoxConstraintCollection::BoxConstraintCollection(const BoxConstraintCollection& other) : Collection<BoxConstraint>(other) {}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+BoxConstraintCollection* BoxConstraintCollection::clone() const {
+  return new BoxConstraintCollection(*this);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void BoxConstraintCollection::add(std::string name, std::unique_ptr<BoxConstraint> term) {
+  for (const auto& boxTerm : this->terms_) {
+    const auto& indices = boxTerm->getIndices();
+    for (const int index : term->getIndices()) {
+      if (std::find(indices.begin(), indices.end(), index) != indices.end()) {
+        throw std::runtime_error("[BoxConstraintCollection::add] Index " + std::to_string(index) + " of term \"" + name +
+                                 "\" is already constrained by another term");
+      }
+    }
+  }
+  Collection<BoxConstraint>::add(std::move(name), std::move(term));
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+size_t BoxConstraintCollection::getNumConstraints(scalar_t time) const {
+  size_t numConstraints = 0;
+  for (const auto& boxTerm : this->terms_) {
+    if (boxTerm->isActive(time)) {
+      numConstraints += boxTerm->getNumConstraints();
+    }
+  }
+  return numConstraints;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+size_t BoxConstraintCollection::getNumSoftConstraints(scalar_t time) const {
+  size_t numConstraints = 0;
+  for (const auto& boxTerm : this->terms_) {
+    if (boxTerm->isActive(time) && boxTerm->isSoft()) {
+      numConstraints += boxTerm->getNumConstraints();
+    }
+  }
+  return numConstraints;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+BoxConstraintBounds BoxConstraintCollection::getBounds(scalar_t time) const {
+  BoxConstraintBounds bounds;
+  getBounds(time, bounds);
+  return bounds;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void BoxConstraintCollection::getBounds(scalar_t time, BoxConstraintBounds& bounds) const {
+  const auto numConstraints = getNumConstraints(time);
+  const auto numSoftConstraints = getNumSoftConstraints(time);
+
+  bounds.indices.resize(numConstraints);
+  bounds.lowerBound.resize(numConstraints);
+  bounds.upperBound.resize(numConstraints);
+  bounds.softIndices.resize(numSoftConstraints);
+  bounds.slackQuadraticPenalty.resize(numSoftConstraints);
+  bounds.slackLinearPenalty.resize(numSoftConstraints);
+
+  // accumulate bounds
+  size_t row = 0;
+  size_t softRow = 0;
+  for (const auto& boxTerm : this->terms_) {
+    if (boxTerm->isActive(time)) {
+      const auto termSize = boxTerm->getNumConstraints();
+      std::copy(boxTerm->getIndices().begin(), boxTerm->getIndices().end(), bounds.indices.begin() + row);
+      bounds.lowerBound.segment(row, termSize) = boxTerm->getLowerBound(time);
+      bounds.upperBound.segment(row, termSize) = boxTerm->getUpperBound(time);
+
+      if (boxTerm->isSoft()) {
+        for (size_t i = 0; i < termSize; ++i) {
+          bounds.softIndices[softRow + i] = row + i;
+        }
+        bounds.slackQuadraticPenalty.segment(softRow, termSize).setConstant(boxTerm->getSlackQuadraticPenalty());
+        bounds.slackLinearPenalty.segment(softRow, termSize).setConstant(boxTerm->getSlackLinearPenalty());
+        softRow += termSize;
+      }
+
+      row += termSize;
+    }
+  }
+}
+
+}  // namespace ocs2
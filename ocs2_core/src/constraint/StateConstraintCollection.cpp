@@ -87,7 +87,17 @@ vector_array_t StateConstraintCollection::getValue(scalar_t time, const vector_t
 /******************************************************************************************************/
 VectorFunctionLinearApproximation StateConstraintCollection::getLinearApproximation(scalar_t time, const vector_t& state,
                                                                                     const PreComputation& preComp) const {
-  VectorFunctionLinearApproximation linearApproximation(getNumConstraints(time), state.rows());
+  VectorFunctionLinearApproximation linearApproximation;
+  StateConstraintCollection::getLinearApproximation(time, state, preComp, linearApproximation);
+  return linearApproximation;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void StateConstraintCollection::getLinearApproximation(scalar_t time, const vector_t& state, const PreComputation& preComp,
+                                                       VectorFunctionLinearApproximation& linearApproximation) const {
+  linearApproximation.resize(getNumConstraints(time), state.rows());
 
   // append linearApproximation of each constraintTerm
   size_t i = 0;
@@ -100,8 +110,6 @@ VectorFunctionLinearApproximation StateConstraintCollection::getLinearApproximat
       i += nc;
     }
   }
-
-  return linearApproximation;
 }
 
 /******************************************************************************************************/
@@ -90,7 +90,18 @@ vector_array_t StateInputConstraintCollection::getValue(scalar_t time, const vec
 VectorFunctionLinearApproximation StateInputConstraintCollection::getLinearApproximation(scalar_t time, const vector_t& state,
                                                                                          const vector_t& input,
                                                                                          const PreComputation& preComp) const {
-  VectorFunctionLinearApproximation linearApproximation(getNumConstraints(time), state.rows(), input.rows());
+  VectorFunctionLinearApproximation linearApproximation;
+  StateInputConstraintCollection::getLinearApproximation(time, state, input, preComp, linearApproximation);
+  return linearApproximation;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void StateInputConstraintCollection::getLinearApproximation(scalar_t time, const vector_t& state, const vector_t& input,
+                                                            const PreComputation& preComp,
+                                                            VectorFunctionLinearApproximation& linearApproximation) const {
+  linearApproximation.resize(getNumConstraints(time), state.rows(), input.rows());
 
   // append linearApproximation of each constraintTerm
   size_t i = 0;
@@ -104,8 +115,6 @@ VectorFunctionLinearApproximation StateInputConstraintCollection::getLinearAppro
       i += nc;
     }
   }
-
-  return linearApproximation;
 }
 
 /******************************************************************************************************/
@@ -87,7 +87,8 @@ void FeedforwardController::setController(const scalar_array_t& controllerTime,
 /******************************************************************************************************/
 /******************************************************************************************************/
 vector_t FeedforwardController::computeInput(scalar_t t, const vector_t& x) {
-  return LinearInterpolation::interpolate(t, timeStamp_, uffArray_);
+  const auto indexAlpha = LinearInterpolation::timeSegment(t, timeStamp_, timeSegmentHint_);
+  return LinearInterpolation::interpolate(indexAlpha, uffArray_);
 }
 
 /******************************************************************************************************/
@@ -39,6 +39,7 @@ namespace ocs2 {
 /******************************************************************************************************/
 LinearController::LinearController(const LinearController& other) : LinearController(other.timeStamp_, other.biasArray_, other.gainArray_) {
   deltaBiasArray_ = other.deltaBiasArray_;
+  inputKernel_ = other.inputKernel_;
 }
 
 /******************************************************************************************************/
@@ -77,10 +78,17 @@ void LinearController::setController(const scalar_array_t& controllerTime, const
 /******************************************************************************************************/
 /******************************************************************************************************/
 vector_t LinearController::computeInput(scalar_t t, const vector_t& x) {
-  const auto indexAlpha = LinearInterpolation::timeSegment(t, timeStamp_);
+  const auto indexAlpha = LinearInterpolation::timeSegment(t, timeStamp_, timeSegmentHint_);
+  return inputKernel_(indexAlpha, *this, x);
+}
 
-  vector_t uff = LinearInterpolation::interpolate(indexAlpha, biasArray_);
-  const matrix_t k = LinearInterpolation::interpolate(indexAlpha, gainArray_);
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+vector_t LinearController::dynamicSizeInputKernel(LinearInterpolation::index_alpha_t indexAlpha, const LinearController& controller,
+                                                  const vector_t& x) {
+  vector_t uff = LinearInterpolation::interpolate(indexAlpha, controller.biasArray_);
+  const matrix_t k = LinearInterpolation::interpolate(indexAlpha, controller.gainArray_);
 
   uff.noalias() += k * x;
   return uff;
@@ -288,6 +296,7 @@ void swap(LinearController& a, LinearController& b) noexcept {
   std::swap(a.biasArray_, b.biasArray_);
   std::swap(a.deltaBiasArray_, b.deltaBiasArray_);
   std::swap(a.gainArray_, b.gainArray_);
+  std::swap(a.inputKernel_, b.inputKernel_);
 }
 
 /******************************************************************************************************/
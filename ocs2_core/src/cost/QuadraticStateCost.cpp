@@ -67,6 +67,17 @@ ScalarFunctionQuadraticApproximation QuadraticStateCost::getQuadraticApproximati
   return Phi;
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void QuadraticStateCost::addQuadraticApproximation(scalar_t time, const vector_t& state, const TargetTrajectories& targetTrajectories,
+                                                   const PreComputation&, ScalarFunctionQuadraticApproximation& cost) const {
+  const vector_t xDeviation = getStateDeviation(time, state, targetTrajectories);
+  cost.f += 0.5 * xDeviation.dot(Q_.lazyProduct(xDeviation));
+  cost.dfdx.noalias() += Q_ * xDeviation;
+  cost.dfdxx += Q_;
+}
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
@@ -71,29 +71,33 @@ scalar_t QuadraticStateInputCost::getValue(scalar_t time, const vector_t& state,
 ScalarFunctionQuadraticApproximation QuadraticStateInputCost::getQuadraticApproximation(scalar_t time, const vector_t& state,
                                                                                         const vector_t& input,
                                                                                         const TargetTrajectories& targetTrajectories,
-                                                                                        const PreComputation&) const {
+                                                                                        const PreComputation& preComp) const {
+  auto L = ScalarFunctionQuadraticApproximation::Zero(state.size(), input.size());
+  addQuadraticApproximation(time, state, input, targetTrajectories, preComp, L);
+  return L;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void QuadraticStateInputCost::addQuadraticApproximation(scalar_t time, const vector_t& state, const vector_t& input,
+                                                        const TargetTrajectories& targetTrajectories, const PreComputation&,
+                                                        ScalarFunctionQuadraticApproximation& cost) const {
   vector_t stateDeviation, inputDeviation;
   std::tie(stateDeviation, inputDeviation) = getStateInputDeviation(time, state, input, targetTrajectories);
 
-  ScalarFunctionQuadraticApproximation L;
-  L.dfdxx = Q_;
-  L.dfduu = R_;
-  L.dfdx.noalias() = Q_ * stateDeviation;
-  L.dfdu.noalias() = R_ * inputDeviation;
-  L.f = 0.5 * stateDeviation.dot(L.dfdx) + 0.5 * inputDeviation.dot(L.dfdu);
+  cost.f += 0.5 * stateDeviation.dot(Q_.lazyProduct(stateDeviation)) + 0.5 * inputDeviation.dot(R_.lazyProduct(inputDeviation));
+  cost.dfdx.noalias() += Q_ * stateDeviation;
+  cost.dfdu.noalias() += R_ * inputDeviation;
+  cost.dfdxx += Q_;
+  cost.dfduu += R_;
 
-  if (P_.size() == 0) {
-    L.dfdux.setZero(input.size(), state.size());
-
-  } else {
-    const vector_t pDeviation = P_ * stateDeviation;
-    L.f += inputDeviation.dot(pDeviation);
-    L.dfdu += pDeviation;
-    L.dfdx.noalias() += P_.transpose() * inputDeviation;
-    L.dfdux = P_;
+  if (P_.size() > 0) {
+    cost.f += inputDeviation.dot(P_.lazyProduct(stateDeviation));
+    cost.dfdu.noalias() += P_ * stateDeviation;
+    cost.dfdx.noalias() += P_.transpose() * inputDeviation;
+    cost.dfdux += P_;
   }
-
-  return L;
 }
 
 /******************************************************************************************************/
@@ -101,9 +105,9 @@ ScalarFunctionQuadraticApproximation QuadraticStateInputCost::getQuadraticApprox
 /******************************************************************************************************/
 std::pair<vector_t, vector_t> QuadraticStateInputCost::getStateInputDeviation(scalar_t time, const vector_t& state, const vector_t& input,
                                                                               const TargetTrajectories& targetTrajectories) const {
-  const vector_t stateDeviation = state - targetTrajectories.getDesiredState(time);
-  const vector_t inputDeviation = input - targetTrajectories.getDesiredInput(time);
-  return {stateDeviation, inputDeviation};
+  vector_t stateDeviation = state - targetTrajectories.getDesiredState(time);
+  vector_t inputDeviation = input - targetTrajectories.getDesiredInput(time);
+  return {std::move(stateDeviation), std::move(inputDeviation)};
 }
 
 }  // namespace ocs2
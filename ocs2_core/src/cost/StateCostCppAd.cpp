@@ -74,22 +74,28 @@ scalar_t StateCostCppAd::getValue(scalar_t time, const vector_t& state, const Ta
 ScalarFunctionQuadraticApproximation StateCostCppAd::getQuadraticApproximation(scalar_t time, const vector_t& state,
                                                                                const TargetTrajectories& targetTrajectories,
                                                                                const PreComputation& preComputation) const {
-  ScalarFunctionQuadraticApproximation cost;
+  auto cost = ScalarFunctionQuadraticApproximation::Zero(state.rows());
+  addQuadraticApproximation(time, state, targetTrajectories, preComputation, cost);
+  return cost;
+}
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void StateCostCppAd::addQuadraticApproximation(scalar_t time, const vector_t& state, const TargetTrajectories& targetTrajectories,
+                                               const PreComputation& preComputation, ScalarFunctionQuadraticApproximation& cost) const {
   const size_t stateDim = state.rows();
   const vector_t params = getParameters(time, targetTrajectories, preComputation);
   vector_t tapedTimeState(1 + stateDim);
   tapedTimeState << time, state;
 
-  cost.f = adInterfacePtr_->getFunctionValue(tapedTimeState, params)(0);
+  cost.f += adInterfacePtr_->getFunctionValue(tapedTimeState, params)(0);
 
   const matrix_t J = adInterfacePtr_->getJacobian(tapedTimeState, params);
-  cost.dfdx = J.rightCols(stateDim).transpose();
+  cost.dfdx += J.rightCols(stateDim).transpose();
 
   const matrix_t H = adInterfacePtr_->getHessian(0, tapedTimeState, params);
-  cost.dfdxx = H.bottomRightCorner(stateDim, stateDim);
-
-  return cost;
+  cost.dfdxx += H.bottomRightCorner(stateDim, stateDim);
 }
 
 }  // namespace ocs2
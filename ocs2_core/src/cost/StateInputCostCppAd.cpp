@@ -76,26 +76,33 @@ ScalarFunctionQuadraticApproximation StateInputCostCppAd::getQuadraticApproximat
                                                                                     const vector_t& input,
                                                                                     const TargetTrajectories& targetTrajectories,
                                                                                     const PreComputation& preComputation) const {
-  ScalarFunctionQuadraticApproximation cost;
+  auto cost = ScalarFunctionQuadraticApproximation::Zero(state.rows(), input.rows());
+  addQuadraticApproximation(time, state, input, targetTrajectories, preComputation, cost);
+  return cost;
+}
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void StateInputCostCppAd::addQuadraticApproximation(scalar_t time, const vector_t& state, const vector_t& input,
+                                                    const TargetTrajectories& targetTrajectories, const PreComputation& preComputation,
+                                                    ScalarFunctionQuadraticApproximation& cost) const {
   const size_t stateDim = state.rows();
   const size_t inputDim = input.rows();
   const vector_t params = getParameters(time, targetTrajectories, preComputation);
   vector_t tapedTimeStateInput(1 + stateDim + inputDim);
   tapedTimeStateInput << time, state, input;
 
-  cost.f = adInterfacePtr_->getFunctionValue(tapedTimeStateInput, params)(0);
+  cost.f += adInterfacePtr_->getFunctionValue(tapedTimeStateInput, params)(0);
 
   const matrix_t J = adInterfacePtr_->getJacobian(tapedTimeStateInput, params);
-  cost.dfdx = J.middleCols(1, stateDim).transpose();
-  cost.dfdu = J.rightCols(inputDim).transpose();
+  cost.dfdx += J.middleCols(1, stateDim).transpose();
+  cost.dfdu += J.rightCols(inputDim).transpose();
 
   const matrix_t H = adInterfacePtr_->getHessian(0, tapedTimeStateInput, params);
-  cost.dfdxx = H.block(1, 1, stateDim, stateDim);
-  cost.dfdux = H.block(1 + stateDim, 1, inputDim, stateDim);
-  cost.dfduu = H.bottomRightCorner(inputDim, inputDim);
-
-  return cost;
+  cost.dfdxx += H.block(1, 1, stateDim, stateDim);
+  cost.dfdux += H.block(1 + stateDim, 1, inputDim, stateDim);
+  cost.dfduu += H.bottomRightCorner(inputDim, inputDim);
 }
 
 }  // namespace ocs2
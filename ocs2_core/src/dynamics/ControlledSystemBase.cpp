@@ -63,6 +63,22 @@ vector_t ControlledSystemBase::computeFlowMap(scalar_t t, const vector_t& x, con
   return computeFlowMap(t, x, u, *preCompPtr_);
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void ControlledSystemBase::computeFlowMap(scalar_t t, const vector_t& x, const vector_t& u, const PreComputation& preComp, vector_t& dxdt) {
+  dxdt = computeFlowMap(t, x, u, preComp);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void ControlledSystemBase::computeFlowMap(scalar_t t, const vector_t& x, const vector_t& u, vector_t& dxdt) {
+  assert(preCompPtr_ != nullptr);
+  preCompPtr_->request(Request::Dynamics, t, x, u);
+  computeFlowMap(t, x, u, *preCompPtr_, dxdt);
+}
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
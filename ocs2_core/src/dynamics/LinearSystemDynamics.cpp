@@ -51,12 +51,20 @@ LinearSystemDynamics* LinearSystemDynamics::clone() const {
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
-vector_t LinearSystemDynamics::computeFlowMap(scalar_t t, const vector_t& x, const vector_t& u, const PreComputation&) {
-  vector_t f = A_ * x;
-  f.noalias() += B_ * u;
+vector_t LinearSystemDynamics::computeFlowMap(scalar_t t, const vector_t& x, const vector_t& u, const PreComputation& preComp) {
+  vector_t f;
+  computeFlowMap(t, x, u, preComp, f);
   return f;
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void LinearSystemDynamics::computeFlowMap(scalar_t t, const vector_t& x, const vector_t& u, const PreComputation&, vector_t& dxdt) {
+  dxdt.noalias() = A_ * x;
+  dxdt.noalias() += B_ * u;
+}
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
@@ -68,13 +76,21 @@ vector_t LinearSystemDynamics::computeJumpMap(scalar_t t, const vector_t& x, con
 /******************************************************************************************************/
 /******************************************************************************************************/
 VectorFunctionLinearApproximation LinearSystemDynamics::linearApproximation(scalar_t t, const vector_t& x, const vector_t& u,
-                                                                            const PreComputation&) {
+                                                                            const PreComputation& preComp) {
   VectorFunctionLinearApproximation approximation;
-  approximation.f = A_ * x;
+  linearApproximation(t, x, u, preComp, approximation);
+  return approximation;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void LinearSystemDynamics::linearApproximation(scalar_t t, const vector_t& x, const vector_t& u, const PreComputation&,
+                                               VectorFunctionLinearApproximation& approximation) {
+  approximation.f.noalias() = A_ * x;
   approximation.f.noalias() += B_ * u;
   approximation.dfdx = A_;
   approximation.dfdu = B_;
-  return approximation;
 }
 
 /******************************************************************************************************/
@@ -82,14 +82,14 @@ void SystemDynamicsBaseAD::initialize(size_t stateDim, size_t inputDim, const st
   guardSurfacesADInterfacePtr_.reset(
       new CppAdInterface(guardSurfaces, 1 + stateDim, getNumGuardSurfacesParameters(), modelName + "_guard_surfaces", modelFolder));
 
+  // The three libraries are independent and compiled concurrently
+  const CppAdInterface::model_list_t models{{flowMapADInterfacePtr_.get(), CppAdInterface::ApproximationOrder::First},
+                                            {jumpMapADInterfacePtr_.get(), CppAdInterface::ApproximationOrder::First},
+                                            {guardSurfacesADInterfacePtr_.get(), CppAdInterface::ApproximationOrder::First}};
   if (recompileLibraries) {
-    flowMapADInterfacePtr_->createModels(CppAdInterface::ApproximationOrder::First, verbose);
-    jumpMapADInterfacePtr_->createModels(CppAdInterface::ApproximationOrder::First, verbose);
-    guardSurfacesADInterfacePtr_->createModels(CppAdInterface::ApproximationOrder::First, verbose);
+    CppAdInterface::createModels(models, models.size(), verbose);
   } else {
-    flowMapADInterfacePtr_->loadModelsIfAvailable(CppAdInterface::ApproximationOrder::First, verbose);
-    jumpMapADInterfacePtr_->loadModelsIfAvailable(CppAdInterface::ApproximationOrder::First, verbose);
-    guardSurfacesADInterfacePtr_->loadModelsIfAvailable(CppAdInterface::ApproximationOrder::First, verbose);
+    CppAdInterface::loadModelsIfAvailable(models, models.size(), verbose);
   }
 }
 
@@ -125,15 +125,23 @@ vector_t SystemDynamicsBaseAD::computeGuardSurfaces(scalar_t t, const vector_t&
 /******************************************************************************************************/
 VectorFunctionLinearApproximation SystemDynamicsBaseAD::linearApproximation(scalar_t t, const vector_t& x, const vector_t& u,
                                                                             const PreComputation& preComputation) {
+  VectorFunctionLinearApproximation approximation;
+  linearApproximation(t, x, u, preComputation, approximation);
+  return approximation;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void SystemDynamicsBaseAD::linearApproximation(scalar_t t, const vector_t& x, const vector_t& u, const PreComputation& preComputation,
+                                               VectorFunctionLinearApproximation& approximation) {
   tapedTimeStateInput_ << t, x, u;
   const vector_t parameters = getFlowMapParameters(t, preComputation);
   flowJacobian_ = flowMapADInterfacePtr_->getJacobian(tapedTimeStateInput_, parameters);
 
-  VectorFunctionLinearApproximation approximation;
   approximation.dfdx = flowJacobian_.middleCols(1, x.rows());
   approximation.dfdu = flowJacobian_.rightCols(u.rows());
   approximation.f = flowMapADInterfacePtr_->getFunctionValue(tapedTimeStateInput_, parameters);
-  return approximation;
 }
 
 /******************************************************************************************************/
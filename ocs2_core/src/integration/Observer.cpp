@@ -37,6 +37,12 @@ namespace ocs2 {
 Observer::Observer(vector_array_t* stateTrajectoryPtr /*= nullptr*/, scalar_array_t* timeTrajectoryPtr /*= nullptr*/)
     : timeTrajectoryPtr_(timeTrajectoryPtr), stateTrajectoryPtr_(stateTrajectoryPtr) {}
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+Observer::Observer(ContiguousVectorArray* stateTrajectoryPtr, scalar_array_t* timeTrajectoryPtr)
+    : timeTrajectoryPtr_(timeTrajectoryPtr), stateTrajectoryPtr_(nullptr), contiguousStateTrajectoryPtr_(stateTrajectoryPtr) {}
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
@@ -45,6 +51,9 @@ void Observer::observe(const vector_t& state, scalar_t time) {
   if (stateTrajectoryPtr_ != nullptr) {
     stateTrajectoryPtr_->push_back(state);
   }
+  if (contiguousStateTrajectoryPtr_ != nullptr) {
+    contiguousStateTrajectoryPtr_->push_back(state);
+  }
   if (timeTrajectoryPtr_ != nullptr) {
     timeTrajectoryPtr_->push_back(time);
   }
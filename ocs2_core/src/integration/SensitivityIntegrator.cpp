@@ -35,17 +35,24 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 namespace ocs2 {
 
+namespace {
+// The in-place overloads of the discretizations
+using DiscretizationFunction = void (*)(SystemDynamicsBase&, scalar_t, const vector_t&, const vector_t&, scalar_t, vector_t&);
+using SensitivityDiscretizationFunction = void (*)(SystemDynamicsBase&, scalar_t, const vector_t&, const vector_t&, scalar_t,
+                                                   VectorFunctionLinearApproximation&);
+}  // unnamed namespace
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
 DynamicsDiscretizer selectDynamicsDiscretization(SensitivityIntegratorType integratorType) {
   switch (integratorType) {
     case SensitivityIntegratorType::EULER:
-      return eulerDiscretization;
+      return static_cast<DiscretizationFunction>(eulerDiscretization);
     case SensitivityIntegratorType::RK2:
-      return rk2Discretization;
+      return static_cast<DiscretizationFunction>(rk2Discretization);
     case SensitivityIntegratorType::RK4:
-      return rk4Discretization;
+      return static_cast<DiscretizationFunction>(rk4Discretization);
     default:
       throw std::runtime_error("Integrator of type " + sensitivity_integrator::toString(integratorType) + " not supported.");
   }
@@ -57,11 +64,11 @@ DynamicsDiscretizer selectDynamicsDiscretization(SensitivityIntegratorType integ
 DynamicsSensitivityDiscretizer selectDynamicsSensitivityDiscretization(SensitivityIntegratorType integratorType) {
   switch (integratorType) {
     case SensitivityIntegratorType::EULER:
-      return eulerSensitivityDiscretization;
+      return static_cast<SensitivityDiscretizationFunction>(eulerSensitivityDiscretization);
     case SensitivityIntegratorType::RK2:
-      return rk2SensitivityDiscretization;
+      return static_cast<SensitivityDiscretizationFunction>(rk2SensitivityDiscretization);
     case SensitivityIntegratorType::RK4:
-      return rk4SensitivityDiscretization;
+      return static_cast<SensitivityDiscretizationFunction>(rk4SensitivityDiscretization);
     default:
       throw std::runtime_error("Integrator of type " + sensitivity_integrator::toString(integratorType) + " not supported.");
   }
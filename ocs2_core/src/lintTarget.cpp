@@ -4,6 +4,7 @@
 
 // Automatic Differentation
 #include <ocs2_core/automatic_differentiation/CppAdInterface.h>
+#include <ocs2_core/automatic_differentiation/CppAdModelBatch.h>
 #include <ocs2_core/automatic_differentiation/CppAdSparsity.h>
 #include <ocs2_core/automatic_differentiation/FiniteDifferenceMethods.h>
 
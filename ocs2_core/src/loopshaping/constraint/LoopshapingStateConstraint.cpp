@@ -81,6 +81,14 @@ VectorFunctionLinearApproximation LoopshapingStateConstraint::getLinearApproxima
   return c;
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void LoopshapingStateConstraint::getLinearApproximation(scalar_t t, const vector_t& x, const PreComputation& preComp,
+                                                        VectorFunctionLinearApproximation& linearApproximation) const {
+  linearApproximation = getLinearApproximation(t, x, preComp);
+}
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
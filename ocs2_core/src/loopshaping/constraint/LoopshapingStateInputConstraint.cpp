@@ -52,4 +52,14 @@ vector_array_t LoopshapingStateInputConstraint::getValue(scalar_t t, const vecto
   return StateInputConstraintCollection::getValue(t, x_system, u_system, preComp_system);
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void LoopshapingStateInputConstraint::getLinearApproximation(scalar_t t, const vector_t& x, const vector_t& u,
+                                                             const PreComputation& preComp,
+                                                             VectorFunctionLinearApproximation& linearApproximation) const {
+  // the loop shaping patterns only provide the approximation by value
+  linearApproximation = getLinearApproximation(t, x, u, preComp);
+}
+
 }  // namespace ocs2
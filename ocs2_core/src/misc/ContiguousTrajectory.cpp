@@ -0,0 +1,124 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include "ocs2_core/misc/ContiguousTrajectory.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace ocs2 {
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+ContiguousVectorArray::ContiguousVectorArray(const vector_array_t& vectorArray) {
+  assign(vectorArray);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void ContiguousVectorArray::assign(const vector_array_t& vectorArray) {
+  const size_t dimension = vectorArray.empty() ? 0 : vectorArray.front().size();
+  resize(vectorArray.size(), dimension);
+  for (size_t i = 0; i < vectorArray.size(); ++i) {
+    if (static_cast<size_t>(vectorArray[i].size()) != dimension) {
+      throw std::runtime_error("[ContiguousVectorArray] All vectors should have the same dimension!");
+    }
+    data_.col(i) = vectorArray[i];
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+vector_array_t ContiguousVectorArray::toVectorArray() const {
+  vector_array_t vectorArray;
+  vectorArray.reserve(size_);
+  for (size_t i = 0; i < size_; ++i) {
+    vectorArray.emplace_back(data_.col(i));
+  }
+  return vectorArray;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void ContiguousVectorArray::resize(size_t size, size_t dimension) {
+  if (dimension != this->dimension()) {
+    data_.resize(dimension, std::max(size, capacity()));
+  } else if (size > capacity()) {
+    data_.conservativeResize(Eigen::NoChange, size);
+  }
+  size_ = size;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void ContiguousVectorArray::reserve(size_t capacity) {
+  if (capacity > this->capacity()) {
+    data_.conservativeResize(Eigen::NoChange, capacity);
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void ContiguousVectorArray::push_back(const vector_t& v) {
+  if (size_ == 0 && static_cast<size_t>(v.size()) != dimension()) {
+    data_.resize(v.size(), capacity());
+  } else if (static_cast<size_t>(v.size()) != dimension()) {
+    throw std::runtime_error("[ContiguousVectorArray] All vectors should have the same dimension!");
+  }
+  if (size_ == capacity()) {
+    reserve(std::max<size_t>(2 * capacity(), 1));
+  }
+  data_.col(size_++) = v;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+std::pair<size_t, size_t> ContiguousTrajectory::modeRange(size_t modeIndex) const {
+  assert(modeIndex < numModes());
+  const size_t begin = (modeIndex == 0) ? 0 : postEventIndices[modeIndex - 1];
+  const size_t end = (modeIndex < postEventIndices.size()) ? postEventIndices[modeIndex] : timeTrajectory.size();
+  return {begin, end};
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+size_t ContiguousTrajectory::modeIndex(size_t nodeIndex) const {
+  // the number of events whose post-event node is at or before the given node
+  return std::distance(postEventIndices.cbegin(), std::upper_bound(postEventIndices.cbegin(), postEventIndices.cend(), nodeIndex));
+}
+
+}  // namespace ocs2
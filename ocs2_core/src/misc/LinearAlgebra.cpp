@@ -32,6 +32,16 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 namespace ocs2 {
 namespace LinearAlgebra {
 
+namespace {
+/** Fills the projection terms from the LU decomposition of D, @see luConstraintProjection */
+void fillLuConstraintProjection(const Eigen::FullPivLU<matrix_t>& lu, const VectorFunctionLinearApproximation& constraint,
+                                VectorFunctionLinearApproximation& projectionTerms) {
+  projectionTerms.dfdu = lu.kernel();
+  projectionTerms.dfdx.noalias() = -lu.solve(constraint.dfdx);
+  projectionTerms.f.noalias() = -lu.solve(constraint.f);
+}
+}  // unnamed namespace
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
@@ -158,6 +168,16 @@ void computeConstraintProjection(const matrix_t& Dm, const matrix_t& RmInvUmUmT,
 /******************************************************************************************************/
 /******************************************************************************************************/
 std::pair<VectorFunctionLinearApproximation, matrix_t> qrConstraintProjection(const VectorFunctionLinearApproximation& constraint) {
+  std::pair<VectorFunctionLinearApproximation, matrix_t> result;
+  qrConstraintProjection(constraint, result.first, result.second);
+  return result;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void qrConstraintProjection(const VectorFunctionLinearApproximation& constraint, VectorFunctionLinearApproximation& projectionTerms,
+                            matrix_t& pseudoInverse) {
   // Constraint Projectors are based on the QR decomposition
   const auto numConstraints = constraint.dfdu.rows();
   const auto numInputs = constraint.dfdu.cols();
@@ -167,14 +187,11 @@ std::pair<VectorFunctionLinearApproximation, matrix_t> qrConstraintProjection(co
   const auto Q1 = Q.leftCols(numConstraints);
 
   const auto R = QRof_DT.matrixQR().topRows(numConstraints).triangularView<Eigen::Upper>();
-  const matrix_t pseudoInverse = R.solve(Q1.transpose());  // left pseudo-inverse of D^T
+  pseudoInverse = R.solve(Q1.transpose());  // left pseudo-inverse of D^T
 
-  VectorFunctionLinearApproximation projectionTerms;
   projectionTerms.dfdu = Q.rightCols(numInputs - numConstraints);
   projectionTerms.dfdx.noalias() = -pseudoInverse.transpose() * constraint.dfdx;
   projectionTerms.f.noalias() = -pseudoInverse.transpose() * constraint.f;
-
-  return std::make_pair(std::move(projectionTerms), std::move(pseudoInverse));
 }
 
 /******************************************************************************************************/
@@ -186,9 +203,7 @@ std::pair<VectorFunctionLinearApproximation, matrix_t> luConstraintProjection(co
   const Eigen::FullPivLU<matrix_t> lu(constraint.dfdu);
 
   VectorFunctionLinearApproximation projectionTerms;
-  projectionTerms.dfdu = lu.kernel();
-  projectionTerms.dfdx.noalias() = -lu.solve(constraint.dfdx);
-  projectionTerms.f.noalias() = -lu.solve(constraint.f);
+  fillLuConstraintProjection(lu, constraint, projectionTerms);
 
   matrix_t pseudoInverse;
   if (extractPseudoInverse) {
@@ -198,6 +213,15 @@ std::pair<VectorFunctionLinearApproximation, matrix_t> luConstraintProjection(co
   return std::make_pair(std::move(projectionTerms), std::move(pseudoInverse));
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void luConstraintProjection(const VectorFunctionLinearApproximation& constraint, VectorFunctionLinearApproximation& projectionTerms) {
+  // Constraint Projectors are based on the LU decomposition
+  const Eigen::FullPivLU<matrix_t> lu(constraint.dfdu);
+  fillLuConstraintProjection(lu, constraint, projectionTerms);
+}
+
 // Explicit instantiations for dynamic sized matrices
 template int rank(const matrix_t& A);
 template Eigen::VectorXcd eigenvalues(const matrix_t& A);
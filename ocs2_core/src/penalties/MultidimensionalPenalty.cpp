@@ -140,26 +140,9 @@ scalar_t MultidimensionalPenalty::getValue(scalar_t t, const vector_t& h, const
 ScalarFunctionQuadraticApproximation MultidimensionalPenalty::getQuadraticApproximation(scalar_t t,
                                                                                         const VectorFunctionLinearApproximation& h,
                                                                                         const vector_t* l) const {
-  const auto stateDim = h.dfdx.cols();
-  const auto inputDim = h.dfdu.cols();
-
-  scalar_t penaltyValue = 0.0;
-  vector_t penaltyDerivative, penaltySecondDerivative;
-  std::tie(penaltyValue, penaltyDerivative, penaltySecondDerivative) = getPenaltyValue1stDev2ndDev(t, h.f, l);
-  const matrix_t penaltySecondDev_dhdx = penaltySecondDerivative.asDiagonal() * h.dfdx;
-
   // to make sure that dfdux in the state-only case has a right size
-  ScalarFunctionQuadraticApproximation penaltyApproximation(stateDim, inputDim);
-
-  penaltyApproximation.f = penaltyValue;
-  penaltyApproximation.dfdx.noalias() = h.dfdx.transpose() * penaltyDerivative;
-  penaltyApproximation.dfdxx.noalias() = h.dfdx.transpose() * penaltySecondDev_dhdx;
-  if (inputDim > 0) {
-    penaltyApproximation.dfdu.noalias() = h.dfdu.transpose() * penaltyDerivative;
-    penaltyApproximation.dfdux.noalias() = h.dfdu.transpose() * penaltySecondDev_dhdx;
-    penaltyApproximation.dfduu.noalias() = h.dfdu.transpose() * penaltySecondDerivative.asDiagonal() * h.dfdu;
-  }
-
+  auto penaltyApproximation = ScalarFunctionQuadraticApproximation::Zero(h.dfdx.cols(), h.dfdu.cols());
+  addQuadraticApproximation(t, h, l, 1.0, penaltyApproximation);
   return penaltyApproximation;
 }
 
@@ -169,57 +152,81 @@ ScalarFunctionQuadraticApproximation MultidimensionalPenalty::getQuadraticApprox
 ScalarFunctionQuadraticApproximation MultidimensionalPenalty::getQuadraticApproximation(scalar_t t,
                                                                                         const VectorFunctionQuadraticApproximation& h,
                                                                                         const vector_t* l) const {
-  const auto stateDim = h.dfdx.cols();
-  const auto inputDim = h.dfdu.cols();
-  const auto numConstraints = h.f.rows();
+  // to make sure that dfdux in the state-only case has a right size
+  auto penaltyApproximation = ScalarFunctionQuadraticApproximation::Zero(h.dfdx.cols(), h.dfdu.cols());
+  addQuadraticApproximation(t, h, l, 1.0, penaltyApproximation);
+  return penaltyApproximation;
+}
 
-  scalar_t penaltyValue = 0.0;
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void MultidimensionalPenalty::addQuadraticApproximation(scalar_t t, const VectorFunctionLinearApproximation& h, const vector_t* l,
+                                                       scalar_t scaling, ScalarFunctionQuadraticApproximation& cost) const {
   vector_t penaltyDerivative, penaltySecondDerivative;
-  std::tie(penaltyValue, penaltyDerivative, penaltySecondDerivative) = getPenaltyValue1stDev2ndDev(t, h.f, l);
-  const matrix_t penaltySecondDev_dhdx = penaltySecondDerivative.asDiagonal() * h.dfdx;
+  cost.f += getPenaltyValue1stDev2ndDev(t, h.f, l, scaling, penaltyDerivative, penaltySecondDerivative);
+  addGaussNewtonApproximation(h.dfdx, h.dfdu, penaltyDerivative, penaltySecondDerivative, cost);
+}
 
-  // to make sure that dfdux in the state-only case has a right size
-  ScalarFunctionQuadraticApproximation penaltyApproximation(stateDim, inputDim);
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void MultidimensionalPenalty::addQuadraticApproximation(scalar_t t, const VectorFunctionQuadraticApproximation& h, const vector_t* l,
+                                                       scalar_t scaling, ScalarFunctionQuadraticApproximation& cost) const {
+  const auto numConstraints = h.f.rows();
+
+  vector_t penaltyDerivative, penaltySecondDerivative;
+  cost.f += getPenaltyValue1stDev2ndDev(t, h.f, l, scaling, penaltyDerivative, penaltySecondDerivative);
+  addGaussNewtonApproximation(h.dfdx, h.dfdu, penaltyDerivative, penaltySecondDerivative, cost);
 
-  penaltyApproximation.f = penaltyValue;
-  penaltyApproximation.dfdx.noalias() = h.dfdx.transpose() * penaltyDerivative;
-  penaltyApproximation.dfdxx.noalias() = h.dfdx.transpose() * penaltySecondDev_dhdx;
   for (size_t i = 0; i < numConstraints; i++) {
-    penaltyApproximation.dfdxx.noalias() += penaltyDerivative(i) * h.dfdxx[i];
+    cost.dfdxx.noalias() += penaltyDerivative(i) * h.dfdxx[i];
   }
-
-  if (inputDim > 0) {
-    penaltyApproximation.dfdu.noalias() = h.dfdu.transpose() * penaltyDerivative;
-    penaltyApproximation.dfdux.noalias() = h.dfdu.transpose() * penaltySecondDev_dhdx;
-    penaltyApproximation.dfduu.noalias() = h.dfdu.transpose() * penaltySecondDerivative.asDiagonal() * h.dfdu;
+  if (h.dfdu.cols() > 0 && cost.dfdu.size() > 0) {
     for (size_t i = 0; i < numConstraints; i++) {
-      penaltyApproximation.dfduu.noalias() += penaltyDerivative(i) * h.dfduu[i];
-      penaltyApproximation.dfdux.noalias() += penaltyDerivative(i) * h.dfdux[i];
+      cost.dfduu.noalias() += penaltyDerivative(i) * h.dfduu[i];
+      cost.dfdux.noalias() += penaltyDerivative(i) * h.dfdux[i];
     }
   }
+}
 
-  return penaltyApproximation;
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void MultidimensionalPenalty::addGaussNewtonApproximation(const matrix_t& dhdx, const matrix_t& dhdu, const vector_t& penaltyDerivative,
+                                                          const vector_t& penaltySecondDerivative,
+                                                          ScalarFunctionQuadraticApproximation& cost) {
+  const matrix_t penaltySecondDev_dhdx = penaltySecondDerivative.asDiagonal() * dhdx;
+  cost.dfdx.noalias() += dhdx.transpose() * penaltyDerivative;
+  cost.dfdxx.noalias() += dhdx.transpose() * penaltySecondDev_dhdx;
+
+  if (dhdu.cols() > 0 && cost.dfdu.size() > 0) {
+    const matrix_t penaltySecondDev_dhdu = penaltySecondDerivative.asDiagonal() * dhdu;
+    cost.dfdu.noalias() += dhdu.transpose() * penaltyDerivative;
+    cost.dfdux.noalias() += dhdu.transpose() * penaltySecondDev_dhdx;
+    cost.dfduu.noalias() += dhdu.transpose() * penaltySecondDev_dhdu;
+  }
 }
 
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
-std::tuple<scalar_t, vector_t, vector_t> MultidimensionalPenalty::getPenaltyValue1stDev2ndDev(scalar_t t, const vector_t& h,
-                                                                                              const vector_t* l) const {
+scalar_t MultidimensionalPenalty::getPenaltyValue1stDev2ndDev(scalar_t t, const vector_t& h, const vector_t* l, scalar_t scaling,
+                                                              vector_t& penaltyDerivative, vector_t& penaltySecondDerivative) const {
   const auto numConstraints = h.rows();
   assert(penaltyPtrArray_.size() == 1 || penaltyPtrArray_.size() == numConstraints);
 
   scalar_t penaltyValue = 0.0;
-  vector_t penaltyDerivative(numConstraints);
-  vector_t penaltySecondDerivative(numConstraints);
+  penaltyDerivative.resize(numConstraints);
+  penaltySecondDerivative.resize(numConstraints);
   for (size_t i = 0; i < numConstraints; i++) {
     const auto& penaltyTerm = (penaltyPtrArray_.size() == 1) ? penaltyPtrArray_[0] : penaltyPtrArray_[i];
     penaltyValue += penaltyTerm->getValue(t, getMultiplier(l, i), h(i));
-    penaltyDerivative(i) = penaltyTerm->getDerivative(t, getMultiplier(l, i), h(i));
-    penaltySecondDerivative(i) = penaltyTerm->getSecondDerivative(t, getMultiplier(l, i), h(i));
+    penaltyDerivative(i) = scaling * penaltyTerm->getDerivative(t, getMultiplier(l, i), h(i));
+    penaltySecondDerivative(i) = scaling * penaltyTerm->getSecondDerivative(t, getMultiplier(l, i), h(i));
   }  // end of i loop
 
-  return {penaltyValue, penaltyDerivative, penaltySecondDerivative};
+  return scaling * penaltyValue;
 }
 
 /******************************************************************************************************/
@@ -100,13 +100,22 @@ scalar_t StateInputSoftBoxConstraint::getValue(scalar_t time, const vector_t& st
 /******************************************************************************************************/
 ScalarFunctionQuadraticApproximation StateInputSoftBoxConstraint::getQuadraticApproximation(scalar_t time, const vector_t& state,
                                                                                             const vector_t& input,
-                                                                                            const TargetTrajectories&,
+                                                                                            const TargetTrajectories& targetTrajectories,
                                                                                             const PreComputation& preComp) const {
   auto cost = ScalarFunctionQuadraticApproximation::Zero(state.size(), input.size());
+  addQuadraticApproximation(time, state, input, targetTrajectories, preComp, cost);
+  return cost;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void StateInputSoftBoxConstraint::addQuadraticApproximation(scalar_t time, const vector_t& state, const vector_t& input,
+                                                            const TargetTrajectories&, const PreComputation&,
+                                                            ScalarFunctionQuadraticApproximation& cost) const {
   fillQuadraticApproximation(time, state, stateBoxConstraints_, cost.f, cost.dfdx, cost.dfdxx);
   fillQuadraticApproximation(time, input, inputBoxConstraints_, cost.f, cost.dfdu, cost.dfduu);
   cost.f += offset_;
-  return cost;
 }
 
 /******************************************************************************************************/
@@ -89,4 +89,22 @@ ScalarFunctionQuadraticApproximation StateInputSoftConstraint::getQuadraticAppro
   }
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void StateInputSoftConstraint::addQuadraticApproximation(scalar_t time, const vector_t& state, const vector_t& input,
+                                                         const TargetTrajectories&, const PreComputation& preComp,
+                                                         ScalarFunctionQuadraticApproximation& cost) const {
+  switch (constraintPtr_->getOrder()) {
+    case ConstraintOrder::Linear:
+      penalty_.addQuadraticApproximation(time, constraintPtr_->getLinearApproximation(time, state, input, preComp), nullptr, 1.0, cost);
+      break;
+    case ConstraintOrder::Quadratic:
+      penalty_.addQuadraticApproximation(time, constraintPtr_->getQuadraticApproximation(time, state, input, preComp), nullptr, 1.0, cost);
+      break;
+    default:
+      throw std::runtime_error("[StateInputSoftConstraint] Unknown constraint Order");
+  }
+}
+
 }  // namespace ocs2
@@ -88,4 +88,21 @@ ScalarFunctionQuadraticApproximation StateSoftConstraint::getQuadraticApproximat
   }
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void StateSoftConstraint::addQuadraticApproximation(scalar_t time, const vector_t& state, const TargetTrajectories&,
+                                                    const PreComputation& preComp, ScalarFunctionQuadraticApproximation& cost) const {
+  switch (constraintPtr_->getOrder()) {
+    case ConstraintOrder::Linear:
+      penalty_.addQuadraticApproximation(time, constraintPtr_->getLinearApproximation(time, state, preComp), nullptr, 1.0, cost);
+      break;
+    case ConstraintOrder::Quadratic:
+      penalty_.addQuadraticApproximation(time, constraintPtr_->getQuadraticApproximation(time, state, preComp), nullptr, 1.0, cost);
+      break;
+    default:
+      throw std::runtime_error("[StateSoftConstraint] Unknown constraint Order");
+  }
+}
+
 }  // namespace ocs2
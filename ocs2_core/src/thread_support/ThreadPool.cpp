@@ -30,12 +30,205 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ocs2_core/thread_support/SetThreadPriority.h>
 #include <ocs2_core/thread_support/ThreadPool.h>
 
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
 namespace ocs2 {
 
+namespace {
+// Number of idle polls before a worker (or a thread waiting for a parallel region) parks on a condition variable.
+constexpr int numSpinIterations = 1024;
+
+// The pool and the worker index of the calling thread, if it is a pool worker.
+thread_local const ThreadPool* currentPool = nullptr;
+thread_local int currentWorkerIndex = -1;
+}  // unnamed namespace
+
+/**
+ * Task deque owned by a worker. Aligned and padded to a cache line to avoid false sharing between the workers. Before C++17,
+ * new does not honor the over-alignment, therefore the queues are allocated with posix_memalign.
+ */
+struct alignas(64) ThreadPool::WorkerQueue {
+  std::deque<std::unique_ptr<TaskBase>> tasks;  // protected by lock
+  std::mutex lock;
+
+  static void* operator new(size_t size) {
+    void* ptr = nullptr;
+    if (posix_memalign(&ptr, alignof(WorkerQueue), size) != 0) {
+      throw std::bad_alloc();
+    }
+    return ptr;
+  }
+  static void operator delete(void* ptr) { std::free(ptr); }
+};
+
+/**
+ * Shared state of a parallel region. The instances are claimed through an atomic counter.
+ */
+struct ThreadPool::ParallelRegion {
+  ParallelRegion(std::function<void(int, int)> bodyArg, int numInstancesArg)
+      : body(std::move(bodyArg)), numInstances(numInstancesArg) {}
+
+  /** Claims and runs instances until none is left. */
+  void execute(int workerIndex) {
+    int instance;
+    while ((instance = nextInstance++) < numInstances) {
+      executeInstance(instance, workerIndex);
+    }
+  }
+
+  /** Runs the given instance and signals the completion of the region. */
+  void executeInstance(int instance, int workerIndex) {
+    try {
+      body(instance, workerIndex);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(completionLock);
+      if (!exception) {
+        exception = std::current_exception();
+      }
+    }
+
+    if (++numCompletedInstances == numInstances) {
+      std::lock_guard<std::mutex> lock(completionLock);
+      completionCondition.notify_one();
+    }
+  }
+
+  /** Spins and then blocks until all instances are completed. */
+  void wait() {
+    for (int i = 0; i < numSpinIterations && numCompletedInstances < numInstances; ++i) {
+      std::this_thread::yield();
+    }
+    std::unique_lock<std::mutex> lock(completionLock);
+    completionCondition.wait(lock, [this] { return numCompletedInstances == numInstances; });
+  }
+
+  const std::function<void(int, int)> body;
+  const int numInstances;
+  std::atomic_int nextInstance{0};
+  std::atomic_int numCompletedInstances{0};
+  std::exception_ptr exception;  // protected by completionLock
+  std::condition_variable completionCondition;
+  std::mutex completionLock;
+};
+
+/**
+ * Helper task of a parallel region. It keeps the region alive since it may start after the region is completed.
+ * The task either claims instances dynamically or runs a single preassigned instance.
+ */
+struct ThreadPool::ParallelRegionTask final : public ThreadPool::TaskBase {
+  explicit ParallelRegionTask(std::shared_ptr<ParallelRegion> regionPtr, int instanceArg = -1)
+      : region(std::move(regionPtr)), instance(instanceArg) {}
+  ~ParallelRegionTask() override = default;
+  void operator()(int workerIndex) override {
+    if (instance < 0) {
+      region->execute(workerIndex);
+    } else {
+      region->executeInstance(instance, workerIndex);
+    }
+  }
+
+  std::shared_ptr<ParallelRegion> region;
+  const int instance;
+};
+
+/**
+ * Shared state of a gang. The number of joined helpers and the closed flag are packed in a single atomic, such that a helper either
+ * joins before the gang is closed or not at all.
+ */
+struct ThreadPool::Gang {
+  explicit Gang(std::function<void(int, int)> taskArg) : task(std::move(taskArg)) {}
+
+  /** Joins the gang and returns the instance index, or -1 if the gang is already closed. */
+  int join() {
+    int state = joinState.load();
+    while ((state & closedFlag) == 0) {
+      if (joinState.compare_exchange_weak(state, state + 1)) {
+        return state + 1;  // the instance 0 is the calling thread
+      }
+    }
+    return -1;
+  }
+
+  /** Closes the gang and publishes its size. */
+  void close() {
+    size.store((joinState.fetch_or(closedFlag) & ~closedFlag) + 1, std::memory_order_release);
+  }
+
+  /** Waits until the gang is closed and returns its size. */
+  int waitForSize() const {
+    int gangSize;
+    while ((gangSize = size.load(std::memory_order_acquire)) == 0) {
+      std::this_thread::yield();
+    }
+    return gangSize;
+  }
+
+  /** Runs the given instance and signals the completion of a helper. */
+  void execute(int instance, int gangSize) {
+    try {
+      task(instance, gangSize);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(completionLock);
+      if (!exception) {
+        exception = std::current_exception();
+      }
+    }
+
+    if (instance != 0 && ++numCompletedHelpers == gangSize - 1) {
+      std::lock_guard<std::mutex> lock(completionLock);
+      completionCondition.notify_one();
+    }
+  }
+
+  /** Spins and then blocks until all the helpers of the closed gang are completed. */
+  void wait(int gangSize) {
+    for (int i = 0; i < numSpinIterations && numCompletedHelpers < gangSize - 1; ++i) {
+      std::this_thread::yield();
+    }
+    std::unique_lock<std::mutex> lock(completionLock);
+    completionCondition.wait(lock, [&] { return numCompletedHelpers == gangSize - 1; });
+  }
+
+  static constexpr int closedFlag = 1 << 30;
+
+  const std::function<void(int, int)> task;
+  std::atomic_int joinState{0};
+  std::atomic_int size{0};  // 0 until the gang is closed
+  std::atomic_int numCompletedHelpers{0};
+  std::exception_ptr exception;  // protected by completionLock
+  std::condition_variable completionCondition;
+  std::mutex completionLock;
+};
+
+constexpr int ThreadPool::Gang::closedFlag;
+
+/**
+ * Helper task of a gang. It keeps the gang alive since it may start after the gang is completed.
+ */
+struct ThreadPool::GangTask final : public ThreadPool::TaskBase {
+  explicit GangTask(std::shared_ptr<Gang> gangPtr) : gang(std::move(gangPtr)) {}
+  ~GangTask() override = default;
+  void operator()(int) override {
+    const int instance = gang->join();
+    if (instance > 0) {
+      gang->execute(instance, gang->waitForSize());
+    }
+  }
+
+  std::shared_ptr<Gang> gang;
+};
+
 /**************************************************************************************************/
 /**************************************************************************************************/
 /**************************************************************************************************/
 ThreadPool::ThreadPool(size_t nThreads, int priority) {
+  workerQueues_.reserve(nThreads);
+  for (size_t i = 0; i < nThreads; i++) {
+    workerQueues_.emplace_back(new WorkerQueue);
+  }
+
   workerThreads_.reserve(nThreads);
   for (size_t i = 0; i < nThreads; i++) {
     workerThreads_.emplace_back(&ThreadPool::worker, this, i);
@@ -48,10 +241,10 @@ ThreadPool::ThreadPool(size_t nThreads, int priority) {
 /**************************************************************************************************/
 ThreadPool::~ThreadPool() {
   {  // set exit flag, wake up threads and join
-    std::lock_guard<std::mutex> lock(taskQueueLock_);
+    std::lock_guard<std::mutex> lock(parkLock_);
     stop_ = true;
   }
-  taskQueueCondition_.notify_all();
+  parkCondition_.notify_all();
   for (auto& thread : workerThreads_) {
     if (thread.joinable()) {
       thread.join();
@@ -63,26 +256,31 @@ ThreadPool::~ThreadPool() {
 /**************************************************************************************************/
 /**************************************************************************************************/
 void ThreadPool::worker(int workerIndex) {
-  while (true) {
-    std::unique_ptr<ThreadPool::TaskBase> taskPtr;
-    {
-      std::unique_lock<std::mutex> lock(taskQueueLock_);
-      taskQueueCondition_.wait(lock, [this] { return !taskQueue_.empty() || stop_; });
-
-      // exit condition
-      if (stop_) {
-        break;
-      }
+  currentPool = this;
+  currentWorkerIndex = workerIndex;
 
-      // pop the first task
-      if (!taskQueue_.empty()) {
-        taskPtr = std::move(taskQueue_.front());
-        taskQueue_.pop();
-      }
+  int numIdlePolls = 0;
+  while (true) {
+    // exit condition
+    if (stop_) {
+      break;
     }
 
+    auto taskPtr = popTask(workerIndex);
     if (taskPtr) {
       taskPtr->operator()(workerIndex);
+      numIdlePolls = 0;
+
+    } else if (numIdlePolls < numSpinIterations) {
+      ++numIdlePolls;
+      std::this_thread::yield();
+
+    } else {
+      std::unique_lock<std::mutex> lock(parkLock_);
+      ++numParkedWorkers_;
+      parkCondition_.wait(lock, [this] { return numPendingTasks_ > 0 || stop_; });
+      --numParkedWorkers_;
+      numIdlePolls = 0;
     }
   }
 }
@@ -90,36 +288,209 @@ void ThreadPool::worker(int workerIndex) {
 /**************************************************************************************************/
 /**************************************************************************************************/
 /**************************************************************************************************/
-void ThreadPool::runTask(std::unique_ptr<TaskBase> taskPtr) {
+void ThreadPool::pushTask(size_t queueIndex, std::unique_ptr<TaskBase> taskPtr) {
+  auto& queue = *workerQueues_[queueIndex];
   {
-    std::lock_guard<std::mutex> lock(taskQueueLock_);
-    taskQueue_.push(std::move(taskPtr));
+    std::lock_guard<std::mutex> lock(queue.lock);
+    queue.tasks.push_back(std::move(taskPtr));
   }
-  taskQueueCondition_.notify_one();
+  // must be incremented before numParkedWorkers_ is read in notifyWorkers
+  ++numPendingTasks_;
 }
 
 /**************************************************************************************************/
 /**************************************************************************************************/
 /**************************************************************************************************/
-void ThreadPool::runParallel(std::function<void(int)> taskFunction, int N) {
-  // Launch tasks in helper threads
-  std::vector<std::future<void>> futures;
-  if (N > 1) {
-    const int numHelpers = N - 1;
-    futures.reserve(numHelpers);
-    for (int i = 0; i < numHelpers; ++i) {
-      futures.emplace_back(run(taskFunction));
+std::unique_ptr<ThreadPool::TaskBase> ThreadPool::popTask(int workerIndex) {
+  std::unique_ptr<TaskBase> taskPtr;
+  if (numPendingTasks_ <= 0) {
+    return taskPtr;
+  }
+
+  // own deque: newest first
+  {
+    auto& queue = *workerQueues_[workerIndex];
+    std::lock_guard<std::mutex> lock(queue.lock);
+    if (!queue.tasks.empty()) {
+      taskPtr = std::move(queue.tasks.back());
+      queue.tasks.pop_back();
     }
   }
 
-  // Execute one instance in this thread.
+  // steal: oldest first
+  const size_t numQueues = workerQueues_.size();
+  for (size_t i = 1; i < numQueues && !taskPtr; ++i) {
+    auto& queue = *workerQueues_[(workerIndex + i) % numQueues];
+    std::lock_guard<std::mutex> lock(queue.lock);
+    if (!queue.tasks.empty()) {
+      taskPtr = std::move(queue.tasks.front());
+      queue.tasks.pop_front();
+    }
+  }
+
+  if (taskPtr) {
+    --numPendingTasks_;
+  }
+  return taskPtr;
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+void ThreadPool::notifyWorkers(bool all) {
+  if (numParkedWorkers_ > 0) {
+    // acquiring the lock guarantees that a worker which has missed the new task is already waiting
+    { std::lock_guard<std::mutex> lock(parkLock_); }
+    if (all) {
+      parkCondition_.notify_all();
+    } else {
+      parkCondition_.notify_one();
+    }
+  }
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+void ThreadPool::runTask(std::unique_ptr<TaskBase> taskPtr) {
+  const size_t queueIndex =
+      (currentPool == this) ? static_cast<size_t>(currentWorkerIndex) : nextQueueIndex_++ % workerQueues_.size();
+  pushTask(queueIndex, std::move(taskPtr));
+  notifyWorkers(false);
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+void ThreadPool::runParallelRegion(std::function<void(int, int)> body, int numInstances) {
   const auto workerId = static_cast<int>(numThreads());  // threadpool workers use ID 0 -> nThreads - 1
-  taskFunction(workerId);
 
-  // Wait for helpers to finish.
-  for (auto&& fut : futures) {
-    fut.get();
+  // Simple case: a single instance or no worker threads
+  if (numInstances <= 1 || workerThreads_.empty()) {
+    for (int i = 0; i < numInstances; ++i) {
+      body(i, workerId);
+    }
+    return;
+  }
+
+  auto region = std::make_shared<ParallelRegion>(std::move(body), numInstances);
+
+  // Launch one helper per worker deque
+  const int numHelpers = std::min(numInstances - 1, static_cast<int>(numThreads()));
+  const size_t firstQueueIndex = nextQueueIndex_.fetch_add(numHelpers);
+  for (int i = 0; i < numHelpers; ++i) {
+    pushTask((firstQueueIndex + i) % workerQueues_.size(), std::unique_ptr<TaskBase>(new ParallelRegionTask(region)));
+  }
+  notifyWorkers(numHelpers > 1);
+
+  // Execute instances in this thread and wait for the helpers to finish the claimed ones.
+  region->execute(workerId);
+  region->wait();
+
+  if (region->exception) {
+    std::rethrow_exception(region->exception);
+  }
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+void ThreadPool::runParallel(std::function<void(int)> taskFunction, int N) {
+  runParallelRegion([&taskFunction](int, int workerIndex) { taskFunction(workerIndex); }, std::max(N, 1));
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+void ThreadPool::runParallelPartitioned(std::function<void(int)> partitionTask, int numPartitions) {
+  // Simple case: a single partition or no worker threads
+  if (numPartitions <= 1 || workerThreads_.empty()) {
+    for (int p = 0; p < numPartitions; ++p) {
+      partitionTask(p);
+    }
+    return;
+  }
+
+  auto region = std::make_shared<ParallelRegion>([&partitionTask](int p, int) { partitionTask(p); }, numPartitions);
+
+  // Partition p goes to the deque of worker p, the last one is run by this thread.
+  const int lastPartition = numPartitions - 1;
+  for (int p = 0; p < lastPartition; ++p) {
+    pushTask(p % workerQueues_.size(), std::unique_ptr<TaskBase>(new ParallelRegionTask(region, p)));
+  }
+  notifyWorkers(lastPartition > 1);
+
+  region->executeInstance(lastPartition, static_cast<int>(numThreads()));
+  region->wait();
+
+  if (region->exception) {
+    std::rethrow_exception(region->exception);
+  }
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+int ThreadPool::runGang(std::function<void(int, int)> gangTask, int maxGangSize, std::chrono::microseconds maxJoinTime) {
+  // A worker of this pool cannot be a helper of its own gang
+  const int numAvailableThreads = static_cast<int>(numThreads()) - (currentPool == this ? 1 : 0);
+
+  // Simple case: a single instance or no worker threads
+  if (maxGangSize <= 1 || numAvailableThreads <= 0) {
+    gangTask(0, 1);
+    return 1;
   }
+
+  auto gang = std::make_shared<Gang>(std::move(gangTask));
+
+  // Launch one helper per worker deque. The deque of the calling worker is skipped.
+  const int numHelpers = std::min(maxGangSize - 1, numAvailableThreads);
+  size_t queueIndex = nextQueueIndex_.fetch_add(numHelpers);
+  for (int i = 0; i < numHelpers; ++queueIndex) {
+    queueIndex %= workerQueues_.size();
+    if (currentPool != this || queueIndex != static_cast<size_t>(currentWorkerIndex)) {
+      pushTask(queueIndex, std::unique_ptr<TaskBase>(new GangTask(gang)));
+      ++i;
+    }
+  }
+  notifyWorkers(numHelpers > 1);
+
+  // Wait for the helpers to join. With a finite maxJoinTime, the helpers which cannot start in time are not waited for.
+  const bool hasDeadline = maxJoinTime != std::chrono::microseconds::max();
+  const auto deadline = hasDeadline ? std::chrono::steady_clock::now() + maxJoinTime : std::chrono::steady_clock::time_point::max();
+  while (gang->joinState.load() < numHelpers && (!hasDeadline || std::chrono::steady_clock::now() < deadline)) {
+    std::this_thread::yield();
+  }
+  gang->close();
+
+  const int gangSize = gang->size.load();
+  gang->execute(0, gangSize);
+  gang->wait(gangSize);
+
+  if (gang->exception) {
+    std::rethrow_exception(gang->exception);
+  }
+  return gangSize;
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+void ThreadPool::parallelFor(int begin, int end, int grain, const std::function<void(int, int)>& taskFunction) {
+  if (end <= begin) {
+    return;
+  }
+  grain = std::max(grain, 1);
+  const int numChunks = (end - begin + grain - 1) / grain;
+
+  auto chunkFunction = [&](int chunk, int workerIndex) {
+    const int first = begin + chunk * grain;
+    const int last = std::min(first + grain, end);
+    for (int i = first; i < last; ++i) {
+      taskFunction(i, workerIndex);
+    }
+  };
+  runParallelRegion(chunkFunction, numChunks);
 }
 
 }  // namespace ocs2
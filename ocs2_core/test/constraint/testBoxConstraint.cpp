@@ -0,0 +1,94 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+
+#include <gtest/gtest.h>
+
+#include <ocs2_core/constraint/BoxConstraintCollection.h>
+
+using namespace ocs2;
+
+TEST(TestBoxConstraint, invalidBounds) {
+  EXPECT_THROW(BoxConstraint({0, 1}, vector_t::Zero(1), vector_t::Ones(2)), std::runtime_error);
+  EXPECT_THROW(BoxConstraint({0}, vector_t::Ones(1), vector_t::Zero(1)), std::runtime_error);
+  EXPECT_THROW(BoxConstraint({-1}, vector_t::Zero(1), vector_t::Ones(1)), std::runtime_error);
+  EXPECT_THROW(BoxConstraint({0}, vector_t::Zero(1), vector_t::Ones(1), 0.0, 1.0), std::runtime_error);
+  EXPECT_THROW(BoxConstraint({1, 0, 1}, vector_t::Zero(3), vector_t::Ones(3)), std::runtime_error);
+}
+
+TEST(TestBoxConstraint, duplicateIndices) {
+  BoxConstraintCollection boxConstraints;
+  boxConstraints.add("first", std::make_unique<BoxConstraint>(std::vector<int>{2, 0}, vector_t::Constant(2, -1.0), vector_t::Ones(2)));
+  auto getSecondTerm = []() { return std::make_unique<BoxConstraint>(std::vector<int>{1, 0}, vector_t::Zero(2), vector_t::Ones(2)); };
+  EXPECT_THROW(boxConstraints.add("second", getSecondTerm()), std::runtime_error);
+  EXPECT_EQ(boxConstraints.getNumConstraints(0.0), 2);
+
+  // Soft and hard terms share the same indices
+  auto softTerm = std::make_unique<BoxConstraint>(std::vector<int>{2}, vector_t::Zero(1), vector_t::Ones(1), 1.0, 0.0);
+  EXPECT_THROW(boxConstraints.add("soft", std::move(softTerm)), std::runtime_error);
+
+  // The index is free again once the term is erased
+  ASSERT_TRUE(boxConstraints.erase("first"));
+  EXPECT_NO_THROW(boxConstraints.add("second", getSecondTerm()));
+}
+
+TEST(TestBoxConstraint, stackedBounds) {
+  BoxConstraintCollection boxConstraints;
+  boxConstraints.add("hard", std::make_unique<BoxConstraint>(std::vector<int>{2, 0}, vector_t::Constant(2, -1.0), vector_t::Ones(2)));
+  boxConstraints.add("soft", std::make_unique<BoxConstraint>(std::vector<int>{3}, vector_t::Constant(1, -2.0), vector_t::Constant(1, 2.0),
+                                                             10.0, 1.0));
+  EXPECT_EQ(boxConstraints.getNumConstraints(0.0), 3);
+  EXPECT_EQ(boxConstraints.getNumSoftConstraints(0.0), 1);
+
+  const auto bounds = boxConstraints.getBounds(0.0);
+  EXPECT_EQ(bounds.indices, std::vector<int>({2, 0, 3}));
+  EXPECT_EQ(bounds.softIndices, std::vector<int>({2}));
+  EXPECT_TRUE(bounds.lowerBound.isApprox((vector_t(3) << -1.0, -1.0, -2.0).finished()));
+  EXPECT_TRUE(bounds.upperBound.isApprox((vector_t(3) << 1.0, 1.0, 2.0).finished()));
+  EXPECT_DOUBLE_EQ(bounds.slackQuadraticPenalty[0], 10.0);
+  EXPECT_DOUBLE_EQ(bounds.slackLinearPenalty[0], 1.0);
+
+  // Clone keeps the terms
+  std::unique_ptr<BoxConstraintCollection> clonedPtr(boxConstraints.clone());
+  EXPECT_EQ(clonedPtr->getNumConstraints(0.0), 3);
+}
+
+TEST(TestBoxConstraint, valueAndPenalty) {
+  BoxConstraintCollection boxConstraints;
+  boxConstraints.add("hard", std::make_unique<BoxConstraint>(std::vector<int>{0}, vector_t::Constant(1, -1.0), vector_t::Ones(1)));
+  boxConstraints.add("soft", std::make_unique<BoxConstraint>(std::vector<int>{1}, vector_t::Constant(1, -1.0), vector_t::Ones(1), 2.0, 3.0));
+  const auto bounds = boxConstraints.getBounds(0.0);
+
+  const vector_t v = (vector_t(2) << 0.5, 1.5).finished();
+  const vector_t expectedValue = (vector_t(2) << 1.5, 0.5).finished();
+  EXPECT_TRUE(getHardBoxConstraintValue(bounds, v).isApprox(expectedValue));
+
+  // violation of 0.5 of the soft upper bound
+  EXPECT_DOUBLE_EQ(getSoftBoxConstraintPenalty(bounds, v), 0.5 * 2.0 * 0.25 + 3.0 * 0.5);
+}
@@ -1,3 +1,5 @@
+#include <memory>
+
 #include <gtest/gtest.h>
 
 #include <ocs2_core/control/LinearController.h>
@@ -24,3 +26,27 @@ TEST(testLinearController, testSerialization) {
     EXPECT_TRUE(controller.biasArray_[k].isApprox(controllerOut.biasArray_[k], 1e-6));
   }
 }
+
+TEST(testLinearController, fixedSizeKernel) {
+  constexpr int nx = 4;
+  constexpr int nu = 2;
+  // The last segment changes the input dimension and is evaluated by the dynamic-size kernel
+  scalar_array_t time = {0.0, 0.5, 1.0, 1.5};
+  vector_array_t bias = {vector_t::Random(nu), vector_t::Random(nu), vector_t::Random(nu), vector_t::Random(nu + 1)};
+  matrix_array_t gain = {matrix_t::Random(nu, nx), matrix_t::Random(nu, nx), matrix_t::Random(nu, nx), matrix_t::Random(nu + 1, nx)};
+  LinearController dynamicSizeController(time, bias, gain);
+  LinearController fixedSizeController(time, bias, gain);
+  fixedSizeController.useFixedSizeKernel<nx, nu>();
+
+  // The kernel is kept by copies
+  LinearController copiedController(fixedSizeController);
+  std::unique_ptr<LinearController> clonedController(fixedSizeController.clone());
+
+  for (scalar_t t : {-0.1, 0.0, 0.2, 0.5, 0.9, 1.2, 1.5, 2.0}) {
+    const vector_t x = vector_t::Random(nx);
+    const vector_t uExpected = dynamicSizeController.computeInput(t, x);
+    EXPECT_TRUE(fixedSizeController.computeInput(t, x).isApprox(uExpected)) << "t = " << t;
+    EXPECT_TRUE(copiedController.computeInput(t, x).isApprox(uExpected)) << "t = " << t;
+    EXPECT_TRUE(clonedController->computeInput(t, x).isApprox(uExpected)) << "t = " << t;
+  }
+}
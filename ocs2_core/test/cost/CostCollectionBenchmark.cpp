@@ -0,0 +1,131 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <ocs2_core/constraint/LinearStateInputConstraint.h>
+#include <ocs2_core/cost/QuadraticStateCost.h>
+#include <ocs2_core/cost/QuadraticStateInputCost.h>
+#include <ocs2_core/cost/StateCostCollection.h>
+#include <ocs2_core/cost/StateInputCostCollection.h>
+#include <ocs2_core/penalties/penalties/RelaxedBarrierPenalty.h>
+#include <ocs2_core/soft_constraint/StateInputSoftConstraint.h>
+#include <ocs2_core/test/AllocationCounter.h>
+
+namespace {
+
+using namespace ocs2;
+
+/** The cost of a single node of a legged-robot-sized problem with many cost terms. */
+struct ManyTermsCost {
+  static constexpr int stateDim = 24;
+  static constexpr int inputDim = 12;
+  static constexpr int numConstraints = 4;
+
+  ManyTermsCost() : state(vector_t::Random(stateDim)), input(vector_t::Random(inputDim)) {
+    for (int i = 0; i < 30; i++) {
+      matrix_t Q = matrix_t::Random(stateDim, stateDim);
+      matrix_t R = matrix_t::Random(inputDim, inputDim);
+      auto costPtr = std::make_unique<QuadraticStateInputCost>(Q * Q.transpose(), R * R.transpose(), matrix_t::Random(inputDim, stateDim));
+      stateInputTerms.push_back(costPtr.get());
+      stateInputCosts.add("quadratic_" + std::to_string(i), std::move(costPtr));
+    }
+    for (int i = 0; i < 10; i++) {
+      auto constraintPtr = std::make_unique<LinearStateInputConstraint>(
+          vector_t::Random(numConstraints), matrix_t::Random(numConstraints, stateDim), matrix_t::Random(numConstraints, inputDim));
+      auto penaltyPtr = std::make_unique<RelaxedBarrierPenalty>(RelaxedBarrierPenalty::Config(0.1, 1e-3));
+      auto costPtr = std::make_unique<StateInputSoftConstraint>(std::move(constraintPtr), std::move(penaltyPtr));
+      stateInputTerms.push_back(costPtr.get());
+      stateInputCosts.add("soft_" + std::to_string(i), std::move(costPtr));
+    }
+    for (int i = 0; i < 10; i++) {
+      matrix_t Q = matrix_t::Random(stateDim, stateDim);
+      auto costPtr = std::make_unique<QuadraticStateCost>(Q * Q.transpose());
+      stateTerms.push_back(costPtr.get());
+      stateCosts.add("state_" + std::to_string(i), std::move(costPtr));
+    }
+  }
+
+  StateInputCostCollection stateInputCosts;
+  StateCostCollection stateCosts;
+  std::vector<const StateInputCost*> stateInputTerms;
+  std::vector<const StateCost*> stateTerms;
+
+  const TargetTrajectories targetTrajectories{{0.0}, {vector_t::Zero(stateDim)}, {vector_t::Zero(inputDim)}};
+  const PreComputation preComp;
+  const vector_t state;
+  const vector_t input;
+};
+
+/** Every term returns its own approximation which is then summed up. */
+void getAndAccumulate(benchmark::State& state) {
+  const ManyTermsCost problem;
+  ScalarFunctionQuadraticApproximation cost;
+  const AllocationCounter allocationCounter;
+  for (auto _ : state) {
+    cost = ScalarFunctionQuadraticApproximation::Zero(problem.stateDim, problem.inputDim);
+    for (const auto* termPtr : problem.stateInputTerms) {
+      cost += termPtr->getQuadraticApproximation(0.0, problem.state, problem.input, problem.targetTrajectories, problem.preComp);
+    }
+    for (const auto* termPtr : problem.stateTerms) {
+      const auto stateCost = termPtr->getQuadraticApproximation(0.0, problem.state, problem.targetTrajectories, problem.preComp);
+      cost.f += stateCost.f;
+      cost.dfdx += stateCost.dfdx;
+      cost.dfdxx += stateCost.dfdxx;
+    }
+    benchmark::DoNotOptimize(cost.f);
+  }
+  state.counters["allocations"] = benchmark::Counter(allocationCounter.count(), benchmark::Counter::kAvgIterations);
+}
+
+/** Every term adds its approximation into the same output. */
+void addQuadraticApproximation(benchmark::State& state) {
+  const ManyTermsCost problem;
+  auto cost = ScalarFunctionQuadraticApproximation::Zero(problem.stateDim, problem.inputDim);
+  const AllocationCounter allocationCounter;
+  for (auto _ : state) {
+    cost.setZero(problem.stateDim, problem.inputDim);
+    problem.stateInputCosts.addQuadraticApproximation(0.0, problem.state, problem.input, problem.targetTrajectories, problem.preComp,
+                                                      cost);
+    problem.stateCosts.addQuadraticApproximation(0.0, problem.state, problem.targetTrajectories, problem.preComp, cost);
+    benchmark::DoNotOptimize(cost.f);
+  }
+  state.counters["allocations"] = benchmark::Counter(allocationCounter.count(), benchmark::Counter::kAvgIterations);
+}
+
+}  // unnamed namespace
+
+BENCHMARK(getAndAccumulate);
+BENCHMARK(addQuadraticApproximation);
+
+BENCHMARK_MAIN();
@@ -117,6 +117,31 @@ TEST_F(StateInputCost_TestFixture, getStateInputCostApproximation) {
   EXPECT_TRUE((cost.dfdux.array() == 0.0).all());
 }
 
+TEST_F(StateInputCost_TestFixture, addStateInputCostApproximation) {
+  // accumulate on top of an existing approximation
+  auto cost = expectedCostApproximation;
+  costCollection.addQuadraticApproximation(t, x, u, targetTrajectories, {}, cost);
+  EXPECT_NEAR(cost.f, 2.0 * expectedCost, 1e-6);
+  EXPECT_TRUE(cost.dfdx.isApprox(2.0 * expectedCostApproximation.dfdx));
+  EXPECT_TRUE(cost.dfdu.isApprox(2.0 * expectedCostApproximation.dfdu));
+  EXPECT_TRUE(cost.dfdxx.isApprox(2.0 * expectedCostApproximation.dfdxx));
+  EXPECT_TRUE(cost.dfduu.isApprox(2.0 * expectedCostApproximation.dfduu));
+  EXPECT_TRUE((cost.dfdux.array() == 0.0).all());
+
+  // inactive terms are skipped
+  auto& cost1 = costCollection.get<SimpleQuadraticCost>("Simple quadratic cost");
+  auto& cost2 = costCollection.get<SimpleQuadraticCost>("Another simple quadratic cost");
+  cost1.active_ = false;
+  const auto expected = cost2.getQuadraticApproximation(t, x, u, targetTrajectories, {});
+  cost.setZero(STATE_DIM, INPUT_DIM);
+  costCollection.addQuadraticApproximation(t, x, u, targetTrajectories, {}, cost);
+  EXPECT_NEAR(cost.f, expected.f, 1e-6);
+  EXPECT_TRUE(cost.dfdx.isApprox(expected.dfdx));
+  EXPECT_TRUE(cost.dfdu.isApprox(expected.dfdu));
+  EXPECT_TRUE(cost.dfdxx.isApprox(expected.dfdxx));
+  EXPECT_TRUE(cost.dfduu.isApprox(expected.dfduu));
+}
+
 TEST_F(StateInputCost_TestFixture, canGetCostFunction) {
   const auto& costFunction = costCollection.get("Simple quadratic cost");
 }
@@ -220,3 +245,16 @@ TEST_F(StateCost_TestFixture, testStateCostApproximation) {
   EXPECT_TRUE(cost.dfdx.isApprox(expectedCostApproximation.dfdx));
   EXPECT_TRUE(cost.dfdxx.isApprox(expectedCostApproximation.dfdxx));
 }
+
+TEST_F(StateCost_TestFixture, addStateCostApproximation) {
+  // a state cost only touches the state part of a state-input approximation
+  ocs2::ScalarFunctionQuadraticApproximation cost;
+  cost.setZero(STATE_DIM, INPUT_DIM);
+  cost.dfdu.setOnes();
+  costCollection.addQuadraticApproximation(t, x, targetTrajectories, {}, cost);
+  EXPECT_NEAR(cost.f, expectedCost, 1e-6);
+  EXPECT_TRUE(cost.dfdx.isApprox(expectedCostApproximation.dfdx));
+  EXPECT_TRUE(cost.dfdxx.isApprox(expectedCostApproximation.dfdxx));
+  EXPECT_TRUE((cost.dfdu.array() == 1.0).all());
+  EXPECT_TRUE((cost.dfduu.array() == 0.0).all());
+}
@@ -1,9 +1,13 @@
 
 
+#include <sys/stat.h>
+
 #include <gtest/gtest.h>
 
 #include "commonFixture.h"
 
+#include <ocs2_core/automatic_differentiation/CppAdModelBatch.h>
+
 using namespace ocs2;
 
 class CppAdInterfaceNoParameterFixture : public CommonCppAdNoParameterFixture {};
@@ -60,3 +64,118 @@ TEST_F(CppAdInterfaceParameterizedFixture, loadIfAvailable) {
   ASSERT_TRUE(gnApproximation.dfdx.isApprox(testJacobian(x, p).transpose() * testFun(x, p)));
   ASSERT_TRUE(gnApproximation.dfdxx.isApprox(testJacobian(x, p).transpose() * testJacobian(x, p)));
 }
+
+TEST_F(CppAdInterfaceParameterizedFixture, recompileIfModified) {
+  const std::string modelName = "testModelRecompileIfModified";
+  auto scaledFunImpl = [](const ad_vector_t& x, const ad_vector_t& p, ad_vector_t& y) {
+    funImpl(x, p, y);
+    y *= ad_scalar_t(2.0);
+  };
+  auto getLibraryInode = [&]() {
+    struct stat libraryStat;
+    stat(("/tmp/ocs2/" + modelName + "/cppad_generated/" + modelName + "_lib.so").c_str(), &libraryStat);
+    return libraryStat.st_ino;
+  };
+  const vector_t x = vector_t::Random(variableDim_);
+  const vector_t p = vector_t::Random(parameterDim_);
+
+  ocs2::CppAdInterface adInterface(funImpl, variableDim_, parameterDim_, modelName);
+  adInterface.createModels(ocs2::CppAdInterface::ApproximationOrder::First, false);
+  ASSERT_TRUE(adInterface.getFunctionValue(x, p).isApprox(testFun(x, p)));
+
+  // Same name, different function: the library on disk is stale
+  ocs2::CppAdInterface modifiedAdInterface(scaledFunImpl, variableDim_, parameterDim_, modelName);
+  modifiedAdInterface.loadModelsIfAvailable(ocs2::CppAdInterface::ApproximationOrder::First, false);
+  ASSERT_TRUE(modifiedAdInterface.getFunctionValue(x, p).isApprox(2.0 * testFun(x, p)));
+  ASSERT_TRUE(modifiedAdInterface.getJacobian(x, p).isApprox(2.0 * testJacobian(x, p)));
+
+  // Same function: the library is reused without compilation
+  const auto libraryInode = getLibraryInode();
+  ocs2::CppAdInterface reloadedAdInterface(scaledFunImpl, variableDim_, parameterDim_, modelName);
+  reloadedAdInterface.loadModelsIfAvailable(ocs2::CppAdInterface::ApproximationOrder::First, false);
+  ASSERT_EQ(getLibraryInode(), libraryInode);
+  ASSERT_TRUE(reloadedAdInterface.getFunctionValue(x, p).isApprox(2.0 * testFun(x, p)));
+
+  // Same function, different approximation order: the library is stale
+  reloadedAdInterface.loadModelsIfAvailable(ocs2::CppAdInterface::ApproximationOrder::Second, false);
+  ASSERT_NE(getLibraryInode(), libraryInode);
+  ASSERT_TRUE(reloadedAdInterface.getHessian(0, x, p).isApprox(2.0 * testHessian(0, x, p)));
+}
+
+TEST_F(CppAdInterfaceParameterizedFixture, loadIfAvailableConcurrently) {
+  constexpr size_t numModels = 3;
+  std::vector<std::unique_ptr<ocs2::CppAdInterface>> adInterfaces;
+  ocs2::CppAdInterface::model_list_t models;
+  for (size_t i = 0; i < numModels; i++) {
+    auto scaledFunImpl = [i](const ad_vector_t& x, const ad_vector_t& p, ad_vector_t& y) {
+      funImpl(x, p, y);
+      y *= static_cast<ad_scalar_t>(i + 1);
+    };
+    const std::string modelName = "testModelConcurrent" + std::to_string(i);
+    adInterfaces.emplace_back(new ocs2::CppAdInterface(scaledFunImpl, variableDim_, parameterDim_, modelName));
+    models.emplace_back(adInterfaces.back().get(), ocs2::CppAdInterface::ApproximationOrder::Second);
+  }
+
+  const vector_t x = vector_t::Random(variableDim_);
+  const vector_t p = vector_t::Random(parameterDim_);
+  auto checkModels = [&]() {
+    for (size_t i = 0; i < numModels; i++) {
+      const scalar_t scaling = i + 1;
+      ASSERT_TRUE(adInterfaces[i]->getFunctionValue(x, p).isApprox(scaling * testFun(x, p)));
+      ASSERT_TRUE(adInterfaces[i]->getJacobian(x, p).isApprox(scaling * testJacobian(x, p)));
+      ASSERT_TRUE(adInterfaces[i]->getHessian(1, x, p).isApprox(scaling * testHessian(1, x, p)));
+    }
+  };
+
+  // cold start
+  ocs2::CppAdInterface::createModels(models, numModels, true);
+  checkModels();
+
+  // warm start
+  ocs2::CppAdInterface::loadModelsIfAvailable(models, numModels, true);
+  checkModels();
+}
+
+TEST_F(CppAdInterfaceParameterizedFixture, modelBatch) {
+  constexpr size_t numModels = 3;
+  const vector_t x = vector_t::Random(variableDim_);
+  const vector_t p = vector_t::Random(parameterDim_);
+
+  std::vector<std::unique_ptr<ocs2::CppAdInterface>> adInterfaces;
+  ocs2::CppAdModelBatch modelBatch(numModels);
+  for (size_t i = 0; i < numModels + 1; i++) {
+    auto scaledFunImpl = [i](const ad_vector_t& x, const ad_vector_t& p, ad_vector_t& y) {
+      funImpl(x, p, y);
+      y *= static_cast<ad_scalar_t>(i + 1);
+    };
+    const std::string modelName = "testModelBatch" + std::to_string(i);
+    adInterfaces.emplace_back(new ocs2::CppAdInterface(scaledFunImpl, variableDim_, parameterDim_, modelName));
+    // The models are only collected, as done by the CppAd terms during construction
+    if (i % 2 == 0) {
+      adInterfaces.back()->createModels(ocs2::CppAdInterface::ApproximationOrder::Second, false);
+    } else {
+      adInterfaces.back()->loadModelsIfAvailable(ocs2::CppAdInterface::ApproximationOrder::Second, false);
+    }
+  }
+  ASSERT_EQ(modelBatch.getNumPendingModels(), numModels + 1);
+
+  // A pending model cannot be copied, and a destroyed one is dropped from the batch
+  ASSERT_THROW(ocs2::CppAdInterface copiedAdInterface(*adInterfaces.back()), std::runtime_error);
+  adInterfaces.pop_back();
+  ASSERT_EQ(modelBatch.getNumPendingModels(), numModels);
+
+  modelBatch.prepare();
+  ASSERT_EQ(modelBatch.getNumPendingModels(), 0);
+  for (size_t i = 0; i < numModels; i++) {
+    const scalar_t scaling = i + 1;
+    ASSERT_TRUE(adInterfaces[i]->getFunctionValue(x, p).isApprox(scaling * testFun(x, p)));
+    ASSERT_TRUE(adInterfaces[i]->getJacobian(x, p).isApprox(scaling * testJacobian(x, p)));
+    ASSERT_TRUE(adInterfaces[i]->getHessian(1, x, p).isApprox(scaling * testHessian(1, x, p)));
+  }
+
+  // After prepare(), the batch is inactive and models are prepared immediately
+  ocs2::CppAdInterface adInterface(funImpl, variableDim_, parameterDim_, "testModelBatchInactive");
+  adInterface.createModels(ocs2::CppAdInterface::ApproximationOrder::First, false);
+  ASSERT_EQ(modelBatch.getNumPendingModels(), 0);
+  ASSERT_TRUE(adInterface.getFunctionValue(x, p).isApprox(testFun(x, p)));
+}
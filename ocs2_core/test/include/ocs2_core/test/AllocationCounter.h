@@ -0,0 +1,105 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+/*
+ * Counts the heap allocations of a test or benchmark executable by interposing the allocation functions of glibc. All allocations of
+ * the executable, including those of Eigen and operator new, go through these functions.
+ *
+ * This header defines malloc, calloc, and realloc. It must therefore be included in exactly one source file of a dedicated executable,
+ * which only contains the allocation tests or benchmarks, and never in a library.
+ */
+
+namespace ocs2 {
+namespace allocation_counter {
+
+/** Whether the allocations are currently counted. */
+inline std::atomic_bool& isCounting() {
+  static std::atomic_bool counting{false};
+  return counting;
+}
+
+/** The number of allocations since counting was enabled. */
+inline std::atomic_size_t& numAllocations() {
+  static std::atomic_size_t count{0};
+  return count;
+}
+
+inline void recordAllocation() {
+  if (isCounting()) {
+    ++numAllocations();
+  }
+}
+
+}  // namespace allocation_counter
+
+/**
+ * Counts the heap allocations of all threads during its lifetime. The scopes of two counters must not overlap.
+ */
+class AllocationCounter {
+ public:
+  AllocationCounter() {
+    allocation_counter::numAllocations() = 0;
+    allocation_counter::isCounting() = true;
+  }
+  ~AllocationCounter() { allocation_counter::isCounting() = false; }
+
+  AllocationCounter(const AllocationCounter&) = delete;
+  AllocationCounter& operator=(const AllocationCounter&) = delete;
+
+  /** The number of allocations since the construction of this counter. */
+  size_t count() const { return allocation_counter::numAllocations(); }
+};
+
+}  // namespace ocs2
+
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t num, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+
+void* malloc(size_t size) {
+  ocs2::allocation_counter::recordAllocation();
+  return __libc_malloc(size);
+}
+
+void* calloc(size_t num, size_t size) {
+  ocs2::allocation_counter::recordAllocation();
+  return __libc_calloc(num, size);
+}
+
+void* realloc(void* ptr, size_t size) {
+  ocs2::allocation_counter::recordAllocation();
+  return __libc_realloc(ptr, size);
+}
+}
@@ -79,9 +79,11 @@ TEST(test_sensitivity_integrator, eulerSensitivity) {
     return discreteApproximation;
   }();
 
-  const auto eulerForwardDynamics = eulerDiscretization(*system, t, x, u, dt);
+  ocs2::vector_t eulerForwardDynamics;
+  eulerDiscretization(*system, t, x, u, dt, eulerForwardDynamics);
   ASSERT_TRUE(eulerForwardDynamics.isApprox(eulerdynamics_check.f));
-  const auto eulerLinearizedDynamics = eulerSensitivityDiscretization(*system, t, x, u, dt);
+  ocs2::VectorFunctionLinearApproximation eulerLinearizedDynamics;
+  eulerSensitivityDiscretization(*system, t, x, u, dt, eulerLinearizedDynamics);
   ASSERT_TRUE(eulerLinearizedDynamics.f.isApprox(eulerdynamics_check.f));
   ASSERT_TRUE(eulerLinearizedDynamics.dfdx.isApprox(eulerdynamics_check.dfdx));
   ASSERT_TRUE(eulerLinearizedDynamics.dfdu.isApprox(eulerdynamics_check.dfdu));
@@ -123,9 +125,11 @@ TEST(test_sensitivity_integrator, rk2Sensitivity) {
     return discreteApproximation;
   }();
 
-  const auto rk2ForwardDynamics = rk2Discretization(*system, t, x, u, dt);
+  ocs2::vector_t rk2ForwardDynamics;
+  rk2Discretization(*system, t, x, u, dt, rk2ForwardDynamics);
   ASSERT_TRUE(rk2ForwardDynamics.isApprox(rk2dynamics_check.f));
-  const auto rk2LinearizedDynamics = rk2SensitivityDiscretization(*system, t, x, u, dt);
+  ocs2::VectorFunctionLinearApproximation rk2LinearizedDynamics;
+  rk2SensitivityDiscretization(*system, t, x, u, dt, rk2LinearizedDynamics);
   ASSERT_TRUE(rk2LinearizedDynamics.f.isApprox(rk2dynamics_check.f));
   ASSERT_TRUE(rk2LinearizedDynamics.dfdx.isApprox(rk2dynamics_check.dfdx));
   ASSERT_TRUE(rk2LinearizedDynamics.dfdu.isApprox(rk2dynamics_check.dfdu));
@@ -176,9 +180,11 @@ TEST(test_sensitivity_integrator, rk4Sensitivity) {
     return discreteApproximation;
   }();
 
-  const auto rk4ForwardDynamics = rk4Discretization(*system, t, x, u, dt);
+  ocs2::vector_t rk4ForwardDynamics;
+  rk4Discretization(*system, t, x, u, dt, rk4ForwardDynamics);
   ASSERT_TRUE(rk4ForwardDynamics.isApprox(rk4dynamics_check.f));
-  const auto rk4LinearizedDynamics = rk4SensitivityDiscretization(*system, t, x, u, dt);
+  ocs2::VectorFunctionLinearApproximation rk4LinearizedDynamics;
+  rk4SensitivityDiscretization(*system, t, x, u, dt, rk4LinearizedDynamics);
   ASSERT_TRUE(rk4LinearizedDynamics.f.isApprox(rk4dynamics_check.f));
   ASSERT_TRUE(rk4LinearizedDynamics.dfdx.isApprox(rk4dynamics_check.dfdx));
   ASSERT_TRUE(rk4LinearizedDynamics.dfdu.isApprox(rk4dynamics_check.dfdu));
@@ -205,7 +211,8 @@ TEST(test_sensitivity_integrator, vsBoostRK4) {
   // This version
   auto type = ocs2::SensitivityIntegratorType::RK4;
   auto rk4Discretization = ocs2::selectDynamicsDiscretization(type);
-  const auto rk4ForwardDynamics = rk4Discretization(*system, t, x, u, dt);
+  ocs2::vector_t rk4ForwardDynamics;
+  rk4Discretization(*system, t, x, u, dt, rk4ForwardDynamics);
 
   // Check
   ASSERT_TRUE(rk4ForwardDynamics.isApprox(boostRk4ForwardDynamics));
@@ -0,0 +1,79 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <ocs2_core/misc/LinearInterpolation.h>
+
+namespace {
+
+/** MPC policy of 1000 nodes evaluated by a 1 kHz loop with four integrator substeps per cycle. */
+struct MonotoneQueries {
+  MonotoneQueries() : timeArray(1000) {
+    for (size_t i = 0; i < timeArray.size(); ++i) {
+      timeArray[i] = 1e-3 * i;
+    }
+    for (double time = 0.0; time < timeArray.back(); time += 2.5e-4) {
+      queries.push_back(time);
+    }
+  }
+
+  std::vector<double> timeArray;
+  std::vector<double> queries;
+};
+
+void timeSegmentBinarySearch(benchmark::State& state) {
+  const MonotoneQueries data;
+  for (auto _ : state) {
+    for (const auto time : data.queries) {
+      benchmark::DoNotOptimize(ocs2::LinearInterpolation::timeSegment(time, data.timeArray));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * data.queries.size());
+}
+
+void timeSegmentHint(benchmark::State& state) {
+  const MonotoneQueries data;
+  for (auto _ : state) {
+    ocs2::LinearInterpolation::TimeSegmentHint hint;
+    for (const auto time : data.queries) {
+      benchmark::DoNotOptimize(ocs2::LinearInterpolation::timeSegment(time, data.timeArray, hint));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * data.queries.size());
+}
+
+}  // unnamed namespace
+
+BENCHMARK(timeSegmentBinarySearch);
+BENCHMARK(timeSegmentHint);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <ocs2_core/misc/ContiguousTrajectory.h>
+#include <ocs2_core/misc/LinearInterpolation.h>
+
+using namespace ocs2;
+
+TEST(testContiguousTrajectory, conversion) {
+  constexpr size_t dimension = 3;
+  vector_array_t vectorArray(5);
+  for (auto& v : vectorArray) {
+    v.setRandom(dimension);
+  }
+
+  const ContiguousVectorArray contiguousArray(vectorArray);
+  ASSERT_EQ(contiguousArray.size(), vectorArray.size());
+  ASSERT_EQ(contiguousArray.dimension(), dimension);
+  for (size_t i = 0; i < vectorArray.size(); ++i) {
+    EXPECT_TRUE(contiguousArray[i].isApprox(vectorArray[i]));
+  }
+
+  const auto convertedArray = contiguousArray.toVectorArray();
+  ASSERT_EQ(convertedArray.size(), vectorArray.size());
+  for (size_t i = 0; i < vectorArray.size(); ++i) {
+    EXPECT_TRUE(convertedArray[i].isApprox(vectorArray[i]));
+  }
+
+  vectorArray.back().setRandom(dimension + 1);
+  EXPECT_THROW(ContiguousVectorArray{vectorArray}, std::runtime_error);
+}
+
+TEST(testContiguousTrajectory, memoryReuse) {
+  ContiguousVectorArray contiguousArray;
+  for (size_t i = 0; i < 10; ++i) {
+    contiguousArray.push_back(vector_t::Constant(2, i));
+  }
+  ASSERT_EQ(contiguousArray.size(), 10);
+  ASSERT_GE(contiguousArray.capacity(), 10);
+  EXPECT_DOUBLE_EQ(contiguousArray.back()(1), 9.0);
+  EXPECT_THROW(contiguousArray.push_back(vector_t::Zero(3)), std::runtime_error);
+
+  // clearing and resizing within the capacity keeps the storage
+  const scalar_t* storage = contiguousArray.data().data();
+  contiguousArray.clear();
+  contiguousArray.resize(8, 2);
+  EXPECT_EQ(contiguousArray.data().data(), storage);
+  EXPECT_EQ(contiguousArray.size(), 8);
+
+  contiguousArray.assign(vector_array_t(5, vector_t::Ones(2)));
+  EXPECT_EQ(contiguousArray.data().data(), storage);
+  EXPECT_EQ(contiguousArray.size(), 5);
+  EXPECT_DOUBLE_EQ(contiguousArray.back()(0), 1.0);
+}
+
+TEST(testContiguousTrajectory, interpolation) {
+  const scalar_array_t timeArray{0.0, 1.0, 2.0, 2.0, 3.0};
+  vector_array_t vectorArray;
+  for (const auto t : timeArray) {
+    vectorArray.push_back(vector_t::Constant(4, t));
+  }
+  const ContiguousVectorArray contiguousArray(vectorArray);
+
+  for (const scalar_t t : {-1.0, 0.0, 0.3, 1.0, 1.5, 2.0, 2.5, 3.0, 4.0}) {
+    const vector_t expected = LinearInterpolation::interpolate(t, timeArray, vectorArray);
+    const vector_t result = LinearInterpolation::interpolate(t, timeArray, contiguousArray);
+    EXPECT_TRUE(result.isApprox(expected)) << "time: " << t;
+  }
+
+  // single node
+  const ContiguousVectorArray singleNode(vector_array_t{vector_t::Ones(4)});
+  EXPECT_TRUE(LinearInterpolation::interpolate(0.5, scalar_array_t{0.0}, singleNode).isApprox(vector_t::Ones(4)));
+}
+
+TEST(testContiguousTrajectory, modeIndex) {
+  ContiguousTrajectory trajectory;
+  trajectory.timeTrajectory = {0.0, 0.5, 1.0, 1.0, 1.5, 2.0, 2.0, 2.5};
+  trajectory.postEventIndices = {3, 6};
+  ASSERT_EQ(trajectory.numModes(), 3);
+
+  EXPECT_EQ(trajectory.modeRange(0).first, 0);
+  EXPECT_EQ(trajectory.modeRange(0).second, 3);
+  EXPECT_EQ(trajectory.modeRange(1).first, 3);
+  EXPECT_EQ(trajectory.modeRange(1).second, 6);
+  EXPECT_EQ(trajectory.modeRange(2).first, 6);
+  EXPECT_EQ(trajectory.modeRange(2).second, 8);
+
+  const std::vector<size_t> expectedModes{0, 0, 0, 1, 1, 1, 2, 2};
+  for (size_t i = 0; i < trajectory.timeTrajectory.size(); ++i) {
+    EXPECT_EQ(trajectory.modeIndex(i), expectedModes[i]);
+  }
+}
@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <iostream>
+#include <random>
 
 #include <ocs2_core/misc/LinearInterpolation.h>
 #include <Eigen/Dense>
@@ -132,3 +134,43 @@ TEST(testLinearInterpolation, testDifferentEigenSizes) {
   result = ocs2::LinearInterpolation::interpolate(1.1, times, data);
   EXPECT_TRUE(result.isApprox(data[1]));
 }
+
+TEST(testLinearInterpolation, testTimeSegmentHint) {
+  // Time array with events (repeated times) and a short interval
+  std::vector<double> t = {0.0, 0.1, 0.2, 0.2, 0.3, 0.3 + 1e-14, 0.4, 0.5, 0.5, 0.6};
+
+  auto checkQueries = [&](const std::vector<double>& queries) {
+    ocs2::LinearInterpolation::TimeSegmentHint hint;
+    for (const auto time : queries) {
+      const auto expected = ocs2::LinearInterpolation::timeSegment(time, t);
+      const auto result = ocs2::LinearInterpolation::timeSegment(time, t, hint);
+      ASSERT_EQ(result.first, expected.first) << "time: " << time;
+      ASSERT_DOUBLE_EQ(result.second, expected.second) << "time: " << time;
+    }
+  };
+
+  // Monotone increasing queries including the time stamps and extrapolation
+  std::vector<double> queries;
+  for (double time = -0.1; time < 0.7; time += 1e-3) {
+    queries.push_back(time);
+  }
+  queries.insert(queries.end(), t.begin(), t.end());
+  std::sort(queries.begin(), queries.end());
+  checkQueries(queries);
+
+  // Monotone decreasing queries
+  std::reverse(queries.begin(), queries.end());
+  checkQueries(queries);
+
+  // Random queries
+  std::mt19937 generator(0);
+  std::shuffle(queries.begin(), queries.end(), generator);
+  checkQueries(queries);
+
+  // The hint is only a guess, reusing it with a different time array is allowed
+  ocs2::LinearInterpolation::TimeSegmentHint hint;
+  ocs2::LinearInterpolation::timeSegment(0.55, t, hint);
+  const std::vector<double> shorterTime = {0.0, 1.0};
+  EXPECT_EQ(ocs2::LinearInterpolation::timeSegment(0.5, shorterTime, hint).first, 0);
+  EXPECT_DOUBLE_EQ(ocs2::LinearInterpolation::timeSegment(0.5, shorterTime, hint).second, 0.5);
+}
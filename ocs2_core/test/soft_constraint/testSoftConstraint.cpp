@@ -29,9 +29,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <gtest/gtest.h>
 
+#include <ocs2_core/augmented_lagrangian/AugmentedLagrangian.h>
 #include <ocs2_core/penalties/Penalties.h>
 #include <ocs2_core/soft_constraint/StateInputSoftConstraint.h>
 #include <ocs2_core/soft_constraint/StateSoftConstraint.h>
+#include <ocs2_core/test/testTools.h>
 
 /******************************************************************************************************/
 /******************************************************************************************************/
@@ -225,3 +227,210 @@ TEST(testSoftConstraint, checkActivityStateInputConstraint) {
   softConstraint->get<ActivityTestStateInputConstraint>().setActivity(false);
   EXPECT_FALSE(std::unique_ptr<ocs2::StateInputCost>(softConstraint->clone())->isActive(0.0));
 }
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+namespace {
+
+ocs2::VectorFunctionQuadraticApproximation getRandomConstraintApproximation(size_t numConstraints, int stateDim, int inputDim = -1) {
+  auto h = ocs2::VectorFunctionQuadraticApproximation::Zero(numConstraints, stateDim, inputDim);
+  h.f.setRandom();
+  h.dfdx.setRandom();
+  h.dfdu.setRandom();
+  for (size_t i = 0; i < numConstraints; i++) {
+    h.dfdxx[i].setRandom();
+    h.dfdxx[i] = (h.dfdxx[i] + h.dfdxx[i].transpose()).eval();
+    h.dfduu[i].setRandom();
+    h.dfduu[i] = (h.dfduu[i] + h.dfduu[i].transpose()).eval();
+    h.dfdux[i].setRandom();
+  }
+  return h;
+}
+
+ocs2::VectorFunctionLinearApproximation getLinearPart(const ocs2::VectorFunctionQuadraticApproximation& h) {
+  ocs2::VectorFunctionLinearApproximation linearApproximation;
+  linearApproximation.f = h.f;
+  linearApproximation.dfdx = h.dfdx;
+  linearApproximation.dfdu = h.dfdu;
+  return linearApproximation;
+}
+
+ocs2::ScalarFunctionQuadraticApproximation getRandomCostApproximation(int stateDim, int inputDim) {
+  auto cost = ocs2::ScalarFunctionQuadraticApproximation::Zero(stateDim, inputDim);
+  cost.f = 1.0;
+  cost.dfdx.setRandom();
+  cost.dfdu.setRandom();
+  cost.dfdxx.setRandom();
+  cost.dfduu.setRandom();
+  cost.dfdux.setRandom();
+  return cost;
+}
+
+/** A state constraint which returns a fixed approximation. */
+class FixedStateConstraint final : public ocs2::StateConstraint {
+ public:
+  FixedStateConstraint(ocs2::ConstraintOrder constraintOrder, ocs2::VectorFunctionQuadraticApproximation h)
+      : StateConstraint(constraintOrder), h_(std::move(h)) {}
+  ~FixedStateConstraint() override = default;
+  FixedStateConstraint* clone() const override { return new FixedStateConstraint(*this); }
+
+  size_t getNumConstraints(ocs2::scalar_t time) const override { return h_.f.size(); }
+  ocs2::vector_t getValue(ocs2::scalar_t time, const ocs2::vector_t& state, const ocs2::PreComputation&) const override { return h_.f; }
+  ocs2::VectorFunctionLinearApproximation getLinearApproximation(ocs2::scalar_t time, const ocs2::vector_t& state,
+                                                                 const ocs2::PreComputation&) const override {
+    return getLinearPart(h_);
+  }
+  ocs2::VectorFunctionQuadraticApproximation getQuadraticApproximation(ocs2::scalar_t time, const ocs2::vector_t& state,
+                                                                       const ocs2::PreComputation&) const override {
+    return h_;
+  }
+
+ private:
+  ocs2::VectorFunctionQuadraticApproximation h_;
+};
+
+/** A state-input constraint which returns a fixed approximation. */
+class FixedStateInputConstraint final : public ocs2::StateInputConstraint {
+ public:
+  FixedStateInputConstraint(ocs2::ConstraintOrder constraintOrder, ocs2::VectorFunctionQuadraticApproximation h)
+      : StateInputConstraint(constraintOrder), h_(std::move(h)) {}
+  ~FixedStateInputConstraint() override = default;
+  FixedStateInputConstraint* clone() const override { return new FixedStateInputConstraint(*this); }
+
+  size_t getNumConstraints(ocs2::scalar_t time) const override { return h_.f.size(); }
+  ocs2::vector_t getValue(ocs2::scalar_t time, const ocs2::vector_t& state, const ocs2::vector_t& input,
+                          const ocs2::PreComputation&) const override {
+    return h_.f;
+  }
+  ocs2::VectorFunctionLinearApproximation getLinearApproximation(ocs2::scalar_t time, const ocs2::vector_t& state,
+                                                                 const ocs2::vector_t& input, const ocs2::PreComputation&) const override {
+    return getLinearPart(h_);
+  }
+  ocs2::VectorFunctionQuadraticApproximation getQuadraticApproximation(ocs2::scalar_t time, const ocs2::vector_t& state,
+                                                                       const ocs2::vector_t& input,
+                                                                       const ocs2::PreComputation&) const override {
+    return h_;
+  }
+
+ private:
+  ocs2::VectorFunctionQuadraticApproximation h_;
+};
+
+}  // unnamed namespace
+
+TEST(testSoftConstraint, addStateInputApproximation) {
+  constexpr size_t numConstraints = 5;
+  constexpr int stateDim = 4;
+  constexpr int inputDim = 3;
+  const ocs2::vector_t state = ocs2::vector_t::Random(stateDim);
+  const ocs2::vector_t input = ocs2::vector_t::Random(inputDim);
+  const ocs2::TargetTrajectories targetTrajectories;
+  const ocs2::PreComputation preComp;
+  const auto h = getRandomConstraintApproximation(numConstraints, stateDim, inputDim);
+
+  for (const auto order : {ocs2::ConstraintOrder::Linear, ocs2::ConstraintOrder::Quadratic}) {
+    auto penaltyPtr = std::make_unique<ocs2::RelaxedBarrierPenalty>(ocs2::RelaxedBarrierPenalty::Config{10.0, 1.0});
+    const ocs2::StateInputSoftConstraint softConstraint(std::make_unique<FixedStateInputConstraint>(order, h), std::move(penaltyPtr));
+
+    const auto initialCost = getRandomCostApproximation(stateDim, inputDim);
+    auto expected = softConstraint.getQuadraticApproximation(0.0, state, input, targetTrajectories, preComp);
+    expected += initialCost;
+
+    auto cost = initialCost;
+    softConstraint.addQuadraticApproximation(0.0, state, input, targetTrajectories, preComp, cost);
+    EXPECT_TRUE(ocs2::isApprox(cost, expected));
+  }
+}
+
+TEST(testSoftConstraint, addStateApproximation) {
+  constexpr size_t numConstraints = 5;
+  constexpr int stateDim = 4;
+  constexpr int inputDim = 3;
+  const ocs2::vector_t state = ocs2::vector_t::Random(stateDim);
+  const ocs2::TargetTrajectories targetTrajectories;
+  const ocs2::PreComputation preComp;
+  const auto h = getRandomConstraintApproximation(numConstraints, stateDim);
+
+  for (const auto order : {ocs2::ConstraintOrder::Linear, ocs2::ConstraintOrder::Quadratic}) {
+    auto penaltyPtr = std::make_unique<ocs2::RelaxedBarrierPenalty>(ocs2::RelaxedBarrierPenalty::Config{10.0, 1.0});
+    const ocs2::StateSoftConstraint softConstraint(std::make_unique<FixedStateConstraint>(order, h), std::move(penaltyPtr));
+    const auto stateApproximation = softConstraint.getQuadraticApproximation(0.0, state, targetTrajectories, preComp);
+
+    // state-only approximation
+    auto stateCost = getRandomCostApproximation(stateDim, 0);
+    auto expected = stateCost;
+    expected.f += stateApproximation.f;
+    expected.dfdx += stateApproximation.dfdx;
+    expected.dfdxx += stateApproximation.dfdxx;
+    softConstraint.addQuadraticApproximation(0.0, state, targetTrajectories, preComp, stateCost);
+    EXPECT_TRUE(ocs2::isApprox(stateCost, expected));
+
+    // the state term is added into a state-input approximation without touching the input derivatives
+    auto cost = getRandomCostApproximation(stateDim, inputDim);
+    expected = cost;
+    expected.f += stateApproximation.f;
+    expected.dfdx += stateApproximation.dfdx;
+    expected.dfdxx += stateApproximation.dfdxx;
+    softConstraint.addQuadraticApproximation(0.0, state, targetTrajectories, preComp, cost);
+    EXPECT_TRUE(ocs2::isApprox(cost, expected));
+  }
+}
+
+TEST(testAugmentedLagrangian, addStateInputApproximation) {
+  constexpr size_t numConstraints = 5;
+  constexpr int stateDim = 4;
+  constexpr int inputDim = 3;
+  const ocs2::vector_t state = ocs2::vector_t::Random(stateDim);
+  const ocs2::vector_t input = ocs2::vector_t::Random(inputDim);
+  const ocs2::PreComputation preComp;
+  const auto h = getRandomConstraintApproximation(numConstraints, stateDim, inputDim);
+  const ocs2::Multiplier multiplier{3.7, ocs2::vector_t::Random(numConstraints).cwiseAbs()};
+
+  for (const auto order : {ocs2::ConstraintOrder::Linear, ocs2::ConstraintOrder::Quadratic}) {
+    auto penaltyPtr = ocs2::augmented::SlacknessSquaredHingePenalty::create({10.0, 1.0});
+    const auto augmentedLagrangian = ocs2::create(std::make_unique<FixedStateInputConstraint>(order, h), std::move(penaltyPtr));
+
+    const auto initialCost = getRandomCostApproximation(stateDim, inputDim);
+    auto expected = augmentedLagrangian->getQuadraticApproximation(0.0, state, input, multiplier, preComp);
+    expected += initialCost;
+
+    auto cost = initialCost;
+    augmentedLagrangian->addQuadraticApproximation(0.0, state, input, multiplier, preComp, cost);
+    EXPECT_TRUE(ocs2::isApprox(cost, expected));
+  }
+}
+
+TEST(testAugmentedLagrangian, addStateApproximation) {
+  constexpr size_t numConstraints = 5;
+  constexpr int stateDim = 4;
+  constexpr int inputDim = 3;
+  const ocs2::vector_t state = ocs2::vector_t::Random(stateDim);
+  const ocs2::PreComputation preComp;
+  const auto h = getRandomConstraintApproximation(numConstraints, stateDim);
+  const ocs2::Multiplier multiplier{3.7, ocs2::vector_t::Random(numConstraints)};
+
+  for (const auto order : {ocs2::ConstraintOrder::Linear, ocs2::ConstraintOrder::Quadratic}) {
+    auto penaltyPtr = ocs2::augmented::QuadraticPenalty::create({100.0, 1.0});
+    const auto augmentedLagrangian = ocs2::create(std::make_unique<FixedStateConstraint>(order, h), std::move(penaltyPtr));
+    const auto stateApproximation = augmentedLagrangian->getQuadraticApproximation(0.0, state, multiplier, preComp);
+
+    // state-only approximation
+    auto stateCost = getRandomCostApproximation(stateDim, 0);
+    auto expected = stateCost;
+    expected.f += stateApproximation.f;
+    expected.dfdx += stateApproximation.dfdx;
+    expected.dfdxx += stateApproximation.dfdxx;
+    augmentedLagrangian->addQuadraticApproximation(0.0, state, multiplier, preComp, stateCost);
+    EXPECT_TRUE(ocs2::isApprox(stateCost, expected));
+
+    // the state term is added into a state-input approximation without touching the input derivatives
+    auto cost = getRandomCostApproximation(stateDim, inputDim);
+    expected = cost;
+    expected.f += stateApproximation.f;
+    expected.dfdx += stateApproximation.dfdx;
+    expected.dfdxx += stateApproximation.dfdxx;
+    augmentedLagrangian->addQuadraticApproximation(0.0, state, multiplier, preComp, cost);
+    EXPECT_TRUE(ocs2::isApprox(cost, expected));
+  }
+}
@@ -29,6 +29,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <gtest/gtest.h>
 
+#include <ocs2_core/FixedSizeTypes.h>
 #include <ocs2_core/Types.h>
 
 namespace {
@@ -167,3 +168,38 @@ TEST(testTypes, stateOnlyQuadraticOperations_resize) {
   resized.dfdxx.setConstant(2.0);
   stateOnlyQuadraticOperationsTest(resized, nx);
 }
+
+TEST(testTypes, fixedSizeConversion) {
+  constexpr int nx = 4;
+  constexpr int nu = 2;
+  ocs2::ScalarFunctionQuadraticApproximation cost;
+  cost.dfdxx.setRandom(nx, nx);
+  cost.dfdux.setRandom(nu, nx);
+  cost.dfduu.setRandom(nu, nu);
+  cost.dfdx.setRandom(nx);
+  cost.dfdu.setRandom(nu);
+  cost.f = 0.5;
+
+  using fixed_cost_t = ocs2::ScalarFunctionQuadraticApproximationT<nx, nu>;
+  ASSERT_TRUE(fixed_cost_t::hasSize(cost));
+  ASSERT_FALSE((ocs2::ScalarFunctionQuadraticApproximationT<nx, nu + 1>::hasSize(cost)));
+  const auto costOut = fixed_cost_t(cost).toDynamic();
+  EXPECT_TRUE(costOut.dfdxx.isApprox(cost.dfdxx));
+  EXPECT_TRUE(costOut.dfdux.isApprox(cost.dfdux));
+  EXPECT_TRUE(costOut.dfduu.isApprox(cost.dfduu));
+  EXPECT_TRUE(costOut.dfdx.isApprox(cost.dfdx));
+  EXPECT_TRUE(costOut.dfdu.isApprox(cost.dfdu));
+  EXPECT_DOUBLE_EQ(costOut.f, cost.f);
+
+  ocs2::VectorFunctionLinearApproximation dynamics;
+  dynamics.dfdx.setRandom(nx, nx);
+  dynamics.dfdu.setRandom(nx, nu);
+  dynamics.f.setRandom(nx);
+
+  using fixed_dynamics_t = ocs2::VectorFunctionLinearApproximationT<nx, nx, nu>;
+  ASSERT_TRUE(fixed_dynamics_t::hasSize(dynamics));
+  const auto dynamicsOut = fixed_dynamics_t(dynamics).toDynamic();
+  EXPECT_TRUE(dynamicsOut.dfdx.isApprox(dynamics.dfdx));
+  EXPECT_TRUE(dynamicsOut.dfdu.isApprox(dynamics.dfdu));
+  EXPECT_TRUE(dynamicsOut.f.isApprox(dynamics.f));
+}
@@ -0,0 +1,65 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <atomic>
+
+#include <benchmark/benchmark.h>
+
+#include <ocs2_core/thread_support/ThreadPool.h>
+
+namespace {
+
+constexpr int numTasks = 100;
+
+/** Dispatch of a parallel region of numTasks trivial tasks to a pool of state.range(0) threads. The items are the tasks. */
+void runParallelDispatch(benchmark::State& state) {
+  ocs2::ThreadPool pool(state.range(0));
+  std::atomic_int counter{0};
+  for (auto _ : state) {
+    pool.runParallel([&](int) { counter++; }, numTasks);
+  }
+  state.SetItemsProcessed(state.iterations() * numTasks);
+}
+
+/** Dispatch of a parallel loop over numTasks indices to a pool of state.range(0) threads. The items are the indices. */
+void parallelForDispatch(benchmark::State& state) {
+  ocs2::ThreadPool pool(state.range(0));
+  std::atomic_int counter{0};
+  for (auto _ : state) {
+    pool.parallelFor(0, numTasks, 1, [&](int, int) { counter++; });
+  }
+  state.SetItemsProcessed(state.iterations() * numTasks);
+}
+
+}  // unnamed namespace
+
+BENCHMARK(runParallelDispatch)->Arg(1)->Arg(3)->UseRealTime();
+BENCHMARK(parallelForDispatch)->Arg(1)->Arg(3)->UseRealTime();
+
+BENCHMARK_MAIN();
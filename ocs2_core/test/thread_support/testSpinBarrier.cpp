@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include <ocs2_core/thread_support/SpinBarrier.h>
+#include <ocs2_core/thread_support/ThreadPool.h>
+
+using namespace ocs2;
+
+TEST(testSpinBarrier, phasesAreSeparated) {
+  constexpr int numThreads = 4;
+  constexpr int numPhases = 1000;
+  SpinBarrier barrier(numThreads);
+
+  // each thread writes its own slot, then checks the slots of the other threads after the barrier
+  std::vector<int> phaseOfThread(numThreads, -1);
+  std::vector<int> numErrors(numThreads, 0);
+  auto task = [&](int threadId) {
+    bool localSense = false;
+    for (int phase = 0; phase < numPhases; phase++) {
+      phaseOfThread[threadId] = phase;
+      barrier.arriveAndWait(localSense);
+      for (int i = 0; i < numThreads; i++) {
+        numErrors[threadId] += phaseOfThread[i] != phase;
+      }
+      barrier.arriveAndWait(localSense);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < numThreads; i++) {
+    threads.emplace_back(task, i);
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (int i = 0; i < numThreads; i++) {
+    EXPECT_EQ(numErrors[i], 0);
+  }
+}
+
+TEST(testSpinBarrier, completionRunsOncePerPhase) {
+  constexpr int numPartitions = 3;
+  constexpr int numPhases = 500;
+  ThreadPool pool(numPartitions - 1);
+  SpinBarrier barrier(numPartitions);
+
+  int numCompletions = 0;
+  std::vector<int> observedCompletions(numPartitions, 0);
+  // the gang guarantees that the partitions run concurrently and waits for all the workers to join
+  const int gangSize = pool.runGang(
+      [&](int partition, int) {
+        bool localSense = false;
+        for (int phase = 0; phase < numPhases; phase++) {
+          barrier.arriveAndWait(localSense, [&] { ++numCompletions; });
+          // the completion of the current phase is visible to all the threads
+          observedCompletions[partition] += numCompletions == phase + 1;
+          barrier.arriveAndWait(localSense);
+        }
+      },
+      numPartitions);
+
+  ASSERT_EQ(gangSize, numPartitions);
+  EXPECT_EQ(numCompletions, numPhases);
+  for (int p = 0; p < numPartitions; p++) {
+    EXPECT_EQ(observedCompletions[p], numPhases);
+  }
+}
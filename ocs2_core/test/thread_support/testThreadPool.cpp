@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <ocs2_core/thread_support/SpinBarrier.h>
 #include <ocs2_core/thread_support/ThreadPool.h>
 
 using namespace ocs2;
@@ -121,3 +122,199 @@ TEST(testThreadPool, testMoveOnlyTask) {
 
   EXPECT_EQ(result.get(), 3.14);
 }
+
+TEST(testThreadPool, testRunParallelPropagateException) {
+  ThreadPool pool(2);
+  std::atomic_int counter;
+  counter = 0;
+
+  auto task = [&](int) {
+    if (counter++ == 3) {
+      throw std::runtime_error("exception");
+    }
+  };
+  EXPECT_THROW(pool.runParallel(task, 10), std::runtime_error);
+  EXPECT_EQ(counter, 10);
+}
+
+TEST(testThreadPool, testRunParallelWorkerIndex) {
+  constexpr size_t numThreads = 3;
+  ThreadPool pool(numThreads);
+  std::vector<std::atomic_int> counters(numThreads + 1);
+  for (auto& c : counters) {
+    c = 0;
+  }
+
+  pool.runParallel([&](int workerIndex) { counters.at(workerIndex)++; }, 100);
+
+  int sum = 0;
+  for (const auto& c : counters) {
+    sum += c;
+  }
+  EXPECT_EQ(sum, 100);
+}
+
+TEST(testThreadPool, testParallelFor) {
+  for (size_t numThreads : {0, 1, 3}) {
+    ThreadPool pool(numThreads);
+    for (int grain : {1, 3, 7, 1000}) {
+      std::vector<int> visited(100, 0);
+      pool.parallelFor(5, 95, grain, [&](int i, int workerIndex) {
+        ASSERT_LE(workerIndex, numThreads);
+        visited[i]++;
+      });
+      for (int i = 0; i < visited.size(); i++) {
+        EXPECT_EQ(visited[i], (i >= 5 && i < 95) ? 1 : 0) << "index: " << i << ", grain: " << grain;
+      }
+    }
+  }
+}
+
+TEST(testThreadPool, testParallelForEmptyRange) {
+  ThreadPool pool(2);
+  int counter = 0;
+  pool.parallelFor(3, 3, 1, [&](int, int) { counter++; });
+  pool.parallelFor(3, 1, 1, [&](int, int) { counter++; });
+  EXPECT_EQ(counter, 0);
+}
+
+TEST(testThreadPool, testNestedRun) {
+  ThreadPool pool(2);
+
+  auto outer = pool.run([&](int) { return pool.run([](int) { return 42; }).get(); });
+
+  EXPECT_EQ(outer.get(), 42);
+}
+
+TEST(testThreadPool, testRunParallelPartitioned) {
+  for (size_t numThreads : {0, 1, 3}) {
+    ThreadPool pool(numThreads);
+    for (int numPartitions : {1, 2, 4, 7}) {
+      std::vector<int> visited(numPartitions, 0);
+      pool.runParallelPartitioned([&](int p) { visited[p]++; }, numPartitions);
+      for (int p = 0; p < numPartitions; p++) {
+        EXPECT_EQ(visited[p], 1) << "partition: " << p << ", numThreads: " << numThreads;
+      }
+    }
+  }
+}
+
+TEST(testThreadPool, testRunGang) {
+  for (size_t numThreads : {0, 1, 3}) {
+    ThreadPool pool(numThreads);
+    for (int maxGangSize : {1, 2, 4, 7}) {
+      // the members synchronize with a barrier, which requires them to run concurrently
+      std::unique_ptr<SpinBarrier> barrierPtr;
+      std::once_flag barrierFlag;
+      std::vector<int> visited(maxGangSize, 0);
+      const int gangSize = pool.runGang(
+          [&](int instance, int size) {
+            std::call_once(barrierFlag, [&] { barrierPtr.reset(new SpinBarrier(size)); });
+            bool localSense = false;
+            for (int phase = 0; phase < 10; phase++) {
+              barrierPtr->arriveAndWait(localSense);
+            }
+            visited[instance]++;
+          },
+          maxGangSize);
+
+      // the gang waits for all the workers to join
+      EXPECT_EQ(gangSize, std::min(maxGangSize, static_cast<int>(numThreads) + 1)) << "numThreads: " << numThreads;
+      for (int i = 0; i < maxGangSize; i++) {
+        EXPECT_EQ(visited[i], i < gangSize ? 1 : 0) << "instance: " << i << ", numThreads: " << numThreads;
+      }
+    }
+  }
+}
+
+TEST(testThreadPool, testRunGangBusyWorkers) {
+  ThreadPool pool(2);
+
+  // block one worker until the gang is completed
+  std::promise<void> release;
+  std::shared_future<void> released = release.get_future().share();
+  std::atomic_int numStarted{0};
+  auto blockingTask = pool.run([&](int) {
+    ++numStarted;
+    released.wait();
+  });
+  while (numStarted == 0) {
+    std::this_thread::yield();
+  }
+
+  // the gang is called from the other worker with a join timeout, hence it can only run on the calling thread
+  auto gangTask = pool.run([&](int) {
+    std::unique_ptr<SpinBarrier> barrierPtr;
+    std::once_flag barrierFlag;
+    return pool.runGang(
+        [&](int, int size) {
+          std::call_once(barrierFlag, [&] { barrierPtr.reset(new SpinBarrier(size)); });
+          bool localSense = false;
+          barrierPtr->arriveAndWait(localSense);
+        },
+        3, std::chrono::milliseconds(1));
+  });
+
+  EXPECT_EQ(gangTask.get(), 1);
+  release.set_value();
+  blockingTask.get();
+}
+
+TEST(testThreadPool, testRunGangWaitsForBusyWorkers) {
+  ThreadPool pool(2);
+
+  // keep one worker busy for a while
+  std::atomic_int numStarted{0};
+  auto busyTask = pool.run([&](int) {
+    ++numStarted;
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  });
+  while (numStarted == 0) {
+    std::this_thread::yield();
+  }
+
+  // without a join timeout, the gang waits for the busy worker, hence its size does not depend on the timing
+  std::unique_ptr<SpinBarrier> barrierPtr;
+  std::once_flag barrierFlag;
+  const int gangSize = pool.runGang(
+      [&](int, int size) {
+        std::call_once(barrierFlag, [&] { barrierPtr.reset(new SpinBarrier(size)); });
+        bool localSense = false;
+        barrierPtr->arriveAndWait(localSense);
+      },
+      3);
+
+  EXPECT_EQ(gangSize, 3);
+  busyTask.get();
+}
+
+TEST(testThreadPool, testRunGangFromWorker) {
+  ThreadPool pool(3);
+
+  // the calling worker is not a helper of its own gang, hence the gang runs on all the threads of the pool
+  auto gangTask = pool.run([&](int) {
+    std::unique_ptr<SpinBarrier> barrierPtr;
+    std::once_flag barrierFlag;
+    return pool.runGang(
+        [&](int, int size) {
+          std::call_once(barrierFlag, [&] { barrierPtr.reset(new SpinBarrier(size)); });
+          bool localSense = false;
+          barrierPtr->arriveAndWait(localSense);
+        },
+        5);
+  });
+
+  EXPECT_EQ(gangTask.get(), 3);
+}
+
+TEST(testThreadPool, testRunGangPropagateException) {
+  ThreadPool pool(2);
+  EXPECT_THROW(pool.runGang(
+                   [](int instance, int) {
+                     if (instance == 0) {
+                       throw std::runtime_error("error");
+                     }
+                   },
+                   3),
+               std::runtime_error);
+}
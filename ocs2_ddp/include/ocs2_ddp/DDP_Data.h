@@ -29,6 +29,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #pragma once
 
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
 #include <ocs2_core/Types.h>
 #include <ocs2_core/model_data/Metrics.h>
 #include <ocs2_core/model_data/ModelData.h>
@@ -40,6 +44,46 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 namespace ocs2 {
 
+/**
+ * A pool of recycled ModelData. The elements removed from a ModelData trajectory are kept in the pool together with the memory of
+ * their Eigen members, and they are moved back when a trajectory grows. Therefore refilling a trajectory of the same time grid in the
+ * next iteration or MPC call does not reallocate the members which are assigned in place.
+ *
+ * @note The recycled elements are not reset. The user should overwrite all the fields which it reads.
+ */
+class ModelDataPool {
+ public:
+  /**
+   * Resizes a trajectory by moving the elements from and to the pool.
+   *
+   * @param [in, out] trajectory: The ModelData trajectory.
+   * @param [in] size: The new size of the trajectory.
+   */
+  void resize(std::vector<ModelData>& trajectory, size_t size) {
+    if (size > trajectory.size()) {
+      trajectory.reserve(size);
+      const size_t numRecycled = std::min(size - trajectory.size(), pool_.size());
+      std::move(pool_.end() - numRecycled, pool_.end(), std::back_inserter(trajectory));
+      pool_.resize(pool_.size() - numRecycled);
+      trajectory.resize(size);
+    } else {
+      std::move(trajectory.begin() + size, trajectory.end(), std::back_inserter(pool_));
+      trajectory.resize(size);
+    }
+  }
+
+  /** Moves all the elements of a trajectory to the pool. */
+  void clear(std::vector<ModelData>& trajectory) { resize(trajectory, 0); }
+
+  /** The number of the recycled elements. */
+  size_t size() const { return pool_.size(); }
+
+  void swap(ModelDataPool& other) { pool_.swap(other.pool_); }
+
+ private:
+  std::vector<ModelData> pool_;
+};
+
 /**
  * Primal data container
  *
@@ -60,6 +104,8 @@ struct PrimalDataContainer {
   std::vector<ModelData> modelDataEventTimes;
   // intermediate model data trajectory
   std::vector<ModelData> modelDataTrajectory;
+  // recycled elements of modelDataTrajectory
+  ModelDataPool modelDataPool;
 
   void swap(PrimalDataContainer& other) {
     primalSolution.swap(other.primalSolution);
@@ -67,13 +113,14 @@ struct PrimalDataContainer {
     std::swap(modelDataFinalTime, other.modelDataFinalTime);
     modelDataEventTimes.swap(other.modelDataEventTimes);
     modelDataTrajectory.swap(other.modelDataTrajectory);
+    modelDataPool.swap(other.modelDataPool);
   }
 
   void clear() {
     primalSolution.clear();
     problemMetrics.clear();
     modelDataEventTimes.clear();
-    modelDataTrajectory.clear();
+    modelDataPool.clear(modelDataTrajectory);
   }
 };
 
@@ -89,6 +136,8 @@ struct DualDataContainer {
   DualSolution dualSolution;
   // projected model data trajectory
   std::vector<ModelData> projectedModelDataTrajectory;
+  // recycled elements of projectedModelDataTrajectory
+  ModelDataPool projectedModelDataPool;
   // Riccati modification
   std::vector<riccati_modification::Data> riccatiModificationTrajectory;
   // Riccati solution coefficients
@@ -97,13 +146,14 @@ struct DualDataContainer {
   void swap(DualDataContainer& other) {
     dualSolution.swap(other.dualSolution);
     projectedModelDataTrajectory.swap(other.projectedModelDataTrajectory);
+    projectedModelDataPool.swap(other.projectedModelDataPool);
     riccatiModificationTrajectory.swap(other.riccatiModificationTrajectory);
     valueFunctionTrajectory.swap(other.valueFunctionTrajectory);
   }
 
   void clear() {
     dualSolution.clear();
-    projectedModelDataTrajectory.clear();
+    projectedModelDataPool.clear(projectedModelDataTrajectory);
     riccatiModificationTrajectory.clear();
     valueFunctionTrajectory.clear();
   }
@@ -29,6 +29,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #pragma once
 
+#include <functional>
+
 #include <ocs2_core/Types.h>
 #include <ocs2_core/control/LinearController.h>
 #include <ocs2_core/model_data/Metrics.h>
@@ -53,6 +55,21 @@ namespace ocs2 {
 void computeRolloutMetrics(OptimalControlProblem& problem, const PrimalSolution& primalSolution, DualSolutionConstRef dualSolution,
                            ProblemMetrics& problemMetrics);
 
+/**
+ * Computes cost, soft constraints and constraints values of each point in the the primalSolution rollout. The PerformanceIndex of
+ * the pre-jumps and the intermediate points is accumulated along the way and the computation stops as soon as the terminate
+ * callback returns true for the accumulated PerformanceIndex.
+ *
+ * @param [in] problem: A reference to the optimal control problem.
+ * @param [in] primalSolution: The primal solution.
+ * @param [in] dualSolution: Const reference view to the dual solution
+ * @param [out] problemMetrics: The cost, soft constraints and constraints values of the rollout.
+ * @param [in] terminate: Gets the PerformanceIndex of the partial trajectory and returns whether to stop the computation.
+ * @return false if the computation is terminated early, in which case problemMetrics is incomplete.
+ */
+bool computeRolloutMetrics(OptimalControlProblem& problem, const PrimalSolution& primalSolution, DualSolutionConstRef dualSolution,
+                           ProblemMetrics& problemMetrics, const std::function<bool(const PerformanceIndex&)>& terminate);
+
 /**
  * Calculates the PerformanceIndex associated to the given ProblemMetrics.
  *
@@ -58,6 +58,17 @@ class ILQR : public GaussNewtonDDP {
    */
   ~ILQR() override = default;
 
+  /**
+   * Uses fixed-size kernels in the Riccati equations for the time steps with NX states and NU projected inputs, e.g., for a small system
+   * without state-input equality constraints. The other time steps use the dynamic-size kernels.
+   */
+  template <int NX, int NU>
+  void useFixedSizeRiccatiEquations() {
+    for (auto& riccatiEquationsPtr : riccatiEquationsPtrStock_) {
+      riccatiEquationsPtr->useFixedSizeKernel<NX, NU>();
+    }
+  }
+
  protected:
   scalar_t solveSequentialRiccatiEquations(const ScalarFunctionQuadraticApproximation& finalValueFunction) override;
 
@@ -32,6 +32,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <Eigen/Dense>
 #include <Eigen/StdVector>
 
+#include <ocs2_core/FixedSizeTypes.h>
 #include <ocs2_core/Types.h>
 #include <ocs2_core/model_data/ModelData.h>
 
@@ -52,8 +53,7 @@ struct DiscreteTimeRiccatiData {
   matrix_t projectedGm_;
   vector_t projectedGv_;
 
-  matrix_t projectedKm_T_projectedGm_;
-  matrix_t projectedHm_projectedKm_;
+  matrix_t projectedGm_plus_projectedHm_projectedKm_;
   vector_t projectedHm_projectedLv_;
 
   // risk sensitive data
@@ -107,7 +107,37 @@ class DiscreteTimeRiccatiEquations {
                   const vector_t& SvNext, const scalar_t& sNext, matrix_t& projectedKm, vector_t& projectedLv, matrix_t& Sm, vector_t& Sv,
                   scalar_t& s);
 
+  /**
+   * Uses a fixed-size kernel for the steps where the projected model data has NX states and NU inputs. The other steps keep the
+   * dynamic-size implementation. The risk-sensitive variant uses the kernel for its inner ILQR map.
+   */
+  template <int NX, int NU>
+  void useFixedSizeKernel() {
+    fixedSizeKernel_ = &computeMapILQRFixedSize<NX, NU>;
+  }
+
+  /**
+   * The state dimension from which the symmetric terms of the Riccati matrix are evaluated only on their lower triangle. Below
+   * this size, the general matrix products of Eigen are faster than the triangular ones.
+   */
+  static constexpr size_t symmetricKernelMinStateDim = 16;
+
  private:
+  using fixed_size_kernel_t = bool (*)(bool, const ModelData&, const riccati_modification::Data&, const matrix_t&, const vector_t&,
+                                       const scalar_t&, matrix_t&, vector_t&, matrix_t&, vector_t&, scalar_t&);
+
+  /**
+   * Fixed-size variant of computeMapILQR for NX states and NU inputs. The dynamic-size inputs are mapped without copies and all the
+   * intermediate terms are fixed-size.
+   *
+   * @return false if the dimensions do not match, in which case the outputs are not modified.
+   */
+  template <int NX, int NU>
+  static bool computeMapILQRFixedSize(bool reducedFormRiccati, const ModelData& projectedModelData,
+                                      const riccati_modification::Data& riccatiModification, const matrix_t& SmNext, const vector_t& SvNext,
+                                      const scalar_t& sNext, matrix_t& projectedKm, vector_t& projectedLv, matrix_t& Sm, vector_t& Sv,
+                                      scalar_t& s);
+
   /**
    * Computes one step Riccati difference equations for ILQR formulation.
    *
@@ -152,6 +182,9 @@ class DiscreteTimeRiccatiEquations {
   scalar_t riskSensitiveCoeff_ = 0.0;
 
   DiscreteTimeRiccatiData discreteTimeRiccatiData_;
+  fixed_size_kernel_t fixedSizeKernel_ = nullptr;
 };
 
 }  // namespace ocs2
+
+#include "implementation/DiscreteTimeRiccatiEquations.h"
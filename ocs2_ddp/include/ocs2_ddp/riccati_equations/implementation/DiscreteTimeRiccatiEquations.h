@@ -0,0 +1,127 @@
+/******************************************************************************
+Copyright (c) 2017, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ * Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+ * Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+ * Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+namespace ocs2 {
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+template <int NX, int NU>
+bool DiscreteTimeRiccatiEquations::computeMapILQRFixedSize(bool reducedFormRiccati, const ModelData& projectedModelData,
+                                                           const riccati_modification::Data& riccatiModification, const matrix_t& SmNext,
+                                                           const vector_t& SvNext, const scalar_t& sNext, matrix_t& projectedKm,
+                                                           vector_t& projectedLv, matrix_t& Sm, vector_t& Sv, scalar_t& s) {
+  const auto& dynamics = projectedModelData.dynamics;
+  const auto& cost = projectedModelData.cost;
+  if (dynamics.dfdx.rows() != NX || dynamics.dfdx.cols() != NX || dynamics.dfdu.cols() != NU || SmNext.rows() != NX ||
+      riccatiModification.deltaGm_.rows() != NU) {
+    return false;
+  }
+
+  using state_matrix_t = fixed_matrix_t<NX, NX>;
+  using input_state_matrix_t = fixed_matrix_t<NU, NX>;
+  using input_matrix_t = fixed_matrix_t<NU, NU>;
+  using state_vector_t = fixed_vector_t<NX>;
+  using input_vector_t = fixed_vector_t<NU>;
+
+  const Eigen::Map<const state_matrix_t> Am(dynamics.dfdx.data());
+  const Eigen::Map<const fixed_matrix_t<NX, NU>> Bm(dynamics.dfdu.data());
+  const Eigen::Map<const state_vector_t> Hv(projectedModelData.dynamicsBias.data());
+  const Eigen::Map<const state_matrix_t> Qm(cost.dfdxx.data());
+  const Eigen::Map<const input_state_matrix_t> Pm(cost.dfdux.data());
+  const Eigen::Map<const input_matrix_t> Rm(cost.dfduu.data());
+  const Eigen::Map<const state_vector_t> Qv(cost.dfdx.data());
+  const Eigen::Map<const input_vector_t> Rv(cost.dfdu.data());
+  const Eigen::Map<const state_matrix_t> deltaQm(riccatiModification.deltaQm_.data());
+  const Eigen::Map<const input_state_matrix_t> deltaGm(riccatiModification.deltaGm_.data());
+  const Eigen::Map<const input_vector_t> deltaGv(riccatiModification.deltaGv_.data());
+  const Eigen::Map<const state_matrix_t> SmNextMap(SmNext.data());
+  const Eigen::Map<const state_vector_t> SvNextMap(SvNext.data());
+
+  // precomputation (1)
+  const state_vector_t Sm_projectedHv = SmNextMap * Hv;
+  const state_matrix_t Sm_projectedAm = SmNextMap * Am;
+  const state_vector_t Sv_plus_Sm_projectedHv = SvNextMap + Sm_projectedHv;
+
+  // projectedGm = projectedPm + projectedBm^T * Sm * projectedAm
+  input_state_matrix_t projectedGm = Pm;
+  projectedGm.noalias() += Bm.transpose() * Sm_projectedAm;
+
+  // projectedGv = projectedRv + projectedBm^T * (Sv + Sm * projectedHv)
+  input_vector_t projectedGv = Rv;
+  projectedGv.noalias() += Bm.transpose() * Sv_plus_Sm_projectedHv;
+
+  // projected feedback and feedforward
+  projectedKm.resize(NU, NX);
+  projectedLv.resize(NU);
+  Eigen::Map<input_state_matrix_t> Km(projectedKm.data());
+  Eigen::Map<input_vector_t> Lv(projectedLv.data());
+  Km = -projectedGm - deltaGm;
+  Lv = -projectedGv - deltaGv;
+
+  // Sm = Qm + deltaQm + Am^T * Sm * Am + Km^T * Gm (+ Gm^T * Km + Km^T * Hm * Km)
+  Sm.resize(NX, NX);
+  Eigen::Map<state_matrix_t> SmMap(Sm.data());
+  const state_matrix_t projectedKm_T_projectedGm = Km.transpose() * projectedGm;
+  SmMap = Qm + deltaQm;
+  SmMap.noalias() += Sm_projectedAm.transpose() * Am;
+
+  // Sv = Qv + Am^T * (Sv + Sm * Hv) + Gm^T * Lv (+ Km^T * Gv + Km^T * Hm * Lv)
+  Sv.resize(NX);
+  Eigen::Map<state_vector_t> SvMap(Sv.data());
+  SvMap = Qv;
+  SvMap.noalias() += Am.transpose() * Sv_plus_Sm_projectedHv;
+  SvMap.noalias() += projectedGm.transpose() * Lv;
+
+  // s = s + q + Hv^T * (Sv + Sm * Hv) - 0.5 Hv^T * Sm * Hv (+ 0.5 Lv^T Gv or + Lv^T Gv + 0.5 Lv^T Hm Lv)
+  s = sNext + cost.f;
+  s += Hv.dot(Sv_plus_Sm_projectedHv);
+  s -= 0.5 * Hv.dot(Sm_projectedHv);
+
+  if (reducedFormRiccati) {
+    SmMap += projectedKm_T_projectedGm;
+    s += 0.5 * Lv.dot(projectedGv);
+  } else {
+    input_matrix_t projectedHm = Rm;
+    projectedHm.noalias() += Bm.transpose() * (SmNextMap * Bm);
+    const input_state_matrix_t projectedHm_projectedKm = projectedHm * Km;
+    const input_vector_t projectedHm_projectedLv = projectedHm * Lv;
+
+    SmMap += projectedKm_T_projectedGm + projectedKm_T_projectedGm.transpose();
+    SmMap.noalias() += Km.transpose() * projectedHm_projectedKm;
+    SvMap.noalias() += Km.transpose() * projectedGv;
+    SvMap.noalias() += projectedHm_projectedKm.transpose() * Lv;
+    s += Lv.dot(projectedGv);
+    s += 0.5 * Lv.dot(projectedHm_projectedLv);
+  }
+
+  return true;
+}
+
+}  // namespace ocs2
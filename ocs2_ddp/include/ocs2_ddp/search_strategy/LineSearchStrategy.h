@@ -96,8 +96,17 @@ class LineSearchStrategy final : public SearchStrategyBase {
   /** number of line search iterations (the if statements order is important) */
   size_t maxNumOfSearches() const;
 
-  /** Computes the solution on a thread and a given stepLength  */
-  void computeSolution(size_t taskId, scalar_t stepLength, search_strategy::Solution& solution);
+  /**
+   * Computes the solution on a thread and a given stepLength.
+   *
+   * @param [in] taskId: The thread's task ID.
+   * @param [in] stepLength: The step length.
+   * @param [out] solution: The solution.
+   * @param [in] isCandidate: Whether the step length is a line search candidate. A candidate is dropped as soon as it cannot be
+   *                          accepted anymore.
+   * @return false if the candidate is dropped before its solution is completely computed.
+   */
+  bool computeSolution(size_t taskId, scalar_t stepLength, search_strategy::Solution& solution, bool isCandidate);
 
   /**
    * Defines line search task on a thread with various learning rates and choose the largest acceptable step-size.
@@ -130,6 +139,7 @@ class LineSearchStrategy final : public SearchStrategyBase {
   std::atomic_size_t nextTaskId_{0};
   std::atomic_size_t alphaExpNext_{0};
   std::vector<bool> alphaProcessed_;
+  std::vector<scalar_t> workersStepLength_;  // the step length under process by each task, zero if idle
   std::mutex lineSearchResultMutex_;
   mutable std::mutex outputDisplayGuardMutex_;
 };
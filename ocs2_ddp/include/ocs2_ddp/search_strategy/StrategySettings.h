@@ -97,6 +97,9 @@ struct Settings {
   hessian_correction::Strategy hessianCorrectionStrategy = hessian_correction::Strategy::DIAGONAL_SHIFT;
   /** The multiple used for correcting the Hessian for numerical stability of the Riccati backward pass.*/
   scalar_t hessianCorrectionMultiple = numeric_traits::limitEpsilon<scalar_t>();
+  /** Whether to drop a step length as soon as the merit of its partial trajectory violates the Armijo condition. This assumes that
+   * the merit of a partial trajectory is a lower bound of the total merit, e.g. the cost and the penalties are non-negative. */
+  bool pruneByPartialMerit = false;
 };  // end of Settings
 
 /**
@@ -63,6 +63,14 @@ void copySegment(const LinearInterpolation::index_alpha_t& indexAlpha0, const Li
 /******************************************************************************************************/
 void computeRolloutMetrics(OptimalControlProblem& problem, const PrimalSolution& primalSolution, DualSolutionConstRef dualSolution,
                            ProblemMetrics& problemMetrics) {
+  computeRolloutMetrics(problem, primalSolution, dualSolution, problemMetrics, nullptr);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+bool computeRolloutMetrics(OptimalControlProblem& problem, const PrimalSolution& primalSolution, DualSolutionConstRef dualSolution,
+                           ProblemMetrics& problemMetrics, const std::function<bool(const PerformanceIndex&)>& terminate) {
   const auto& tTrajectory = primalSolution.timeTrajectory_;
   const auto& xTrajectory = primalSolution.stateTrajectory_;
   const auto& uTrajectory = primalSolution.inputTrajectory_;
@@ -72,6 +80,10 @@ void computeRolloutMetrics(OptimalControlProblem& problem, const PrimalSolution&
   problemMetrics.preJumps.reserve(postEventIndices.size());
   problemMetrics.intermediates.reserve(tTrajectory.size());
 
+  // the performance index of the partial trajectory, only accumulated if it is required
+  PerformanceIndex partialPerformanceIndex;
+  PerformanceIndex previousIntermediate;
+
   auto nextPostEventIndexItr = postEventIndices.begin();
   constexpr auto request = Request::Cost + Request::Constraint + Request::SoftConstraint;
   for (size_t k = 0; k < tTrajectory.size(); k++) {
@@ -86,6 +98,21 @@ void computeRolloutMetrics(OptimalControlProblem& problem, const PrimalSolution&
       problem.preComputationPtr->requestPreJump(request, tTrajectory[k], xTrajectory[k]);
       problemMetrics.preJumps.push_back(computePreJumpMetrics(problem, tTrajectory[k], xTrajectory[k], m));
       nextPostEventIndexItr++;
+      if (terminate) {
+        partialPerformanceIndex += toPerformanceIndex(problemMetrics.preJumps.back());
+      }
+    }
+
+    // trapezoidal integration of the intermediates, same as in computeRolloutPerformanceIndex
+    if (terminate) {
+      auto currentIntermediate = toPerformanceIndex(problemMetrics.intermediates.back());
+      if (k > 0) {
+        partialPerformanceIndex += (0.5 * (tTrajectory[k] - tTrajectory[k - 1])) * (previousIntermediate + currentIntermediate);
+      }
+      previousIntermediate = std::move(currentIntermediate);
+      if (terminate(partialPerformanceIndex)) {
+        return false;
+      }
     }
   }
 
@@ -94,6 +121,8 @@ void computeRolloutMetrics(OptimalControlProblem& problem, const PrimalSolution&
     problem.preComputationPtr->requestFinal(request, tTrajectory.back(), xTrajectory.back());
     problemMetrics.final = computeFinalMetrics(problem, tTrajectory.back(), xTrajectory.back(), dualSolution.final);
   }
+
+  return true;
 }
 
 /******************************************************************************************************/
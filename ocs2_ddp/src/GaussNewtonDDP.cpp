@@ -73,6 +73,10 @@ GaussNewtonDDP::GaussNewtonDDP(ddp::Settings ddpSettings, const RolloutBase& rol
         "[GaussNewtonDDP] DDP does not support final equality constraints (a.k.a. finalEqualityConstraintPtr), instead use the Lagrangian "
         "method!");
   }
+  if (!optimalControlProblem.stateBoxConstraintPtr->empty() || !optimalControlProblem.inputBoxConstraintPtr->empty() ||
+      !optimalControlProblem.finalStateBoxConstraintPtr->empty()) {
+    throw std::runtime_error("[GaussNewtonDDP] DDP does not support box constraints, instead use inequality constraints!");
+  }
 
   // initializer Rollout
   initializerRolloutPtr_.reset(new InitializerRollout(initializer, rollout.settings()));
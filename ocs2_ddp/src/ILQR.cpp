@@ -85,8 +85,7 @@ void ILQR::approximateIntermediateLQ(const DualSolution& dualSolution, PrimalDat
   const auto& multiplierTrajectory = dualSolution.intermediates;
   auto& modelDataTrajectory = primalData.modelDataTrajectory;
 
-  modelDataTrajectory.clear();
-  modelDataTrajectory.resize(timeTrajectory.size());
+  primalData.modelDataPool.resize(modelDataTrajectory, timeTrajectory.size());
 
   nextTimeIndex_ = 0;
   nextTaskId_ = 0;
@@ -140,9 +139,10 @@ void ILQR::discreteLQWorker(SystemDynamicsBase& system, scalar_t time, const vec
   modelData.stateDim = continuousTimeModelData.stateDim;
   modelData.inputDim = continuousTimeModelData.inputDim;
 
-  // linearize system dynamics
+  // linearize system dynamics (the covariance is not discretized)
   modelData.dynamicsBias.setZero(modelData.stateDim);
-  modelData.dynamics = sensitivityDiscretizer_(system, time, state, input, timeStep);
+  modelData.dynamicsCovariance.resize(0, 0);
+  sensitivityDiscretizer_(system, time, state, input, timeStep, modelData.dynamics);
   modelData.dynamics.f.setZero(modelData.stateDim);
 
   // quadratic approximation to the cost function
@@ -189,7 +189,7 @@ scalar_t ILQR::solveSequentialRiccatiEquations(const ScalarFunctionQuadraticAppr
   projectedKmTrajectoryStock_.resize(N);
 
   nominalDualData_.riccatiModificationTrajectory.resize(N);
-  nominalDualData_.projectedModelDataTrajectory.resize(N);
+  nominalDualData_.projectedModelDataPool.resize(nominalDualData_.projectedModelDataTrajectory, N);
 
   const auto& finalModelData = nominalPrimalData_.modelDataTrajectory.back();
   auto& finalRiccatiModification = nominalDualData_.riccatiModificationTrajectory.back();
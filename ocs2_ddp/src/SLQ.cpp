@@ -84,8 +84,7 @@ void SLQ::approximateIntermediateLQ(const DualSolution& dualSolution, PrimalData
   const auto& multiplierTrajectory = dualSolution.intermediates;
   auto& modelDataTrajectory = primalData.modelDataTrajectory;
 
-  modelDataTrajectory.clear();
-  modelDataTrajectory.resize(timeTrajectory.size());
+  primalData.modelDataPool.resize(modelDataTrajectory, timeTrajectory.size());
 
   nextTimeIndex_ = 0;
   nextTaskId_ = 0;
@@ -177,7 +176,7 @@ scalar_t SLQ::solveSequentialRiccatiEquations(const ScalarFunctionQuadraticAppro
   const size_t N = nominalPrimalData_.primalSolution.timeTrajectory_.size();
 
   nominalDualData_.riccatiModificationTrajectory.resize(N);
-  nominalDualData_.projectedModelDataTrajectory.resize(N);
+  nominalDualData_.projectedModelDataPool.resize(nominalDualData_.projectedModelDataTrajectory, N);
 
   if (N > 0) {
     // perform the computeRiccatiModificationTerms for partition i
@@ -67,19 +67,26 @@ void DiscreteTimeRiccatiEquations::computeMapILQR(const ModelData& projectedMode
                                                   const vector_t& SvNext, const scalar_t& sNext, DiscreteTimeRiccatiData& dreCache,
                                                   matrix_t& projectedKm, vector_t& projectedLv, matrix_t& Sm, vector_t& Sv,
                                                   scalar_t& s) const {
+  if (fixedSizeKernel_ != nullptr && fixedSizeKernel_(reducedFormRiccati_, projectedModelData, riccatiModification, SmNext, SvNext, sNext,
+                                                      projectedKm, projectedLv, Sm, Sv, s)) {
+    return;
+  }
+
+  const auto& Am = projectedModelData.dynamics.dfdx;
+  const auto& Bm = projectedModelData.dynamics.dfdu;
+
   // precomputation (1)
   dreCache.Sm_projectedHv_.noalias() = SmNext * projectedModelData.dynamicsBias;
-  dreCache.Sm_projectedAm_.noalias() = SmNext * projectedModelData.dynamics.dfdx;
-  dreCache.Sm_projectedBm_.noalias() = SmNext * projectedModelData.dynamics.dfdu;
+  dreCache.Sm_projectedAm_.noalias() = SmNext * Am;
   dreCache.Sv_plus_Sm_projectedHv_ = SvNext + dreCache.Sm_projectedHv_;
 
   // projectedGm = projectedPm + projectedBm^T * Sm * projectedAm
   dreCache.projectedGm_ = projectedModelData.cost.dfdux;
-  dreCache.projectedGm_.noalias() += projectedModelData.dynamics.dfdu.transpose() * dreCache.Sm_projectedAm_;
+  dreCache.projectedGm_.noalias() += Bm.transpose() * dreCache.Sm_projectedAm_;
 
   // projectedGv = projectedRv + projectedBm^T * (Sv + Sm * projectedHv)
   dreCache.projectedGv_ = projectedModelData.cost.dfdu;
-  dreCache.projectedGv_.noalias() += projectedModelData.dynamics.dfdu.transpose() * dreCache.Sv_plus_Sm_projectedHv_;
+  dreCache.projectedGv_.noalias() += Bm.transpose() * dreCache.Sv_plus_Sm_projectedHv_;
 
   // projected feedback
   projectedKm = -dreCache.projectedGm_ - riccatiModification.deltaGm_;
@@ -87,31 +94,53 @@ void DiscreteTimeRiccatiEquations::computeMapILQR(const ModelData& projectedMode
   projectedLv = -dreCache.projectedGv_ - riccatiModification.deltaGv_;
 
   // precomputation (2)
-  dreCache.projectedKm_T_projectedGm_.noalias() = projectedKm.transpose() * dreCache.projectedGm_;
   if (!reducedFormRiccati_) {
     // projectedHm
+    dreCache.Sm_projectedBm_.noalias() = SmNext * Bm;
     dreCache.projectedHm_ = projectedModelData.cost.dfduu;
-    dreCache.projectedHm_.noalias() += dreCache.Sm_projectedBm_.transpose() * projectedModelData.dynamics.dfdu;
+    dreCache.projectedHm_.noalias() += Bm.transpose() * dreCache.Sm_projectedBm_;
 
-    dreCache.projectedHm_projectedKm_.noalias() = dreCache.projectedHm_ * projectedKm;
+    // Gm + Hm * Km
+    dreCache.projectedGm_plus_projectedHm_projectedKm_ = dreCache.projectedGm_;
+    dreCache.projectedGm_plus_projectedHm_projectedKm_.noalias() += dreCache.projectedHm_ * projectedKm;
     dreCache.projectedHm_projectedLv_.noalias() = dreCache.projectedHm_ * projectedLv;
   }
 
   /*
    * Sm
    */
+  // Km^T * Gm is symmetric in the reduced form only if deltaGm is zero, which is the case for the line-search strategy.
+  const bool symmetricKernel =
+      Am.rows() >= symmetricKernelMinStateDim && (!reducedFormRiccati_ || riccatiModification.deltaGm_.isZero(0.0));
+
   // = Qm + deltaQm
   Sm = projectedModelData.cost.dfdxx + riccatiModification.deltaQm_;
-  // += Am^T * Sm * Am
-  Sm.noalias() += dreCache.Sm_projectedAm_.transpose() * projectedModelData.dynamics.dfdx;
-  if (reducedFormRiccati_) {
-    // += Km^T * Gm + Gm^T * Km
-    Sm += dreCache.projectedKm_T_projectedGm_;
+  if (symmetricKernel) {
+    // the products are only evaluated on the lower triangle which is then reflected on the upper one
+    auto SmLower = Sm.triangularView<Eigen::Lower>();
+    // += Am^T * Sm * Am
+    SmLower += dreCache.Sm_projectedAm_.transpose() * Am;
+    if (reducedFormRiccati_) {
+      // += Km^T * Gm
+      SmLower += projectedKm.transpose() * dreCache.projectedGm_;
+    } else {
+      // += Gm^T * Km + Km^T * (Gm + Hm * Km)
+      SmLower += dreCache.projectedGm_.transpose() * projectedKm;
+      SmLower += projectedKm.transpose() * dreCache.projectedGm_plus_projectedHm_projectedKm_;
+    }
+    Sm.triangularView<Eigen::StrictlyUpper>() = Sm.transpose();
+
   } else {
-    // += Km^T * Gm + Gm^T * Km
-    Sm += dreCache.projectedKm_T_projectedGm_ + dreCache.projectedKm_T_projectedGm_.transpose();
-    // += Km^T * Hm * Km
-    Sm.noalias() += projectedKm.transpose() * dreCache.projectedHm_projectedKm_;
+    // += Am^T * Sm * Am
+    Sm.noalias() += dreCache.Sm_projectedAm_.transpose() * Am;
+    if (reducedFormRiccati_) {
+      // += Km^T * Gm
+      Sm.noalias() += projectedKm.transpose() * dreCache.projectedGm_;
+    } else {
+      // += Gm^T * Km + Km^T * (Gm + Hm * Km)
+      Sm.noalias() += dreCache.projectedGm_.transpose() * projectedKm;
+      Sm.noalias() += projectedKm.transpose() * dreCache.projectedGm_plus_projectedHm_projectedKm_;
+    }
   }
 
   /*
@@ -120,17 +149,14 @@ void DiscreteTimeRiccatiEquations::computeMapILQR(const ModelData& projectedMode
   // = Qv
   Sv = projectedModelData.cost.dfdx;
   // += Am^T * (Sv + Sm * Hv)
-  Sv.noalias() += projectedModelData.dynamics.dfdx.transpose() * dreCache.Sv_plus_Sm_projectedHv_;
-  if (reducedFormRiccati_) {
-    // += Gm^T * Lv
-    Sv.noalias() += dreCache.projectedGm_.transpose() * projectedLv;
-  } else {
-    // += Gm^T * Lv
-    Sv.noalias() += dreCache.projectedGm_.transpose() * projectedLv;
+  Sv.noalias() += Am.transpose() * dreCache.Sv_plus_Sm_projectedHv_;
+  // += Gm^T * Lv
+  Sv.noalias() += dreCache.projectedGm_.transpose() * projectedLv;
+  if (!reducedFormRiccati_) {
     // += Km^T * Gv
     Sv.noalias() += projectedKm.transpose() * dreCache.projectedGv_;
     // Km^T * Hm * Lv
-    Sv.noalias() += dreCache.projectedHm_projectedKm_.transpose() * projectedLv;
+    Sv.noalias() += projectedKm.transpose() * dreCache.projectedHm_projectedLv_;
   }
 
   /*
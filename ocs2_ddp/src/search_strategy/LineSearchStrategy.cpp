@@ -53,7 +53,8 @@ LineSearchStrategy::LineSearchStrategy(search_strategy::Settings baseSettings, l
       workersSolution_(threadPoolRef.numThreads() + 1),
       rolloutRefStock_(std::move(rolloutRefStock)),
       optimalControlProblemRefStock_(std::move(optimalControlProblemRefStock)),
-      meritFunc_(std::move(meritFunc)) {
+      meritFunc_(std::move(meritFunc)),
+      workersStepLength_(rolloutRefStock_.size(), 0.0) {
   // infeasible learning rate adjustment scheme
   if (!numerics::almost_ge(settings_.maxStepLength, settings_.minStepLength)) {
     throw std::runtime_error("The maximum learning rate is smaller than the minimum learning rate.");
@@ -85,7 +86,7 @@ size_t LineSearchStrategy::maxNumOfSearches() const {
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
-void LineSearchStrategy::computeSolution(size_t taskId, scalar_t stepLength, search_strategy::Solution& solution) {
+bool LineSearchStrategy::computeSolution(size_t taskId, scalar_t stepLength, search_strategy::Solution& solution, bool isCandidate) {
   auto& problem = optimalControlProblemRefStock_[taskId];
   auto& rollout = rolloutRefStock_[taskId];
 
@@ -113,7 +114,18 @@ void LineSearchStrategy::computeSolution(size_t taskId, scalar_t stepLength, sea
   initializeDualSolution(problem, solution.primalSolution, *adjustedDualSolutionPtr, solution.dualSolution);
 
   // compute problem metrics
-  computeRolloutMetrics(problem, solution.primalSolution, solution.dualSolution, solution.problemMetrics);
+  if (isCandidate) {
+    // drop the candidate as soon as a larger step length is accepted or the Armijo condition cannot be satisfied anymore
+    const scalar_t armijoBound = baselineMerit_ - settings_.armijoCoefficient * stepLength * unoptimizedControllerUpdateIS_;
+    const auto terminate = [&](const PerformanceIndex& partialPerformanceIndex) {
+      return stepLength < bestStepSize_ || (settings_.pruneByPartialMerit && meritFunc_(partialPerformanceIndex) >= armijoBound);
+    };
+    if (!computeRolloutMetrics(problem, solution.primalSolution, solution.dualSolution, solution.problemMetrics, terminate)) {
+      return false;
+    }
+  } else {
+    computeRolloutMetrics(problem, solution.primalSolution, solution.dualSolution, solution.problemMetrics);
+  }
 
   // compute performanceIndex
   solution.performanceIndex = computeRolloutPerformanceIndex(solution.primalSolution.timeTrajectory_, solution.problemMetrics);
@@ -126,6 +138,8 @@ void LineSearchStrategy::computeSolution(size_t taskId, scalar_t stepLength, sea
     infoDisplay << std::setw(4) << solution.performanceIndex << "\n\n";
     printString(infoDisplay.str());
   }
+
+  return true;
 }
 
 /******************************************************************************************************/
@@ -146,7 +160,7 @@ bool LineSearchStrategy::run(const std::pair<scalar_t, scalar_t>& timePeriod, co
   constexpr size_t taskId = 0;
   constexpr scalar_t stepLength = 0.0;
   try {
-    computeSolution(taskId, stepLength, workersSolution_[taskId]);
+    computeSolution(taskId, stepLength, workersSolution_[taskId], false);
     baselineMerit_ = workersSolution_[taskId].performanceIndex.merit;
     unoptimizedControllerUpdateIS_ = computeControllerUpdateIS(unoptimizedController);
 
@@ -166,6 +180,7 @@ bool LineSearchStrategy::run(const std::pair<scalar_t, scalar_t>& timePeriod, co
   nextTaskId_ = 0;
   alphaExpNext_ = 0;
   alphaProcessed_ = std::vector<bool>(maxNumOfSearches(), false);
+  std::fill(workersStepLength_.begin(), workersStepLength_.end(), 0.0);
   auto task = [&](int) { lineSearchTask(nextTaskId_++); };
   threadPoolRef_.runParallel(task, threadPoolRef_.numThreads());
 
@@ -200,7 +215,13 @@ void LineSearchStrategy::lineSearchTask(const size_t taskId) {
     }
 
     // skip if the current learning rate is less than the best candidate
-    if (stepLength < bestStepSize_) {
+    bool skipStepLength;
+    {
+      std::lock_guard<std::mutex> lock(lineSearchResultMutex_);
+      skipStepLength = stepLength < bestStepSize_;
+      workersStepLength_[taskId] = skipStepLength ? 0.0 : stepLength;
+    }
+    if (skipStepLength) {
       // display
       if (baseSettings_.displayInfo) {
         std::string linesearchDisplay;
@@ -211,13 +232,20 @@ void LineSearchStrategy::lineSearchTask(const size_t taskId) {
       break;
     }
 
+    bool isCompleted = false;
     try {
-      computeSolution(taskId, stepLength, workersSolution_[taskId]);
+      isCompleted = computeSolution(taskId, stepLength, workersSolution_[taskId], true);
+      if (!isCompleted && baseSettings_.displayInfo) {
+        printString("    [Thread " + std::to_string(taskId) + "] rollout with step length " + std::to_string(stepLength) +
+                    " is dropped: It cannot be accepted anymore!\n");
+      }
     } catch (const std::exception& error) {
       if (baseSettings_.displayInfo) {
         printString("    [Thread " + std::to_string(taskId) + "] rollout with step length " + std::to_string(stepLength) +
                     " is terminated: " + error.what() + '\n');
       }
+    }
+    if (!isCompleted) {
       workersSolution_[taskId].performanceIndex.merit = std::numeric_limits<scalar_t>::max();
       workersSolution_[taskId].performanceIndex.cost = std::numeric_limits<scalar_t>::max();
     }
@@ -238,9 +266,17 @@ void LineSearchStrategy::lineSearchTask(const size_t taskId) {
         bestStepSize_ = stepLength;
         swap(*bestSolutionRef_, workersSolution_[taskId]);
         terminateLinesearchTasks = std::all_of(alphaProcessed_.cbegin(), alphaProcessed_.cbegin() + alphaExp, [](bool f) { return f; });
+
+        // cancel the rollouts in flight which cannot be accepted anymore
+        for (size_t i = 0; i < workersStepLength_.size(); i++) {
+          if (i != taskId && workersStepLength_[i] > 0.0 && workersStepLength_[i] < stepLength) {
+            rolloutRefStock_[i].get().abortRollout();
+          }
+        }
       }
 
       alphaProcessed_[alphaExp] = true;
+      workersStepLength_[taskId] = 0.0;
     }  // end lock
 
     // kill other ongoing line search tasks
@@ -83,6 +83,7 @@ Settings load(const std::string& filename, const std::string& fieldName, bool ve
   settings.hessianCorrectionStrategy = hessian_correction::fromString(hessianCorrectionStrategyName);
 
   loadData::loadPtreeValue(pt, settings.hessianCorrectionMultiple, fieldName + ".hessianCorrectionMultiple", verbose);
+  loadData::loadPtreeValue(pt, settings.pruneByPartialMerit, fieldName + ".pruneByPartialMerit", verbose);
 
   if (verbose) {
     std::cerr << " #### }" << std::endl;
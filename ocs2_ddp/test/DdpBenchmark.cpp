@@ -0,0 +1,136 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <ocs2_core/initialization/DefaultInitializer.h>
+#include <ocs2_core/test/AllocationCounter.h>
+#include <ocs2_ddp/DDP_Data.h>
+#include <ocs2_ddp/SLQ.h>
+#include <ocs2_oc/approximate_model/LinearQuadraticApproximator.h>
+#include <ocs2_oc/rollout/TimeTriggeredRollout.h>
+#include <ocs2_oc/synchronized_module/ReferenceManager.h>
+#include <ocs2_oc/test/testProblemsGeneration.h>
+
+namespace {
+
+using namespace ocs2;
+
+/** A linear-quadratic problem with state.range(0) states and state.range(1) inputs. */
+struct LinearQuadraticProblem {
+  explicit LinearQuadraticProblem(const ::benchmark::State& state)
+      : stateDim(state.range(0)),
+        inputDim(state.range(1)),
+        referenceManagerPtr(std::make_shared<ReferenceManager>(
+            TargetTrajectories({0.0}, {vector_t::Random(stateDim)}, {vector_t::Random(inputDim)}))) {
+    problem.dynamicsPtr = getOcs2Dynamics(getRandomDynamics(stateDim, inputDim));
+    problem.costPtr->add("cost", getOcs2Cost(getRandomCost(stateDim, inputDim)));
+    problem.finalCostPtr->add("finalCost", getOcs2StateCost(getRandomCost(stateDim, 0)));
+    problem.targetTrajectoriesPtr = &referenceManagerPtr->getTargetTrajectories();
+  }
+
+  const int stateDim;
+  const int inputDim;
+  std::shared_ptr<ReferenceManager> referenceManagerPtr;
+  OptimalControlProblem problem;
+};
+
+/**
+ * The LQ approximation of a trajectory of 100 nodes as GaussNewtonDDP computes it. With recycle, the model data trajectory is recycled
+ * through a ModelDataPool, otherwise it is reconstructed in every iteration.
+ */
+void lqApproximation(::benchmark::State& state, bool recycle) {
+  constexpr size_t numTime = 100;
+  LinearQuadraticProblem lqProblem(state);
+  const vector_t x = vector_t::Random(lqProblem.stateDim);
+  const vector_t u = vector_t::Random(lqProblem.inputDim);
+  const MultiplierCollection multipliers;
+
+  ModelDataPool pool;
+  std::vector<ModelData> modelDataTrajectory;
+  const AllocationCounter allocationCounter;
+  for (auto _ : state) {
+    if (recycle) {
+      pool.clear(modelDataTrajectory);
+      pool.resize(modelDataTrajectory, numTime);
+    } else {
+      modelDataTrajectory.clear();
+      modelDataTrajectory.resize(numTime);
+    }
+    for (size_t k = 0; k < numTime; ++k) {
+      approximateIntermediateLQ(lqProblem.problem, 0.01 * k, x, u, multipliers, modelDataTrajectory[k]);
+    }
+    ::benchmark::DoNotOptimize(modelDataTrajectory.back().cost.f);
+  }
+  state.counters["allocations"] = ::benchmark::Counter(allocationCounter.count(), ::benchmark::Counter::kAvgIterations);
+}
+
+/** A complete SLQ solve of the linear-quadratic problem, warm started from the previous solution. */
+void slqRun(::benchmark::State& state) {
+  LinearQuadraticProblem lqProblem(state);
+
+  ddp::Settings ddpSettings;
+  ddpSettings.algorithm_ = ddp::Algorithm::SLQ;
+  ddpSettings.nThreads_ = 1;
+  ddpSettings.maxNumIterations_ = 5;
+  ddpSettings.displayInfo_ = false;
+  ddpSettings.displayShortSummary_ = false;
+  ddpSettings.timeStep_ = 0.01;
+  rollout::Settings rolloutSettings;
+  rolloutSettings.timeStep = 0.01;
+  rolloutSettings.integratorType = IntegratorType::RK4;
+
+  TimeTriggeredRollout rollout(*lqProblem.problem.dynamicsPtr, rolloutSettings);
+  DefaultInitializer initializer(lqProblem.inputDim);
+  SLQ slq(ddpSettings, rollout, lqProblem.problem, initializer);
+  slq.setReferenceManager(lqProblem.referenceManagerPtr);
+
+  const vector_t initState = vector_t::Zero(lqProblem.stateDim);
+  slq.run(0.0, initState, 1.0);
+  const AllocationCounter allocationCounter;
+  for (auto _ : state) {
+    slq.run(0.0, initState, 1.0);
+  }
+  state.counters["allocations"] = ::benchmark::Counter(allocationCounter.count(), ::benchmark::Counter::kAvgIterations);
+}
+
+void typicalRobotSizes(::benchmark::internal::Benchmark* b) {
+  b->Args({12, 4})->Args({24, 12})->Args({36, 12});
+}
+
+}  // unnamed namespace
+
+BENCHMARK_CAPTURE(lqApproximation, recycled, true)->Apply(typicalRobotSizes);
+BENCHMARK_CAPTURE(lqApproximation, reconstructed, false)->Apply(typicalRobotSizes);
+BENCHMARK(slqRun)->Apply(typicalRobotSizes)->Unit(::benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
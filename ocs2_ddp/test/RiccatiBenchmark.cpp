@@ -0,0 +1,100 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <ocs2_core/misc/LinearAlgebra.h>
+#include <ocs2_core/misc/randomMatrices.h>
+#include <ocs2_ddp/riccati_equations/DiscreteTimeRiccatiEquations.h>
+
+namespace {
+
+/**
+ * Benchmarks one step of the discrete-time Riccati equation for the projected model data of a system with state.range(0)
+ * states and state.range(1) inputs. The reported time is per stage. With fixedSizeKernel, the fixed-size kernel for 12
+ * states and 4 inputs is enabled.
+ */
+void discreteTimeRiccatiStep(benchmark::State& state, bool reducedFormRiccati, bool fixedSizeKernel = false) {
+  const int stateDim = state.range(0);
+  const int inputDim = state.range(1);
+
+  ocs2::ModelData projectedModelData;
+  projectedModelData.stateDim = stateDim;
+  projectedModelData.inputDim = inputDim;
+  projectedModelData.dynamicsBias = ocs2::vector_t::Random(stateDim);
+  projectedModelData.dynamics.dfdx = ocs2::matrix_t::Random(stateDim, stateDim);
+  projectedModelData.dynamics.dfdu = ocs2::matrix_t::Random(stateDim, inputDim);
+  projectedModelData.cost.f = 0.1;
+  projectedModelData.cost.dfdx = ocs2::vector_t::Random(stateDim);
+  projectedModelData.cost.dfdxx = ocs2::LinearAlgebra::generateSPDmatrix<ocs2::matrix_t>(stateDim);
+  projectedModelData.cost.dfdu = ocs2::vector_t::Random(inputDim);
+  projectedModelData.cost.dfduu.setIdentity(inputDim, inputDim);
+  projectedModelData.cost.dfdux = ocs2::matrix_t::Random(inputDim, stateDim);
+
+  ocs2::riccati_modification::Data riccatiModification;
+  riccatiModification.deltaQm_.setZero(stateDim, stateDim);
+  riccatiModification.deltaGv_.setZero(inputDim);
+  riccatiModification.deltaGm_.setZero(inputDim, stateDim);
+
+  const ocs2::matrix_t SmNext = ocs2::LinearAlgebra::generateSPDmatrix<ocs2::matrix_t>(stateDim);
+  const ocs2::vector_t SvNext = ocs2::vector_t::Random(stateDim);
+  const ocs2::scalar_t sNext = 0.3;
+
+  ocs2::DiscreteTimeRiccatiEquations riccati(reducedFormRiccati);
+  if (fixedSizeKernel) {
+    riccati.useFixedSizeKernel<12, 4>();
+  }
+  ocs2::matrix_t Km, Sm;
+  ocs2::vector_t Lv, Sv;
+  ocs2::scalar_t s;
+  for (auto _ : state) {
+    riccati.computeMap(projectedModelData, riccatiModification, SmNext, SvNext, sNext, Km, Lv, Sm, Sv, s);
+    benchmark::DoNotOptimize(Sm.data());
+    benchmark::DoNotOptimize(s);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void typicalRobotSizes(benchmark::internal::Benchmark* b) {
+  for (const auto& dims : std::vector<std::pair<int, int>>{{12, 4}, {12, 12}, {24, 12}, {36, 12}, {50, 20}}) {
+    b->Args({dims.first, dims.second});
+  }
+}
+
+}  // unnamed namespace
+
+BENCHMARK_CAPTURE(discreteTimeRiccatiStep, reducedForm, true)->Apply(typicalRobotSizes);
+BENCHMARK_CAPTURE(discreteTimeRiccatiStep, fullForm, false)->Apply(typicalRobotSizes);
+BENCHMARK_CAPTURE(discreteTimeRiccatiStep, reducedFormFixedSize, true, true)->Args({12, 4});
+BENCHMARK_CAPTURE(discreteTimeRiccatiStep, fullFormFixedSize, false, true)->Args({12, 4});
+
+BENCHMARK_MAIN();
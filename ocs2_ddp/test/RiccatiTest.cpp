@@ -34,6 +34,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ocs2_core/misc/LinearAlgebra.h>
 #include <ocs2_core/misc/randomMatrices.h>
 #include <ocs2_ddp/riccati_equations/ContinuousTimeRiccatiEquations.h>
+#include <ocs2_ddp/riccati_equations/DiscreteTimeRiccatiEquations.h>
 
 class RiccatiInitializer {
  public:
@@ -155,3 +156,97 @@ TEST(RiccatiTest, testFlattenAndUnflatten) {
   ASSERT_TRUE(Sv.isApprox(Sv_out));
   ASSERT_TRUE(Sm.isApprox(Sm_out));
 }
+
+TEST(RiccatiTest, discreteTimeFixedSizeKernel) {
+  constexpr int STATE_DIM = 12;
+  constexpr int INPUT_DIM = 4;
+
+  RiccatiInitializer ri(STATE_DIM, INPUT_DIM);
+  const auto& projectedModelData = ri.projectedModelDataTrajectory.front();
+  const auto& riccatiModification = ri.riccatiModificationTrajectory.front();
+  const ocs2::matrix_t SmNext = ocs2::LinearAlgebra::generateSPDmatrix<ocs2::matrix_t>(STATE_DIM);
+  const ocs2::vector_t SvNext = ocs2::vector_t::Random(STATE_DIM);
+  const ocs2::scalar_t sNext = 0.3;
+
+  for (bool reducedFormRiccati : {true, false}) {
+    ocs2::DiscreteTimeRiccatiEquations dynamicSizeRiccati(reducedFormRiccati);
+    ocs2::DiscreteTimeRiccatiEquations fixedSizeRiccati(reducedFormRiccati);
+    fixedSizeRiccati.useFixedSizeKernel<STATE_DIM, INPUT_DIM>();
+
+    ocs2::matrix_t Km, KmFixed, Sm, SmFixed;
+    ocs2::vector_t Lv, LvFixed, Sv, SvFixed;
+    ocs2::scalar_t s, sFixed;
+
+    dynamicSizeRiccati.computeMap(projectedModelData, riccatiModification, SmNext, SvNext, sNext, Km, Lv, Sm, Sv, s);
+    fixedSizeRiccati.computeMap(projectedModelData, riccatiModification, SmNext, SvNext, sNext, KmFixed, LvFixed, SmFixed, SvFixed, sFixed);
+
+    EXPECT_TRUE(KmFixed.isApprox(Km));
+    EXPECT_TRUE(LvFixed.isApprox(Lv));
+    EXPECT_TRUE(SmFixed.isApprox(Sm));
+    EXPECT_TRUE(SvFixed.isApprox(Sv));
+    EXPECT_NEAR(sFixed, s, 1e-9 * std::abs(s));
+  }
+
+  // Other dimensions fall back to the dynamic-size kernel
+  RiccatiInitializer riOther(STATE_DIM, INPUT_DIM - 1);
+  const auto& otherModelData = riOther.projectedModelDataTrajectory.front();
+  ocs2::DiscreteTimeRiccatiEquations dynamicSizeRiccati(true);
+  ocs2::DiscreteTimeRiccatiEquations fixedSizeRiccati(true);
+  fixedSizeRiccati.useFixedSizeKernel<STATE_DIM, INPUT_DIM>();
+  ocs2::matrix_t Km, KmFixed, Sm, SmFixed;
+  ocs2::vector_t Lv, LvFixed, Sv, SvFixed;
+  ocs2::scalar_t s, sFixed;
+  dynamicSizeRiccati.computeMap(otherModelData, riOther.riccatiModificationTrajectory.front(), SmNext, SvNext, sNext, Km, Lv, Sm, Sv, s);
+  fixedSizeRiccati.computeMap(otherModelData, riOther.riccatiModificationTrajectory.front(), SmNext, SvNext, sNext, KmFixed, LvFixed,
+                              SmFixed, SvFixed, sFixed);
+  ASSERT_EQ(KmFixed.rows(), INPUT_DIM - 1);
+  EXPECT_TRUE(KmFixed.isApprox(Km));
+  EXPECT_TRUE(SmFixed.isApprox(Sm));
+}
+
+TEST(RiccatiTest, discreteTimeSymmetricKernel) {
+  constexpr int STATE_DIM = 24;
+  constexpr int INPUT_DIM = 12;
+  static_assert(STATE_DIM >= ocs2::DiscreteTimeRiccatiEquations::symmetricKernelMinStateDim, "The test should use the symmetric kernel");
+
+  RiccatiInitializer ri(STATE_DIM, INPUT_DIM);
+  const auto& projectedModelData = ri.projectedModelDataTrajectory.front();
+  const auto& riccatiModification = ri.riccatiModificationTrajectory.front();
+  const ocs2::matrix_t SmNext = ocs2::LinearAlgebra::generateSPDmatrix<ocs2::matrix_t>(STATE_DIM);
+  const ocs2::vector_t SvNext = ocs2::vector_t::Random(STATE_DIM);
+  const ocs2::scalar_t sNext = 0.3;
+
+  // reference solution
+  const auto& Am = projectedModelData.dynamics.dfdx;
+  const auto& Bm = projectedModelData.dynamics.dfdu;
+  const auto& Hv = projectedModelData.dynamicsBias;
+  const auto& cost = projectedModelData.cost;
+  const ocs2::matrix_t Gm = cost.dfdux + Bm.transpose() * SmNext * Am;
+  const ocs2::vector_t Gv = cost.dfdu + Bm.transpose() * (SvNext + SmNext * Hv);
+  const ocs2::matrix_t Hm = cost.dfduu + Bm.transpose() * SmNext * Bm;
+  const ocs2::matrix_t KmExpected = -Gm;
+  const ocs2::vector_t LvExpected = -Gv;
+
+  for (bool reducedFormRiccati : {true, false}) {
+    ocs2::DiscreteTimeRiccatiEquations riccati(reducedFormRiccati);
+    ocs2::matrix_t Km, Sm;
+    ocs2::vector_t Lv, Sv;
+    ocs2::scalar_t s;
+    riccati.computeMap(projectedModelData, riccatiModification, SmNext, SvNext, sNext, Km, Lv, Sm, Sv, s);
+
+    ocs2::matrix_t SmExpected = cost.dfdxx + riccatiModification.deltaQm_ + Am.transpose() * SmNext * Am;
+    ocs2::vector_t SvExpected = cost.dfdx + Am.transpose() * (SvNext + SmNext * Hv) + Gm.transpose() * LvExpected;
+    if (reducedFormRiccati) {
+      SmExpected += KmExpected.transpose() * Gm;
+    } else {
+      SmExpected += KmExpected.transpose() * Gm + Gm.transpose() * KmExpected + KmExpected.transpose() * Hm * KmExpected;
+      SvExpected += KmExpected.transpose() * Gv + KmExpected.transpose() * Hm * LvExpected;
+    }
+
+    EXPECT_TRUE(Km.isApprox(KmExpected));
+    EXPECT_TRUE(Lv.isApprox(LvExpected));
+    EXPECT_TRUE(Sm.isApprox(SmExpected));
+    EXPECT_TRUE(Sv.isApprox(SvExpected));
+    EXPECT_TRUE(Sm == Sm.transpose());
+  }
+}
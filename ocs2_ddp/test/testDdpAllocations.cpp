@@ -0,0 +1,147 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+#include <ocs2_core/test/AllocationCounter.h>
+#include <ocs2_ddp/DDP_Data.h>
+#include <ocs2_oc/approximate_model/LinearQuadraticApproximator.h>
+#include <ocs2_oc/test/testProblemsGeneration.h>
+
+using namespace ocs2;
+
+TEST(ModelDataPool, recycle) {
+  constexpr int stateDim = 24;
+  constexpr int inputDim = 12;
+  constexpr size_t numTime = 200;
+
+  // fills the trajectory in place as the projection of the LQ approximation does
+  ModelData modelData;
+  modelData.dynamics = getRandomDynamics(stateDim, inputDim);
+  modelData.cost = getRandomCost(stateDim, inputDim);
+  auto fill = [&](std::vector<ModelData>& trajectory) {
+    for (auto& m : trajectory) {
+      m.dynamics = modelData.dynamics;
+      m.cost = modelData.cost;
+    }
+  };
+
+  ModelDataPool pool;
+  std::vector<ModelData> trajectory;
+  pool.resize(trajectory, numTime);
+  fill(trajectory);
+  const scalar_t* dfdxData = trajectory.front().dynamics.dfdx.data();
+
+  // moving the whole trajectory to the pool and back keeps the memory of the elements
+  pool.clear(trajectory);
+  EXPECT_TRUE(trajectory.empty());
+  EXPECT_EQ(pool.size(), numTime);
+  pool.resize(trajectory, numTime / 2);
+  EXPECT_EQ(pool.size(), numTime / 2);
+  pool.resize(trajectory, numTime);
+  EXPECT_EQ(pool.size(), 0);
+  const bool isRecycled = std::any_of(trajectory.cbegin(), trajectory.cend(),
+                                      [&](const ModelData& m) { return m.dynamics.dfdx.data() == dfdxData; });
+  EXPECT_TRUE(isRecycled);
+  EXPECT_TRUE(std::all_of(trajectory.cbegin(), trajectory.cend(), [&](const ModelData& m) { return m.cost.dfdxx.rows() == stateDim; }));
+
+  // growing beyond the pool size
+  pool.resize(trajectory, numTime + 10);
+  EXPECT_EQ(trajectory.size(), numTime + 10);
+  EXPECT_EQ(trajectory.back().cost.dfdxx.size(), 0);
+
+  // after the warm-up, recycling and refilling the trajectory does not allocate, unlike clearing it
+  pool.clear(trajectory);
+  pool.resize(trajectory, numTime);
+  fill(trajectory);
+  size_t numRecycleAllocations;
+  {
+    AllocationCounter counter;
+    for (size_t i = 0; i < 10; ++i) {
+      pool.clear(trajectory);
+      pool.resize(trajectory, numTime);
+      fill(trajectory);
+    }
+    numRecycleAllocations = counter.count();
+  }
+  EXPECT_EQ(numRecycleAllocations, 0);
+
+  size_t numClearAllocations;
+  {
+    AllocationCounter counter;
+    trajectory.clear();
+    trajectory.resize(numTime);
+    fill(trajectory);
+    numClearAllocations = counter.count();
+  }
+  EXPECT_GT(numClearAllocations, numTime);
+}
+
+TEST(approximateIntermediateLQ, noAllocationWithRecycledModelData) {
+  constexpr int stateDim = 24;
+  constexpr int inputDim = 12;
+  constexpr size_t numTime = 100;
+
+  // Only the dynamics and the (empty) constraint collections are approximated in place. The cost and constraint terms still return
+  // their approximations by value, e.g., QuadraticStateInputCost allocates the state and input deviations.
+  OptimalControlProblem problem;
+  problem.dynamicsPtr = getOcs2Dynamics(getRandomDynamics(stateDim, inputDim));
+  const TargetTrajectories targetTrajectories({0.0}, {vector_t::Random(stateDim)}, {vector_t::Random(inputDim)});
+  problem.targetTrajectoriesPtr = &targetTrajectories;
+
+  const vector_t state = vector_t::Random(stateDim);
+  const vector_t input = vector_t::Random(inputDim);
+  const MultiplierCollection multipliers;
+  auto approximate = [&](std::vector<ModelData>& trajectory) {
+    for (size_t k = 0; k < trajectory.size(); ++k) {
+      approximateIntermediateLQ(problem, 0.01 * k, state, input, multipliers, trajectory[k]);
+    }
+  };
+
+  // the first approximation sizes the model data and the first clear sizes the pool
+  ModelDataPool pool;
+  std::vector<ModelData> trajectory;
+  pool.resize(trajectory, numTime);
+  approximate(trajectory);
+  pool.clear(trajectory);
+  pool.resize(trajectory, numTime);
+
+  size_t numAllocations;
+  {
+    AllocationCounter counter;
+    pool.clear(trajectory);
+    pool.resize(trajectory, numTime);
+    approximate(trajectory);
+    numAllocations = counter.count();
+  }
+  EXPECT_EQ(numAllocations, 0);
+  EXPECT_TRUE(trajectory.back().dynamics.dfdx.isApprox(problem.dynamicsPtr->linearApproximation(0.0, state, input).dfdx));
+}
@@ -27,11 +27,11 @@ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 ******************************************************************************/
 
-#include <iostream>
-
 #include <gtest/gtest.h>
 
 #include <ocs2_ddp/DDP_HelperFunctions.h>
+#include <ocs2_oc/oc_problem/OptimalControlProblemHelperFunction.h>
+#include <ocs2_oc/test/testProblemsGeneration.h>
 
 using namespace ocs2;
 
@@ -99,3 +99,53 @@ TEST(extractPrimalSolution, eventAtInitTime) {
   //  std::cerr << ">>>>>> Test 3\n" << PrimalSolutionTest3 << "\n";
   EXPECT_EQ(PrimalSolutionTest3.timeTrajectory_.size(), 1);
 }
+
+TEST(computeRolloutMetrics, terminate) {
+  constexpr int stateDim = 3;
+  constexpr int inputDim = 2;
+  constexpr size_t numTime = 10;
+
+  OptimalControlProblem problem;
+  problem.costPtr->add("cost", getOcs2Cost(getRandomCost(stateDim, inputDim)));
+  problem.preJumpCostPtr->add("eventCost", getOcs2StateCost(getRandomCost(stateDim, 0)));
+  problem.finalCostPtr->add("finalCost", getOcs2StateCost(getRandomCost(stateDim, 0)));
+  const TargetTrajectories targetTrajectories({0.0}, {vector_t::Random(stateDim)}, {vector_t::Random(inputDim)});
+  problem.targetTrajectoriesPtr = &targetTrajectories;
+
+  PrimalSolution primalSolution;
+  for (size_t n = 0; n <= numTime; ++n) {
+    primalSolution.timeTrajectory_.push_back(n * 0.1);
+    primalSolution.stateTrajectory_.push_back(vector_t::Random(stateDim));
+    primalSolution.inputTrajectory_.push_back(vector_t::Random(inputDim));
+  }
+  primalSolution.postEventIndices_.push_back(5);
+  primalSolution.modeSchedule_ = ModeSchedule({primalSolution.timeTrajectory_[4]}, {0, 1});
+
+  DualSolution dualSolution;
+  initializeDualSolution(problem, primalSolution, DualSolution(), dualSolution);
+
+  ProblemMetrics problemMetrics;
+  computeRolloutMetrics(problem, primalSolution, dualSolution, problemMetrics);
+  const auto performanceIndex = computeRolloutPerformanceIndex(primalSolution.timeTrajectory_, problemMetrics);
+
+  // never terminate: the last partial performance index misses only the final cost
+  PerformanceIndex partialPerformanceIndex;
+  ProblemMetrics completeProblemMetrics;
+  const bool isCompleted = computeRolloutMetrics(problem, primalSolution, dualSolution, completeProblemMetrics,
+                                                 [&](const PerformanceIndex& p) {
+                                                   partialPerformanceIndex = p;
+                                                   return false;
+                                                 });
+  EXPECT_TRUE(isCompleted);
+  EXPECT_EQ(completeProblemMetrics.intermediates.size(), problemMetrics.intermediates.size());
+  EXPECT_EQ(completeProblemMetrics.preJumps.size(), problemMetrics.preJumps.size());
+  EXPECT_NEAR(partialPerformanceIndex.cost + problemMetrics.final.cost, performanceIndex.cost, 1e-9);
+
+  // terminate at the third node
+  size_t numCalls = 0;
+  ProblemMetrics partialProblemMetrics;
+  const bool isTerminated = !computeRolloutMetrics(problem, primalSolution, dualSolution, partialProblemMetrics,
+                                                   [&](const PerformanceIndex&) { return ++numCalls == 3; });
+  EXPECT_TRUE(isTerminated);
+  EXPECT_EQ(partialProblemMetrics.intermediates.size(), 3);
+}
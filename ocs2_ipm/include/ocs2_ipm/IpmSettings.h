@@ -37,6 +37,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 namespace ocs2 {
 namespace ipm {
 
+/** Solver of the QP subproblems */
+enum class QpSolverType { HPIPM, PARALLEL_RICCATI };
+
 struct Settings {
   // Ipm settings
   size_t ipmIteration = 10;  // Maximum number of IPM iterations
@@ -60,6 +63,7 @@ struct Settings {
                                             // in the PerformanceIndex log is incorrect but it will not affect algorithm correctness.
 
   // QP subproblem solver settings
+  QpSolverType qpSolverType = QpSolverType::HPIPM;  // PARALLEL_RICCATI: parallel in time over nThreads
   hpipm_interface::Settings hpipmSettings = hpipm_interface::Settings();
 
   // Discretization method
@@ -73,6 +77,8 @@ struct Settings {
   scalar_t barrierReductionConstraintTol = 1.0e-02;  // Barrier reduction condition : Constraint violations below this value
   scalar_t barrierLinearDecreaseFactor = 0.2;        // Linear decrease factor of the barrier parameter, i.e., mu <- mu * factor.
   scalar_t barrierSuperlinearDecreasePower = 1.5;    // Superlinear decrease factor of the barrier parameter, i.e., mu <- mu ^ factor
+  bool warmStart = false;  // Start from the barrier parameter at the end of the previous call instead of the initial barrier parameter.
+                           // The slack and dual variables are always initialized with the solution of the previous call.
 
   // Initialization of the interior point method. Follows the initialization method of IPOPT
   // (https://coin-or.github.io/Ipopt/OPTIONS.html#OPT_Initialization).
@@ -95,8 +101,22 @@ struct Settings {
   // Threading
   size_t nThreads = 4;
   int threadPriority = 50;
+  bool nodePartitioning = false;             // Pin contiguous ranges of time nodes to fixed workers instead of dynamic scheduling
+  scalar_t nodePartitionImbalanceTol = 0.2;  // Rebalance the node ranges if the slowest worker exceeds the average by this fraction
 };
 
+/**
+ * Get string name of the QP solver type
+ * @param qpSolverType: QP solver type enum
+ */
+std::string toString(QpSolverType qpSolverType);
+
+/**
+ * Get the QP solver type from string name, useful for reading config file
+ * @param name: QP solver name
+ */
+QpSolverType fromString(const std::string& name);
+
 /**
  * Loads the multiple shooting IPM settings from a given file.
  *
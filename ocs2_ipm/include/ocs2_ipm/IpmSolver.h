@@ -34,6 +34,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ocs2_core/misc/Benchmark.h>
 #include <ocs2_core/thread_support/ThreadPool.h>
 
+#include <ocs2_oc/multiple_shooting/NodePartition.h>
+#include <ocs2_oc/multiple_shooting/ParallelRiccatiSolver.h>
 #include <ocs2_oc/multiple_shooting/ProjectionMultiplierCoefficients.h>
 #include <ocs2_oc/multiple_shooting/Transcription.h>
 #include <ocs2_oc/oc_data/TimeDiscretization.h>
@@ -113,6 +115,12 @@ class IpmSolver : public SolverBase {
   /** Run a task in parallel with settings.nThreads */
   void runParallel(std::function<void(int)> taskFunction);
 
+  /**
+   * Run a task for each time node in [0, numNodes) in parallel with settings.nThreads. The node task takes the worker index and the
+   * node index. If settings.nodePartitioning is set, each worker processes a fixed range of nodes.
+   */
+  void runParallelOverNodes(int numNodes, const std::function<void(int, int)>& nodeTask, bool measureCost);
+
   /** Get profiling information as a string */
   std::string getBenchmarkingInformation() const;
 
@@ -194,9 +202,11 @@ class IpmSolver : public SolverBase {
 
   // Solver interface
   HpipmInterface hpipmInterface_;
+  multiple_shooting::ParallelRiccatiSolver parallelRiccatiSolver_;
 
   // Threading
   ThreadPool threadPool_;
+  multiple_shooting::NodePartition nodePartition_;
 
   // Solution
   PrimalSolution primalSolution_;
@@ -204,6 +214,7 @@ class IpmSolver : public SolverBase {
   vector_array_t projectionMultiplierTrajectory_;
   DualSolution slackIneqTrajectory_;
   DualSolution dualIneqTrajectory_;
+  scalar_t barrierParameter_;  // barrier parameter at the end of the last call, the start value of the next call if warm started
 
   // Value function in absolute state coordinates (without the constant value)
   std::vector<ScalarFunctionQuadraticApproximation> valueFunction_;
@@ -29,6 +29,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "ocs2_ipm/IpmSettings.h"
 
+#include <unordered_map>
+
 #include <boost/property_tree/info_parser.hpp>
 #include <boost/property_tree/ptree.hpp>
 
@@ -39,6 +41,20 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 namespace ocs2 {
 namespace ipm {
 
+std::string toString(QpSolverType qpSolverType) {
+  static const std::unordered_map<QpSolverType, std::string> qpSolverMap = {{QpSolverType::HPIPM, "HPIPM"},
+                                                                            {QpSolverType::PARALLEL_RICCATI, "PARALLEL_RICCATI"}};
+
+  return qpSolverMap.at(qpSolverType);
+}
+
+QpSolverType fromString(const std::string& name) {
+  static const std::unordered_map<std::string, QpSolverType> qpSolverMap = {{"HPIPM", QpSolverType::HPIPM},
+                                                                            {"PARALLEL_RICCATI", QpSolverType::PARALLEL_RICCATI}};
+
+  return qpSolverMap.at(name);
+}
+
 Settings loadSettings(const std::string& filename, const std::string& fieldName, bool verbose) {
   boost::property_tree::ptree pt;
   boost::property_tree::read_info(filename, pt);
@@ -72,6 +88,7 @@ Settings loadSettings(const std::string& filename, const std::string& fieldName,
   loadData::loadPtreeValue(pt, settings.barrierReductionConstraintTol, fieldName + ".barrierReductionConstraintTol", verbose);
   loadData::loadPtreeValue(pt, settings.barrierLinearDecreaseFactor, fieldName + ".barrierLinearDecreaseFactor", verbose);
   loadData::loadPtreeValue(pt, settings.barrierSuperlinearDecreasePower, fieldName + ".barrierSuperlinearDecreasePower", verbose);
+  loadData::loadPtreeValue(pt, settings.warmStart, fieldName + ".warmStart", verbose);
   loadData::loadPtreeValue(pt, settings.fractionToBoundaryMargin, fieldName + ".fractionToBoundaryMargin", verbose);
   loadData::loadPtreeValue(pt, settings.usePrimalStepSizeForDual, fieldName + ".usePrimalStepSizeForDual", verbose);
   loadData::loadPtreeValue(pt, settings.initialSlackLowerBound, fieldName + ".initialSlackLowerBound", verbose);
@@ -83,6 +100,11 @@ Settings loadSettings(const std::string& filename, const std::string& fieldName,
   loadData::loadPtreeValue(pt, settings.printLinesearch, fieldName + ".printLinesearch", verbose);
   loadData::loadPtreeValue(pt, settings.nThreads, fieldName + ".nThreads", verbose);
   loadData::loadPtreeValue(pt, settings.threadPriority, fieldName + ".threadPriority", verbose);
+  loadData::loadPtreeValue(pt, settings.nodePartitioning, fieldName + ".nodePartitioning", verbose);
+  loadData::loadPtreeValue(pt, settings.nodePartitionImbalanceTol, fieldName + ".nodePartitionImbalanceTol", verbose);
+  auto qpSolverName = toString(settings.qpSolverType);
+  loadData::loadPtreeValue(pt, qpSolverName, fieldName + ".qpSolverType", verbose);
+  settings.qpSolverType = fromString(qpSolverName);
 
   if (settings.initialSlackLowerBound <= 0.0) {
     throw std::runtime_error("[MultipleShootingIpmSettings] initialSlackLowerBound must be positive!");
@@ -66,10 +66,18 @@ ipm::Settings rectifySettings(const OptimalControlProblem& ocp, ipm::Settings&&
 IpmSolver::IpmSolver(ipm::Settings settings, const OptimalControlProblem& optimalControlProblem, const Initializer& initializer)
     : settings_(rectifySettings(optimalControlProblem, std::move(settings))),
       hpipmInterface_(OcpSize(), settings_.hpipmSettings),
-      threadPool_(std::max(settings_.nThreads, size_t(1)) - 1, settings_.threadPriority) {
+      parallelRiccatiSolver_(settings_.nThreads),
+      threadPool_(std::max(settings_.nThreads, size_t(1)) - 1, settings_.threadPriority),
+      nodePartition_(settings_.nThreads, settings_.nodePartitionImbalanceTol),
+      barrierParameter_(settings_.initialBarrierParameter) {
   Eigen::setNbThreads(1);  // No multithreading within Eigen.
   Eigen::initParallel();
 
+  if (!optimalControlProblem.stateBoxConstraintPtr->empty() || !optimalControlProblem.inputBoxConstraintPtr->empty() ||
+      !optimalControlProblem.finalStateBoxConstraintPtr->empty()) {
+    throw std::runtime_error("[IpmSolver] Box constraints are not supported, use the SQP solver or inequality constraints instead!");
+  }
+
   // Dynamics discretization
   discretizer_ = selectDynamicsDiscretization(settings_.integratorType);
   sensitivityDiscretizer_ = selectDynamicsSensitivityDiscretization(settings_.integratorType);
@@ -102,9 +110,13 @@ void IpmSolver::reset() {
   projectionMultiplierTrajectory_.clear();
   slackIneqTrajectory_.clear();
   dualIneqTrajectory_.clear();
+  barrierParameter_ = settings_.initialBarrierParameter;
   valueFunction_.clear();
   performanceIndeces_.clear();
 
+  // Clear the HPIPM warm start
+  hpipmInterface_.resetInitialGuess();
+
   // reset timers
   totalNumIterations_ = 0;
   initializationTimer_.reset();
@@ -234,7 +246,8 @@ void IpmSolver::runImpl(scalar_t initTime, const vector_t& initState, scalar_t f
     std::ignore = trajectorySpread(oldModeSchedule, newModeSchedule, slackIneqTrajectory_);
     std::ignore = trajectorySpread(oldModeSchedule, newModeSchedule, dualIneqTrajectory_);
   }
-  scalar_t barrierParam = settings_.initialBarrierParameter;
+  // The inequality constraints are condensed into the QP that HPIPM solves, hence the barrier parameter is warm started instead of HPIPM.
+  scalar_t barrierParam = settings_.warmStart ? barrierParameter_ : settings_.initialBarrierParameter;
   vector_array_t slackStateIneq, dualStateIneq, slackStateInputIneq, dualStateInputIneq;
   initializeSlackDualTrajectory(timeDiscretization, x, u, barrierParam, slackStateIneq, dualStateIneq, slackStateInputIneq,
                                 dualStateInputIneq);
@@ -300,6 +313,7 @@ void IpmSolver::runImpl(scalar_t initTime, const vector_t& initState, scalar_t f
   projectionMultiplierTrajectory_ = std::move(nu);
   slackIneqTrajectory_ = ipm::toDualSolution(timeDiscretization, constraintsSize_, slackStateIneq, slackStateInputIneq);
   dualIneqTrajectory_ = ipm::toDualSolution(timeDiscretization, constraintsSize_, dualStateIneq, dualStateInputIneq);
+  barrierParameter_ = barrierParam;
   problemMetrics_ = multiple_shooting::toProblemMetrics(timeDiscretization, std::move(metrics));
   computeControllerTimer_.endTimer();
 
@@ -315,6 +329,20 @@ void IpmSolver::runParallel(std::function<void(int)> taskFunction) {
   threadPool_.runParallel(std::move(taskFunction), settings_.nThreads);
 }
 
+void IpmSolver::runParallelOverNodes(int numNodes, const std::function<void(int, int)>& nodeTask, bool measureCost) {
+  if (settings_.nodePartitioning) {
+    nodePartition_.run(threadPool_, numNodes, nodeTask, measureCost);
+  } else {
+    std::atomic_int nodeIndex{0};
+    runParallel([&](int workerId) {
+      int i;
+      while ((i = nodeIndex++) < numNodes) {
+        nodeTask(workerId, i);
+      }
+    });
+  }
+}
+
 void IpmSolver::initializeCostateTrajectory(const std::vector<AnnotatedTime>& timeDiscretization, const vector_array_t& stateTrajectory,
                                             vector_array_t& costateTrajectory) const {
   costateTrajectory.clear();
@@ -440,7 +468,7 @@ void IpmSolver::initializeSlackDualTrajectory(const std::vector<AnnotatedTime>&
         std::tie(slackStateIneq[i], slackStateInputIneq[i]) =
             ipm::fromMultiplierCollection(getIntermediateDualSolutionAtTime(slackIneqTrajectory_, time));
         std::tie(dualStateIneq[i], dualStateInputIneq[i]) =
-            ipm::fromMultiplierCollection(getIntermediateDualSolutionAtTime(slackIneqTrajectory_, time));
+            ipm::fromMultiplierCollection(getIntermediateDualSolutionAtTime(dualIneqTrajectory_, time));
       } else {
         std::tie(slackStateIneq[i], slackStateInputIneq[i]) = ipm::initializeIntermediateSlackVariable(
             ocpDefinition, time, x[i], u[i], settings_.initialSlackLowerBound, settings_.initialSlackMarginRate);
@@ -475,12 +503,19 @@ IpmSolver::OcpSubproblemSolution IpmSolver::getOCPSolution(const vector_t& delta
   OcpSubproblemSolution solution;
   auto& deltaXSol = solution.deltaXSol;
   auto& deltaUSol = solution.deltaUSol;
-  hpipm_status status;
-  hpipmInterface_.resize(extractSizesFromProblem(dynamics_, lagrangian_, nullptr));
-  status = hpipmInterface_.solve(delta_x0, dynamics_, lagrangian_, nullptr, deltaXSol, deltaUSol, settings_.printSolverStatus);
+  // The inequality constraints are condensed into the Lagrangian and the equality constraints are projected, hence the QP has no
+  // constraints other than the dynamics.
+  if (settings_.qpSolverType == ipm::QpSolverType::PARALLEL_RICCATI) {
+    parallelRiccatiSolver_.solve(threadPool_, delta_x0, dynamics_, lagrangian_, deltaXSol, deltaUSol);
+
+  } else {
+    hpipmInterface_.resize(extractSizesFromProblem(dynamics_, lagrangian_, nullptr));
+    const auto status =
+        hpipmInterface_.solve(delta_x0, dynamics_, lagrangian_, nullptr, deltaXSol, deltaUSol, settings_.printSolverStatus);
 
-  if (status != hpipm_status::SUCCESS) {
-    throw std::runtime_error("[IpmSolver] Failed to solve QP");
+    if (status != hpipm_status::SUCCESS) {
+      throw std::runtime_error("[IpmSolver] Failed to solve QP");
+    }
   }
 
   // to determine if the solution is a descent direction for the cost: compute gradient(cost)' * [dx; du]
@@ -488,7 +523,9 @@ IpmSolver::OcpSubproblemSolution IpmSolver::getOCPSolution(const vector_t& delta
 
   // Extract value function
   if (settings_.createValueFunction) {
-    valueFunction_ = hpipmInterface_.getRiccatiCostToGo(dynamics_[0], lagrangian_[0]);
+    valueFunction_ = (settings_.qpSolverType == ipm::QpSolverType::PARALLEL_RICCATI)
+                         ? parallelRiccatiSolver_.getRiccatiCostToGo()
+                         : hpipmInterface_.getRiccatiCostToGo(dynamics_[0], lagrangian_[0]);
   }
 
   // Problem horizon
@@ -593,7 +630,9 @@ void IpmSolver::extractValueFunction(const std::vector<AnnotatedTime>& time, con
 PrimalSolution IpmSolver::toPrimalSolution(const std::vector<AnnotatedTime>& time, vector_array_t&& x, vector_array_t&& u) {
   if (settings_.useFeedbackPolicy) {
     ModeSchedule modeSchedule = this->getReferenceManager().getModeSchedule();
-    matrix_array_t KMatrices = hpipmInterface_.getRiccatiFeedback(dynamics_[0], lagrangian_[0]);
+    matrix_array_t KMatrices = (settings_.qpSolverType == ipm::QpSolverType::PARALLEL_RICCATI)
+                                   ? parallelRiccatiSolver_.getRiccatiFeedback()
+                                   : hpipmInterface_.getRiccatiFeedback(dynamics_[0], lagrangian_[0]);
     multiple_shooting::remapProjectedGain(constraintsProjection_, KMatrices);
     return multiple_shooting::toPrimalSolution(time, std::move(modeSchedule), std::move(x), std::move(u), std::move(KMatrices));
 
@@ -622,76 +661,12 @@ PerformanceIndex IpmSolver::setupQuadraticSubproblem(const std::vector<Annotated
   constraintsSize_.resize(N + 1);
   metrics.resize(N + 1);
 
-  std::atomic_int timeIndex{0};
-  auto parallelTask = [&](int workerId) {
+  auto nodeTask = [&](int workerId, int i) {
     // Get worker specific resources
     OptimalControlProblem& ocpDefinition = ocpDefinitions_[workerId];
 
-    int i = timeIndex++;
-    while (i < N) {
-      if (time[i].event == AnnotatedTime::Event::PreEvent) {
-        // Event node
-        auto result = multiple_shooting::setupEventNode(ocpDefinition, time[i].time, x[i], x[i + 1]);
-        metrics[i] = multiple_shooting::computeMetrics(result);
-        performance[workerId] += ipm::computePerformanceIndex(result, barrierParam, slackStateIneq[i]);
-        dynamics_[i] = std::move(result.dynamics);
-        stateInputEqConstraints_[i].resize(0, x[i].size());
-        stateIneqConstraints_[i] = std::move(result.ineqConstraints);
-        stateInputIneqConstraints_[i].resize(0, x[i].size());
-        constraintsProjection_[i].resize(0, x[i].size());
-        projectionMultiplierCoefficients_[i] = multiple_shooting::ProjectionMultiplierCoefficients();
-        constraintsSize_[i] = std::move(result.constraintsSize);
-        if (settings_.computeLagrangeMultipliers) {
-          lagrangian_[i] = multiple_shooting::evaluateLagrangianEventNode(lmd[i], lmd[i + 1], std::move(result.cost), dynamics_[i]);
-        } else {
-          lagrangian_[i] = std::move(result.cost);
-        }
-
-        ipm::condenseIneqConstraints(barrierParam, slackStateIneq[i], dualStateIneq[i], stateIneqConstraints_[i], lagrangian_[i]);
-        performance[workerId].dualFeasibilitiesSSE += multiple_shooting::evaluateDualFeasibilities(lagrangian_[i]);
-        performance[workerId].dualFeasibilitiesSSE +=
-            ipm::evaluateComplementarySlackness(barrierParam, slackStateIneq[i], dualStateIneq[i]);
-      } else {
-        // Normal, intermediate node
-        const scalar_t ti = getIntervalStart(time[i]);
-        const scalar_t dt = getIntervalDuration(time[i], time[i + 1]);
-        auto result = multiple_shooting::setupIntermediateNode(ocpDefinition, sensitivityDiscretizer_, ti, dt, x[i], x[i + 1], u[i]);
-        // Disable the state-only inequality constraints at the initial node
-        if (i == 0) {
-          result.stateIneqConstraints.setZero(0, x[i].size());
-          std::fill(result.constraintsSize.stateIneq.begin(), result.constraintsSize.stateIneq.end(), 0);
-        }
-        metrics[i] = multiple_shooting::computeMetrics(result);
-        performance[workerId] += ipm::computePerformanceIndex(result, dt, barrierParam, slackStateIneq[i], slackStateInputIneq[i]);
-        multiple_shooting::projectTranscription(result, settings_.computeLagrangeMultipliers);
-        dynamics_[i] = std::move(result.dynamics);
-        stateInputEqConstraints_[i] = std::move(result.stateInputEqConstraints);
-        stateIneqConstraints_[i] = std::move(result.stateIneqConstraints);
-        stateInputIneqConstraints_[i] = std::move(result.stateInputIneqConstraints);
-        constraintsProjection_[i] = std::move(result.constraintsProjection);
-        projectionMultiplierCoefficients_[i] = std::move(result.projectionMultiplierCoefficients);
-        constraintsSize_[i] = std::move(result.constraintsSize);
-        if (settings_.computeLagrangeMultipliers) {
-          lagrangian_[i] = multiple_shooting::evaluateLagrangianIntermediateNode(lmd[i], lmd[i + 1], nu[i], std::move(result.cost),
-                                                                                 dynamics_[i], stateInputEqConstraints_[i]);
-        } else {
-          lagrangian_[i] = std::move(result.cost);
-        }
-
-        ipm::condenseIneqConstraints(barrierParam, slackStateIneq[i], dualStateIneq[i], stateIneqConstraints_[i], lagrangian_[i]);
-        ipm::condenseIneqConstraints(barrierParam, slackStateInputIneq[i], dualStateInputIneq[i], stateInputIneqConstraints_[i],
-                                     lagrangian_[i]);
-        performance[workerId].dualFeasibilitiesSSE += multiple_shooting::evaluateDualFeasibilities(lagrangian_[i]);
-        performance[workerId].dualFeasibilitiesSSE +=
-            ipm::evaluateComplementarySlackness(barrierParam, slackStateIneq[i], dualStateIneq[i]);
-        performance[workerId].dualFeasibilitiesSSE +=
-            ipm::evaluateComplementarySlackness(barrierParam, slackStateInputIneq[i], dualStateInputIneq[i]);
-      }
-
-      i = timeIndex++;
-    }
-
-    if (i == N) {  // Only one worker will execute this
+    if (i == N) {
+      // Terminal node
       const scalar_t tN = getIntervalStart(time[N]);
       auto result = multiple_shooting::setupTerminalNode(ocpDefinition, tN, x[N]);
       metrics[i] = multiple_shooting::computeMetrics(result);
@@ -707,9 +682,66 @@ PerformanceIndex IpmSolver::setupQuadraticSubproblem(const std::vector<Annotated
       ipm::condenseIneqConstraints(barrierParam, slackStateIneq[N], dualStateIneq[N], stateIneqConstraints_[N], lagrangian_[N]);
       performance[workerId].dualFeasibilitiesSSE += multiple_shooting::evaluateDualFeasibilities(lagrangian_[N]);
       performance[workerId].dualFeasibilitiesSSE += ipm::evaluateComplementarySlackness(barrierParam, slackStateIneq[N], dualStateIneq[N]);
+    } else if (time[i].event == AnnotatedTime::Event::PreEvent) {
+      // Event node
+      auto result = multiple_shooting::setupEventNode(ocpDefinition, time[i].time, x[i], x[i + 1]);
+      metrics[i] = multiple_shooting::computeMetrics(result);
+      performance[workerId] += ipm::computePerformanceIndex(result, barrierParam, slackStateIneq[i]);
+      dynamics_[i] = std::move(result.dynamics);
+      stateInputEqConstraints_[i].resize(0, x[i].size());
+      stateIneqConstraints_[i] = std::move(result.ineqConstraints);
+      stateInputIneqConstraints_[i].resize(0, x[i].size());
+      constraintsProjection_[i].resize(0, x[i].size());
+      projectionMultiplierCoefficients_[i] = multiple_shooting::ProjectionMultiplierCoefficients();
+      constraintsSize_[i] = std::move(result.constraintsSize);
+      if (settings_.computeLagrangeMultipliers) {
+        lagrangian_[i] = multiple_shooting::evaluateLagrangianEventNode(lmd[i], lmd[i + 1], std::move(result.cost), dynamics_[i]);
+      } else {
+        lagrangian_[i] = std::move(result.cost);
+      }
+
+      ipm::condenseIneqConstraints(barrierParam, slackStateIneq[i], dualStateIneq[i], stateIneqConstraints_[i], lagrangian_[i]);
+      performance[workerId].dualFeasibilitiesSSE += multiple_shooting::evaluateDualFeasibilities(lagrangian_[i]);
+      performance[workerId].dualFeasibilitiesSSE +=
+          ipm::evaluateComplementarySlackness(barrierParam, slackStateIneq[i], dualStateIneq[i]);
+    } else {
+      // Normal, intermediate node
+      const scalar_t ti = getIntervalStart(time[i]);
+      const scalar_t dt = getIntervalDuration(time[i], time[i + 1]);
+      auto result = multiple_shooting::setupIntermediateNode(ocpDefinition, sensitivityDiscretizer_, ti, dt, x[i], x[i + 1], u[i]);
+      // Disable the state-only inequality constraints at the initial node
+      if (i == 0) {
+        result.stateIneqConstraints.setZero(0, x[i].size());
+        std::fill(result.constraintsSize.stateIneq.begin(), result.constraintsSize.stateIneq.end(), 0);
+      }
+      metrics[i] = multiple_shooting::computeMetrics(result);
+      performance[workerId] += ipm::computePerformanceIndex(result, dt, barrierParam, slackStateIneq[i], slackStateInputIneq[i]);
+      multiple_shooting::projectTranscription(result, settings_.computeLagrangeMultipliers);
+      dynamics_[i] = std::move(result.dynamics);
+      stateInputEqConstraints_[i] = std::move(result.stateInputEqConstraints);
+      stateIneqConstraints_[i] = std::move(result.stateIneqConstraints);
+      stateInputIneqConstraints_[i] = std::move(result.stateInputIneqConstraints);
+      constraintsProjection_[i] = std::move(result.constraintsProjection);
+      projectionMultiplierCoefficients_[i] = std::move(result.projectionMultiplierCoefficients);
+      constraintsSize_[i] = std::move(result.constraintsSize);
+      if (settings_.computeLagrangeMultipliers) {
+        lagrangian_[i] = multiple_shooting::evaluateLagrangianIntermediateNode(lmd[i], lmd[i + 1], nu[i], std::move(result.cost),
+                                                                               dynamics_[i], stateInputEqConstraints_[i]);
+      } else {
+        lagrangian_[i] = std::move(result.cost);
+      }
+
+      ipm::condenseIneqConstraints(barrierParam, slackStateIneq[i], dualStateIneq[i], stateIneqConstraints_[i], lagrangian_[i]);
+      ipm::condenseIneqConstraints(barrierParam, slackStateInputIneq[i], dualStateInputIneq[i], stateInputIneqConstraints_[i],
+                                   lagrangian_[i]);
+      performance[workerId].dualFeasibilitiesSSE += multiple_shooting::evaluateDualFeasibilities(lagrangian_[i]);
+      performance[workerId].dualFeasibilitiesSSE +=
+          ipm::evaluateComplementarySlackness(barrierParam, slackStateIneq[i], dualStateIneq[i]);
+      performance[workerId].dualFeasibilitiesSSE +=
+          ipm::evaluateComplementarySlackness(barrierParam, slackStateInputIneq[i], dualStateInputIneq[i]);
     }
   };
-  runParallel(std::move(parallelTask));
+  runParallelOverNodes(N + 1, nodeTask, true);
 
   // Account for initial state in performance
   const vector_t initDynamicsViolation = initState - x.front();
@@ -731,40 +763,33 @@ PerformanceIndex IpmSolver::computePerformance(const std::vector<AnnotatedTime>&
   metrics.resize(N + 1);
 
   std::vector<PerformanceIndex> performance(settings_.nThreads, PerformanceIndex());
-  std::atomic_int timeIndex{0};
-  auto parallelTask = [&](int workerId) {
+  auto nodeTask = [&](int workerId, int i) {
     // Get worker specific resources
     OptimalControlProblem& ocpDefinition = ocpDefinitions_[workerId];
 
-    int i = timeIndex++;
-    while (i < N) {
-      if (time[i].event == AnnotatedTime::Event::PreEvent) {
-        // Event node
-        metrics[i] = multiple_shooting::computeEventMetrics(ocpDefinition, time[i].time, x[i], x[i + 1]);
-        performance[workerId] += ipm::toPerformanceIndex(metrics[i], barrierParam, slackStateIneq[i]);
-      } else {
-        // Normal, intermediate node
-        const scalar_t ti = getIntervalStart(time[i]);
-        const scalar_t dt = getIntervalDuration(time[i], time[i + 1]);
-        const bool enableStateInequalityConstraints = (i > 0);
-        metrics[i] = multiple_shooting::computeIntermediateMetrics(ocpDefinition, discretizer_, ti, dt, x[i], x[i + 1], u[i]);
-        // Disable the state-only inequality constraints at the initial node
-        if (i == 0) {
-          metrics[i].stateIneqConstraint.clear();
-        }
-        performance[workerId] += ipm::toPerformanceIndex(metrics[i], dt, barrierParam, slackStateIneq[i], slackStateInputIneq[i]);
-      }
-
-      i = timeIndex++;
-    }
-
-    if (i == N) {  // Only one worker will execute this
+    if (i == N) {
+      // Terminal node
       const scalar_t tN = getIntervalStart(time[N]);
       metrics[N] = multiple_shooting::computeTerminalMetrics(ocpDefinition, tN, x[N]);
       performance[workerId] += ipm::toPerformanceIndex(metrics[N], barrierParam, slackStateIneq[N]);
+    } else if (time[i].event == AnnotatedTime::Event::PreEvent) {
+      // Event node
+      metrics[i] = multiple_shooting::computeEventMetrics(ocpDefinition, time[i].time, x[i], x[i + 1]);
+      performance[workerId] += ipm::toPerformanceIndex(metrics[i], barrierParam, slackStateIneq[i]);
+    } else {
+      // Normal, intermediate node
+      const scalar_t ti = getIntervalStart(time[i]);
+      const scalar_t dt = getIntervalDuration(time[i], time[i + 1]);
+      const bool enableStateInequalityConstraints = (i > 0);
+      metrics[i] = multiple_shooting::computeIntermediateMetrics(ocpDefinition, discretizer_, ti, dt, x[i], x[i + 1], u[i]);
+      // Disable the state-only inequality constraints at the initial node
+      if (i == 0) {
+        metrics[i].stateIneqConstraint.clear();
+      }
+      performance[workerId] += ipm::toPerformanceIndex(metrics[i], dt, barrierParam, slackStateIneq[i], slackStateInputIneq[i]);
     }
   };
-  runParallel(std::move(parallelTask));
+  runParallelOverNodes(N + 1, nodeTask, false);
 
   // Account for initial state in performance
   const vector_t initDynamicsViolation = initState - x.front();
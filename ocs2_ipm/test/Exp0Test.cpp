@@ -38,6 +38,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ocs2_core/constraint/LinearStateConstraint.h>
 #include <ocs2_core/constraint/LinearStateInputConstraint.h>
 #include <ocs2_core/initialization/DefaultInitializer.h>
+#include <ocs2_core/misc/LinearInterpolation.h>
 #include <ocs2_oc/test/EXP0.h>
 
 using namespace ocs2;
@@ -174,4 +175,111 @@ TEST(Exp0Test, Constrained) {
   for (const auto e : shiftTime) {
     solver.run(startTime + e, initState, finalTime + e);
   }
-}
\ No newline at end of file
+}
+
+TEST(Exp0Test, WarmStart) {
+  constexpr size_t STATE_DIM = 2;
+  constexpr size_t INPUT_DIM = 1;
+
+  // Solver settings
+  auto getSettings = [](bool warmStart) {
+    ipm::Settings s;
+    s.dt = 0.01;
+    s.ipmIteration = 20;
+    s.nThreads = 1;
+    s.initialBarrierParameter = 1.0e-02;
+    s.targetBarrierParameter = 1.0e-04;
+    s.warmStart = warmStart;
+    return s;
+  };
+
+  const scalar_array_t initEventTimes{0.1897};
+  const size_array_t modeSequence{0, 1};
+  auto referenceManagerPtr = getExp0ReferenceManager(initEventTimes, modeSequence);
+  auto problem = createExp0Problem(referenceManagerPtr);
+
+  // add an input bound which is active at the beginning of the horizon
+  const vector_t e = (vector_t(2) << 2.0, 2.0).finished();
+  const matrix_t C = matrix_t::Zero(2, STATE_DIM);
+  const matrix_t D = (matrix_t(2, INPUT_DIM) << 1.0, -1.0).finished();
+  problem.inequalityConstraintPtr->add("ubound", std::make_unique<LinearStateInputConstraint>(e, C, D));
+
+  const scalar_t startTime = 0.0;
+  const scalar_t finalTime = 2.0;
+  const vector_t initState = (vector_t(STATE_DIM) << 0.0, 2.0).finished();
+
+  DefaultInitializer zeroInitializer(INPUT_DIM);
+
+  // Run a few MPC calls in a receding horizon, each one starting from the state predicted by the previous solution. Both solvers
+  // initialize the primal, slack, and dual variables with the previous solution, but only the warm started one continues with the
+  // barrier parameter it reached in the previous call.
+  auto getNumIterationsOfRecedingHorizon = [&](bool warmStart) {
+    IpmSolver solver(getSettings(warmStart), problem, zeroInitializer);
+    solver.setReferenceManager(referenceManagerPtr);
+    solver.run(startTime, initState, finalTime);
+    size_t numIterations = 0;
+    for (const scalar_t shiftTime : {0.01, 0.02, 0.03, 0.04, 0.05}) {
+      const auto& primalSolution = solver.primalSolution(finalTime);
+      const vector_t state =
+          LinearInterpolation::interpolate(startTime + shiftTime, primalSolution.timeTrajectory_, primalSolution.stateTrajectory_);
+      solver.run(startTime + shiftTime, state, finalTime + shiftTime);
+      numIterations += solver.getIterationsLog().size();
+    }
+    return numIterations;
+  };
+  EXPECT_LT(getNumIterationsOfRecedingHorizon(true), getNumIterationsOfRecedingHorizon(false));
+}
+
+TEST(Exp0Test, ParallelRiccati) {
+  constexpr size_t STATE_DIM = 2;
+  constexpr size_t INPUT_DIM = 1;
+  constexpr scalar_t tol = 1e-6;
+
+  // Solver settings
+  auto getSettings = [](ipm::QpSolverType qpSolverType) {
+    ipm::Settings s;
+    s.dt = 0.01;
+    s.ipmIteration = 20;
+    s.nThreads = 4;
+    s.initialBarrierParameter = 1.0e-02;
+    s.targetBarrierParameter = 1.0e-04;
+    s.qpSolverType = qpSolverType;
+    return s;
+  };
+
+  const scalar_array_t initEventTimes{0.1897};
+  const size_array_t modeSequence{0, 1};
+  auto referenceManagerPtr = getExp0ReferenceManager(initEventTimes, modeSequence);
+  auto problem = createExp0Problem(referenceManagerPtr);
+
+  // add an input bound
+  const vector_t e = (vector_t(2) << 2.0, 2.0).finished();
+  const matrix_t C = matrix_t::Zero(2, STATE_DIM);
+  const matrix_t D = (matrix_t(2, INPUT_DIM) << 1.0, -1.0).finished();
+  problem.inequalityConstraintPtr->add("ubound", std::make_unique<LinearStateInputConstraint>(e, C, D));
+
+  const scalar_t startTime = 0.0;
+  const scalar_t finalTime = 2.0;
+  const vector_t initState = (vector_t(STATE_DIM) << 0.0, 2.0).finished();
+
+  DefaultInitializer zeroInitializer(INPUT_DIM);
+
+  auto solve = [&](ipm::QpSolverType qpSolverType) {
+    IpmSolver solver(getSettings(qpSolverType), problem, zeroInitializer);
+    solver.setReferenceManager(referenceManagerPtr);
+    solver.run(startTime, initState, finalTime);
+    return solver.primalSolution(finalTime);
+  };
+  const auto withHpipm = solve(ipm::QpSolverType::HPIPM);
+  const auto withParallelRiccati = solve(ipm::QpSolverType::PARALLEL_RICCATI);
+
+  ASSERT_EQ(withHpipm.timeTrajectory_.size(), withParallelRiccati.timeTrajectory_.size());
+  for (int i = 0; i < withHpipm.timeTrajectory_.size(); i++) {
+    ASSERT_DOUBLE_EQ(withHpipm.timeTrajectory_[i], withParallelRiccati.timeTrajectory_[i]);
+    ASSERT_TRUE(withHpipm.stateTrajectory_[i].isApprox(withParallelRiccati.stateTrajectory_[i], tol));
+    ASSERT_TRUE(withHpipm.inputTrajectory_[i].isApprox(withParallelRiccati.inputTrajectory_[i], tol));
+    const auto t = withHpipm.timeTrajectory_[i];
+    const auto& x = withHpipm.stateTrajectory_[i];
+    ASSERT_TRUE(withHpipm.controllerPtr_->computeInput(t, x).isApprox(withParallelRiccati.controllerPtr_->computeInput(t, x), tol));
+  }
+}
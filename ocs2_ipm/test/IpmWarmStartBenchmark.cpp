@@ -0,0 +1,110 @@
+/******************************************************************************
+Copyright (c) 2017, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include "ocs2_ipm/IpmSolver.h"
+
+#include <ocs2_core/constraint/LinearStateInputConstraint.h>
+#include <ocs2_core/initialization/DefaultInitializer.h>
+#include <ocs2_core/misc/LinearInterpolation.h>
+#include <ocs2_oc/test/EXP0.h>
+
+namespace {
+
+/**
+ * Solves the input constrained EXP0 problem in a receding horizon as consecutive MPC calls do, each call starting 10 ms later with the
+ * state that the previous solution predicts. state.range(0) selects ipm::Settings::warmStart. The counter "iterations" is the average
+ * number of IPM iterations per call.
+ */
+void ipmWarmStart(benchmark::State& state) {
+  using namespace ocs2;
+  constexpr size_t STATE_DIM = 2;
+  constexpr size_t INPUT_DIM = 1;
+  constexpr scalar_t timeHorizon = 2.0;
+  constexpr scalar_t mpcTimeStep = 0.01;
+
+  ipm::Settings settings;
+  settings.dt = 0.01;
+  settings.ipmIteration = 20;
+  settings.nThreads = 1;
+  settings.initialBarrierParameter = 1.0e-02;
+  settings.targetBarrierParameter = 1.0e-04;
+  settings.warmStart = state.range(0) != 0;
+
+  const scalar_array_t initEventTimes{0.1897};
+  const size_array_t modeSequence{0, 1};
+  auto referenceManagerPtr = getExp0ReferenceManager(initEventTimes, modeSequence);
+  auto problem = createExp0Problem(referenceManagerPtr);
+
+  // input bound which is active at the beginning of the horizon
+  const vector_t e = (vector_t(2) << 2.0, 2.0).finished();
+  const matrix_t C = matrix_t::Zero(2, STATE_DIM);
+  const matrix_t D = (matrix_t(2, INPUT_DIM) << 1.0, -1.0).finished();
+  problem.inequalityConstraintPtr->add("ubound", std::make_unique<LinearStateInputConstraint>(e, C, D));
+
+  DefaultInitializer zeroInitializer(INPUT_DIM);
+  IpmSolver solver(settings, problem, zeroInitializer);
+  solver.setReferenceManager(referenceManagerPtr);
+
+  // The first call starts from scratch with and without warm start
+  scalar_t initTime = 0.0;
+  vector_t initState = (vector_t(STATE_DIM) << 0.0, 2.0).finished();
+  solver.run(initTime, initState, initTime + timeHorizon);
+
+  size_t numCalls = 0;
+  size_t numIterations = 0;
+  for (auto _ : state) {
+    const auto& primalSolution = solver.primalSolution(initTime + timeHorizon);
+    initState = LinearInterpolation::interpolate(initTime + mpcTimeStep, primalSolution.timeTrajectory_, primalSolution.stateTrajectory_);
+    initTime += mpcTimeStep;
+    solver.run(initTime, initState, initTime + timeHorizon);
+    numIterations += solver.getIterationsLog().size();
+    ++numCalls;
+
+    // restart the receding horizon before it reaches the end of the mode schedule
+    if (initTime > 1.0) {
+      state.PauseTiming();
+      solver.reset();
+      initTime = 0.0;
+      initState = (vector_t(STATE_DIM) << 0.0, 2.0).finished();
+      solver.run(initTime, initState, initTime + timeHorizon);
+      state.ResumeTiming();
+    }
+  }
+  state.counters["iterations"] = ::benchmark::Counter(numIterations, ::benchmark::Counter::kAvgIterations);
+}
+
+}  // unnamed namespace
+
+BENCHMARK(ipmWarmStart)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
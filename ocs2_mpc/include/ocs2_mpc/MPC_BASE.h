@@ -67,6 +67,14 @@ class MPC_BASE {
    */
   virtual bool run(scalar_t currentTime, const vector_t& currentState);
 
+  /**
+   * The preparation phase of the next MPC iteration. Solvers with a real-time iteration scheme use it to linearize around the shifted
+   * solution before the next observation arrives, which reduces the latency of the next run() call. Does nothing before the first run.
+   *
+   * @param [in] nextTime: The expected time of the next run() call.
+   */
+  virtual void prepare(scalar_t nextTime);
+
   /** Gets a pointer to the underlying solver used in the MPC. */
   virtual SolverBase* getSolverPtr() = 0;
 
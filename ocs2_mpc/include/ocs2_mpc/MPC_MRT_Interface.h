@@ -32,12 +32,14 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <condition_variable>
 #include <csignal>
 #include <ctime>
+#include <future>
 #include <iostream>
 #include <string>
 #include <thread>
 
 #include <ocs2_core/misc/Benchmark.h>
 #include <ocs2_core/model_data/Multiplier.h>
+#include <ocs2_core/thread_support/ThreadPool.h>
 #include "ocs2_mpc/MPC_BASE.h"
 #include "ocs2_mpc/MRT_BASE.h"
 
@@ -55,7 +57,7 @@ class MPC_MRT_Interface final : public MRT_BASE {
    */
   explicit MPC_MRT_Interface(MPC_BASE& mpc);
 
-  ~MPC_MRT_Interface() override = default;
+  ~MPC_MRT_Interface() override;
 
   void resetMpcNode(const TargetTrajectories& initTargetTrajectories) override;
 
@@ -69,7 +71,9 @@ class MPC_MRT_Interface final : public MRT_BASE {
 
   /**
    * Advance the mpc module for one iteration. The evaluation methods can be called while this method is running. They will evaluate the
-   * control law that was up-to-date at the last updatePolicy() call.
+   * control law that was up-to-date at the last updatePolicy() call. After the new policy is buffered, the next MPC iteration is prepared
+   * (see MPC_BASE::prepare) for the expected time of the next observation. The preparation runs asynchronously after this method
+   * returns, and the next call waits for it.
    */
   void advanceMpc();
 
@@ -123,12 +127,19 @@ class MPC_MRT_Interface final : public MRT_BASE {
    */
   void copyToBuffer(const SystemObservation& mpcInitObservation);
 
+  /** Waits for the preparation of the next MPC iteration, if any, and rethrows its exception. */
+  void waitForPreparation() const;
+
   MPC_BASE& mpc_;
   benchmark::RepeatedTimer mpcTimer_;
 
   // MPC inputs
   SystemObservation currentObservation_;
   std::mutex observationMutex_;
+
+  // the preparation of the next MPC iteration runs on this thread, off the path from the observation to the policy
+  ThreadPool preparationThreadPool_{1};
+  mutable std::future<void> preparationFuture_;
 };
 
 }  // namespace ocs2
@@ -31,6 +31,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <Eigen/Dense>
 
+#include <array>
 #include <atomic>
 #include <cstddef>
 #include <memory>
@@ -54,6 +55,12 @@ namespace ocs2 {
 /**
  * This class implements core MRT (Model Reference Tracking) functionality.
  * The responsibility of filling the buffer variables is left to the deriving classes.
+ *
+ * The policies are handed over from moveToBuffer() to updatePolicy() through a triple buffer: the producer fills a back
+ * buffer and atomically exchanges it with the middle buffer, while updatePolicy() atomically exchanges the active buffer
+ * with the middle one if it holds a new policy. Therefore, updatePolicy() never blocks nor allocates or frees memory; the
+ * outdated policies are destroyed on the producer side. The only exception is reset(), which is applied to the active policy by
+ * the next call to updatePolicy().
  */
 class MRT_BASE {
  public:
@@ -62,7 +69,9 @@ class MRT_BASE {
   virtual ~MRT_BASE() = default;
 
   /**
-   * Resets the class to its instantiated state.
+   * Resets the class to its instantiated state. This method can be called concurrently to updatePolicy(). An unconsumed policy is
+   * discarded immediately, while the active policy is kept until the next call to updatePolicy(), which clears it. Therefore,
+   * the policy accessors remain valid until then.
    */
   void reset();
 
@@ -142,6 +151,7 @@ class MRT_BASE {
    * Checks the data buffer for an update of the MPC policy. If a new policy
    * is available on the buffer this method will load it to the in-use policy.
    * This method also calls the modifyActiveSolution() method.
+   * This method is wait-free and should be called from a single thread, i.e., the control loop.
    *
    * @return True if the policy is updated.
    */
@@ -163,31 +173,43 @@ class MRT_BASE {
                     std::unique_ptr<PerformanceIndex> performanceIndicesPtr);
 
  private:
-  /** Calls modifyActiveSolution on all mrt observers. This function is called while holding a policyBufferMutex lock */
+  /** A policy and its associated data */
+  struct PolicyBuffer {
+    std::unique_ptr<CommandData> commandPtr;
+    std::unique_ptr<PrimalSolution> primalSolutionPtr;
+    std::unique_ptr<PerformanceIndex> performanceIndicesPtr;
+    size_t resetCount = 0;  // the number of reset() calls before the policy was published
+  };
+
+  /** Frees the policy of the given buffer */
+  static void clearBuffer(PolicyBuffer& buffer);
+
+  /** Calls modifyActiveSolution on all mrt observers. This function is called on the active buffer in updatePolicy */
   void modifyActiveSolution(const CommandData& command, PrimalSolution& primalSolution);
 
-  /** Calls modifyBufferedSolution on all mrt observers. This function is called while holding a policyBufferMutex lock */
+  /** Calls modifyBufferedSolution on all mrt observers. This function is called on the back buffer while holding a producerMutex_ lock */
   void modifyBufferedSolution(const CommandData& commandBuffer, PrimalSolution& primalSolutionBuffer);
 
+  const PolicyBuffer& activeBuffer() const { return policyBuffers_[activeBufferIndex_]; }
+
   // flags on state of the class
   std::atomic_bool policyReceivedEver_;
-  bool newPolicyInBuffer_;  // whether a new policy is waiting to be swapped in
 
-  // variables related to the MPC output
-  std::unique_ptr<CommandData> activeCommandPtr_;
-  std::unique_ptr<CommandData> bufferCommandPtr_;
-  std::unique_ptr<PrimalSolution> activePrimalSolutionPtr_;
-  std::unique_ptr<PrimalSolution> bufferPrimalSolutionPtr_;
-  std::unique_ptr<PerformanceIndex> activePerformanceIndicesPtr_;
-  std::unique_ptr<PerformanceIndex> bufferPerformanceIndicesPtr_;
+  // triple buffer of the MPC output
+  static constexpr size_t newPolicyFlag_ = 4;  // set on middleBufferIndex_ if the middle buffer has not been consumed yet
+  std::array<PolicyBuffer, 3> policyBuffers_;
+  size_t activeBufferIndex_;               // only accessed by updatePolicy()
+  size_t backBufferIndex_;                 // only accessed by moveToBuffer()
+  std::atomic<size_t> middleBufferIndex_;  // the buffer index, combined with newPolicyFlag_
+  std::atomic<size_t> resetCount_;         // incremented by reset(), older active policies are cleared by updatePolicy()
 
   // thread safety
-  mutable std::mutex bufferMutex_;  // for policy variables with the prefix (buffer*)
-  const size_t mrtTrylockWarningThreshold_ = 5;
-  size_t mrtTrylockWarningCount_;
+  std::mutex producerMutex_;  // serializes the calls to moveToBuffer() and reset()
 
   // variables needed for policy evaluation
   std::unique_ptr<RolloutBase> rolloutPtr_;
+  ContiguousTrajectory rolloutTrajectory_;  // reused by rolloutPolicy()
+  LinearInterpolation::TimeSegmentHint timeSegmentHint_;
 
   std::vector<std::shared_ptr<MrtObserver>> observerPtrArray_;
 };
@@ -0,0 +1,75 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <ocs2_core/Types.h>
+
+namespace ocs2 {
+
+/** The quantization of the controller data in a compact policy. The values match the ENCODING_* constants of the policy message. */
+enum class PolicyEncoding : uint8_t {
+  NONE = 0,     // the policy is not compressed
+  FLOAT32 = 1,  // single precision
+  FLOAT16 = 2,  // the controller data is rounded to half precision
+  INT16 = 3,    // the controller data of each node is quantized to 16-bit integers with a scale factor
+  INT8 = 4      // as INT16 with 8-bit integers
+};
+
+/** A policy in single precision as it is sent to the MRT: the trajectories and the flattened controller data of each node. */
+struct FlatPolicy {
+  scalar_array_t timeTrajectory;
+  std::vector<std::vector<float>> stateTrajectory;
+  std::vector<std::vector<float>> inputTrajectory;
+  std::vector<std::vector<float>> controllerData;  // the output of ControllerBase::flatten()
+};
+
+/**
+ * Encodes a policy compactly. The states and the inputs are kept in single precision, while the controller data, i.e., the feedforward
+ * inputs and the feedback gains, is quantized according to the encoding. Each policy is encoded on its own.
+ *
+ * @param [in] encoding: The quantization of the controller data. It cannot be PolicyEncoding::NONE.
+ * @param [in] policy: The policy.
+ * @return The compact policy. The time trajectory is not part of the data and should be sent along.
+ */
+std::vector<uint8_t> encodePolicy(PolicyEncoding encoding, const FlatPolicy& policy);
+
+/**
+ * Decodes a compact policy of encodePolicy().
+ *
+ * @param [in] timeTrajectory: The time trajectory of the policy.
+ * @param [in] compactPolicy: The compact policy.
+ * @param [out] policy: The decoded policy.
+ */
+void decodePolicy(const scalar_array_t& timeTrajectory, const std::vector<uint8_t>& compactPolicy, FlatPolicy& policy);
+
+}  // namespace ocs2
@@ -0,0 +1,132 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <ocs2_core/misc/Benchmark.h>
+#include <ocs2_oc/oc_data/PerformanceIndex.h>
+#include <ocs2_oc/oc_data/PrimalSolution.h>
+
+#include "ocs2_mpc/CommandData.h"
+#include "ocs2_mpc/MPC_BASE.h"
+#include "ocs2_mpc/shared_memory/SharedMemoryChannel.h"
+
+namespace ocs2 {
+
+/**
+ * This class implements the MPC side of the communication through POSIX shared memory. It is the counterpart of
+ * MRT_SharedMemory_Interface and does not depend on ROS.
+ *
+ * It creates the channels "channelPrefix_mpc_observation", "channelPrefix_mpc_policy", and "channelPrefix_mpc_reset". On every new
+ * observation, the MPC is run and the policy is written directly into the shared memory of the policy channel.
+ */
+class MPC_SharedMemory_Interface {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param [in] mpc: The underlying MPC class to be used.
+   * @param [in] channelPrefix: The robot's name.
+   * @param [in] policyCapacity: The maximum size of a policy message in bytes.
+   */
+  explicit MPC_SharedMemory_Interface(MPC_BASE& mpc, std::string channelPrefix = "anonymousRobot", size_t policyCapacity = 16 << 20);
+
+  /**
+   * Destructor. Removes the channels.
+   */
+  virtual ~MPC_SharedMemory_Interface() = default;
+
+  /**
+   * Resets the class to its instantiation state.
+   *
+   * @param [in] initTargetTrajectories: The initial desired cost trajectories.
+   */
+  void resetMpcNode(TargetTrajectories&& initTargetTrajectories);
+
+  /**
+   * Waits for a reset request or a new observation and processes it. If an observation is received before the MPC has been reset,
+   * it is discarded.
+   *
+   * @param [in] timeout: The maximum waiting time.
+   * @return True if a new policy is published.
+   */
+  bool spinOnce(std::chrono::microseconds timeout = std::chrono::milliseconds(100));
+
+  /**
+   * Processes the incoming messages until shutdown() is called.
+   */
+  void spin();
+
+  /**
+   * Stops spinning.
+   */
+  void shutdown() { terminate_ = true; }
+
+ protected:
+  /**
+   * Runs the MPC on the observation and publishes the policy.
+   *
+   * @param [in] currentObservation: The current observation.
+   * @return True if a new policy is published.
+   */
+  bool mpcObservationCallback(const SystemObservation& currentObservation);
+
+  /*
+   * Variables
+   */
+  MPC_BASE& mpc_;
+  std::string channelPrefix_;
+
+  SharedMemoryChannel observationChannel_;
+  SharedMemoryChannel policyChannel_;
+  SharedMemoryChannel resetChannel_;
+  uint64_t observationSequence_ = 0;
+  uint64_t resetSequence_ = 0;
+  std::vector<char> messageBuffer_;
+
+  CommandData commandData_;
+  PrimalSolution primalSolution_;
+  PerformanceIndex performanceIndices_;
+
+  benchmark::RepeatedTimer mpcTimer_;
+
+  // MPC reset
+  std::mutex resetMutex_;
+  std::atomic_bool resetRequestedEver_{false};
+  std::atomic_bool terminate_{false};
+};
+
+}  // namespace ocs2
@@ -0,0 +1,92 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ocs2_mpc/MRT_BASE.h"
+#include "ocs2_mpc/shared_memory/SharedMemoryChannel.h"
+
+namespace ocs2 {
+
+/**
+ * This class implements MRT (Model Reference Tracking) communication interface using POSIX shared memory. It is a ROS-free
+ * alternative to MRT_ROS_Interface for MPC and MRT processes on the same machine, see MPC_SharedMemory_Interface.
+ *
+ * Writing an observation is wait-free and copies it directly into the shared memory. Reading a policy takes one copy of the message
+ * and its conversion to the PrimalSolution, which happens in spinMRT().
+ */
+class MRT_SharedMemory_Interface : public MRT_BASE {
+ public:
+  /**
+   * Constructor
+   *
+   * @param [in] channelPrefix: The prefix defines the names for: observation's channel "channelPrefix_mpc_observation",
+   * policy's channel "channelPrefix_mpc_policy", and MPC reset channel "channelPrefix_mpc_reset".
+   */
+  explicit MRT_SharedMemory_Interface(std::string channelPrefix = "anonymousRobot");
+
+  /**
+   * Destructor
+   */
+  ~MRT_SharedMemory_Interface() override = default;
+
+  /**
+   * Opens the channels created by the MPC process.
+   *
+   * @param [in] timeout: Maximum time to wait for the MPC process to create the channels.
+   */
+  void connect(std::chrono::milliseconds timeout = std::chrono::seconds(10));
+
+  void resetMpcNode(const TargetTrajectories& initTargetTrajectories) override;
+
+  void setCurrentObservation(const SystemObservation& currentObservation) override;
+
+  /**
+   * Checks the policy channel and moves a new policy into the buffer. Call updatePolicy() to activate it.
+   *
+   * @return True if a new policy is received.
+   */
+  bool spinMRT();
+
+ private:
+  std::string channelPrefix_;
+
+  std::unique_ptr<SharedMemoryChannel> observationChannelPtr_;
+  std::unique_ptr<SharedMemoryChannel> policyChannelPtr_;
+  std::unique_ptr<SharedMemoryChannel> resetChannelPtr_;
+  uint64_t policySequence_ = 0;
+  std::vector<char> policyMessage_;
+};
+
+}  // namespace ocs2
@@ -0,0 +1,136 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace ocs2 {
+
+/**
+ * A single-writer channel in POSIX shared memory which transports the latest message between two processes.
+ *
+ * The messages are written to a ring of slots. Every slot is guarded by a sequence lock: its version is odd while the writer
+ * fills it. The writer never blocks and never allocates; it serializes directly into the shared memory. A reader copies the
+ * latest complete message into its own buffer and retries if the writer has started to overwrite the slot in the meantime.
+ * With two or more slots, a reader only retries if it is overtaken by at least numSlots - 1 writes during a single copy.
+ *
+ * The process that creates the channel owns it and removes the shared memory segment on destruction. Any number of processes
+ * can open the channel, but only one of them may write to it.
+ */
+class SharedMemoryChannel {
+ public:
+  /**
+   * Creates a channel. An existing channel with the same name is replaced.
+   *
+   * @param [in] name: Name of the shared memory segment, e.g. "anonymousRobot_mpc_policy".
+   * @param [in] slotCapacity: Maximum size of a message in bytes.
+   * @param [in] numSlots: Number of slots in the ring. At least two for double buffering.
+   */
+  SharedMemoryChannel(const std::string& name, size_t slotCapacity, size_t numSlots = 2);
+
+  /**
+   * Opens a channel which has been created by another process.
+   *
+   * @param [in] name: Name of the shared memory segment.
+   * @param [in] timeout: Maximum time to wait for the channel to be created.
+   */
+  SharedMemoryChannel(const std::string& name, std::chrono::milliseconds timeout);
+
+  /** Unmaps the channel. The owner also removes the shared memory segment. */
+  ~SharedMemoryChannel();
+
+  SharedMemoryChannel(const SharedMemoryChannel&) = delete;
+  SharedMemoryChannel& operator=(const SharedMemoryChannel&) = delete;
+
+  /**
+   * Publishes a message. Wait-free for the writer.
+   *
+   * @param [in] size: Size of the message in bytes.
+   * @param [in] serialize: Writes the message of the given size to the provided memory.
+   * @return The sequence number of the message, starting from 1.
+   */
+  uint64_t write(size_t size, const std::function<void(char*)>& serialize);
+
+  /**
+   * Copies the latest message if it is newer than the given sequence number.
+   *
+   * @param [out] buffer: The message. Its capacity is reused, hence no allocation after the first message of maximum size.
+   * @param [in, out] sequence: The sequence number of the last read message. Updated to the one of the returned message.
+   * @return True if a new message is copied.
+   */
+  bool read(std::vector<char>& buffer, uint64_t& sequence) const;
+
+  /**
+   * Waits until a message newer than the given sequence number is published. Spins for a short time before it starts to sleep in
+   * intervals of the poll period.
+   *
+   * @return True if a new message is available, false on timeout.
+   */
+  bool waitForMessage(uint64_t sequence, std::chrono::microseconds timeout,
+                      std::chrono::microseconds pollPeriod = std::chrono::microseconds(50)) const;
+
+  /** The sequence number of the latest published message, zero if no message has been published. */
+  uint64_t getSequence() const;
+
+  /** Marks the messages up to the given sequence number as processed. Called by the reader. */
+  void acknowledge(uint64_t sequence);
+
+  /** The sequence number of the last processed message. */
+  uint64_t getAcknowledgedSequence() const;
+
+  /** Maximum size of a message in bytes. */
+  size_t getSlotCapacity() const;
+
+  /** The name of the shared memory segment. */
+  const std::string& getName() const { return name_; }
+
+ private:
+  struct Header;
+  struct SlotHeader;
+
+  void map(size_t size);
+  SlotHeader& getSlotHeader(size_t slotIndex) const;
+  char* getSlotData(size_t slotIndex) const;
+
+  std::string name_;
+  bool isOwner_;
+  int fileDescriptor_ = -1;
+  void* memoryPtr_ = nullptr;
+  size_t memorySize_ = 0;
+  Header* headerPtr_ = nullptr;
+};
+
+}  // namespace ocs2
@@ -0,0 +1,87 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <ocs2_core/reference/TargetTrajectories.h>
+#include <ocs2_oc/oc_data/PerformanceIndex.h>
+#include <ocs2_oc/oc_data/PrimalSolution.h>
+
+#include "ocs2_mpc/CommandData.h"
+#include "ocs2_mpc/SystemObservation.h"
+#include "ocs2_mpc/shared_memory/SharedMemoryChannel.h"
+
+namespace ocs2 {
+namespace shared_memory_conversions {
+
+/*
+ * The messages are written in a flat binary layout in native byte order, directly into the shared memory slot of the channel.
+ * Unlike the ROS messages, the values are kept in double precision.
+ */
+
+/** Writes the observation message to the channel. */
+uint64_t writeObservation(SharedMemoryChannel& channel, const SystemObservation& observation);
+
+/** Reads the observation message. */
+SystemObservation readObservation(const std::vector<char>& message);
+
+/** Writes the target trajectories message to the channel. */
+uint64_t writeTargetTrajectories(SharedMemoryChannel& channel, const TargetTrajectories& targetTrajectories);
+
+/** Reads the target trajectories message. */
+TargetTrajectories readTargetTrajectories(const std::vector<char>& message);
+
+/**
+ * Writes the MPC policy message to the channel. Only the feedforward and the linear controllers are supported.
+ *
+ * @param [in] channel: The policy channel.
+ * @param [in] primalSolution: The policy data of the MPC.
+ * @param [in] commandData: The command data of the MPC.
+ * @param [in] performanceIndices: The performance indices data of the solver.
+ * @return The sequence number of the message.
+ */
+uint64_t writePolicy(SharedMemoryChannel& channel, const PrimalSolution& primalSolution, const CommandData& commandData,
+                     const PerformanceIndex& performanceIndices);
+
+/**
+ * Reads the MPC policy message.
+ *
+ * @param [in] message: The policy message.
+ * @param [out] commandData: The MPC command data
+ * @param [out] primalSolution: The MPC policy data
+ * @param [out] performanceIndices: The MPC performance indices data
+ */
+void readPolicy(const std::vector<char>& message, CommandData& commandData, PrimalSolution& primalSolution,
+                PerformanceIndex& performanceIndices);
+
+}  // namespace shared_memory_conversions
+}  // namespace ocs2
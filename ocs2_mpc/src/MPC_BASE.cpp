@@ -89,4 +89,14 @@ bool MPC_BASE::run(scalar_t currentTime, const vector_t& currentState) {
   return true;
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void MPC_BASE::prepare(scalar_t nextTime) {
+  if (initRun_) {
+    return;
+  }
+  getSolverPtr()->prepare(nextTime, nextTime + mpcSettings_.timeHorizon_);
+}
+
 }  // namespace ocs2
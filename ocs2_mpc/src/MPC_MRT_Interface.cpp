@@ -41,10 +41,21 @@ MPC_MRT_Interface::MPC_MRT_Interface(MPC_BASE& mpc) : mpc_(mpc) {
   mpcTimer_.reset();
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+MPC_MRT_Interface::~MPC_MRT_Interface() {
+  // the preparation uses the MPC, hence it should be completed before the interface is destroyed
+  if (preparationFuture_.valid()) {
+    preparationFuture_.wait();
+  }
+}
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
 void MPC_MRT_Interface::resetMpcNode(const TargetTrajectories& initTargetTrajectories) {
+  waitForPreparation();
   mpc_.reset();
   mpc_.getSolverPtr()->getReferenceManager().setTargetTrajectories(initTargetTrajectories);
   mpcTimer_.reset();
@@ -79,6 +90,9 @@ void MPC_MRT_Interface::advanceMpc() {
   // measure the delay in running MPC
   mpcTimer_.startTimer();
 
+  // the solver is used by the preparation of this iteration until it is completed
+  waitForPreparation();
+
   SystemObservation currentObservation;
   {
     std::lock_guard<std::mutex> lock(observationMutex_);
@@ -110,6 +124,12 @@ void MPC_MRT_Interface::advanceMpc() {
     std::cerr << "\n###   Average : " << mpcTimer_.getAverageInMilliseconds() << "[ms].";
     std::cerr << "\n###   Latest  : " << mpcTimer_.getLastIntervalInMilliseconds() << "[ms]." << std::endl;
   }
+
+  // prepare the next iteration, expected after one MPC period, while the caller uses the new policy
+  const scalar_t mpcPeriod = (mpc_.settings().mpcDesiredFrequency_ > 0) ? 1.0 / mpc_.settings().mpcDesiredFrequency_
+                                                                        : mpcTimer_.getAverageInMilliseconds() * 1e-3;
+  const scalar_t nextTime = currentObservation.time + mpcPeriod;
+  preparationFuture_ = preparationThreadPool_.run([this, nextTime](int) { mpc_.prepare(nextTime); });
 }
 
 /******************************************************************************************************/
@@ -135,6 +155,15 @@ void MPC_MRT_Interface::copyToBuffer(const SystemObservation& mpcInitObservation
   this->moveToBuffer(std::move(commandPtr), std::move(primalSolutionPtr), std::move(performanceIndicesPtr));
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void MPC_MRT_Interface::waitForPreparation() const {
+  if (preparationFuture_.valid()) {
+    preparationFuture_.get();
+  }
+}
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
@@ -152,6 +181,7 @@ matrix_t MPC_MRT_Interface::getLinearFeedbackGain(scalar_t time) {
 /******************************************************************************************************/
 /******************************************************************************************************/
 ScalarFunctionQuadraticApproximation MPC_MRT_Interface::getValueFunction(scalar_t time, const vector_t& state) const {
+  waitForPreparation();
   return mpc_.getSolverPtr()->getValueFunction(time, state);
 }
 
@@ -159,6 +189,7 @@ ScalarFunctionQuadraticApproximation MPC_MRT_Interface::getValueFunction(scalar_
 /******************************************************************************************************/
 /******************************************************************************************************/
 vector_t MPC_MRT_Interface::getStateInputEqualityConstraintLagrangian(scalar_t time, const vector_t& state) const {
+  waitForPreparation();
   return mpc_.getSolverPtr()->getStateInputEqualityConstraintLagrangian(time, state);
 }
 
@@ -166,6 +197,7 @@ vector_t MPC_MRT_Interface::getStateInputEqualityConstraintLagrangian(scalar_t t
 /******************************************************************************************************/
 /******************************************************************************************************/
 MultiplierCollection MPC_MRT_Interface::getIntermediateDualSolution(scalar_t time) const {
+  waitForPreparation();
   return mpc_.getSolverPtr()->getIntermediateDualSolution(time);
 }
 
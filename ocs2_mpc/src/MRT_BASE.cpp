@@ -33,10 +33,12 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 namespace ocs2 {
 
+constexpr size_t MRT_BASE::newPolicyFlag_;
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
-MRT_BASE::MRT_BASE() {
+MRT_BASE::MRT_BASE() : activeBufferIndex_(0), backBufferIndex_(2), middleBufferIndex_(1), resetCount_(0) {
   reset();
 }
 
@@ -44,26 +46,28 @@ MRT_BASE::MRT_BASE() {
 /******************************************************************************************************/
 /******************************************************************************************************/
 void MRT_BASE::reset() {
-  std::lock_guard<std::mutex> lock(bufferMutex_);
+  std::lock_guard<std::mutex> lock(producerMutex_);
 
   policyReceivedEver_ = false;
-  newPolicyInBuffer_ = false;
-  mrtTrylockWarningCount_ = 0;
-
-  activeCommandPtr_.reset();
-  bufferCommandPtr_.reset();
-  activePrimalSolutionPtr_.reset();
-  bufferPrimalSolutionPtr_.reset();
-  activePerformanceIndicesPtr_.reset();
-  bufferPerformanceIndicesPtr_.reset();
+
+  // Withdraw an unconsumed policy. Once the flag is cleared, updatePolicy() cannot take the middle buffer anymore and it is owned
+  // by the producer side, the same as the back buffer.
+  const auto middleBufferIndex = middleBufferIndex_.fetch_and(~newPolicyFlag_, std::memory_order_acq_rel) & ~newPolicyFlag_;
+  clearBuffer(policyBuffers_[middleBufferIndex]);
+  clearBuffer(policyBuffers_[backBufferIndex_]);
+
+  // the active buffer is owned by the consumer, therefore it is cleared in the next call to updatePolicy() if it was published
+  // before this reset
+  resetCount_.fetch_add(1, std::memory_order_release);
 }
 
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
 const CommandData& MRT_BASE::getCommand() const {
-  if (activeCommandPtr_ != nullptr) {
-    return *activeCommandPtr_;
+  const auto& commandPtr = activeBuffer().commandPtr;
+  if (commandPtr != nullptr) {
+    return *commandPtr;
   } else {
     throw std::runtime_error("[MRT_BASE::getCommand] updatePolicy() should be called first!");
   }
@@ -73,8 +77,9 @@ const CommandData& MRT_BASE::getCommand() const {
 /******************************************************************************************************/
 /******************************************************************************************************/
 const PrimalSolution& MRT_BASE::getPolicy() const {
-  if (activePrimalSolutionPtr_ != nullptr) {
-    return *activePrimalSolutionPtr_;
+  const auto& primalSolutionPtr = activeBuffer().primalSolutionPtr;
+  if (primalSolutionPtr != nullptr) {
+    return *primalSolutionPtr;
   } else {
     throw std::runtime_error("[MRT_BASE::getPolicy] updatePolicy() should be called first!");
   }
@@ -84,8 +89,9 @@ const PrimalSolution& MRT_BASE::getPolicy() const {
 /******************************************************************************************************/
 /******************************************************************************************************/
 const PerformanceIndex& MRT_BASE::getPerformanceIndices() const {
-  if (activePerformanceIndicesPtr_ != nullptr) {
-    return *activePerformanceIndicesPtr_;
+  const auto& performanceIndicesPtr = activeBuffer().performanceIndicesPtr;
+  if (performanceIndicesPtr != nullptr) {
+    return *performanceIndicesPtr;
   } else {
     throw std::runtime_error("[MRT_BASE::getPerformanceIndices] updatePolicy() should be called first!");
   }
@@ -102,20 +108,21 @@ void MRT_BASE::initRollout(const RolloutBase* rolloutPtr) {
 /******************************************************************************************************/
 /******************************************************************************************************/
 void MRT_BASE::evaluatePolicy(scalar_t currentTime, const vector_t& currentState, vector_t& mpcState, vector_t& mpcInput, size_t& mode) {
-  if (activePrimalSolutionPtr_ == nullptr) {
+  const auto& activePrimalSolutionPtr = activeBuffer().primalSolutionPtr;
+  if (activePrimalSolutionPtr == nullptr) {
     throw std::runtime_error("[MRT_BASE::evaluatePolicy] updatePolicy() should be called first!");
   }
 
-  if (currentTime > activePrimalSolutionPtr_->timeTrajectory_.back()) {
+  if (currentTime > activePrimalSolutionPtr->timeTrajectory_.back()) {
     std::cerr << "The requested currentTime is greater than the received plan: " << std::to_string(currentTime) << ">"
-              << std::to_string(activePrimalSolutionPtr_->timeTrajectory_.back()) << "\n";
+              << std::to_string(activePrimalSolutionPtr->timeTrajectory_.back()) << "\n";
   }
 
-  mpcInput = activePrimalSolutionPtr_->controllerPtr_->computeInput(currentTime, currentState);
-  mpcState =
-      LinearInterpolation::interpolate(currentTime, activePrimalSolutionPtr_->timeTrajectory_, activePrimalSolutionPtr_->stateTrajectory_);
+  mpcInput = activePrimalSolutionPtr->controllerPtr_->computeInput(currentTime, currentState);
+  const auto indexAlpha = LinearInterpolation::timeSegment(currentTime, activePrimalSolutionPtr->timeTrajectory_, timeSegmentHint_);
+  mpcState = LinearInterpolation::interpolate(indexAlpha, activePrimalSolutionPtr->stateTrajectory_);
 
-  mode = activePrimalSolutionPtr_->modeSchedule_.modeAtTime(currentTime);
+  mode = activePrimalSolutionPtr->modeSchedule_.modeAtTime(currentTime);
 }
 
 /******************************************************************************************************/
@@ -127,56 +134,64 @@ void MRT_BASE::rolloutPolicy(scalar_t currentTime, const vector_t& currentState,
     throw std::runtime_error("[MRT_BASE::rolloutPolicy] rollout class is not set! Use initRollout() to initialize it!");
   }
 
-  if (activePrimalSolutionPtr_ == nullptr) {
+  const auto& activePrimalSolutionPtr = activeBuffer().primalSolutionPtr;
+  if (activePrimalSolutionPtr == nullptr) {
     throw std::runtime_error("[MRT_BASE::rolloutPolicy] updatePolicy() should be called first!");
   }
 
-  if (currentTime > activePrimalSolutionPtr_->timeTrajectory_.back()) {
+  if (currentTime > activePrimalSolutionPtr->timeTrajectory_.back()) {
     std::cerr << "The requested currentTime is greater than the received plan: " << std::to_string(currentTime) << ">"
-              << std::to_string(activePrimalSolutionPtr_->timeTrajectory_.back()) << "\n";
+              << std::to_string(activePrimalSolutionPtr->timeTrajectory_.back()) << "\n";
   }
 
-  // perform a rollout
-  scalar_array_t timeTrajectory;
-  size_array_t postEventIndicesStock;
-  vector_array_t stateTrajectory, inputTrajectory;
+  // perform a rollout. The contiguous trajectory keeps its memory between the calls.
   const scalar_t finalTime = currentTime + timeStep;
-  rolloutPtr_->run(currentTime, currentState, finalTime, activePrimalSolutionPtr_->controllerPtr_.get(),
-                   activePrimalSolutionPtr_->modeSchedule_, timeTrajectory, postEventIndicesStock, stateTrajectory, inputTrajectory);
+  rolloutPtr_->run(currentTime, currentState, finalTime, activePrimalSolutionPtr->controllerPtr_.get(),
+                   activePrimalSolutionPtr->modeSchedule_, rolloutTrajectory_);
 
-  mpcState = stateTrajectory.back();
-  mpcInput = inputTrajectory.back();
+  mpcState = rolloutTrajectory_.stateTrajectory.back();
+  mpcInput = rolloutTrajectory_.inputTrajectory.back();
 
-  mode = activePrimalSolutionPtr_->modeSchedule_.modeAtTime(finalTime);
+  mode = activePrimalSolutionPtr->modeSchedule_.modeAtTime(finalTime);
 }
 
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
 bool MRT_BASE::updatePolicy() {
-  std::unique_lock<std::mutex> lock(bufferMutex_, std::try_to_lock);
-  if (lock.owns_lock()) {
-    mrtTrylockWarningCount_ = 0;
-    if (newPolicyInBuffer_) {
-      // update the active solution from buffer
-      activeCommandPtr_.swap(bufferCommandPtr_);
-      activePrimalSolutionPtr_.swap(bufferPrimalSolutionPtr_);
-      activePerformanceIndicesPtr_.swap(bufferPerformanceIndicesPtr_);
-      newPolicyInBuffer_ = false;  // make sure we don't swap in the old policy again
-
-      modifyActiveSolution(*activeCommandPtr_, *activePrimalSolutionPtr_);
-      return true;
-    } else {
-      return false;  // No policy update: the buffer contains nothing new.
+  bool isUpdated = false;
+
+  // cheap check which avoids the read-modify-write operation when there is no new policy
+  auto middleBufferIndex = middleBufferIndex_.load(std::memory_order_relaxed);
+  if ((middleBufferIndex & newPolicyFlag_) != 0) {
+    // update the active solution from buffer. The acquire ordering makes the producer's writes to the new buffer visible and the
+    // release ordering makes sure that we are done with the old active buffer before the producer can reuse it. The exchange only
+    // succeeds while the middle buffer is flagged as new, since reset() may withdraw it concurrently. On a failure, the expected
+    // value is reloaded and the exchange is retried as long as there is a new policy.
+    while (!isUpdated && (middleBufferIndex & newPolicyFlag_) != 0) {
+      isUpdated = middleBufferIndex_.compare_exchange_weak(middleBufferIndex, activeBufferIndex_, std::memory_order_acq_rel,
+                                                           std::memory_order_relaxed);
     }
-  } else {
-    ++mrtTrylockWarningCount_;
-    if (mrtTrylockWarningCount_ > mrtTrylockWarningThreshold_) {
-      std::cerr << "[MRT_BASE::updatePolicy] failed to lock the policyBufferMutex for " << mrtTrylockWarningCount_
-                << " consecutive times.\n";
+    if (isUpdated) {
+      activeBufferIndex_ = middleBufferIndex & ~newPolicyFlag_;
     }
-    return false;  // No policy update: the lock could not be acquired.
   }
+
+  // Discard the active policy if it was published before the latest reset(). A policy which is published after the reset carries the
+  // new reset count, so a reset() and a moveToBuffer() that both happen during this call cannot discard the new policy. This is the
+  // only case where the consumer frees a policy.
+  auto& activeBuffer = policyBuffers_[activeBufferIndex_];
+  const auto resetCount = resetCount_.load(std::memory_order_acquire);
+  if (activeBuffer.resetCount < resetCount) {
+    clearBuffer(activeBuffer);
+    activeBuffer.resetCount = resetCount;
+    return false;
+  }
+
+  if (isUpdated) {
+    modifyActiveSolution(*activeBuffer.commandPtr, *activeBuffer.primalSolutionPtr);
+  }
+  return isUpdated;
 }
 
 /******************************************************************************************************/
@@ -196,19 +211,33 @@ void MRT_BASE::moveToBuffer(std::unique_ptr<CommandData> commandDataPtr, std::un
     throw std::runtime_error("[MRT_BASE::moveToBuffer] performanceIndicesPtr cannot be a null pointer!");
   }
 
-  std::lock_guard<std::mutex> lk(bufferMutex_);
-  // use swap such that the old objects are destroyed after releasing the lock.
-  bufferCommandPtr_.swap(commandDataPtr);
-  bufferPrimalSolutionPtr_.swap(primalSolutionPtr);
-  bufferPerformanceIndicesPtr_.swap(performanceIndicesPtr);
+  std::lock_guard<std::mutex> lock(producerMutex_);
+  // use swap such that the old objects are destroyed on this thread after releasing the lock.
+  auto& backBuffer = policyBuffers_[backBufferIndex_];
+  backBuffer.resetCount = resetCount_.load(std::memory_order_relaxed);
+  backBuffer.commandPtr.swap(commandDataPtr);
+  backBuffer.primalSolutionPtr.swap(primalSolutionPtr);
+  backBuffer.performanceIndicesPtr.swap(performanceIndicesPtr);
 
   // allow user to modify the buffer
-  modifyBufferedSolution(*bufferCommandPtr_, *bufferPrimalSolutionPtr_);
+  modifyBufferedSolution(*backBuffer.commandPtr, *backBuffer.primalSolutionPtr);
+
+  // publish the back buffer. An unconsumed policy in the middle buffer is dropped and will be overwritten next time.
+  const auto middleBufferIndex = middleBufferIndex_.exchange(backBufferIndex_ | newPolicyFlag_, std::memory_order_acq_rel);
+  backBufferIndex_ = middleBufferIndex & ~newPolicyFlag_;
 
-  newPolicyInBuffer_ = true;
   policyReceivedEver_ = true;
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void MRT_BASE::clearBuffer(PolicyBuffer& buffer) {
+  buffer.commandPtr.reset();
+  buffer.primalSolutionPtr.reset();
+  buffer.performanceIndicesPtr.reset();
+}
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
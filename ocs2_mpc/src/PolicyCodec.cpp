@@ -0,0 +1,324 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include "ocs2_mpc/PolicyCodec.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace ocs2 {
+namespace {
+
+/*
+ * The compact policy data is laid out in native byte order as:
+ *   uint8 encoding, uint32 numNodes, and for each node:
+ *   uint8 flag whether the sizes differ from the previous node, and if so uint32 stateDim, uint32 inputDim, uint32 dataSize,
+ *   float32 states, float32 inputs, and the controller data where
+ *     FLOAT32: float32 values
+ *     FLOAT16: uint16 values
+ *     INT16:   float32 scale, int16 values
+ *     INT8:    float32 scale, int8 values
+ */
+
+/** Writes values to the compact policy data, which is allocated once with its final size. */
+class DataWriter {
+ public:
+  DataWriter(std::vector<uint8_t>& data, size_t size) : data_(data) { data_.resize(size); }
+
+  template <typename T>
+  void write(T value) {
+    static_assert(std::is_arithmetic<T>::value, "Only arithmetic types can be written.");
+    assert(position_ + sizeof(T) <= data_.size());
+    std::memcpy(data_.data() + position_, &value, sizeof(T));
+    position_ += sizeof(T);
+  }
+
+ private:
+  std::vector<uint8_t>& data_;
+  size_t position_ = 0;
+};
+
+/** Reads values from the compact policy data and checks the bounds. */
+class DataReader {
+ public:
+  explicit DataReader(const std::vector<uint8_t>& data) : data_(data) {}
+
+  template <typename T>
+  T read() {
+    static_assert(std::is_arithmetic<T>::value, "Only arithmetic types can be read.");
+    if (position_ + sizeof(T) > data_.size()) {
+      throw std::runtime_error("[decodePolicy] The compact policy is truncated!");
+    }
+    T value;
+    std::memcpy(&value, data_.data() + position_, sizeof(T));
+    position_ += sizeof(T);
+    return value;
+  }
+
+  bool atEnd() const { return position_ == data_.size(); }
+
+ private:
+  const std::vector<uint8_t>& data_;
+  size_t position_ = 0;
+};
+
+/** Rounds a single precision value to the nearest half precision value (IEEE 754 binary16, ties to even). */
+uint16_t floatToHalf(float value) {
+  uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(float));
+  const auto sign = static_cast<uint16_t>((bits >> 16) & 0x8000);
+  bits &= 0x7fffffff;
+
+  if (bits >= 0x47800000) {  // overflow, infinity, or NaN
+    return sign | (bits > 0x7f800000 ? 0x7e00 : 0x7c00);
+  } else if (bits < 0x38800000) {  // subnormal or zero: counts of 2^-24
+    float magnitude;
+    std::memcpy(&magnitude, &bits, sizeof(float));
+    return sign | static_cast<uint16_t>(std::nearbyint(magnitude * 16777216.0f));
+  } else {  // normal: rebias the exponent and round the mantissa, a carry into the exponent is the correct rounding
+    bits -= (127 - 15) << 23;
+    bits += 0x0fff + ((bits >> 13) & 1);
+    return sign | static_cast<uint16_t>(bits >> 13);
+  }
+}
+
+/** Converts a half precision value to single precision. */
+float halfToFloat(uint16_t value) {
+  const uint32_t sign = static_cast<uint32_t>(value & 0x8000) << 16;
+  const uint32_t exponent = (value >> 10) & 0x1f;
+  const uint32_t mantissa = value & 0x03ff;
+
+  if (exponent == 0) {  // subnormal or zero
+    const float magnitude = std::ldexp(static_cast<float>(mantissa), -24);
+    return (sign != 0) ? -magnitude : magnitude;
+  }
+
+  const uint32_t bits =
+      (exponent == 0x1f) ? (sign | 0x7f800000 | (mantissa << 13)) : (sign | ((exponent + 127 - 15) << 23) | (mantissa << 13));
+  float result;
+  std::memcpy(&result, &bits, sizeof(float));
+  return result;
+}
+
+/** The maximum magnitude of the integer quantization. */
+template <typename Integer>
+float maxQuantizedValue() {
+  return static_cast<float>(std::numeric_limits<Integer>::max());
+}
+
+/** Writes the values quantized with a scale factor such that the largest magnitude maps to the largest integer. */
+template <typename Integer>
+void encodeQuantized(const std::vector<float>& values, DataWriter& writer) {
+  float maxValue = 0.0f;
+  for (const auto value : values) {
+    maxValue = std::max(maxValue, std::abs(value));
+  }
+  const float scale = maxValue / maxQuantizedValue<Integer>();
+  const float inverseScale = (scale > 0.0f) ? 1.0f / scale : 0.0f;
+  writer.write<float>(scale);
+
+  for (const auto value : values) {
+    const float scaledValue = value * inverseScale;
+    const float rounded = scaledValue + (scaledValue < 0.0f ? -0.5f : 0.5f);
+    writer.write<Integer>(static_cast<Integer>(std::max(-maxQuantizedValue<Integer>(), std::min(rounded, maxQuantizedValue<Integer>()))));
+  }
+}
+
+/** Reads the quantized values. */
+template <typename Integer>
+void decodeQuantized(DataReader& reader, std::vector<float>& values) {
+  const auto scale = reader.read<float>();
+  for (auto& value : values) {
+    value = static_cast<float>(reader.read<Integer>()) * scale;
+  }
+}
+
+/** The number of bytes of the encoded values. */
+size_t getEncodedSize(PolicyEncoding encoding, size_t numValues) {
+  switch (encoding) {
+    case PolicyEncoding::FLOAT32:
+      return numValues * sizeof(float);
+    case PolicyEncoding::FLOAT16:
+      return numValues * sizeof(uint16_t);
+    case PolicyEncoding::INT16:
+      return sizeof(float) + numValues * sizeof(int16_t);
+    case PolicyEncoding::INT8:
+      return sizeof(float) + numValues * sizeof(int8_t);
+    default:
+      throw std::runtime_error("[encodePolicy] Unknown encoding!");
+  }
+}
+
+/** Writes the values with the given encoding. */
+void encodeValues(PolicyEncoding encoding, const std::vector<float>& values, DataWriter& writer) {
+  switch (encoding) {
+    case PolicyEncoding::FLOAT32:
+      for (const auto value : values) {
+        writer.write<float>(value);
+      }
+      break;
+    case PolicyEncoding::FLOAT16:
+      for (const auto value : values) {
+        writer.write<uint16_t>(floatToHalf(value));
+      }
+      break;
+    case PolicyEncoding::INT16:
+      encodeQuantized<int16_t>(values, writer);
+      break;
+    case PolicyEncoding::INT8:
+      encodeQuantized<int8_t>(values, writer);
+      break;
+    default:
+      throw std::runtime_error("[encodePolicy] Unknown encoding!");
+  }
+}
+
+/** Reads the values with the given encoding. */
+void decodeValues(PolicyEncoding encoding, DataReader& reader, std::vector<float>& values) {
+  switch (encoding) {
+    case PolicyEncoding::FLOAT32:
+      for (auto& value : values) {
+        value = reader.read<float>();
+      }
+      break;
+    case PolicyEncoding::FLOAT16:
+      for (auto& value : values) {
+        value = halfToFloat(reader.read<uint16_t>());
+      }
+      break;
+    case PolicyEncoding::INT16:
+      decodeQuantized<int16_t>(reader, values);
+      break;
+    case PolicyEncoding::INT8:
+      decodeQuantized<int8_t>(reader, values);
+      break;
+    default:
+      throw std::runtime_error("[decodePolicy] Unknown encoding!");
+  }
+}
+
+/** Whether the sizes of the node differ from the previous node. */
+bool isSizeChanged(const FlatPolicy& policy, size_t nodeIndex) {
+  return nodeIndex == 0 || policy.stateTrajectory[nodeIndex].size() != policy.stateTrajectory[nodeIndex - 1].size() ||
+         policy.inputTrajectory[nodeIndex].size() != policy.inputTrajectory[nodeIndex - 1].size() ||
+         policy.controllerData[nodeIndex].size() != policy.controllerData[nodeIndex - 1].size();
+}
+
+}  // unnamed namespace
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+std::vector<uint8_t> encodePolicy(PolicyEncoding encoding, const FlatPolicy& policy) {
+  if (encoding == PolicyEncoding::NONE) {
+    throw std::runtime_error("[encodePolicy] PolicyEncoding::NONE cannot be used for compact policies!");
+  }
+  const size_t numNodes = policy.timeTrajectory.size();
+  if (policy.stateTrajectory.size() != numNodes || policy.inputTrajectory.size() != numNodes || policy.controllerData.size() != numNodes) {
+    throw std::runtime_error("[encodePolicy] The trajectories of the policy must have the same length!");
+  }
+
+  size_t dataSize = sizeof(uint8_t) + sizeof(uint32_t);
+  for (size_t i = 0; i < numNodes; i++) {
+    dataSize += sizeof(uint8_t) + (isSizeChanged(policy, i) ? 3 * sizeof(uint32_t) : 0);
+    dataSize += getEncodedSize(PolicyEncoding::FLOAT32, policy.stateTrajectory[i].size() + policy.inputTrajectory[i].size());
+    dataSize += getEncodedSize(encoding, policy.controllerData[i].size());
+  }
+
+  std::vector<uint8_t> compactPolicy;
+  DataWriter writer(compactPolicy, dataSize);
+  writer.write<uint8_t>(static_cast<uint8_t>(encoding));
+  writer.write<uint32_t>(numNodes);
+
+  for (size_t i = 0; i < numNodes; i++) {
+    const bool sizeChanged = isSizeChanged(policy, i);
+    writer.write<uint8_t>(sizeChanged ? 1 : 0);
+    if (sizeChanged) {
+      writer.write<uint32_t>(policy.stateTrajectory[i].size());
+      writer.write<uint32_t>(policy.inputTrajectory[i].size());
+      writer.write<uint32_t>(policy.controllerData[i].size());
+    }
+    encodeValues(PolicyEncoding::FLOAT32, policy.stateTrajectory[i], writer);
+    encodeValues(PolicyEncoding::FLOAT32, policy.inputTrajectory[i], writer);
+    encodeValues(encoding, policy.controllerData[i], writer);
+  }
+
+  return compactPolicy;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void decodePolicy(const scalar_array_t& timeTrajectory, const std::vector<uint8_t>& compactPolicy, FlatPolicy& policy) {
+  DataReader reader(compactPolicy);
+  const auto encoding = static_cast<PolicyEncoding>(reader.read<uint8_t>());
+  const size_t numNodes = reader.read<uint32_t>();
+  if (numNodes != timeTrajectory.size()) {
+    throw std::runtime_error("[decodePolicy] The compact policy has " + std::to_string(numNodes) + " nodes while the time trajectory has " +
+                             std::to_string(timeTrajectory.size()) + "!");
+  }
+
+  policy.timeTrajectory = timeTrajectory;
+  policy.stateTrajectory.resize(numNodes);
+  policy.inputTrajectory.resize(numNodes);
+  policy.controllerData.resize(numNodes);
+
+  size_t stateDim = 0;
+  size_t inputDim = 0;
+  size_t dataSize = 0;
+  for (size_t i = 0; i < numNodes; i++) {
+    const bool sizeChanged = reader.read<uint8_t>() != 0;
+    if (sizeChanged) {
+      stateDim = reader.read<uint32_t>();
+      inputDim = reader.read<uint32_t>();
+      dataSize = reader.read<uint32_t>();
+    } else if (i == 0) {
+      throw std::runtime_error("[decodePolicy] The sizes of the first node are missing!");
+    }
+    policy.stateTrajectory[i].resize(stateDim);
+    policy.inputTrajectory[i].resize(inputDim);
+    policy.controllerData[i].resize(dataSize);
+
+    decodeValues(PolicyEncoding::FLOAT32, reader, policy.stateTrajectory[i]);
+    decodeValues(PolicyEncoding::FLOAT32, reader, policy.inputTrajectory[i]);
+    decodeValues(encoding, reader, policy.controllerData[i]);
+  }
+
+  if (!reader.atEnd()) {
+    throw std::runtime_error("[decodePolicy] The compact policy has trailing data!");
+  }
+}
+
+}  // namespace ocs2
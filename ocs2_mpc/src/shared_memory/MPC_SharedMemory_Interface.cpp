@@ -0,0 +1,168 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include "ocs2_mpc/shared_memory/MPC_SharedMemory_Interface.h"
+
+#include <iostream>
+#include <thread>
+
+#include "ocs2_mpc/shared_memory/SharedMemoryConversions.h"
+
+namespace ocs2 {
+namespace {
+constexpr size_t observationCapacity = 1 << 16;
+constexpr size_t resetCapacity = 4 << 20;
+constexpr std::chrono::microseconds pollPeriod(50);
+}  // unnamed namespace
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+MPC_SharedMemory_Interface::MPC_SharedMemory_Interface(MPC_BASE& mpc, std::string channelPrefix, size_t policyCapacity)
+    : mpc_(mpc),
+      channelPrefix_(std::move(channelPrefix)),
+      observationChannel_(channelPrefix_ + "_mpc_observation", observationCapacity),
+      policyChannel_(channelPrefix_ + "_mpc_policy", policyCapacity),
+      resetChannel_(channelPrefix_ + "_mpc_reset", resetCapacity) {}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void MPC_SharedMemory_Interface::resetMpcNode(TargetTrajectories&& initTargetTrajectories) {
+  std::lock_guard<std::mutex> resetLock(resetMutex_);
+  mpc_.reset();
+  mpc_.getSolverPtr()->getReferenceManager().setTargetTrajectories(std::move(initTargetTrajectories));
+  mpcTimer_.reset();
+  resetRequestedEver_ = true;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+bool MPC_SharedMemory_Interface::spinOnce(std::chrono::microseconds timeout) {
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+  while (resetChannel_.getSequence() <= resetSequence_ && observationChannel_.getSequence() <= observationSequence_) {
+    if (std::chrono::steady_clock::now() > deadline) {
+      return false;
+    }
+    std::this_thread::sleep_for(pollPeriod);
+  }
+
+  if (resetChannel_.read(messageBuffer_, resetSequence_)) {
+    resetMpcNode(shared_memory_conversions::readTargetTrajectories(messageBuffer_));
+    resetChannel_.acknowledge(resetSequence_);
+
+    std::cerr << "\n#####################################################"
+              << "\n#####################################################"
+              << "\n#################  MPC is reset.  ###################"
+              << "\n#####################################################"
+              << "\n#####################################################\n";
+  }
+
+  // only the latest observation is processed
+  if (observationChannel_.read(messageBuffer_, observationSequence_)) {
+    return mpcObservationCallback(shared_memory_conversions::readObservation(messageBuffer_));
+  }
+
+  return false;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void MPC_SharedMemory_Interface::spin() {
+  terminate_ = false;
+  while (!terminate_) {
+    spinOnce();
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+bool MPC_SharedMemory_Interface::mpcObservationCallback(const SystemObservation& currentObservation) {
+  std::lock_guard<std::mutex> resetLock(resetMutex_);
+
+  if (!resetRequestedEver_.load()) {
+    std::cerr << "[MPC_SharedMemory_Interface] MPC should be reset first. Either call MPC_SharedMemory_Interface::resetMpcNode() or "
+                 "MRT_SharedMemory_Interface::resetMpcNode().\n";
+    return false;
+  }
+
+  // measure the delay in running MPC
+  mpcTimer_.startTimer();
+
+  // run MPC
+  bool controllerIsUpdated = mpc_.run(currentObservation.time, currentObservation.state);
+  if (!controllerIsUpdated) {
+    return false;
+  }
+
+  // get solution
+  scalar_t finalTime = currentObservation.time + mpc_.settings().solutionTimeWindow_;
+  if (mpc_.settings().solutionTimeWindow_ < 0) {
+    finalTime = mpc_.getSolverPtr()->getFinalTime();
+  }
+  mpc_.getSolverPtr()->getPrimalSolution(finalTime, &primalSolution_);
+
+  // command
+  commandData_.mpcInitObservation_ = currentObservation;
+  commandData_.mpcTargetTrajectories_ = mpc_.getSolverPtr()->getReferenceManager().getTargetTrajectories();
+
+  // performance indices
+  performanceIndices_ = mpc_.getSolverPtr()->getPerformanceIndeces();
+
+  // publish the policy
+  shared_memory_conversions::writePolicy(policyChannel_, primalSolution_, commandData_, performanceIndices_);
+
+  // measure the delay for sending the policy
+  mpcTimer_.endTimer();
+
+  // check MPC delay and solution window compatibility
+  scalar_t timeWindow = mpc_.settings().solutionTimeWindow_;
+  if (mpc_.settings().solutionTimeWindow_ < 0) {
+    timeWindow = mpc_.getSolverPtr()->getFinalTime() - currentObservation.time;
+  }
+  if (timeWindow < 2.0 * mpcTimer_.getAverageInMilliseconds() * 1e-3) {
+    std::cerr << "WARNING: The solution time window might be shorter than the MPC delay!\n";
+  }
+
+  // display
+  if (mpc_.settings().debugPrint_) {
+    std::cerr << '\n';
+    std::cerr << "\n### MPC_SharedMemory Benchmarking";
+    std::cerr << "\n###   Maximum : " << mpcTimer_.getMaxIntervalInMilliseconds() << "[ms].";
+    std::cerr << "\n###   Average : " << mpcTimer_.getAverageInMilliseconds() << "[ms].";
+    std::cerr << "\n###   Latest  : " << mpcTimer_.getLastIntervalInMilliseconds() << "[ms]." << std::endl;
+  }
+
+  return true;
+}
+
+}  // namespace ocs2
@@ -0,0 +1,117 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include "ocs2_mpc/shared_memory/MRT_SharedMemory_Interface.h"
+
+#include <iostream>
+#include <thread>
+
+#include "ocs2_mpc/shared_memory/SharedMemoryConversions.h"
+
+namespace ocs2 {
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+MRT_SharedMemory_Interface::MRT_SharedMemory_Interface(std::string channelPrefix) : channelPrefix_(std::move(channelPrefix)) {}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void MRT_SharedMemory_Interface::connect(std::chrono::milliseconds timeout) {
+  this->reset();
+
+  observationChannelPtr_.reset(new SharedMemoryChannel(channelPrefix_ + "_mpc_observation", timeout));
+  policyChannelPtr_.reset(new SharedMemoryChannel(channelPrefix_ + "_mpc_policy", timeout));
+  resetChannelPtr_.reset(new SharedMemoryChannel(channelPrefix_ + "_mpc_reset", timeout));
+
+  // ignore the policies that were published before connecting
+  policySequence_ = policyChannelPtr_->getSequence();
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void MRT_SharedMemory_Interface::resetMpcNode(const TargetTrajectories& initTargetTrajectories) {
+  if (resetChannelPtr_ == nullptr) {
+    throw std::runtime_error("[MRT_SharedMemory_Interface::resetMpcNode] connect() should be called first!");
+  }
+
+  this->reset();
+
+  // the policies that are published before the reset are outdated
+  policySequence_ = policyChannelPtr_->getSequence();
+  const auto resetSequence = shared_memory_conversions::writeTargetTrajectories(*resetChannelPtr_, initTargetTrajectories);
+
+  auto lastAttemptTime = std::chrono::steady_clock::now();
+  while (resetChannelPtr_->getAcknowledgedSequence() < resetSequence) {
+    if (std::chrono::steady_clock::now() - lastAttemptTime > std::chrono::seconds(5)) {
+      std::cerr << "[MRT_SharedMemory_Interface] MPC has not been reset yet, waiting...\n";
+      lastAttemptTime = std::chrono::steady_clock::now();
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+  }
+
+  std::cerr << "MPC node has been reset.\n";
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void MRT_SharedMemory_Interface::setCurrentObservation(const SystemObservation& currentObservation) {
+  if (observationChannelPtr_ == nullptr) {
+    throw std::runtime_error("[MRT_SharedMemory_Interface::setCurrentObservation] connect() should be called first!");
+  }
+
+  shared_memory_conversions::writeObservation(*observationChannelPtr_, currentObservation);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+bool MRT_SharedMemory_Interface::spinMRT() {
+  if (policyChannelPtr_ == nullptr) {
+    throw std::runtime_error("[MRT_SharedMemory_Interface::spinMRT] connect() should be called first!");
+  }
+
+  if (!policyChannelPtr_->read(policyMessage_, policySequence_)) {
+    return false;
+  }
+
+  // read new policy and command from the message
+  auto commandPtr = std::make_unique<CommandData>();
+  auto primalSolutionPtr = std::make_unique<PrimalSolution>();
+  auto performanceIndicesPtr = std::make_unique<PerformanceIndex>();
+  shared_memory_conversions::readPolicy(policyMessage_, *commandPtr, *primalSolutionPtr, *performanceIndicesPtr);
+
+  this->moveToBuffer(std::move(commandPtr), std::move(primalSolutionPtr), std::move(performanceIndicesPtr));
+  return true;
+}
+
+}  // namespace ocs2
@@ -0,0 +1,298 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include "ocs2_mpc/shared_memory/SharedMemoryChannel.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <thread>
+
+namespace ocs2 {
+namespace {
+
+constexpr uint64_t magicNumber = 0x6f637332'73686d31;  // "ocs2shm1"
+constexpr size_t cacheLineSize = 64;
+constexpr size_t numSpinsBeforeSleep = 100;
+
+size_t roundUpToCacheLine(size_t size) {
+  return (size + cacheLineSize - 1) / cacheLineSize * cacheLineSize;
+}
+
+std::string getSegmentName(const std::string& name) {
+  return (!name.empty() && name.front() == '/') ? name : "/" + name;
+}
+
+std::string getErrorMessage() {
+  return std::string(std::strerror(errno));
+}
+
+}  // unnamed namespace
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "[SharedMemoryChannel] Lock-free 64-bit atomics are required for inter-process use.");
+
+struct SharedMemoryChannel::Header {
+  std::atomic<uint64_t> magic;
+  uint64_t slotCapacity;
+  uint64_t numSlots;
+  uint64_t slotStride;
+  alignas(cacheLineSize) std::atomic<uint64_t> sequence;
+  alignas(cacheLineSize) std::atomic<uint64_t> acknowledgedSequence;
+};
+
+struct SharedMemoryChannel::SlotHeader {
+  std::atomic<uint64_t> version;  // odd while the slot is written
+  uint64_t size;
+};
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+SharedMemoryChannel::SharedMemoryChannel(const std::string& name, size_t slotCapacity, size_t numSlots)
+    : name_(getSegmentName(name)), isOwner_(true) {
+  if (numSlots < 2) {
+    throw std::runtime_error("[SharedMemoryChannel] At least two slots are required!");
+  }
+
+  // remove a segment that is left over, e.g., from a process that has crashed
+  shm_unlink(name_.c_str());
+  fileDescriptor_ = shm_open(name_.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  if (fileDescriptor_ < 0) {
+    throw std::runtime_error("[SharedMemoryChannel] Failed to create " + name_ + ": " + getErrorMessage());
+  }
+
+  const size_t slotStride = cacheLineSize + roundUpToCacheLine(slotCapacity);
+  const size_t size = roundUpToCacheLine(sizeof(Header)) + numSlots * slotStride;
+  if (ftruncate(fileDescriptor_, size) != 0) {
+    const auto errorMessage = getErrorMessage();
+    close(fileDescriptor_);
+    shm_unlink(name_.c_str());
+    throw std::runtime_error("[SharedMemoryChannel] Failed to allocate " + name_ + ": " + errorMessage);
+  }
+  map(size);
+
+  headerPtr_ = new (memoryPtr_) Header;
+  headerPtr_->slotCapacity = slotCapacity;
+  headerPtr_->numSlots = numSlots;
+  headerPtr_->slotStride = slotStride;
+  headerPtr_->sequence.store(0, std::memory_order_relaxed);
+  headerPtr_->acknowledgedSequence.store(0, std::memory_order_relaxed);
+  for (size_t i = 0; i < numSlots; i++) {
+    auto* slotHeaderPtr = new (&getSlotHeader(i)) SlotHeader;
+    slotHeaderPtr->version.store(0, std::memory_order_relaxed);
+    slotHeaderPtr->size = 0;
+  }
+  // the channel can be opened from now on
+  headerPtr_->magic.store(magicNumber, std::memory_order_release);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+SharedMemoryChannel::SharedMemoryChannel(const std::string& name, std::chrono::milliseconds timeout)
+    : name_(getSegmentName(name)), isOwner_(false) {
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+  while (true) {
+    fileDescriptor_ = shm_open(name_.c_str(), O_RDWR, 0);
+    if (fileDescriptor_ >= 0) {
+      struct stat segmentStat;
+      if (fstat(fileDescriptor_, &segmentStat) == 0 && static_cast<size_t>(segmentStat.st_size) >= sizeof(Header)) {
+        map(segmentStat.st_size);
+        headerPtr_ = reinterpret_cast<Header*>(memoryPtr_);
+        if (headerPtr_->magic.load(std::memory_order_acquire) == magicNumber) {
+          break;
+        }
+        munmap(memoryPtr_, memorySize_);
+        memoryPtr_ = nullptr;
+        headerPtr_ = nullptr;
+      }
+      close(fileDescriptor_);
+      fileDescriptor_ = -1;
+    }
+
+    if (std::chrono::steady_clock::now() > deadline) {
+      throw std::runtime_error("[SharedMemoryChannel] Timed out while waiting for " + name_ + " to be created!");
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+
+  if (memorySize_ < roundUpToCacheLine(sizeof(Header)) + headerPtr_->numSlots * headerPtr_->slotStride) {
+    throw std::runtime_error("[SharedMemoryChannel] The shared memory segment " + name_ + " is corrupted!");
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+SharedMemoryChannel::~SharedMemoryChannel() {
+  if (memoryPtr_ != nullptr) {
+    munmap(memoryPtr_, memorySize_);
+  }
+  if (fileDescriptor_ >= 0) {
+    close(fileDescriptor_);
+  }
+  if (isOwner_) {
+    shm_unlink(name_.c_str());
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void SharedMemoryChannel::map(size_t size) {
+  memoryPtr_ = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor_, 0);
+  if (memoryPtr_ == MAP_FAILED) {
+    memoryPtr_ = nullptr;
+    throw std::runtime_error("[SharedMemoryChannel] Failed to map " + name_ + ": " + getErrorMessage());
+  }
+  memorySize_ = size;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+auto SharedMemoryChannel::getSlotHeader(size_t slotIndex) const -> SlotHeader& {
+  char* slotPtr = static_cast<char*>(memoryPtr_) + roundUpToCacheLine(sizeof(Header)) + slotIndex * headerPtr_->slotStride;
+  return *reinterpret_cast<SlotHeader*>(slotPtr);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+char* SharedMemoryChannel::getSlotData(size_t slotIndex) const {
+  return reinterpret_cast<char*>(&getSlotHeader(slotIndex)) + cacheLineSize;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+uint64_t SharedMemoryChannel::write(size_t size, const std::function<void(char*)>& serialize) {
+  if (size > headerPtr_->slotCapacity) {
+    throw std::runtime_error("[SharedMemoryChannel] The message of " + std::to_string(size) + " bytes exceeds the capacity of " + name_ +
+                             " (" + std::to_string(headerPtr_->slotCapacity) + " bytes)!");
+  }
+
+  const uint64_t sequence = headerPtr_->sequence.load(std::memory_order_relaxed) + 1;
+  const size_t slotIndex = (sequence - 1) % headerPtr_->numSlots;
+  auto& slotHeader = getSlotHeader(slotIndex);
+
+  slotHeader.version.store(2 * sequence - 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  slotHeader.size = size;
+  serialize(getSlotData(slotIndex));
+  slotHeader.version.store(2 * sequence, std::memory_order_release);
+
+  headerPtr_->sequence.store(sequence, std::memory_order_release);
+  return sequence;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+bool SharedMemoryChannel::read(std::vector<char>& buffer, uint64_t& sequence) const {
+  while (true) {
+    const uint64_t latestSequence = headerPtr_->sequence.load(std::memory_order_acquire);
+    if (latestSequence <= sequence) {
+      return false;
+    }
+
+    const size_t slotIndex = (latestSequence - 1) % headerPtr_->numSlots;
+    const auto& slotHeader = getSlotHeader(slotIndex);
+    const uint64_t version = slotHeader.version.load(std::memory_order_acquire);
+    if (version != 2 * latestSequence) {
+      continue;  // the slot is already overwritten by a newer message
+    }
+
+    const size_t size = slotHeader.size;
+    if (size <= headerPtr_->slotCapacity) {
+      buffer.resize(size);
+      std::memcpy(buffer.data(), getSlotData(slotIndex), size);
+    }
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slotHeader.version.load(std::memory_order_relaxed) == version && size <= headerPtr_->slotCapacity) {
+      sequence = latestSequence;
+      return true;
+    }
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+bool SharedMemoryChannel::waitForMessage(uint64_t sequence, std::chrono::microseconds timeout, std::chrono::microseconds pollPeriod) const {
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+  for (size_t i = 0; getSequence() <= sequence; i++) {
+    if (std::chrono::steady_clock::now() > deadline) {
+      return false;
+    }
+    if (i < numSpinsBeforeSleep) {
+      std::this_thread::yield();
+    } else {
+      std::this_thread::sleep_for(pollPeriod);
+    }
+  }
+  return true;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+uint64_t SharedMemoryChannel::getSequence() const {
+  return headerPtr_->sequence.load(std::memory_order_acquire);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void SharedMemoryChannel::acknowledge(uint64_t sequence) {
+  headerPtr_->acknowledgedSequence.store(sequence, std::memory_order_release);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+uint64_t SharedMemoryChannel::getAcknowledgedSequence() const {
+  return headerPtr_->acknowledgedSequence.load(std::memory_order_acquire);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+size_t SharedMemoryChannel::getSlotCapacity() const {
+  return headerPtr_->slotCapacity;
+}
+
+}  // namespace ocs2
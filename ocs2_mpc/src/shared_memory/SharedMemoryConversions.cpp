@@ -0,0 +1,349 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include "ocs2_mpc/shared_memory/SharedMemoryConversions.h"
+
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+#include <ocs2_core/control/FeedforwardController.h>
+#include <ocs2_core/control/LinearController.h>
+
+namespace ocs2 {
+namespace shared_memory_conversions {
+namespace {
+
+/** Writes values to a message. Without a data pointer, it only counts the size of the message. */
+class MessageWriter {
+ public:
+  explicit MessageWriter(char* data = nullptr) : data_(data) {}
+
+  size_t size() const { return size_; }
+
+  template <typename T>
+  void write(const T& value) {
+    static_assert(std::is_arithmetic<T>::value, "Only arithmetic types can be written directly.");
+    copy(&value, sizeof(T));
+  }
+
+  void write(const vector_t& vector) {
+    write<uint64_t>(vector.size());
+    copy(vector.data(), vector.size() * sizeof(scalar_t));
+  }
+
+  void write(const matrix_t& matrix) {
+    write<uint64_t>(matrix.rows());
+    write<uint64_t>(matrix.cols());
+    copy(matrix.data(), matrix.size() * sizeof(scalar_t));
+  }
+
+  template <typename T>
+  void write(const std::vector<T>& array) {
+    write<uint64_t>(array.size());
+    for (const auto& value : array) {
+      write(value);
+    }
+  }
+
+ private:
+  void copy(const void* source, size_t numBytes) {
+    if (data_ != nullptr) {
+      std::memcpy(data_ + size_, source, numBytes);
+    }
+    size_ += numBytes;
+  }
+
+  char* data_;
+  size_t size_ = 0;
+};
+
+/** Reads values from a message with bound checks. */
+class MessageReader {
+ public:
+  explicit MessageReader(const std::vector<char>& message) : message_(message) {}
+
+  template <typename T>
+  void read(T& value) {
+    static_assert(std::is_arithmetic<T>::value, "Only arithmetic types can be read directly.");
+    copy(&value, sizeof(T));
+  }
+
+  void read(vector_t& vector) {
+    const auto size = readSize(sizeof(scalar_t));
+    vector.resize(size);
+    copy(vector.data(), size * sizeof(scalar_t));
+  }
+
+  void read(matrix_t& matrix) {
+    uint64_t rows, cols;
+    read(rows);
+    read(cols);
+    checkRemaining(rows * cols * sizeof(scalar_t));
+    matrix.resize(rows, cols);
+    copy(matrix.data(), matrix.size() * sizeof(scalar_t));
+  }
+
+  template <typename T>
+  void read(std::vector<T>& array) {
+    array.resize(readSize(1));
+    for (auto& value : array) {
+      read(value);
+    }
+  }
+
+ private:
+  /** Reads a size and checks that the message can hold as many elements of at least the given size. */
+  uint64_t readSize(size_t minElementSize) {
+    uint64_t size;
+    read(size);
+    checkRemaining(size * minElementSize);
+    return size;
+  }
+
+  void checkRemaining(size_t numBytes) const {
+    if (numBytes > message_.size() - position_) {
+      throw std::runtime_error("[shared_memory_conversions] The message is truncated!");
+    }
+  }
+
+  void copy(void* destination, size_t numBytes) {
+    checkRemaining(numBytes);
+    std::memcpy(destination, message_.data() + position_, numBytes);
+    position_ += numBytes;
+  }
+
+  const std::vector<char>& message_;
+  size_t position_ = 0;
+};
+
+/** Writes the message twice: first to get its size and then into the channel. */
+template <typename Serializer>
+uint64_t writeMessage(SharedMemoryChannel& channel, const Serializer& serializer) {
+  MessageWriter sizeCounter;
+  serializer(sizeCounter);
+  return channel.write(sizeCounter.size(), [&](char* data) {
+    MessageWriter writer(data);
+    serializer(writer);
+  });
+}
+
+void write(MessageWriter& writer, const SystemObservation& observation) {
+  writer.write<uint64_t>(observation.mode);
+  writer.write(observation.time);
+  writer.write(observation.state);
+  writer.write(observation.input);
+}
+
+void read(MessageReader& reader, SystemObservation& observation) {
+  uint64_t mode;
+  reader.read(mode);
+  observation.mode = mode;
+  reader.read(observation.time);
+  reader.read(observation.state);
+  reader.read(observation.input);
+}
+
+void write(MessageWriter& writer, const TargetTrajectories& targetTrajectories) {
+  writer.write(targetTrajectories.timeTrajectory);
+  writer.write(targetTrajectories.stateTrajectory);
+  writer.write(targetTrajectories.inputTrajectory);
+}
+
+void read(MessageReader& reader, TargetTrajectories& targetTrajectories) {
+  reader.read(targetTrajectories.timeTrajectory);
+  reader.read(targetTrajectories.stateTrajectory);
+  reader.read(targetTrajectories.inputTrajectory);
+}
+
+void write(MessageWriter& writer, const PerformanceIndex& performanceIndices) {
+  writer.write(performanceIndices.merit);
+  writer.write(performanceIndices.cost);
+  writer.write(performanceIndices.dualFeasibilitiesSSE);
+  writer.write(performanceIndices.dynamicsViolationSSE);
+  writer.write(performanceIndices.equalityConstraintsSSE);
+  writer.write(performanceIndices.inequalityConstraintsSSE);
+  writer.write(performanceIndices.equalityLagrangian);
+  writer.write(performanceIndices.inequalityLagrangian);
+}
+
+void read(MessageReader& reader, PerformanceIndex& performanceIndices) {
+  reader.read(performanceIndices.merit);
+  reader.read(performanceIndices.cost);
+  reader.read(performanceIndices.dualFeasibilitiesSSE);
+  reader.read(performanceIndices.dynamicsViolationSSE);
+  reader.read(performanceIndices.equalityConstraintsSSE);
+  reader.read(performanceIndices.inequalityConstraintsSSE);
+  reader.read(performanceIndices.equalityLagrangian);
+  reader.read(performanceIndices.inequalityLagrangian);
+}
+
+void write(MessageWriter& writer, const ModeSchedule& modeSchedule) {
+  writer.write(modeSchedule.eventTimes);
+  writer.write(std::vector<uint64_t>(modeSchedule.modeSequence.begin(), modeSchedule.modeSequence.end()));
+}
+
+void read(MessageReader& reader, ModeSchedule& modeSchedule) {
+  scalar_array_t eventTimes;
+  std::vector<uint64_t> modeSequence;
+  reader.read(eventTimes);
+  reader.read(modeSequence);
+  modeSchedule = ModeSchedule(std::move(eventTimes), size_array_t(modeSequence.begin(), modeSequence.end()));
+}
+
+void write(MessageWriter& writer, const ControllerBase& controller) {
+  writer.write(static_cast<int32_t>(controller.getType()));
+  switch (controller.getType()) {
+    case ControllerType::FEEDFORWARD: {
+      const auto& feedforwardController = static_cast<const FeedforwardController&>(controller);
+      writer.write(feedforwardController.timeStamp_);
+      writer.write(feedforwardController.uffArray_);
+      break;
+    }
+    case ControllerType::LINEAR: {
+      const auto& linearController = static_cast<const LinearController&>(controller);
+      writer.write(linearController.timeStamp_);
+      writer.write(linearController.biasArray_);
+      writer.write(linearController.gainArray_);
+      break;
+    }
+    default:
+      throw std::runtime_error("[shared_memory_conversions::writePolicy] Unknown ControllerType!");
+  }
+}
+
+void read(MessageReader& reader, std::unique_ptr<ControllerBase>& controllerPtr) {
+  int32_t controllerType;
+  reader.read(controllerType);
+  switch (static_cast<ControllerType>(controllerType)) {
+    case ControllerType::FEEDFORWARD: {
+      std::unique_ptr<FeedforwardController> feedforwardControllerPtr(new FeedforwardController);
+      reader.read(feedforwardControllerPtr->timeStamp_);
+      reader.read(feedforwardControllerPtr->uffArray_);
+      controllerPtr = std::move(feedforwardControllerPtr);
+      break;
+    }
+    case ControllerType::LINEAR: {
+      std::unique_ptr<LinearController> linearControllerPtr(new LinearController);
+      reader.read(linearControllerPtr->timeStamp_);
+      reader.read(linearControllerPtr->biasArray_);
+      reader.read(linearControllerPtr->gainArray_);
+      controllerPtr = std::move(linearControllerPtr);
+      break;
+    }
+    default:
+      throw std::runtime_error("[shared_memory_conversions::readPolicy] Unknown ControllerType!");
+  }
+}
+
+}  // unnamed namespace
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+uint64_t writeObservation(SharedMemoryChannel& channel, const SystemObservation& observation) {
+  return writeMessage(channel, [&](MessageWriter& writer) { write(writer, observation); });
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+SystemObservation readObservation(const std::vector<char>& message) {
+  MessageReader reader(message);
+  SystemObservation observation;
+  read(reader, observation);
+  return observation;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+uint64_t writeTargetTrajectories(SharedMemoryChannel& channel, const TargetTrajectories& targetTrajectories) {
+  return writeMessage(channel, [&](MessageWriter& writer) { write(writer, targetTrajectories); });
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+TargetTrajectories readTargetTrajectories(const std::vector<char>& message) {
+  MessageReader reader(message);
+  TargetTrajectories targetTrajectories;
+  read(reader, targetTrajectories);
+  return targetTrajectories;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+uint64_t writePolicy(SharedMemoryChannel& channel, const PrimalSolution& primalSolution, const CommandData& commandData,
+                     const PerformanceIndex& performanceIndices) {
+  if (primalSolution.controllerPtr_ == nullptr) {
+    throw std::runtime_error("[shared_memory_conversions::writePolicy] The primal solution has no controller!");
+  }
+
+  return writeMessage(channel, [&](MessageWriter& writer) {
+    write(writer, commandData.mpcInitObservation_);
+    write(writer, commandData.mpcTargetTrajectories_);
+    write(writer, performanceIndices);
+    write(writer, primalSolution.modeSchedule_);
+    writer.write(primalSolution.timeTrajectory_);
+    writer.write(primalSolution.stateTrajectory_);
+    writer.write(primalSolution.inputTrajectory_);
+    writer.write(std::vector<uint64_t>(primalSolution.postEventIndices_.begin(), primalSolution.postEventIndices_.end()));
+    write(writer, *primalSolution.controllerPtr_);
+  });
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void readPolicy(const std::vector<char>& message, CommandData& commandData, PrimalSolution& primalSolution,
+                PerformanceIndex& performanceIndices) {
+  MessageReader reader(message);
+  read(reader, commandData.mpcInitObservation_);
+  read(reader, commandData.mpcTargetTrajectories_);
+  read(reader, performanceIndices);
+
+  primalSolution.clear();
+  read(reader, primalSolution.modeSchedule_);
+  reader.read(primalSolution.timeTrajectory_);
+  reader.read(primalSolution.stateTrajectory_);
+  reader.read(primalSolution.inputTrajectory_);
+  std::vector<uint64_t> postEventIndices;
+  reader.read(postEventIndices);
+  primalSolution.postEventIndices_.assign(postEventIndices.begin(), postEventIndices.end());
+  read(reader, primalSolution.controllerPtr_);
+
+  if (primalSolution.timeTrajectory_.empty()) {
+    throw std::runtime_error("[shared_memory_conversions::readPolicy] controller message is empty!");
+  }
+}
+
+}  // namespace shared_memory_conversions
+}  // namespace ocs2
@@ -0,0 +1,114 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include <benchmark/benchmark.h>
+
+#include <ocs2_core/control/LinearController.h>
+
+#include "ocs2_mpc/shared_memory/SharedMemoryChannel.h"
+#include "ocs2_mpc/shared_memory/SharedMemoryConversions.h"
+
+namespace {
+
+constexpr size_t numNodes = 100;
+constexpr size_t stateDim = 24;
+constexpr size_t inputDim = 12;
+
+ocs2::PrimalSolution getLinearPolicy() {
+  ocs2::PrimalSolution primalSolution;
+  ocs2::vector_array_t biasArray;
+  ocs2::matrix_array_t gainArray;
+  for (size_t i = 0; i < numNodes; i++) {
+    primalSolution.timeTrajectory_.push_back(0.01 * i);
+    primalSolution.stateTrajectory_.push_back(ocs2::vector_t::Random(stateDim));
+    primalSolution.inputTrajectory_.push_back(ocs2::vector_t::Random(inputDim));
+    biasArray.push_back(ocs2::vector_t::Random(inputDim));
+    gainArray.push_back(ocs2::matrix_t::Random(inputDim, stateDim));
+  }
+  primalSolution.modeSchedule_ = ocs2::ModeSchedule({0.5}, {0, 1});
+  primalSolution.postEventIndices_ = {numNodes / 2};
+  primalSolution.controllerPtr_.reset(
+      new ocs2::LinearController(primalSolution.timeTrajectory_, std::move(biasArray), std::move(gainArray)));
+  return primalSolution;
+}
+
+/** Writes a policy into a shared memory channel, copies it out, and decodes it. */
+void sharedMemoryPolicyTransport(benchmark::State& state) {
+  const auto primalSolution = getLinearPolicy();
+  const ocs2::CommandData commandData;
+  const ocs2::PerformanceIndex performanceIndices;
+
+  ocs2::SharedMemoryChannel channel("ocs2_benchmark_policy_" + std::to_string(getpid()), 16 << 20);
+  std::vector<char> message;
+  uint64_t sequence = 0;
+  ocs2::CommandData receivedCommand;
+  ocs2::PrimalSolution receivedSolution;
+  ocs2::PerformanceIndex receivedPerformanceIndices;
+  for (auto _ : state) {
+    ocs2::shared_memory_conversions::writePolicy(channel, primalSolution, commandData, performanceIndices);
+    channel.read(message, sequence);
+    ocs2::shared_memory_conversions::readPolicy(message, receivedCommand, receivedSolution, receivedPerformanceIndices);
+    benchmark::DoNotOptimize(receivedSolution.controllerPtr_.get());
+  }
+  state.SetBytesProcessed(state.iterations() * message.size());
+}
+
+/**
+ * The controller conversion of the ROS path: flatten into one float vector per node and unflatten. The serialization and
+ * the TCP transport of the ROS message are not included.
+ */
+void rosControllerFlattening(benchmark::State& state) {
+  const auto primalSolution = getLinearPolicy();
+  const ocs2::size_array_t stateDims(numNodes, stateDim);
+  const ocs2::size_array_t inputDims(numNodes, inputDim);
+  for (auto _ : state) {
+    std::vector<std::vector<float>> data(numNodes);
+    std::vector<std::vector<float>*> dataPtrArray;
+    std::vector<std::vector<float> const*> constDataPtrArray;
+    for (auto& nodeData : data) {
+      dataPtrArray.push_back(&nodeData);
+      constDataPtrArray.push_back(&nodeData);
+    }
+    primalSolution.controllerPtr_->flatten(primalSolution.timeTrajectory_, dataPtrArray);
+    auto controller = ocs2::LinearController::unFlatten(stateDims, inputDims, primalSolution.timeTrajectory_, constDataPtrArray);
+    benchmark::DoNotOptimize(controller.gainArray_.data());
+  }
+}
+
+}  // unnamed namespace
+
+BENCHMARK(sharedMemoryPolicyTransport);
+BENCHMARK(rosControllerFlattening);
+
+BENCHMARK_MAIN();
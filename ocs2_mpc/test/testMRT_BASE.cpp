@@ -0,0 +1,319 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <thread>
+
+#include <ocs2_core/control/FeedforwardController.h>
+
+#include "ocs2_mpc/MRT_BASE.h"
+
+using namespace ocs2;
+
+namespace {
+
+/** An MRT which receives its policies directly from a thread of the test */
+class TestMRT final : public MRT_BASE {
+ public:
+  void resetMpcNode(const TargetTrajectories&) override {}
+  void setCurrentObservation(const SystemObservation&) override {}
+
+  /** Sends a policy whose time, state, input, and performance indices are all set to the given value */
+  void sendPolicy(scalar_t value, size_t numNodes, size_t stateDim, size_t inputDim) {
+    std::unique_ptr<CommandData> commandPtr(new CommandData);
+    commandPtr->mpcInitObservation_.time = value;
+
+    std::unique_ptr<PrimalSolution> primalSolutionPtr(new PrimalSolution);
+    primalSolutionPtr->timeTrajectory_.resize(numNodes, value);
+    primalSolutionPtr->stateTrajectory_.resize(numNodes, vector_t::Constant(stateDim, value));
+    primalSolutionPtr->inputTrajectory_.resize(numNodes, vector_t::Constant(inputDim, value));
+    primalSolutionPtr->controllerPtr_.reset(
+        new FeedforwardController(primalSolutionPtr->timeTrajectory_, primalSolutionPtr->inputTrajectory_));
+
+    std::unique_ptr<PerformanceIndex> performanceIndicesPtr(new PerformanceIndex);
+    performanceIndicesPtr->cost = value;
+
+    moveToBuffer(std::move(commandPtr), std::move(primalSolutionPtr), std::move(performanceIndicesPtr));
+  }
+};
+
+/** Runs a callback once from the next modifyActiveSolution(), i.e., at the end of a call to updatePolicy() */
+class CallbackMrtObserver final : public MrtObserver {
+ public:
+  void modifyActiveSolution(const CommandData&, PrimalSolution&) override {
+    if (callback) {
+      auto f = std::move(callback);
+      callback = nullptr;
+      f();
+    }
+  }
+
+  std::function<void()> callback;
+};
+
+}  // unnamed namespace
+
+TEST(testMRT_BASE, updatePolicy) {
+  TestMRT mrt;
+  EXPECT_FALSE(mrt.initialPolicyReceived());
+  EXPECT_FALSE(mrt.updatePolicy());
+  EXPECT_THROW(mrt.getPolicy(), std::runtime_error);
+
+  // the latest policy is swapped in
+  mrt.sendPolicy(1.0, 2, 3, 2);
+  mrt.sendPolicy(2.0, 2, 3, 2);
+  EXPECT_TRUE(mrt.initialPolicyReceived());
+  EXPECT_TRUE(mrt.updatePolicy());
+  EXPECT_FALSE(mrt.updatePolicy());
+  EXPECT_DOUBLE_EQ(mrt.getCommand().mpcInitObservation_.time, 2.0);
+  EXPECT_DOUBLE_EQ(mrt.getPolicy().timeTrajectory_.front(), 2.0);
+  EXPECT_DOUBLE_EQ(mrt.getPerformanceIndices().cost, 2.0);
+
+  // the active policy is kept until a new one arrives
+  mrt.sendPolicy(3.0, 2, 3, 2);
+  EXPECT_DOUBLE_EQ(mrt.getPolicy().timeTrajectory_.front(), 2.0);
+  EXPECT_TRUE(mrt.updatePolicy());
+  EXPECT_DOUBLE_EQ(mrt.getPolicy().timeTrajectory_.front(), 3.0);
+
+  mrt.reset();
+  EXPECT_FALSE(mrt.initialPolicyReceived());
+  EXPECT_FALSE(mrt.updatePolicy());
+  EXPECT_THROW(mrt.getCommand(), std::runtime_error);
+}
+
+TEST(testMRT_BASE, updatePolicyLatencyUnderLoad) {
+  constexpr size_t numNodes = 100;
+  constexpr size_t stateDim = 24;
+  constexpr size_t inputDim = 12;
+  constexpr auto testDuration = std::chrono::seconds(1);
+  constexpr auto controlPeriod = std::chrono::microseconds(200);
+
+  TestMRT mrt;
+  std::atomic_bool stop{false};
+
+  // MPC side: publish policies as fast as possible
+  size_t numPublished = 0;
+  std::thread mpcThread([&]() {
+    while (!stop) {
+      mrt.sendPolicy(static_cast<scalar_t>(++numPublished), numNodes, stateDim, inputDim);
+    }
+  });
+
+  // control loop: update and evaluate the policy, check that the policy is consistent and never goes back in time
+  using duration_t = std::chrono::duration<double, std::micro>;
+  duration_t maxLatency{0.0};
+  duration_t totalLatency{0.0};
+  size_t numCalls = 0;
+  size_t numUpdates = 0;
+  scalar_t lastValue = 0.0;
+  bool isConsistent = true;
+  vector_t mpcState, mpcInput;
+  size_t mode;
+  const auto endTime = std::chrono::steady_clock::now() + testDuration;
+  while (std::chrono::steady_clock::now() < endTime) {
+    const auto startTime = std::chrono::steady_clock::now();
+    const bool updated = mrt.updatePolicy();
+    const duration_t latency = std::chrono::steady_clock::now() - startTime;
+    maxLatency = std::max(maxLatency, latency);
+    totalLatency += latency;
+    ++numCalls;
+
+    if (updated) {
+      ++numUpdates;
+      const scalar_t value = mrt.getPolicy().timeTrajectory_.front();
+      mrt.evaluatePolicy(value, vector_t::Zero(stateDim), mpcState, mpcInput, mode);
+      isConsistent = isConsistent && value > lastValue && mrt.getCommand().mpcInitObservation_.time == value &&
+                     mrt.getPerformanceIndices().cost == value && mpcState.isConstant(value) && mpcInput.isConstant(value);
+      lastValue = value;
+    }
+    std::this_thread::sleep_for(controlPeriod);
+  }
+  stop = true;
+  mpcThread.join();
+
+  std::cerr << "[updatePolicyLatencyUnderLoad] " << numPublished << " published policies, " << numUpdates << " updates in " << numCalls
+            << " calls\n"
+            << "  updatePolicy latency: mean " << totalLatency.count() / numCalls << " [us], max " << maxLatency.count() << " [us]\n";
+
+  EXPECT_TRUE(isConsistent);
+  EXPECT_GT(numUpdates, 0);
+}
+
+TEST(testMRT_BASE, resetWhileUpdatingPolicy) {
+  constexpr size_t numNodes = 10;
+  constexpr size_t stateDim = 4;
+  constexpr size_t inputDim = 2;
+  constexpr auto testDuration = std::chrono::milliseconds(500);
+
+  TestMRT mrt;
+  std::atomic_bool stop{false};
+
+  // MPC side: publish policies as fast as possible
+  std::thread mpcThread([&]() {
+    scalar_t value = 0.0;
+    while (!stop) {
+      mrt.sendPolicy(++value, numNodes, stateDim, inputDim);
+    }
+  });
+
+  // another thread resets the MRT, e.g., resetMpcNode() called by the user
+  size_t numResets = 0;
+  std::thread resetThread([&]() {
+    while (!stop) {
+      mrt.reset();
+      ++numResets;
+      std::this_thread::yield();
+    }
+  });
+
+  // control loop: the active policy should be either cleared or consistent
+  size_t numUpdates = 0;
+  size_t numCleared = 0;
+  bool isConsistent = true;
+  vector_t mpcState, mpcInput;
+  size_t mode;
+  const auto endTime = std::chrono::steady_clock::now() + testDuration;
+  while (std::chrono::steady_clock::now() < endTime) {
+    if (mrt.updatePolicy()) {
+      ++numUpdates;
+      const scalar_t value = mrt.getPolicy().timeTrajectory_.front();
+      mrt.evaluatePolicy(value, vector_t::Zero(stateDim), mpcState, mpcInput, mode);
+      isConsistent = isConsistent && mrt.getCommand().mpcInitObservation_.time == value && mrt.getPerformanceIndices().cost == value &&
+                     mpcState.isConstant(value) && mpcInput.isConstant(value);
+    } else {
+      try {
+        const auto& policy = mrt.getPolicy();
+        isConsistent = isConsistent && policy.stateTrajectory_.size() == numNodes;
+      } catch (const std::runtime_error&) {
+        ++numCleared;
+      }
+    }
+  }
+  stop = true;
+  mpcThread.join();
+  resetThread.join();
+
+  EXPECT_TRUE(isConsistent);
+  EXPECT_GT(numResets, 0);
+  EXPECT_GT(numUpdates + numCleared, 0);
+
+  // a reset without new policies clears the active policy in the next update
+  mrt.reset();
+  EXPECT_FALSE(mrt.updatePolicy());
+  EXPECT_THROW(mrt.getPolicy(), std::runtime_error);
+}
+
+TEST(testMRT_BASE, resetAndPublishDuringUpdatePolicy) {
+  TestMRT mrt;
+  auto observerPtr = std::make_shared<CallbackMrtObserver>();
+  mrt.addMrtObserver(observerPtr);
+
+  // reset() and a new policy while the consumer is still in updatePolicy()
+  mrt.sendPolicy(1.0, 2, 3, 2);
+  observerPtr->callback = [&]() {
+    mrt.reset();
+    mrt.sendPolicy(2.0, 2, 3, 2);
+  };
+  EXPECT_TRUE(mrt.updatePolicy());
+  EXPECT_DOUBLE_EQ(mrt.getPolicy().timeTrajectory_.front(), 1.0);
+
+  // the policy published after the reset replaces the old one and it is not discarded by the later calls
+  EXPECT_TRUE(mrt.updatePolicy());
+  EXPECT_DOUBLE_EQ(mrt.getPolicy().timeTrajectory_.front(), 2.0);
+  EXPECT_FALSE(mrt.updatePolicy());
+  EXPECT_DOUBLE_EQ(mrt.getPolicy().timeTrajectory_.front(), 2.0);
+
+  // reset() without a new policy during updatePolicy() discards the active policy in the next call
+  mrt.sendPolicy(3.0, 2, 3, 2);
+  observerPtr->callback = [&]() { mrt.reset(); };
+  EXPECT_TRUE(mrt.updatePolicy());
+  EXPECT_FALSE(mrt.updatePolicy());
+  EXPECT_THROW(mrt.getPolicy(), std::runtime_error);
+}
+
+TEST(testMRT_BASE, policyAfterResetIsKept) {
+  constexpr size_t numNodes = 10;
+  constexpr size_t stateDim = 4;
+  constexpr size_t inputDim = 2;
+  constexpr size_t numResets = 200;
+
+  TestMRT mrt;
+  std::atomic_bool stop{false};
+  std::atomic<size_t> numResetsStarted{0};
+  std::atomic<size_t> numConsumerCalls{0};
+  std::atomic<size_t> lastSeenPolicy{0};
+
+  // MPC side: reset and publish policy k, then wait until the control loop has used it for a few calls
+  std::thread mpcThread([&]() {
+    for (size_t k = 1; k <= numResets; ++k) {
+      numResetsStarted = k;
+      mrt.reset();
+      mrt.sendPolicy(static_cast<scalar_t>(k), numNodes, stateDim, inputDim);
+      while (lastSeenPolicy != k && !stop) {
+        std::this_thread::yield();
+      }
+      const size_t numCalls = numConsumerCalls;
+      while (numConsumerCalls < numCalls + 3 && !stop) {
+        std::this_thread::yield();
+      }
+    }
+    stop = true;
+  });
+
+  // control loop: once policy k is seen, it may only be discarded by the reset of policy k + 1
+  size_t numLost = 0;
+  const auto endTime = std::chrono::steady_clock::now() + std::chrono::seconds(20);
+  while (!stop && std::chrono::steady_clock::now() < endTime) {
+    const size_t seenBefore = lastSeenPolicy;
+    mrt.updatePolicy();
+    const size_t resetsStarted = numResetsStarted;
+    try {
+      const auto value = static_cast<size_t>(mrt.getPolicy().timeTrajectory_.front());
+      if (value == resetsStarted) {
+        lastSeenPolicy = value;
+      }
+    } catch (const std::runtime_error&) {
+      if (seenBefore != 0 && seenBefore == resetsStarted) {
+        ++numLost;
+      }
+    }
+    ++numConsumerCalls;
+  }
+  stop = true;
+  mpcThread.join();
+
+  EXPECT_EQ(lastSeenPolicy, numResets);
+  EXPECT_EQ(numLost, 0);
+}
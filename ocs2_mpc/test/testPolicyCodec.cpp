@@ -0,0 +1,158 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "ocs2_mpc/PolicyCodec.h"
+
+using namespace ocs2;
+
+namespace {
+
+/** A smooth policy over a receding horizon, sampled like the consecutive solutions of an MPC */
+FlatPolicy getPolicy(scalar_t initTime, size_t numNodes, size_t stateDim, size_t inputDim) {
+  const auto value = [](scalar_t t, size_t j) { return static_cast<float>(std::sin(2.0 * t + 0.1 * j) + 0.05 * j); };
+
+  FlatPolicy policy;
+  for (size_t i = 0; i < numNodes; i++) {
+    const scalar_t t = initTime + 0.01 * i;
+    policy.timeTrajectory.push_back(t);
+    policy.stateTrajectory.emplace_back(stateDim);
+    policy.inputTrajectory.emplace_back(inputDim);
+    policy.controllerData.emplace_back(inputDim + inputDim * stateDim);
+    for (size_t j = 0; j < stateDim; j++) {
+      policy.stateTrajectory.back()[j] = value(t, j);
+    }
+    for (size_t j = 0; j < inputDim; j++) {
+      policy.inputTrajectory.back()[j] = value(t, stateDim + j);
+    }
+    for (size_t j = 0; j < policy.controllerData.back().size(); j++) {
+      policy.controllerData.back()[j] = 100.0f * value(t, j);
+    }
+  }
+  return policy;
+}
+
+float maxError(const std::vector<std::vector<float>>& lhs, const std::vector<std::vector<float>>& rhs) {
+  float error = 0.0f;
+  for (size_t i = 0; i < lhs.size(); i++) {
+    EXPECT_EQ(lhs[i].size(), rhs[i].size());
+    for (size_t j = 0; j < lhs[i].size(); j++) {
+      error = std::max(error, std::abs(lhs[i][j] - rhs[i][j]));
+    }
+  }
+  return error;
+}
+
+size_t getFloat32Size(const FlatPolicy& policy) {
+  size_t numValues = 0;
+  for (size_t i = 0; i < policy.timeTrajectory.size(); i++) {
+    numValues += policy.stateTrajectory[i].size() + policy.inputTrajectory[i].size() + policy.controllerData[i].size();
+  }
+  return numValues * sizeof(float);
+}
+
+}  // unnamed namespace
+
+class PolicyCodecTest : public testing::TestWithParam<std::pair<PolicyEncoding, float>> {};
+
+TEST_P(PolicyCodecTest, recedingHorizon) {
+  constexpr size_t numPolicies = 10;
+  constexpr size_t numNodes = 100;
+  constexpr size_t stateDim = 12;
+  constexpr size_t inputDim = 4;
+  const auto encoding = GetParam().first;
+  const auto tolerance = GetParam().second;
+
+  for (size_t k = 0; k < numPolicies; k++) {
+    const auto policy = getPolicy(0.013 * k, numNodes, stateDim, inputDim);
+    const auto compactPolicy = encodePolicy(encoding, policy);
+
+    FlatPolicy decoded;
+    decodePolicy(policy.timeTrajectory, compactPolicy, decoded);
+
+    EXPECT_EQ(decoded.timeTrajectory, policy.timeTrajectory);
+    EXPECT_EQ(maxError(decoded.stateTrajectory, policy.stateTrajectory), 0.0f);
+    EXPECT_EQ(maxError(decoded.inputTrajectory, policy.inputTrajectory), 0.0f);
+    EXPECT_LT(maxError(decoded.controllerData, policy.controllerData), tolerance);
+
+    // the headers: encoding, numNodes, one flag per node, and the sizes once
+    const size_t headerSize = 5 + numNodes + 12;
+    const size_t float32Size = getFloat32Size(policy);
+    const size_t controllerDataSize = numNodes * (inputDim + inputDim * stateDim);
+    const size_t statesAndInputsSize = float32Size - controllerDataSize * sizeof(float);
+    switch (encoding) {
+      case PolicyEncoding::FLOAT32:
+        EXPECT_EQ(compactPolicy.size(), headerSize + float32Size);
+        break;
+      case PolicyEncoding::FLOAT16:
+        EXPECT_EQ(compactPolicy.size(), headerSize + statesAndInputsSize + controllerDataSize * 2);
+        break;
+      case PolicyEncoding::INT16:
+        EXPECT_EQ(compactPolicy.size(), headerSize + statesAndInputsSize + numNodes * 4 + controllerDataSize * 2);
+        break;
+      case PolicyEncoding::INT8:
+        EXPECT_EQ(compactPolicy.size(), headerSize + statesAndInputsSize + numNodes * 4 + controllerDataSize);
+        break;
+      default:
+        FAIL();
+    }
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(PolicyCodecTestCase, PolicyCodecTest,
+                        testing::Values(std::make_pair(PolicyEncoding::FLOAT32, 1e-12f), std::make_pair(PolicyEncoding::FLOAT16, 0.25f),
+                                        std::make_pair(PolicyEncoding::INT16, 0.01f), std::make_pair(PolicyEncoding::INT8, 2.0f)));
+
+TEST(testPolicyCodec, varyingDimensions) {
+  // the dimensions change at a node
+  auto policy = getPolicy(0.05, 12, 3, 2);
+  policy.stateTrajectory[5].resize(4, 1.0f);
+  policy.controllerData[6].clear();
+  const auto compactPolicy = encodePolicy(PolicyEncoding::FLOAT16, policy);
+
+  FlatPolicy decoded;
+  decodePolicy(policy.timeTrajectory, compactPolicy, decoded);
+  EXPECT_EQ(maxError(decoded.stateTrajectory, policy.stateTrajectory), 0.0f);
+  EXPECT_LT(maxError(decoded.controllerData, policy.controllerData), 0.25);
+
+  EXPECT_THROW(decodePolicy(scalar_array_t(3, 0.0), compactPolicy, decoded), std::runtime_error);
+  EXPECT_THROW(encodePolicy(PolicyEncoding::NONE, policy), std::runtime_error);
+}
+
+TEST(testPolicyCodec, truncatedPolicy) {
+  const auto policy = getPolicy(0.0, 10, 3, 2);
+  auto compactPolicy = encodePolicy(PolicyEncoding::INT16, policy);
+  compactPolicy.pop_back();
+
+  FlatPolicy decoded;
+  EXPECT_THROW(decodePolicy(policy.timeTrajectory, compactPolicy, decoded), std::runtime_error);
+}
@@ -0,0 +1,251 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+#include <ocs2_core/control/LinearController.h>
+
+#include "ocs2_mpc/shared_memory/MRT_SharedMemory_Interface.h"
+#include "ocs2_mpc/shared_memory/SharedMemoryChannel.h"
+#include "ocs2_mpc/shared_memory/SharedMemoryConversions.h"
+
+using namespace ocs2;
+
+namespace {
+
+/**
+ * Runs the function in a child process. The process should not run any other thread when forking, since only the calling
+ * thread is duplicated and, e.g., a lock held by another thread would never be released in the child.
+ * @return The process ID of the child.
+ */
+template <typename Function>
+pid_t startChildProcess(Function function) {
+  const pid_t pid = fork();
+  if (pid == 0) {
+    int exitCode = EXIT_FAILURE;
+    try {
+      exitCode = function() ? EXIT_SUCCESS : EXIT_FAILURE;
+    } catch (const std::exception& e) {
+      std::cerr << "[startChildProcess] " << e.what() << "\n";
+    }
+    _exit(exitCode);
+  }
+  return pid;
+}
+
+/** Waits for the child process and returns its exit code. */
+int waitForChildProcess(pid_t pid) {
+  int status = 0;
+  waitpid(pid, &status, 0);
+  return WIFEXITED(status) ? WEXITSTATUS(status) : EXIT_FAILURE;
+}
+
+PrimalSolution getLinearPolicy(scalar_t initTime, size_t numNodes, size_t stateDim, size_t inputDim) {
+  PrimalSolution primalSolution;
+  vector_array_t biasArray;
+  matrix_array_t gainArray;
+  for (size_t i = 0; i < numNodes; i++) {
+    primalSolution.timeTrajectory_.push_back(initTime + 0.01 * i);
+    primalSolution.stateTrajectory_.push_back(vector_t::Random(stateDim));
+    primalSolution.inputTrajectory_.push_back(vector_t::Random(inputDim));
+    biasArray.push_back(vector_t::Random(inputDim));
+    gainArray.push_back(matrix_t::Random(inputDim, stateDim));
+  }
+  primalSolution.modeSchedule_ = ModeSchedule({initTime + 0.5}, {0, 1});
+  primalSolution.postEventIndices_ = {numNodes / 2};
+  primalSolution.controllerPtr_.reset(new LinearController(primalSolution.timeTrajectory_, std::move(biasArray), std::move(gainArray)));
+  return primalSolution;
+}
+
+}  // unnamed namespace
+
+TEST(testSharedMemoryChannel, consistentMessagesAcrossProcesses) {
+  constexpr size_t numMessages = 5000;
+  constexpr size_t maxMessageSize = 4096;
+  const std::string channelName = "ocs2_test_channel_" + std::to_string(getpid());
+  SharedMemoryChannel channel(channelName, maxMessageSize);
+
+  // the child writes messages of varying size in which every word holds the sequence number
+  const pid_t pid = fork();
+  if (pid == 0) {
+    SharedMemoryChannel writerChannel(channelName, std::chrono::milliseconds(1000));
+    for (uint64_t k = 1; k <= numMessages; k++) {
+      const size_t numWords = 1 + k % (maxMessageSize / sizeof(uint64_t));
+      writerChannel.write(numWords * sizeof(uint64_t), [&](char* data) {
+        for (size_t i = 0; i < numWords; i++) {
+          std::memcpy(data + i * sizeof(uint64_t), &k, sizeof(uint64_t));
+        }
+      });
+    }
+    _exit(EXIT_SUCCESS);
+  }
+
+  // the parent checks that no message is torn and that the sequence is monotonic
+  std::vector<char> message;
+  uint64_t sequence = 0;
+  size_t numReceived = 0;
+  while (sequence < numMessages) {
+    const auto previousSequence = sequence;
+    if (!channel.read(message, sequence)) {
+      continue;
+    }
+    ASSERT_GT(sequence, previousSequence);
+    ASSERT_EQ(message.size(), (1 + sequence % (maxMessageSize / sizeof(uint64_t))) * sizeof(uint64_t));
+    for (size_t i = 0; i < message.size(); i += sizeof(uint64_t)) {
+      uint64_t value;
+      std::memcpy(&value, message.data() + i, sizeof(uint64_t));
+      ASSERT_EQ(value, sequence);
+    }
+    ++numReceived;
+  }
+  EXPECT_GT(numReceived, 0);
+
+  int status = 0;
+  waitpid(pid, &status, 0);
+  EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS);
+}
+
+TEST(testSharedMemoryChannel, messageExceedsCapacity) {
+  SharedMemoryChannel channel("ocs2_test_capacity_" + std::to_string(getpid()), 16);
+  EXPECT_THROW(channel.write(17, [](char*) {}), std::runtime_error);
+  EXPECT_EQ(channel.getSequence(), 0);
+}
+
+TEST(testMRT_SharedMemory_Interface, policyFromOtherProcess) {
+  constexpr size_t stateDim = 4;
+  constexpr size_t inputDim = 2;
+  const std::string channelPrefix = "ocs2_test_robot_" + std::to_string(getpid());
+
+  // the channels of the MPC process, which is emulated by this process
+  SharedMemoryChannel observationChannel(channelPrefix + "_mpc_observation", 1 << 16);
+  SharedMemoryChannel policyChannel(channelPrefix + "_mpc_policy", 1 << 20);
+  SharedMemoryChannel resetChannel(channelPrefix + "_mpc_reset", 1 << 16);
+
+  const TargetTrajectories initTargetTrajectories({0.0}, {vector_t::Ones(stateDim)}, {vector_t::Zero(inputDim)});
+  SystemObservation observation;
+  observation.time = 1.0;
+  observation.state = vector_t::Random(stateDim);
+  observation.input = vector_t::Random(inputDim);
+
+  // MPC side in another process: handle the reset request, then reply to the first observation with a policy
+  const pid_t pid = startChildProcess([&]() {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    std::vector<char> message;
+    uint64_t resetSequence = 0;
+    while (!resetChannel.read(message, resetSequence)) {
+      if (std::chrono::steady_clock::now() > deadline) {
+        return false;
+      }
+      std::this_thread::yield();
+    }
+    const auto targetTrajectories = shared_memory_conversions::readTargetTrajectories(message);
+    resetChannel.acknowledge(resetSequence);
+
+    uint64_t observationSequence = 0;
+    while (!observationChannel.read(message, observationSequence)) {
+      if (std::chrono::steady_clock::now() > deadline) {
+        return false;
+      }
+      std::this_thread::yield();
+    }
+    CommandData commandData;
+    commandData.mpcInitObservation_ = shared_memory_conversions::readObservation(message);
+    commandData.mpcTargetTrajectories_ = targetTrajectories;
+    PerformanceIndex performanceIndices;
+    performanceIndices.cost = 42.0;
+    const auto primalSolution = getLinearPolicy(commandData.mpcInitObservation_.time, 10, stateDim, inputDim);
+    shared_memory_conversions::writePolicy(policyChannel, primalSolution, commandData, performanceIndices);
+    return true;
+  });
+
+  // MRT side
+  MRT_SharedMemory_Interface mrt(channelPrefix);
+  mrt.connect();
+  mrt.resetMpcNode(initTargetTrajectories);
+  mrt.setCurrentObservation(observation);
+
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  bool policyReceived = false;
+  while (!(policyReceived = mrt.spinMRT()) && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::yield();
+  }
+  ASSERT_EQ(waitForChildProcess(pid), EXIT_SUCCESS);
+  ASSERT_TRUE(policyReceived);
+  ASSERT_TRUE(mrt.updatePolicy());
+
+  const auto& command = mrt.getCommand();
+  const auto& policy = mrt.getPolicy();
+  vector_t mpcState, mpcInput;
+  size_t mode;
+  mrt.evaluatePolicy(observation.time, observation.state, mpcState, mpcInput, mode);
+  const vector_t expectedInput = policy.controllerPtr_->computeInput(observation.time, observation.state);
+
+  EXPECT_TRUE(command.mpcInitObservation_.state.isApprox(observation.state));
+  EXPECT_TRUE(command.mpcTargetTrajectories_.stateTrajectory.front().isApprox(vector_t::Ones(stateDim)));
+  EXPECT_EQ(mrt.getPerformanceIndices().cost, 42.0);
+  ASSERT_EQ(policy.timeTrajectory_.size(), 10);
+  EXPECT_EQ(policy.timeTrajectory_.front(), 1.0);
+  EXPECT_EQ(policy.postEventIndices_.front(), 5);
+  EXPECT_EQ(policy.modeSchedule_.modeAtTime(2.0), 1);
+  EXPECT_TRUE(mpcInput.isApprox(expectedInput));
+  EXPECT_TRUE(mpcState.isApprox(policy.stateTrajectory_.front()));
+}
+
+TEST(testMRT_SharedMemory_Interface, largePolicyRoundTrip) {
+  constexpr size_t numNodes = 100;
+  constexpr size_t stateDim = 24;
+  constexpr size_t inputDim = 12;
+  const auto primalSolution = getLinearPolicy(0.0, numNodes, stateDim, inputDim);
+  const CommandData commandData;
+  const PerformanceIndex performanceIndices;
+
+  SharedMemoryChannel channel("ocs2_test_large_policy_" + std::to_string(getpid()), 16 << 20);
+  shared_memory_conversions::writePolicy(channel, primalSolution, commandData, performanceIndices);
+
+  std::vector<char> message;
+  uint64_t sequence = 0;
+  ASSERT_TRUE(channel.read(message, sequence));
+  CommandData receivedCommand;
+  PrimalSolution receivedSolution;
+  PerformanceIndex receivedPerformanceIndices;
+  shared_memory_conversions::readPolicy(message, receivedCommand, receivedSolution, receivedPerformanceIndices);
+
+  ASSERT_EQ(receivedSolution.timeTrajectory_.size(), numNodes);
+  EXPECT_TRUE(receivedSolution.stateTrajectory_.back().isApprox(primalSolution.stateTrajectory_.back()));
+  EXPECT_TRUE(receivedSolution.controllerPtr_->computeInput(0.5, vector_t::Ones(stateDim))
+                  .isApprox(primalSolution.controllerPtr_->computeInput(0.5, vector_t::Ones(stateDim))));
+}
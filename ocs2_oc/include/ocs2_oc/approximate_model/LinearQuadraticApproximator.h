@@ -46,7 +46,7 @@ namespace ocs2 {
  * @param [in] state: The current state.
  * @param [in] input: The current input.
  * @param [in] multipliers: The current multipliers associated to the equality and inequality Lagrangians.
- * @param [out] modelData: The output data model.
+ * @param [out] modelData: The output data model. The memory of its members is reused if their sizes do not change.
  */
 void approximateIntermediateLQ(OptimalControlProblem& problem, const scalar_t time, const vector_t& state, const vector_t& input,
                                const MultiplierCollection& multipliers, ModelData& modelData);
@@ -136,6 +136,13 @@ scalar_t computeCost(const OptimalControlProblem& problem, const scalar_t& time,
 ScalarFunctionQuadraticApproximation approximateCost(const OptimalControlProblem& problem, const scalar_t& time, const vector_t& state,
                                                      const vector_t& input);
 
+/**
+ * Compute the quadratic approximation of the total intermediate cost (i.e. cost + softConstraints) in place. The terms are accumulated
+ * directly into the given approximation, so its memory is reused. It is assumed that the precomputation request is already made.
+ */
+void approximateCost(const OptimalControlProblem& problem, const scalar_t& time, const vector_t& state, const vector_t& input,
+                     ScalarFunctionQuadraticApproximation& cost);
+
 /**
  * Compute the total preJump cost (i.e. cost + softConstraints). It is assumed that the precomputation request is already made.
  */
@@ -148,6 +155,13 @@ scalar_t computeEventCost(const OptimalControlProblem& problem, const scalar_t&
 ScalarFunctionQuadraticApproximation approximateEventCost(const OptimalControlProblem& problem, const scalar_t& time,
                                                           const vector_t& state);
 
+/**
+ * Compute the quadratic approximation of the total preJump cost (i.e. cost + softConstraints) in place. The terms are accumulated
+ * directly into the given approximation, so its memory is reused. It is assumed that the precomputation request is already made.
+ */
+void approximateEventCost(const OptimalControlProblem& problem, const scalar_t& time, const vector_t& state,
+                          ScalarFunctionQuadraticApproximation& cost);
+
 /**
  * Compute the total final cost (i.e. cost + softConstraints). It is assumed that the precomputation request is already made.
  */
@@ -160,6 +174,13 @@ scalar_t computeFinalCost(const OptimalControlProblem& problem, const scalar_t&
 ScalarFunctionQuadraticApproximation approximateFinalCost(const OptimalControlProblem& problem, const scalar_t& time,
                                                           const vector_t& state);
 
+/**
+ * Compute the quadratic approximation of the total final cost (i.e. cost + softConstraints) in place. The terms are accumulated
+ * directly into the given approximation, so its memory is reused. It is assumed that the precomputation request is already made.
+ */
+void approximateFinalCost(const OptimalControlProblem& problem, const scalar_t& time, const vector_t& state,
+                          ScalarFunctionQuadraticApproximation& cost);
+
 /**
  * Compute the intermediate-time Metrics (i.e. cost, softConstraints, and constraints).
  *
@@ -46,6 +46,13 @@ namespace multiple_shooting {
  */
 Metrics computeMetrics(const Transcription& transcription);
 
+/**
+ * Compute the Metrics for a single intermediate node in place. The memory of the given metrics is reused if the sizes do not change.
+ * @param transcription: multiple shooting transcription for an intermediate node.
+ * @param [out] metrics: Metrics for a single intermediate node.
+ */
+void computeMetrics(const Transcription& transcription, Metrics& metrics);
+
 /**
  * Compute the Metrics for the event node.
  * @param transcription: multiple shooting transcription for event node.
@@ -74,6 +81,21 @@ Metrics computeMetrics(const TerminalTranscription& transcription);
 Metrics computeIntermediateMetrics(OptimalControlProblem& optimalControlProblem, DynamicsDiscretizer& discretizer, scalar_t t, scalar_t dt,
                                    const vector_t& x, const vector_t& x_next, const vector_t& u);
 
+/**
+ * Compute the Metrics for a single intermediate node in place. The memory of the dynamics violation is reused if its size does not
+ * change.
+ * @param optimalControlProblem : Definition of the optimal control problem
+ * @param discretizer : Integrator to use for creating the discrete dynamics.
+ * @param t : Start of the discrete interval
+ * @param dt : Duration of the interval
+ * @param x : State at start of the interval
+ * @param x_next : State at the end of the interval
+ * @param u : Input, taken to be constant across the interval.
+ * @param [out] metrics : Metrics for a single intermediate node.
+ */
+void computeIntermediateMetrics(OptimalControlProblem& optimalControlProblem, DynamicsDiscretizer& discretizer, scalar_t t, scalar_t dt,
+                                const vector_t& x, const vector_t& x_next, const vector_t& u, Metrics& metrics);
+
 /**
  * Compute the Metrics for the event node.
  * @param optimalControlProblem : Definition of the optimal control problem
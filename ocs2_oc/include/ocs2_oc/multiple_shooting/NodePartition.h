@@ -0,0 +1,100 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include <ocs2_core/Types.h>
+#include <ocs2_core/thread_support/ThreadPool.h>
+
+namespace ocs2 {
+namespace multiple_shooting {
+
+/**
+ * Splits the time nodes of a multiple-shooting problem into contiguous ranges which are pinned to a fixed set of workers.
+ *
+ * Compared to handing out the nodes through an atomic counter, each worker keeps processing the same nodes with the same
+ * worker-specific resources (e.g., the cloned OptimalControlProblem) across iterations and MPC cycles. The computation time of
+ * each node is measured and the partition is only rebalanced when the measured cost of the slowest partition exceeds the average
+ * by more than the given tolerance, e.g., when a mode switch enters the horizon.
+ */
+class NodePartition {
+ public:
+  /**
+   * Constructor
+   *
+   * @param [in] numPartitions: The number of partitions, i.e., the number of workers.
+   * @param [in] imbalanceTolerance: The relative excess of the slowest partition over the average which triggers a rebalancing.
+   */
+  NodePartition(size_t numPartitions, scalar_t imbalanceTolerance);
+
+  /**
+   * Runs nodeTask for all nodes in [0, numNodes) on the thread pool, where partition p processes its node range with workerId = p.
+   *
+   * @param [in] threadPool: The thread pool.
+   * @param [in] numNodes: The number of nodes.
+   * @param [in] nodeTask: The node task. It takes the worker index and the node index.
+   * @param [in] measureCost: Whether to measure the node computation time which is used for rebalancing the partition.
+   */
+  void run(ThreadPool& threadPool, int numNodes, const std::function<void(int, int)>& nodeTask, bool measureCost = true);
+
+  /**
+   * Updates the partition for the given number of nodes. The node ranges are only rebalanced if the number of nodes has changed or
+   * if the last measured node costs indicate an imbalance.
+   *
+   * @param [in] numNodes: The number of nodes.
+   * @return True if the node ranges have been rebalanced.
+   */
+  bool update(int numNodes);
+
+  /** Sets the measured cost of a node. Can be called concurrently for different nodes. */
+  void setNodeCost(int node, scalar_t cost) { nodeCost_[node] = cost; }
+
+  /** The first node of a partition. */
+  int begin(size_t partition) const { return boundaries_[partition]; }
+
+  /** The node after the last node of a partition. */
+  int end(size_t partition) const { return boundaries_[partition + 1]; }
+
+  /** The number of partitions. */
+  size_t numPartitions() const { return boundaries_.size() - 1; }
+
+ private:
+  /** Recomputes the boundaries such that all partitions have approximately the same cost. */
+  void rebalance();
+
+  const scalar_t imbalanceTolerance_;
+  std::vector<int> boundaries_;  // partition p holds the nodes [boundaries_[p], boundaries_[p+1])
+  scalar_array_t nodeCost_;
+};
+
+}  // namespace multiple_shooting
+}  // namespace ocs2
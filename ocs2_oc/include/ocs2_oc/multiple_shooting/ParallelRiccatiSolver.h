@@ -0,0 +1,146 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <vector>
+
+#include <ocs2_core/Types.h>
+#include <ocs2_core/thread_support/ThreadPool.h>
+
+namespace ocs2 {
+namespace multiple_shooting {
+
+/**
+ * Parallel-in-time solver of the equality-free QP subproblem of the multiple-shooting solvers:
+ *
+ *   min_{dx, du}  sum_k 1/2 [dx_k; du_k]' H_k [dx_k; du_k] + h_k' [dx_k; du_k] + 1/2 dx_N' Q_N dx_N + q_N' dx_N
+ *   s.t.          dx_{k+1} = A_k dx_k + B_k du_k + b_k,  dx_0 given.
+ *
+ * The horizon is split into contiguous segments, one per partition. Every segment is first condensed into its conditional
+ * value function, i.e., the optimal cost of moving from the segment's initial state to its final state, which is parametrized as
+ * an element (A, b, C, eta, J) of the associative operator of Sarkka and Garcia-Fernandez, "Temporal Parallelization of Dynamic
+ * Programming and Linear Quadratic Control", IEEE TAC 2023. The solver then
+ *   1. condenses the segments in parallel,
+ *   2. combines the condensed segments serially, which gives the value function and the optimal state at the segment boundaries,
+ *   3. runs the standard Riccati recursion and the forward rollout of each segment in parallel, starting from the boundary values.
+ *
+ * The serial part only scales with the number of partitions. The condensation costs about 1.5 times a Riccati recursion over the same
+ * stages, hence the speedup over the sequential recursion approaches numPartitions / 2.5 on long horizons. The solver is slower than
+ * the sequential recursion with two partitions and gains little with three, therefore fewer than minNumPartitions partitions fall back
+ * to a single partition, for which the solver reduces to the sequential Riccati recursion.
+ *
+ * @note The input Hessians R_k need to be positive definite.
+ */
+class ParallelRiccatiSolver {
+ public:
+  /** The minimum number of partitions for which the parallel algorithm pays off over the sequential Riccati recursion. */
+  static constexpr size_t minNumPartitions = 4;
+
+  /**
+   * Constructor
+   *
+   * @param [in] numPartitions: The number of time segments which are processed in parallel. Less than minNumPartitions selects the
+   *                            sequential Riccati recursion.
+   */
+  explicit ParallelRiccatiSolver(size_t numPartitions);
+
+  /**
+   * Solves the QP subproblem. Throws if a Riccati or condensed input Hessian is not positive definite.
+   *
+   * @param [in] threadPool: The thread pool which processes the segments.
+   * @param [in] x0 : Initial state (deviation).
+   * @param [in] dynamics : Linearized dynamics for k = 0, ..., N - 1.
+   * @param [in] cost : Quadratic cost for k = 0, ..., N.
+   * @param [out] stateTrajectory : Solution state (deviation) trajectory for k = 0, ..., N.
+   * @param [out] inputTrajectory : Solution input (deviation) trajectory for k = 0, ..., N - 1.
+   */
+  void solve(ThreadPool& threadPool, const vector_t& x0, const std::vector<VectorFunctionLinearApproximation>& dynamics,
+             const std::vector<ScalarFunctionQuadraticApproximation>& cost, vector_array_t& stateTrajectory,
+             vector_array_t& inputTrajectory);
+
+  /** Returns the Riccati cost-to-go (dfdxx, dfdx) for k = 0, ..., N of the previously solved problem. */
+  std::vector<ScalarFunctionQuadraticApproximation> getRiccatiCostToGo() const;
+
+  /** Returns the Riccati feedback matrices K of the optimal solution du = K dx + k for k = 0, ..., N - 1. */
+  const matrix_array_t& getRiccatiFeedback() const { return feedback_; }
+
+  /** Returns the Riccati feedforward vectors k of the optimal solution du = K dx + k for k = 0, ..., N - 1. */
+  const vector_array_t& getRiccatiFeedforward() const { return feedforward_; }
+
+  /** The number of partitions, which is 1 if the solver falls back to the sequential Riccati recursion. */
+  size_t numPartitions() const { return numPartitions_; }
+
+ private:
+  /**
+   * Conditional value function of a segment from its initial state x to its final state z:
+   * V(x, z) = 1/2 x' J x - eta' x + 1/2 (z - A x - b)' C^{-1} (z - A x - b), where a singular C restricts z to the reachable set.
+   */
+  struct Element {
+    matrix_t A;
+    vector_t b;
+    matrix_t C;
+    vector_t eta;
+    matrix_t J;
+  };
+
+  /** Temporaries of a partition. */
+  struct Workspace {
+    Eigen::LLT<matrix_t> inputHessianLlt;
+    matrix_t F, Qt, RinvP, JB, AB, HinvJBt, AM, tmp;
+    vector_t c, qt, Rinvr, v, w;
+  };
+
+  /** Condenses the stages of partition p into its element. */
+  void condenseSegment(int p, const std::vector<VectorFunctionLinearApproximation>& dynamics,
+                       const std::vector<ScalarFunctionQuadraticApproximation>& cost);
+
+  /** Combines the element of a single stage with the element of the stages that follow it, E <- e_k (x) E. */
+  static void combineStage(const VectorFunctionLinearApproximation& dynamics, const ScalarFunctionQuadraticApproximation& cost,
+                           Element& element, Workspace& workspace);
+
+  /** Riccati recursion and forward rollout over the stages of partition p. */
+  void solveSegment(int p, const std::vector<VectorFunctionLinearApproximation>& dynamics,
+                    const std::vector<ScalarFunctionQuadraticApproximation>& cost, vector_array_t& stateTrajectory,
+                    vector_array_t& inputTrajectory);
+
+  size_t numPartitions_;
+  std::vector<int> boundaries_;  // first stage of each partition, followed by N
+  std::vector<Element> elements_;
+  std::vector<Workspace> workspaces_;
+
+  // Riccati solution
+  matrix_array_t costToGoMatrix_;
+  vector_array_t costToGoVector_;
+  matrix_array_t feedback_;
+  vector_array_t feedforward_;
+};
+
+}  // namespace multiple_shooting
+}  // namespace ocs2
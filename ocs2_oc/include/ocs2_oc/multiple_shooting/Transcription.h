@@ -30,6 +30,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
 #include <ocs2_core/Types.h>
+#include <ocs2_core/constraint/BoxConstraint.h>
 #include <ocs2_core/integration/SensitivityIntegrator.h>
 
 #include "ocs2_oc/multiple_shooting/ProjectionMultiplierCoefficients.h"
@@ -59,6 +60,8 @@ struct Transcription {
   VectorFunctionLinearApproximation stateInputEqConstraints;
   VectorFunctionLinearApproximation stateIneqConstraints;
   VectorFunctionLinearApproximation stateInputIneqConstraints;
+  BoxConstraintBounds stateBoxConstraints;  // bounds on the state deviation dx
+  BoxConstraintBounds inputBoxConstraints;  // bounds on the input deviation du
   VectorFunctionLinearApproximation constraintsProjection;
   ProjectionMultiplierCoefficients projectionMultiplierCoefficients;
 };
@@ -78,8 +81,29 @@ struct Transcription {
 Transcription setupIntermediateNode(OptimalControlProblem& optimalControlProblem, DynamicsSensitivityDiscretizer& sensitivityDiscretizer,
                                     scalar_t t, scalar_t dt, const vector_t& x, const vector_t& x_next, const vector_t& u);
 
+/**
+ * Compute the multiple shooting transcription for a single intermediate node in place. All fields of the given transcription are
+ * overwritten, such that a transcription object can be reused across iterations without reconstructing it. The memory of the fields is
+ * reused if their sizes do not change.
+ *
+ * @note In the presence of state-input equality constraints, the constraint projection fields keep their previous value until
+ * projectTranscription() overwrites them. Otherwise they are cleared.
+ *
+ * @param optimalControlProblem : Definition of the optimal control problem
+ * @param sensitivityDiscretizer : Integrator to use for creating the discrete dynamics.
+ * @param t : Start of the discrete interval
+ * @param dt : Duration of the interval
+ * @param x : State at start of the interval
+ * @param x_next : State at the end of the interval
+ * @param u : Input, taken to be constant across the interval.
+ * @param [out] transcription : multiple shooting transcription for this node.
+ */
+void setupIntermediateNode(OptimalControlProblem& optimalControlProblem, DynamicsSensitivityDiscretizer& sensitivityDiscretizer, scalar_t t,
+                           scalar_t dt, const vector_t& x, const vector_t& x_next, const vector_t& u, Transcription& transcription);
+
 /**
  * Apply the state-input equality constraint projection for a single intermediate node transcription.
+ * The projection is not compatible with input box constraints, an exception is thrown if both are present.
  *
  * @param transcription : Transcription for a single intermediate node
  * @param extractProjectionMultiplier : Whether to extract the projection multiplier.
@@ -94,6 +118,7 @@ struct TerminalTranscription {
   ScalarFunctionQuadraticApproximation cost;
   VectorFunctionLinearApproximation eqConstraints;
   VectorFunctionLinearApproximation ineqConstraints;
+  BoxConstraintBounds stateBoxConstraints;  // bounds on the state deviation dx
 };
 
 /**
@@ -106,6 +131,16 @@ struct TerminalTranscription {
  */
 TerminalTranscription setupTerminalNode(OptimalControlProblem& optimalControlProblem, scalar_t t, const vector_t& x);
 
+/**
+ * Compute the multiple shooting transcription the terminal node in place. All fields of the given transcription are overwritten.
+ *
+ * @param optimalControlProblem : Definition of the optimal control problem
+ * @param t : Time at the terminal node
+ * @param x : Terminal state
+ * @param [out] transcription : multiple shooting transcription for the terminal node.
+ */
+void setupTerminalNode(OptimalControlProblem& optimalControlProblem, scalar_t t, const vector_t& x, TerminalTranscription& transcription);
+
 /**
  * Results of the transcription at an event
  */
@@ -115,6 +150,7 @@ struct EventTranscription {
   VectorFunctionLinearApproximation dynamics;
   VectorFunctionLinearApproximation eqConstraints;
   VectorFunctionLinearApproximation ineqConstraints;
+  BoxConstraintBounds stateBoxConstraints;  // bounds on the pre-event state deviation dx
 };
 
 /**
@@ -128,5 +164,17 @@ struct EventTranscription {
  */
 EventTranscription setupEventNode(OptimalControlProblem& optimalControlProblem, scalar_t t, const vector_t& x, const vector_t& x_next);
 
+/**
+ * Compute the jump transcription at an event node in place. All fields of the given transcription are overwritten.
+ *
+ * @param optimalControlProblem : Definition of the optimal control problem
+ * @param t : Time at the event node
+ * @param x : Pre-event state
+ * @param x_next : Post-event state
+ * @param [out] transcription : multiple shooting transcription for the event node.
+ */
+void setupEventNode(OptimalControlProblem& optimalControlProblem, scalar_t t, const vector_t& x, const vector_t& x_next,
+                    EventTranscription& transcription);
+
 }  // namespace multiple_shooting
 }  // namespace ocs2
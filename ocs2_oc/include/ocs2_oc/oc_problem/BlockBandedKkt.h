@@ -0,0 +1,112 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <vector>
+
+#include <ocs2_core/Types.h>
+
+namespace ocs2 {
+
+/**
+ * Block-banded storage of the cost hessian H w.r.t. Z = [u_{0}; x_{1}; ...; u_{n}; x_{n+1}]. The decision vector is split into the
+ * stage segments Z_0 = u_{0}, Z_k = [x_{k}; u_{k}], and Z_{n+1} = x_{n+1}, on which H is block diagonal:
+ *
+ * H = diag(R0, [Q1 P1'; P1 R1], ..., [Qn Pn'; Pn Rn], Q{n+1})
+ *
+ * Only the dense diagonal blocks are stored. Refer to getCostMatrixBlockBanded in "ocs2_oc/oc_problem/OcpToKkt.h" for construction.
+ */
+struct BlockBandedCostMatrix {
+  /** The start index of each stage segment in Z. The last entry is the size of Z. */
+  std::vector<int> segmentOffsets;
+  /** The diagonal blocks of H. */
+  matrix_array_t blocks;
+
+  int rows() const { return segmentOffsets.empty() ? 0 : segmentOffsets.back(); }
+  int cols() const { return rows(); }
+
+  /** y = H * x */
+  void multiply(const vector_t& x, vector_t& y) const;
+
+  /** y += alpha * H * x */
+  void multiplyAdd(scalar_t alpha, const vector_t& x, vector_t& y) const;
+
+  /** Returns the dense matrix. Meant for testing. */
+  matrix_t toDense() const;
+};
+
+/**
+ * Block-banded storage of the constraint jacobian G w.r.t. Z = [u_{0}; x_{1}; ...; u_{n}; x_{n+1}] with the stage segments of
+ * BlockBandedCostMatrix. The rows of G are the dynamics rows followed by the general constraint rows:
+ *
+ * G = [-B0  I
+ *       *  -A1 -B1   I
+ *
+ *       *   *   *   -An -Bn  I
+ *       D0  0
+ *       *   C1  D1   0
+ *
+ *       *   *   *    Cn  Dn  0]
+ *
+ * The dynamics rows of stage k hold the block -[Ak, Bk] acting on Z_k and a diagonal block (the identity or the scaling vector) acting
+ * on x_{k+1}. The constraint rows of stage k hold the block [Ck, Dk] acting on Z_k. Refer to getConstraintMatrixBlockBanded in
+ * "ocs2_oc/oc_problem/OcpToKkt.h" for construction.
+ */
+struct BlockBandedConstraintMatrix {
+  /** The start index of each stage segment in Z. The last entry is the size of Z. */
+  std::vector<int> segmentOffsets;
+  /** The start row of the dynamics rows of each stage. The last entry is the number of dynamics rows. */
+  std::vector<int> dynamicsRowOffsets;
+  /** The start row of the constraint rows of each stage. The last entry is the number of rows of G. */
+  std::vector<int> constraintRowOffsets;
+  /** The blocks -[Ak, Bk] of the dynamics rows. For k = 0, it is -B0. */
+  matrix_array_t dynamicsBlocks;
+  /** The diagonal of the blocks acting on x_{k+1} in the dynamics rows. */
+  vector_array_t dynamicsDiagonals;
+  /** The blocks [Ck, Dk] of the constraint rows. For k = 0, it is D0 and for k = n + 1, it is C{n+1}. Empty if there is no constraint. */
+  matrix_array_t constraintBlocks;
+
+  int rows() const { return constraintRowOffsets.empty() ? 0 : constraintRowOffsets.back(); }
+  int cols() const { return segmentOffsets.empty() ? 0 : segmentOffsets.back(); }
+
+  /** y = G * x */
+  void multiply(const vector_t& x, vector_t& y) const;
+
+  /** y += alpha * G * x */
+  void multiplyAdd(scalar_t alpha, const vector_t& x, vector_t& y) const;
+
+  /** y += alpha * G' * x */
+  void transposeMultiplyAdd(scalar_t alpha, const vector_t& x, vector_t& y) const;
+
+  /** Returns the dense matrix. Meant for testing. */
+  matrix_t toDense() const;
+};
+
+}  // namespace ocs2
@@ -32,6 +32,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <vector>
 
 #include <ocs2_core/Types.h>
+#include <ocs2_core/constraint/BoxConstraint.h>
 
 namespace ocs2 {
 /**
@@ -86,4 +87,26 @@ OcpSize extractSizesFromProblem(const std::vector<VectorFunctionLinearApproximat
                                 const std::vector<ScalarFunctionQuadraticApproximation>& cost,
                                 const std::vector<VectorFunctionLinearApproximation>* constraints);
 
+/**
+ * Extract sizes based on the problem data into an existing OcpSize. Does not allocate memory if the number of stages did not change.
+ *
+ * @param dynamics : Linearized approximation of the discrete dynamics.
+ * @param cost : Quadratic approximation of the cost.
+ * @param constraints : Linearized approximation of constraints, all constraints are mapped to inequality constraints in HPIPM.
+ * @param [out] problemSize : Derived sizes
+ */
+void extractSizesFromProblem(const std::vector<VectorFunctionLinearApproximation>& dynamics,
+                             const std::vector<ScalarFunctionQuadraticApproximation>& cost,
+                             const std::vector<VectorFunctionLinearApproximation>* constraints, OcpSize& problemSize);
+
+/**
+ * Sets the number of box constraints and box slack variables of an OcpSize that was extracted with extractSizesFromProblem.
+ *
+ * @param stateBoxConstraints : State box constraints for all N+1 nodes, nullptr if there are none.
+ * @param inputBoxConstraints : Input box constraints for the N stages, nullptr if there are none.
+ * @param [out] problemSize : Sizes with the box constraints added.
+ */
+void extractBoxConstraintSizes(const std::vector<BoxConstraintBounds>* stateBoxConstraints,
+                               const std::vector<BoxConstraintBounds>* inputBoxConstraints, OcpSize& problemSize);
+
 }  // namespace ocs2
\ No newline at end of file
@@ -33,6 +33,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <ocs2_core/Types.h>
 
+#include "ocs2_oc/oc_problem/BlockBandedKkt.h"
 #include "ocs2_oc/oc_problem/OcpSize.h"
 
 namespace ocs2 {
@@ -96,6 +97,25 @@ void getConstraintMatrixSparse(const OcpSize& ocpSize, const vector_t& x0, const
                                const std::vector<VectorFunctionLinearApproximation>* constraints, const vector_array_t* scalingVectorsPtr,
                                Eigen::SparseMatrix<scalar_t>& G, vector_t& g);
 
+/**
+ * Constructs the block-banded representation of the concatenated constraints w.r.t. Z = [u_{0}; x_{1}; ...; u_{n}; x_{n+1}]. The
+ * resulting G and g are identical to getConstraintMatrixSparse, but G only stores the dense per-stage blocks as specified by OcpSize.
+ * The memory of G is reused if the problem size does not change.
+ *
+ * @param[in] ocpSize: The size of optimal control problem.
+ * @param[in] x0: The initial state.
+ * @param[in] dynamics: Linear approximation of the dynamics over the time horizon.
+ * @param[in] constraints: Linear approximation of the constraints over the time horizon. Pass nullptr if there is no constraints.
+ * @param[in] scalingVectorsPtr: Vector representatoin for the identity parts of the dynamics inside the constraint matrix. After scaling,
+ *                               they become arbitrary diagonal matrices. Pass nullptr to get them filled with identity matrices.
+ * @param[out] G: The block-banded jacobian of the concatenated constraints w.r.t. Z.
+ * @param[out] g: The concatenated constraints value.
+ */
+void getConstraintMatrixBlockBanded(const OcpSize& ocpSize, const vector_t& x0,
+                                    const std::vector<VectorFunctionLinearApproximation>& dynamics,
+                                    const std::vector<VectorFunctionLinearApproximation>* constraints,
+                                    const vector_array_t* scalingVectorsPtr, BlockBandedConstraintMatrix& G, vector_t& g);
+
 /**
  * Constructs concatenated quadratic approximation of the total cost w.r.t. Z = [u_{0}; x_{1}; ...; u_{n}; x_{n+1}].
  *
@@ -142,6 +162,20 @@ void getCostMatrix(const OcpSize& ocpSize, const vector_t& x0, const std::vector
 void getCostMatrixSparse(const OcpSize& ocpSize, const vector_t& x0, const std::vector<ScalarFunctionQuadraticApproximation>& cost,
                          Eigen::SparseMatrix<scalar_t>& H, vector_t& h);
 
+/**
+ * Constructs the block-banded representation of the concatenated hessian and jacobian of the total cost w.r.t.
+ * Z = [u_{0}; x_{1}; ...; u_{n}; x_{n+1}]. The resulting H and h are identical to getCostMatrixSparse, but H only stores the dense
+ * diagonal blocks. The memory of H is reused if the problem size does not change.
+ *
+ * @param[in] ocpSize: The size of optimal control problem.
+ * @param[in] x0: The initial state.
+ * @param[in] cost: Quadratic approximation of the cost over the time horizon.
+ * @param[out] H: The block-banded hessian matrix w.r.t. Z.
+ * @param[out] h: The concatenated jacobian vector w.r.t. Z.
+ */
+void getCostMatrixBlockBanded(const OcpSize& ocpSize, const vector_t& x0, const std::vector<ScalarFunctionQuadraticApproximation>& cost,
+                              BlockBandedCostMatrix& H, vector_t& h);
+
 /**
  * Deserializes the stacked solution to state-input trajecotries. Note that the initial state is not part of the stacked solution.
  *
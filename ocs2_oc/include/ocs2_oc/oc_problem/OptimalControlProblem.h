@@ -35,6 +35,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ocs2_core/Types.h>
 #include <ocs2_core/augmented_lagrangian/StateAugmentedLagrangianCollection.h>
 #include <ocs2_core/augmented_lagrangian/StateInputAugmentedLagrangianCollection.h>
+#include <ocs2_core/constraint/BoxConstraintCollection.h>
 #include <ocs2_core/constraint/StateConstraintCollection.h>
 #include <ocs2_core/constraint/StateInputConstraintCollection.h>
 #include <ocs2_core/cost/StateCostCollection.h>
@@ -86,6 +87,14 @@ struct OptimalControlProblem {
   /** Final inequality constraints */
   std::unique_ptr<StateConstraintCollection> finalInequalityConstraintPtr;
 
+  /* Box constraints, only supported by the SQP solver. The state boxes are not enforced on the initial state, which is fixed. */
+  /** Intermediate state box constraints, also applied to the pre-event states */
+  std::unique_ptr<BoxConstraintCollection> stateBoxConstraintPtr;
+  /** Intermediate input box constraints */
+  std::unique_ptr<BoxConstraintCollection> inputBoxConstraintPtr;
+  /** Final state box constraints */
+  std::unique_ptr<BoxConstraintCollection> finalStateBoxConstraintPtr;
+
   /* Lagrangians */
   /** Lagrangian for intermediate equality constraints */
   std::unique_ptr<StateInputAugmentedLagrangianCollection> equalityLagrangianPtr;
@@ -102,6 +102,15 @@ class SolverBase {
    */
   void run(scalar_t initTime, const vector_t& initState, scalar_t finalTime, const PrimalSolution& primalSolution);
 
+  /**
+   * The preparation phase of a real-time iteration scheme. Prepares the next call of run() for the given time horizon before the initial
+   * state is known, such that run() only needs to process the new initial state. Solvers without a preparation phase do nothing.
+   *
+   * @param [in] initTime: The expected initial time of the next run() call.
+   * @param [in] finalTime: The final time.
+   */
+  void prepare(scalar_t initTime, scalar_t finalTime) { prepareImpl(initTime, finalTime); }
+
   /**
    * Sets the ReferenceManager which manages both ModeSchedule and TargetTrajectories. This module updates before SynchronizedModules.
    */
@@ -259,6 +268,8 @@ class SolverBase {
 
   virtual void runImpl(scalar_t initTime, const vector_t& initState, scalar_t finalTime, const PrimalSolution& primalSolution) = 0;
 
+  virtual void prepareImpl(scalar_t /*initTime*/, scalar_t /*finalTime*/) {}
+
   void preRun(scalar_t initTime, const vector_t& initState, scalar_t finalTime);
 
   void postRun();
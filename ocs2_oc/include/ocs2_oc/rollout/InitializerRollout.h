@@ -53,6 +53,7 @@ class InitializerRollout : public RolloutBase {
   ~InitializerRollout() override = default;
   InitializerRollout* clone() const override;
 
+  using RolloutBase::run;
   vector_t run(scalar_t initTime, const vector_t& initState, scalar_t finalTime, ControllerBase* controller, ModeSchedule& modeSchedule,
                scalar_array_t& timeTrajectory, size_array_t& postEventIndices, vector_array_t& stateTrajectory,
                vector_array_t& inputTrajectory) override;
@@ -34,6 +34,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <ocs2_core/Types.h>
 #include <ocs2_core/control/ControllerBase.h>
+#include <ocs2_core/misc/ContiguousTrajectory.h>
 #include "ocs2_core/reference/ModeSchedule.h"
 
 #include "ocs2_oc/rollout/RolloutSettings.h"
@@ -108,6 +109,24 @@ class RolloutBase {
                        ModeSchedule& modeSchedule, scalar_array_t& timeTrajectory, size_array_t& postEventIndices,
                        vector_array_t& stateTrajectory, vector_array_t& inputTrajectory) = 0;
 
+  /**
+   * Forward integrate the system dynamics with given controller into a contiguous trajectory. The trajectory's memory is reused,
+   * so calling this method repeatedly with the same trajectory does not allocate memory per node once it has grown large enough.
+   * The default implementation copies the result of the vector_array_t variant.
+   *
+   * @param [in] initTime: The initial time.
+   * @param [in] initState: The initial state.
+   * @param [in] finalTime: The final time.
+   * @param [in] controller: control policy.
+   * @param [in, out] modeSchedule: Defines the sequence of modes and the associated event times. For TimeTriggeredRollout
+   *                                this is an input argument while for StateTriggeredRollout this is an output argument.
+   * @param [out] trajectory: The time, state, and input trajectories with the post-event indices.
+   *
+   * @return The final state (state jump is considered if it took place)
+   */
+  virtual vector_t run(scalar_t initTime, const vector_t& initState, scalar_t finalTime, ControllerBase* controller,
+                       ModeSchedule& modeSchedule, ContiguousTrajectory& trajectory);
+
   /**
    * Prints out the rollout.
    *
@@ -128,6 +147,10 @@ class RolloutBase {
   void checkNumericalStability(const ControllerBase& controller, const scalar_array_t& timeTrajectory, const size_array_t& postEventIndices,
                                const vector_array_t& stateTrajectory, const vector_array_t& inputTrajectory) const;
 
+  /** Checks for the numerical stability of a contiguous trajectory if rollout::Settings::checkNumericalStability is true. */
+  void checkNumericalStability(const ControllerBase& controller, const scalar_array_t& timeTrajectory, const size_array_t& postEventIndices,
+                               const ContiguousVectorArray& stateTrajectory, const ContiguousVectorArray& inputTrajectory) const;
+
   const rollout::Settings rolloutSettings_;
 };
 
@@ -64,6 +64,7 @@ class StateTriggeredRollout : public RolloutBase {
   void abortRollout() override { systemEventHandlersPtr_->killIntegration_ = true; }
   void reactivateRollout() override { systemEventHandlersPtr_->killIntegration_ = false; }
 
+  using RolloutBase::run;
   vector_t run(scalar_t initTime, const vector_t& initState, scalar_t finalTime, ControllerBase* controller, ModeSchedule& modeSchedule,
                scalar_array_t& timeTrajectory, size_array_t& postEventIndices, vector_array_t& stateTrajectory,
                vector_array_t& inputTrajectory) override;
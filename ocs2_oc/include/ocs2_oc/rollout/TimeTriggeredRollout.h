@@ -68,7 +68,16 @@ class TimeTriggeredRollout : public RolloutBase {
                scalar_array_t& timeTrajectory, size_array_t& postEventIndices, vector_array_t& stateTrajectory,
                vector_array_t& inputTrajectory) override;
 
+  vector_t run(scalar_t initTime, const vector_t& initState, scalar_t finalTime, ControllerBase* controller, ModeSchedule& modeSchedule,
+               ContiguousTrajectory& trajectory) override;
+
  private:
+  /** Implements both variants of run(). StateTrajectory is either vector_array_t or ContiguousVectorArray. */
+  template <typename StateTrajectory>
+  vector_t runImpl(scalar_t initTime, const vector_t& initState, scalar_t finalTime, ControllerBase* controller, ModeSchedule& modeSchedule,
+                   scalar_array_t& timeTrajectory, size_array_t& postEventIndices, StateTrajectory& stateTrajectory,
+                   StateTrajectory& inputTrajectory);
+
   std::unique_ptr<PreComputation> preCompPtr_;
   std::unique_ptr<ControlledSystemBase> systemDynamicsPtr_;
 
@@ -29,6 +29,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #pragma once
 
+#include <mutex>
+
 #include "ocs2_core/thread_support/BufferedValue.h"
 #include "ocs2_oc/synchronized_module/ReferenceManagerInterface.h"
 
@@ -37,11 +39,24 @@ namespace ocs2 {
 /**
  * Implements the reference manager with a thread-safe buffer for setting and getting the references.
  * A protected virtual interface is provided to modify the references before each solver run.
+ *
+ * Besides replacing the whole TargetTrajectories, the target points can be streamed through appendTargetTrajectories(). The
+ * appended points are copied into a preallocated ring buffer and merged into the active TargetTrajectories in preSolverRun(),
+ * where the points before the initial time are dropped. The merge reuses the storage of the dropped points, so a stream that
+ * keeps the horizon length constant does not reallocate.
  */
 class ReferenceManager : public ReferenceManagerInterface {
  public:
+  /**
+   * Constructor
+   *
+   * @param [in] initialTargetTrajectories : The initial TargetTrajectories.
+   * @param [in] initialModeSchedule : The initial ModeSchedule.
+   * @param [in] appendBufferCapacity : The maximum number of appended target points which are kept between two solver runs. If
+   * more points are appended, the oldest ones are overwritten.
+   */
   explicit ReferenceManager(TargetTrajectories initialTargetTrajectories = TargetTrajectories(),
-                            ModeSchedule initialModeSchedule = ModeSchedule());
+                            ModeSchedule initialModeSchedule = ModeSchedule(), size_t appendBufferCapacity = 100);
 
   ~ReferenceManager() override = default;
 
@@ -52,12 +67,9 @@ class ReferenceManager : public ReferenceManagerInterface {
   void setModeSchedule(ModeSchedule&& modeSchedule) override { modeSchedule_.setBuffer(std::move(modeSchedule)); }
 
   const TargetTrajectories& getTargetTrajectories() const override { return targetTrajectories_.get(); }
-  void setTargetTrajectories(const TargetTrajectories& targetTrajectories) override {
-    return targetTrajectories_.setBuffer(targetTrajectories);
-  }
-  void setTargetTrajectories(TargetTrajectories&& targetTrajectories) override {
-    return targetTrajectories_.setBuffer(std::move(targetTrajectories));
-  }
+  void setTargetTrajectories(const TargetTrajectories& targetTrajectories) override;
+  void setTargetTrajectories(TargetTrajectories&& targetTrajectories) override;
+  void appendTargetTrajectories(const TargetTrajectories& targetTrajectories) override;
 
  protected:
   /**
@@ -75,8 +87,18 @@ class ReferenceManager : public ReferenceManagerInterface {
                                 ModeSchedule& modeSchedule) {}
 
  private:
+  /** Merges the appended target points into the active TargetTrajectories and drops the points before initTime. */
+  void mergeAppendedTargets(scalar_t initTime);
+
   BufferedValue<ModeSchedule> modeSchedule_;
   BufferedValue<TargetTrajectories> targetTrajectories_;
+
+  // ring buffer of the target points appended since the last preSolverRun()
+  std::mutex appendedTargetsMutex_;
+  size_t appendedTargetsBegin_ = 0;
+  size_t numAppendedTargets_ = 0;
+  TargetTrajectories appendedTargets_;
+  std::vector<bool> appendedTargetsHasInput_;
 };
 
 }  // namespace ocs2
@@ -63,6 +63,9 @@ class ReferenceManagerDecorator : public ReferenceManagerInterface {
   void setTargetTrajectories(TargetTrajectories&& targetTrajectories) override {
     referenceManagerPtr_->setTargetTrajectories(std::move(targetTrajectories));
   }
+  void appendTargetTrajectories(const TargetTrajectories& targetTrajectories) override {
+    referenceManagerPtr_->appendTargetTrajectories(targetTrajectories);
+  }
 
  protected:
   std::shared_ptr<ReferenceManagerInterface> referenceManagerPtr_;
@@ -90,6 +90,14 @@ class ReferenceManagerInterface {
    * @note: This method must be thread safe.
    */
   virtual void setTargetTrajectories(TargetTrajectories&& targetTrajectories) = 0;
+
+  /**
+   * Appends the points of the given TargetTrajectories to the active TargetTrajectories once preSolverRun() is called.
+   * The appended points replace the active points at or after their time, and the active points before the initial time
+   * of the solver are dropped.
+   * @note: This method must be thread safe.
+   */
+  virtual void appendTargetTrajectories(const TargetTrajectories& targetTrajectories) = 0;
 };
 
 }  // namespace ocs2
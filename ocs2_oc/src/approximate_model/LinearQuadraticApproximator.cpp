@@ -50,36 +50,30 @@ void approximateIntermediateLQ(OptimalControlProblem& problem, const scalar_t ti
 
   // Dynamics
   modelData.dynamicsCovariance = problem.dynamicsPtr->dynamicsCovariance(time, state, input);
-  modelData.dynamics = problem.dynamicsPtr->linearApproximation(time, state, input, preComputation);
+  problem.dynamicsPtr->linearApproximation(time, state, input, preComputation, modelData.dynamics);
   modelData.dynamicsBias.setZero(modelData.dynamics.dfdx.rows());
 
   // Cost
-  modelData.cost = ocs2::approximateCost(problem, time, state, input);
+  ocs2::approximateCost(problem, time, state, input, modelData.cost);
 
   // Equality constraints
-  modelData.stateEqConstraint = problem.stateEqualityConstraintPtr->getLinearApproximation(time, state, preComputation);
-  modelData.stateInputEqConstraint = problem.equalityConstraintPtr->getLinearApproximation(time, state, input, preComputation);
+  problem.stateEqualityConstraintPtr->getLinearApproximation(time, state, preComputation, modelData.stateEqConstraint);
+  problem.equalityConstraintPtr->getLinearApproximation(time, state, input, preComputation, modelData.stateInputEqConstraint);
 
   // Lagrangians
   if (!problem.stateEqualityLagrangianPtr->empty()) {
-    auto approx = problem.stateEqualityLagrangianPtr->getQuadraticApproximation(time, state, multipliers.stateEq, preComputation);
-    modelData.cost.f += approx.f;
-    modelData.cost.dfdx += approx.dfdx;
-    modelData.cost.dfdxx += approx.dfdxx;
+    problem.stateEqualityLagrangianPtr->addQuadraticApproximation(time, state, multipliers.stateEq, preComputation, modelData.cost);
   }
   if (!problem.stateInequalityLagrangianPtr->empty()) {
-    auto approx = problem.stateInequalityLagrangianPtr->getQuadraticApproximation(time, state, multipliers.stateIneq, preComputation);
-    modelData.cost.f += approx.f;
-    modelData.cost.dfdx += approx.dfdx;
-    modelData.cost.dfdxx += approx.dfdxx;
+    problem.stateInequalityLagrangianPtr->addQuadraticApproximation(time, state, multipliers.stateIneq, preComputation, modelData.cost);
   }
   if (!problem.equalityLagrangianPtr->empty()) {
-    modelData.cost +=
-        problem.equalityLagrangianPtr->getQuadraticApproximation(time, state, input, multipliers.stateInputEq, preComputation);
+    problem.equalityLagrangianPtr->addQuadraticApproximation(time, state, input, multipliers.stateInputEq, preComputation,
+                                                             modelData.cost);
   }
   if (!problem.inequalityLagrangianPtr->empty()) {
-    modelData.cost +=
-        problem.inequalityLagrangianPtr->getQuadraticApproximation(time, state, input, multipliers.stateInputIneq, preComputation);
+    problem.inequalityLagrangianPtr->addQuadraticApproximation(time, state, input, multipliers.stateInputIneq, preComputation,
+                                                               modelData.cost);
   }
 }
 
@@ -101,23 +95,17 @@ void approximatePreJumpLQ(OptimalControlProblem& problem, const scalar_t& time,
   modelData.dynamicsBias.setZero(modelData.dynamics.dfdx.rows());
 
   // Pre-jump cost
-  modelData.cost = approximateEventCost(problem, time, state);
+  approximateEventCost(problem, time, state, modelData.cost);
 
   // state equality constraint
-  modelData.stateEqConstraint = problem.preJumpEqualityConstraintPtr->getLinearApproximation(time, state, preComputation);
+  problem.preJumpEqualityConstraintPtr->getLinearApproximation(time, state, preComputation, modelData.stateEqConstraint);
 
   // Lagrangians
   if (!problem.preJumpEqualityLagrangianPtr->empty()) {
-    auto approx = problem.preJumpEqualityLagrangianPtr->getQuadraticApproximation(time, state, multipliers.stateEq, preComputation);
-    modelData.cost.f += approx.f;
-    modelData.cost.dfdx += approx.dfdx;
-    modelData.cost.dfdxx += approx.dfdxx;
+    problem.preJumpEqualityLagrangianPtr->addQuadraticApproximation(time, state, multipliers.stateEq, preComputation, modelData.cost);
   }
   if (!problem.preJumpInequalityLagrangianPtr->empty()) {
-    auto approx = problem.preJumpInequalityLagrangianPtr->getQuadraticApproximation(time, state, multipliers.stateIneq, preComputation);
-    modelData.cost.f += approx.f;
-    modelData.cost.dfdx += approx.dfdx;
-    modelData.cost.dfdxx += approx.dfdxx;
+    problem.preJumpInequalityLagrangianPtr->addQuadraticApproximation(time, state, multipliers.stateIneq, preComputation, modelData.cost);
   }
 }
 
@@ -139,23 +127,17 @@ void approximateFinalLQ(OptimalControlProblem& problem, const scalar_t& time, co
   modelData.dynamics = VectorFunctionLinearApproximation();
 
   // state equality constraint
-  modelData.stateEqConstraint = problem.finalEqualityConstraintPtr->getLinearApproximation(time, state, preComputation);
+  problem.finalEqualityConstraintPtr->getLinearApproximation(time, state, preComputation, modelData.stateEqConstraint);
 
   // Final cost
-  modelData.cost = approximateFinalCost(problem, time, state);
+  approximateFinalCost(problem, time, state, modelData.cost);
 
   // Lagrangians
   if (!problem.finalEqualityLagrangianPtr->empty()) {
-    auto approx = problem.finalEqualityLagrangianPtr->getQuadraticApproximation(time, state, multipliers.stateEq, preComputation);
-    modelData.cost.f += approx.f;
-    modelData.cost.dfdx += approx.dfdx;
-    modelData.cost.dfdxx += approx.dfdxx;
+    problem.finalEqualityLagrangianPtr->addQuadraticApproximation(time, state, multipliers.stateEq, preComputation, modelData.cost);
   }
   if (!problem.finalInequalityLagrangianPtr->empty()) {
-    auto approx = problem.finalInequalityLagrangianPtr->getQuadraticApproximation(time, state, multipliers.stateIneq, preComputation);
-    modelData.cost.f += approx.f;
-    modelData.cost.dfdx += approx.dfdx;
-    modelData.cost.dfdxx += approx.dfdxx;
+    problem.finalInequalityLagrangianPtr->addQuadraticApproximation(time, state, multipliers.stateIneq, preComputation, modelData.cost);
   }
 }
 
@@ -180,32 +162,34 @@ scalar_t computeCost(const OptimalControlProblem& problem, const scalar_t& time,
 /******************************************************************************************************/
 ScalarFunctionQuadraticApproximation approximateCost(const OptimalControlProblem& problem, const scalar_t& time, const vector_t& state,
                                                      const vector_t& input) {
+  ScalarFunctionQuadraticApproximation cost;
+  approximateCost(problem, time, state, input, cost);
+  return cost;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void approximateCost(const OptimalControlProblem& problem, const scalar_t& time, const vector_t& state, const vector_t& input,
+                     ScalarFunctionQuadraticApproximation& cost) {
   const auto& targetTrajectories = *problem.targetTrajectoriesPtr;
   const auto& preComputation = *problem.preComputationPtr;
 
-  // get the state-input cost approximations
-  auto cost = problem.costPtr->getQuadraticApproximation(time, state, input, targetTrajectories, preComputation);
+  cost.setZero(state.rows(), input.rows());
 
+  // accumulate the state-input cost approximations
+  problem.costPtr->addQuadraticApproximation(time, state, input, targetTrajectories, preComputation, cost);
   if (!problem.softConstraintPtr->empty()) {
-    cost += problem.softConstraintPtr->getQuadraticApproximation(time, state, input, targetTrajectories, preComputation);
+    problem.softConstraintPtr->addQuadraticApproximation(time, state, input, targetTrajectories, preComputation, cost);
   }
 
-  // get the state only cost approximations
+  // accumulate the state only cost approximations
   if (!problem.stateCostPtr->empty()) {
-    auto stateCost = problem.stateCostPtr->getQuadraticApproximation(time, state, targetTrajectories, preComputation);
-    cost.f += stateCost.f;
-    cost.dfdx += stateCost.dfdx;
-    cost.dfdxx += stateCost.dfdxx;
+    problem.stateCostPtr->addQuadraticApproximation(time, state, targetTrajectories, preComputation, cost);
   }
-
   if (!problem.stateSoftConstraintPtr->empty()) {
-    auto stateCost = problem.stateSoftConstraintPtr->getQuadraticApproximation(time, state, targetTrajectories, preComputation);
-    cost.f += stateCost.f;
-    cost.dfdx += stateCost.dfdx;
-    cost.dfdxx += stateCost.dfdxx;
+    problem.stateSoftConstraintPtr->addQuadraticApproximation(time, state, targetTrajectories, preComputation, cost);
   }
-
-  return cost;
 }
 
 /******************************************************************************************************/
@@ -226,15 +210,24 @@ scalar_t computeEventCost(const OptimalControlProblem& problem, const scalar_t&
 /******************************************************************************************************/
 ScalarFunctionQuadraticApproximation approximateEventCost(const OptimalControlProblem& problem, const scalar_t& time,
                                                           const vector_t& state) {
+  ScalarFunctionQuadraticApproximation cost;
+  approximateEventCost(problem, time, state, cost);
+  return cost;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void approximateEventCost(const OptimalControlProblem& problem, const scalar_t& time, const vector_t& state,
+                          ScalarFunctionQuadraticApproximation& cost) {
   const auto& targetTrajectories = *problem.targetTrajectoriesPtr;
   const auto& preComputation = *problem.preComputationPtr;
 
-  auto cost = problem.preJumpCostPtr->getQuadraticApproximation(time, state, targetTrajectories, preComputation);
+  cost.setZero(state.rows());
+  problem.preJumpCostPtr->addQuadraticApproximation(time, state, targetTrajectories, preComputation, cost);
   if (!problem.preJumpSoftConstraintPtr->empty()) {
-    cost += problem.preJumpSoftConstraintPtr->getQuadraticApproximation(time, state, targetTrajectories, preComputation);
+    problem.preJumpSoftConstraintPtr->addQuadraticApproximation(time, state, targetTrajectories, preComputation, cost);
   }
-
-  return cost;
 }
 
 /******************************************************************************************************/
@@ -255,15 +248,24 @@ scalar_t computeFinalCost(const OptimalControlProblem& problem, const scalar_t&
 /******************************************************************************************************/
 ScalarFunctionQuadraticApproximation approximateFinalCost(const OptimalControlProblem& problem, const scalar_t& time,
                                                           const vector_t& state) {
+  ScalarFunctionQuadraticApproximation cost;
+  approximateFinalCost(problem, time, state, cost);
+  return cost;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void approximateFinalCost(const OptimalControlProblem& problem, const scalar_t& time, const vector_t& state,
+                          ScalarFunctionQuadraticApproximation& cost) {
   const auto& targetTrajectories = *problem.targetTrajectoriesPtr;
   const auto& preComputation = *problem.preComputationPtr;
 
-  auto cost = problem.finalCostPtr->getQuadraticApproximation(time, state, targetTrajectories, preComputation);
+  cost.setZero(state.rows());
+  problem.finalCostPtr->addQuadraticApproximation(time, state, targetTrajectories, preComputation, cost);
   if (!problem.finalSoftConstraintPtr->empty()) {
-    cost += problem.finalSoftConstraintPtr->getQuadraticApproximation(time, state, targetTrajectories, preComputation);
+    problem.finalSoftConstraintPtr->addQuadraticApproximation(time, state, targetTrajectories, preComputation, cost);
   }
-
-  return cost;
 }
 
 /******************************************************************************************************/
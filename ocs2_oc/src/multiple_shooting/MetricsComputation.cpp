@@ -34,10 +34,25 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 namespace ocs2 {
 namespace multiple_shooting {
 
-Metrics computeMetrics(const Transcription& transcription) {
-  const auto& constraintsSize = transcription.constraintsSize;
+namespace {
+/**
+ * Adds the box constraints evaluated at v to the metrics: the hard constraints are appended to the inequality constraints, the penalty
+ * of the soft constraints is added to the cost.
+ */
+void addBoxConstraintMetrics(const BoxConstraintBounds& bounds, const vector_t& v, vector_array_t& ineqConstraint, scalar_t& cost) {
+  ineqConstraint.push_back(getHardBoxConstraintValue(bounds, v));
+  cost += getSoftBoxConstraintPenalty(bounds, v);
+}
+}  // anonymous namespace
 
+Metrics computeMetrics(const Transcription& transcription) {
   Metrics metrics;
+  computeMetrics(transcription, metrics);
+  return metrics;
+}
+
+void computeMetrics(const Transcription& transcription, Metrics& metrics) {
+  const auto& constraintsSize = transcription.constraintsSize;
 
   // Cost
   metrics.cost = transcription.cost.f;
@@ -53,7 +68,21 @@ Metrics computeMetrics(const Transcription& transcription) {
   metrics.stateIneqConstraint = toConstraintArray(constraintsSize.stateIneq, transcription.stateIneqConstraints.f);
   metrics.stateInputIneqConstraint = toConstraintArray(constraintsSize.stateInputIneq, transcription.stateInputIneqConstraints.f);
 
-  return metrics;
+  // Box constraints, the bounds are defined for the deviation from the current state and input.
+  if (transcription.stateBoxConstraints.size() > 0) {
+    const vector_t dx = vector_t::Zero(transcription.dynamics.dfdx.cols());
+    addBoxConstraintMetrics(transcription.stateBoxConstraints, dx, metrics.stateIneqConstraint, metrics.cost);
+  }
+  if (transcription.inputBoxConstraints.size() > 0) {
+    const vector_t du = vector_t::Zero(transcription.dynamics.dfdu.cols());
+    addBoxConstraintMetrics(transcription.inputBoxConstraints, du, metrics.stateInputIneqConstraint, metrics.cost);
+  }
+
+  // Lagrangians are not part of the transcription
+  metrics.stateEqLagrangian.clear();
+  metrics.stateIneqLagrangian.clear();
+  metrics.stateInputEqLagrangian.clear();
+  metrics.stateInputIneqLagrangian.clear();
 }
 
 Metrics computeMetrics(const EventTranscription& transcription) {
@@ -73,6 +102,12 @@ Metrics computeMetrics(const EventTranscription& transcription) {
   // Inequality constraints.
   metrics.stateIneqConstraint = toConstraintArray(constraintsSize.stateIneq, transcription.ineqConstraints.f);
 
+  // Box constraints, the bounds are defined for the deviation from the current state.
+  if (transcription.stateBoxConstraints.size() > 0) {
+    const vector_t dx = vector_t::Zero(transcription.dynamics.dfdx.cols());
+    addBoxConstraintMetrics(transcription.stateBoxConstraints, dx, metrics.stateIneqConstraint, metrics.cost);
+  }
+
   return metrics;
 }
 
@@ -90,13 +125,27 @@ Metrics computeMetrics(const TerminalTranscription& transcription) {
   // Inequality constraints.
   metrics.stateIneqConstraint = toConstraintArray(constraintsSize.stateIneq, transcription.ineqConstraints.f);
 
+  // Box constraints, the bounds are defined for the deviation from the current state.
+  if (transcription.stateBoxConstraints.size() > 0) {
+    const vector_t dx = vector_t::Zero(transcription.cost.dfdx.size());
+    addBoxConstraintMetrics(transcription.stateBoxConstraints, dx, metrics.stateIneqConstraint, metrics.cost);
+  }
+
   return metrics;
 }
 
 Metrics computeIntermediateMetrics(OptimalControlProblem& optimalControlProblem, DynamicsDiscretizer& discretizer, scalar_t t, scalar_t dt,
                                    const vector_t& x, const vector_t& x_next, const vector_t& u) {
-  // Dynamics
-  auto dynamicsViolation = discretizer(*optimalControlProblem.dynamicsPtr, t, x, u, dt);
+  Metrics metrics;
+  computeIntermediateMetrics(optimalControlProblem, discretizer, t, dt, x, x_next, u, metrics);
+  return metrics;
+}
+
+void computeIntermediateMetrics(OptimalControlProblem& optimalControlProblem, DynamicsDiscretizer& discretizer, scalar_t t, scalar_t dt,
+                                const vector_t& x, const vector_t& x_next, const vector_t& u, Metrics& metrics) {
+  // Dynamics, computed in the memory of the previous dynamics violation
+  vector_t dynamicsViolation = std::move(metrics.dynamicsViolation);
+  discretizer(*optimalControlProblem.dynamicsPtr, t, x, u, dt, dynamicsViolation);
   dynamicsViolation -= x_next;
 
   // Precomputation
@@ -104,10 +153,22 @@ Metrics computeIntermediateMetrics(OptimalControlProblem& optimalControlProblem,
   optimalControlProblem.preComputationPtr->request(request, t, x, u);
 
   // Compute metrics
-  auto metrics = computeIntermediateMetrics(optimalControlProblem, t, x, u, std::move(dynamicsViolation));
+  metrics = computeIntermediateMetrics(optimalControlProblem, t, x, u, std::move(dynamicsViolation));
   metrics.cost *= dt;  // consider dt
 
-  return metrics;
+  // Box constraints, the slack penalty is not scaled with dt.
+  if (!optimalControlProblem.stateBoxConstraintPtr->empty()) {
+    const auto bounds = optimalControlProblem.stateBoxConstraintPtr->getBounds(t);
+    if (bounds.size() > 0) {
+      addBoxConstraintMetrics(bounds, x, metrics.stateIneqConstraint, metrics.cost);
+    }
+  }
+  if (!optimalControlProblem.inputBoxConstraintPtr->empty()) {
+    const auto bounds = optimalControlProblem.inputBoxConstraintPtr->getBounds(t);
+    if (bounds.size() > 0) {
+      addBoxConstraintMetrics(bounds, u, metrics.stateInputIneqConstraint, metrics.cost);
+    }
+  }
 }
 
 Metrics computeTerminalMetrics(OptimalControlProblem& optimalControlProblem, scalar_t t, const vector_t& x) {
@@ -115,7 +176,17 @@ Metrics computeTerminalMetrics(OptimalControlProblem& optimalControlProblem, sca
   constexpr auto request = Request::Cost + Request::SoftConstraint + Request::Constraint;
   optimalControlProblem.preComputationPtr->requestFinal(request, t, x);
 
-  return computeFinalMetrics(optimalControlProblem, t, x);
+  auto metrics = computeFinalMetrics(optimalControlProblem, t, x);
+
+  // Box constraints
+  if (!optimalControlProblem.finalStateBoxConstraintPtr->empty()) {
+    const auto bounds = optimalControlProblem.finalStateBoxConstraintPtr->getBounds(t);
+    if (bounds.size() > 0) {
+      addBoxConstraintMetrics(bounds, x, metrics.stateIneqConstraint, metrics.cost);
+    }
+  }
+
+  return metrics;
 }
 
 Metrics computeEventMetrics(OptimalControlProblem& optimalControlProblem, scalar_t t, const vector_t& x, const vector_t& x_next) {
@@ -127,7 +198,17 @@ Metrics computeEventMetrics(OptimalControlProblem& optimalControlProblem, scalar
   auto dynamicsViolation = optimalControlProblem.dynamicsPtr->computeJumpMap(t, x);
   dynamicsViolation -= x_next;
 
-  return computePreJumpMetrics(optimalControlProblem, t, x, std::move(dynamicsViolation));
+  auto metrics = computePreJumpMetrics(optimalControlProblem, t, x, std::move(dynamicsViolation));
+
+  // Box constraints
+  if (!optimalControlProblem.stateBoxConstraintPtr->empty()) {
+    const auto bounds = optimalControlProblem.stateBoxConstraintPtr->getBounds(t);
+    if (bounds.size() > 0) {
+      addBoxConstraintMetrics(bounds, x, metrics.stateIneqConstraint, metrics.cost);
+    }
+  }
+
+  return metrics;
 }
 
 }  // namespace multiple_shooting
@@ -0,0 +1,121 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include "ocs2_oc/multiple_shooting/NodePartition.h"
+
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+
+namespace ocs2 {
+namespace multiple_shooting {
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+NodePartition::NodePartition(size_t numPartitions, scalar_t imbalanceTolerance)
+    : imbalanceTolerance_(imbalanceTolerance), boundaries_(std::max(numPartitions, size_t(1)) + 1, 0) {}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+bool NodePartition::update(int numNodes) {
+  const int numOldNodes = nodeCost_.size();
+  if (numNodes != numOldNodes) {
+    // Keep the measured costs of the existing nodes, new nodes get the average cost.
+    const scalar_t averageCost =
+        (numOldNodes > 0) ? std::accumulate(nodeCost_.begin(), nodeCost_.end(), scalar_t(0.0)) / numOldNodes : scalar_t(1.0);
+    nodeCost_.resize(numNodes, averageCost);
+    rebalance();
+    return true;
+  }
+
+  // Cost of each partition for the current node ranges
+  scalar_t maxCost = 0.0;
+  scalar_t totalCost = 0.0;
+  for (size_t p = 0; p < numPartitions(); p++) {
+    const scalar_t partitionCost = std::accumulate(nodeCost_.begin() + begin(p), nodeCost_.begin() + end(p), scalar_t(0.0));
+    maxCost = std::max(maxCost, partitionCost);
+    totalCost += partitionCost;
+  }
+
+  const scalar_t averageCost = totalCost / numPartitions();
+  if (maxCost > (1.0 + imbalanceTolerance_) * averageCost) {
+    rebalance();
+    return true;
+  }
+  return false;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void NodePartition::rebalance() {
+  const int numNodes = nodeCost_.size();
+  const scalar_t totalCost = std::accumulate(nodeCost_.begin(), nodeCost_.end(), scalar_t(0.0));
+  const scalar_t targetCost = totalCost / numPartitions();
+
+  // Assign each node to the partition containing the midpoint of its cost interval
+  int node = 0;
+  scalar_t cumulativeCost = 0.0;
+  boundaries_.front() = 0;
+  for (size_t p = 1; p < numPartitions(); p++) {
+    const scalar_t partitionEndCost = p * targetCost;
+    while (node < numNodes && cumulativeCost + 0.5 * nodeCost_[node] < partitionEndCost) {
+      cumulativeCost += nodeCost_[node];
+      ++node;
+    }
+    boundaries_[p] = node;
+  }
+  boundaries_.back() = numNodes;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void NodePartition::run(ThreadPool& threadPool, int numNodes, const std::function<void(int, int)>& nodeTask, bool measureCost) {
+  update(numNodes);
+
+  auto partitionTask = [&](int partition) {
+    for (int i = begin(partition); i < end(partition); i++) {
+      if (measureCost) {
+        const auto startTime = std::chrono::steady_clock::now();
+        nodeTask(partition, i);
+        const auto endTime = std::chrono::steady_clock::now();
+        setNodeCost(i, std::chrono::duration<scalar_t, std::micro>(endTime - startTime).count());
+      } else {
+        nodeTask(partition, i);
+      }
+    }
+  };
+  threadPool.runParallelPartitioned(partitionTask, numPartitions());
+}
+
+}  // namespace multiple_shooting
+}  // namespace ocs2
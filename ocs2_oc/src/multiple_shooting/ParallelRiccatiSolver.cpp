@@ -0,0 +1,321 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include "ocs2_oc/multiple_shooting/ParallelRiccatiSolver.h"
+
+#include <algorithm>
+
+namespace ocs2 {
+namespace multiple_shooting {
+
+namespace {
+void computeLlt(Eigen::LLT<matrix_t>& llt, const matrix_t& hessian) {
+  llt.compute(hessian);
+  if (llt.info() != Eigen::Success) {
+    throw std::runtime_error("[ParallelRiccatiSolver] The input Hessian is not positive definite.");
+  }
+}
+
+void symmetrize(matrix_t& m) {
+  m = 0.5 * (m + m.transpose()).eval();
+}
+}  // namespace
+
+constexpr size_t ParallelRiccatiSolver::minNumPartitions;
+
+ParallelRiccatiSolver::ParallelRiccatiSolver(size_t numPartitions)
+    : numPartitions_(numPartitions < minNumPartitions ? 1 : numPartitions), elements_(numPartitions_), workspaces_(numPartitions_) {}
+
+void ParallelRiccatiSolver::solve(ThreadPool& threadPool, const vector_t& x0,
+                                  const std::vector<VectorFunctionLinearApproximation>& dynamics,
+                                  const std::vector<ScalarFunctionQuadraticApproximation>& cost, vector_array_t& stateTrajectory,
+                                  vector_array_t& inputTrajectory) {
+  const int N = dynamics.size();
+  if (cost.size() != dynamics.size() + 1) {
+    throw std::runtime_error("[ParallelRiccatiSolver] The cost must have one more stage than the dynamics.");
+  }
+
+  // Contiguous segments of (almost) equal length
+  const int numPartitions = std::max(std::min(static_cast<int>(numPartitions_), N), 1);
+  boundaries_.resize(numPartitions + 1);
+  for (int p = 0; p <= numPartitions; p++) {
+    boundaries_[p] = (p * N) / numPartitions;
+  }
+
+  costToGoMatrix_.resize(N + 1);
+  costToGoVector_.resize(N + 1);
+  feedback_.resize(N);
+  feedforward_.resize(N);
+  stateTrajectory.resize(N + 1);
+  inputTrajectory.resize(N);
+
+  // 1. Condense each segment
+  if (numPartitions > 1) {
+    threadPool.runParallelPartitioned([&](int p) { condenseSegment(p, dynamics, cost); }, numPartitions);
+  }
+
+  // 2a. Value function at the segment boundaries, backward in time
+  costToGoMatrix_[N] = cost[N].dfdxx;
+  costToGoVector_[N] = cost[N].dfdx;
+  auto& workspace = workspaces_.front();
+  Eigen::PartialPivLU<matrix_t> lu;
+  for (int p = numPartitions - 1; p > 0; p--) {
+    const auto& element = elements_[p];
+    auto& S = costToGoMatrix_[boundaries_[p]];
+    auto& s = costToGoVector_[boundaries_[p]];
+    if (p == numPartitions - 1) {
+      // The last segment includes the final cost
+      S = element.J;
+      s = -element.eta;
+    } else {
+      // Combine with the value function V(z) = 1/2 z' Sn z + sn' z at the end of the segment, using (I + Sn C)^{-1} Sn = Sn (I + C Sn)^{-1}
+      const auto& Sn = costToGoMatrix_[boundaries_[p + 1]];
+      const auto& sn = costToGoVector_[boundaries_[p + 1]];
+      workspace.tmp.setIdentity(Sn.rows(), Sn.cols());
+      workspace.tmp.noalias() += Sn * element.C;
+      lu.compute(workspace.tmp);
+      workspace.w = sn;
+      workspace.w.noalias() += Sn * element.b;
+      S = element.J;
+      S.noalias() += element.A.transpose() * lu.solve(Sn * element.A);
+      symmetrize(S);
+      s = -element.eta;
+      s.noalias() += element.A.transpose() * lu.solve(workspace.w);
+    }
+  }
+
+  // 2b. Optimal state at the segment boundaries, forward in time
+  stateTrajectory[0] = x0;
+  for (int p = 0; p < numPartitions - 1; p++) {
+    const auto& element = elements_[p];
+    const int next = boundaries_[p + 1];
+    const matrix_t& S = costToGoMatrix_[next];
+    const vector_t& s = costToGoVector_[next];
+    // z = (I + C S)^{-1} (A x + b - C s)
+    workspace.tmp.setIdentity(S.rows(), S.cols());
+    workspace.tmp.noalias() += element.C * S;
+    workspace.w = element.b;
+    workspace.w.noalias() += element.A * stateTrajectory[boundaries_[p]];
+    workspace.w.noalias() -= element.C * s;
+    stateTrajectory[next] = workspace.tmp.partialPivLu().solve(workspace.w);
+  }
+
+  // 3. Riccati recursion and rollout of each segment
+  threadPool.runParallelPartitioned([&](int p) { solveSegment(p, dynamics, cost, stateTrajectory, inputTrajectory); }, numPartitions);
+}
+
+std::vector<ScalarFunctionQuadraticApproximation> ParallelRiccatiSolver::getRiccatiCostToGo() const {
+  std::vector<ScalarFunctionQuadraticApproximation> costToGo(costToGoMatrix_.size());
+  for (int k = 0; k < costToGo.size(); k++) {
+    costToGo[k].dfdxx = costToGoMatrix_[k];
+    costToGo[k].dfdx = costToGoVector_[k];
+    costToGo[k].f = 0.0;
+  }
+  return costToGo;
+}
+
+void ParallelRiccatiSolver::condenseSegment(int p, const std::vector<VectorFunctionLinearApproximation>& dynamics,
+                                            const std::vector<ScalarFunctionQuadraticApproximation>& cost) {
+  const int first = boundaries_[p];
+  const int last = boundaries_[p + 1];
+  const int nx = cost[last].dfdxx.rows();
+
+  auto& element = elements_[p];
+  if (last == static_cast<int>(dynamics.size())) {
+    // Start from the final cost, which does not constrain the (non-existing) state after the horizon
+    element.A.setZero(0, nx);
+    element.b.setZero(0);
+    element.C.setZero(0, 0);
+    element.eta = -cost[last].dfdx;
+    element.J = cost[last].dfdxx;
+  } else {
+    // Start from the neutral element: z = x without cost
+    element.A.setIdentity(nx, nx);
+    element.b.setZero(nx);
+    element.C.setZero(nx, nx);
+    element.eta.setZero(nx);
+    element.J.setZero(nx, nx);
+  }
+
+  for (int k = last - 1; k >= first; k--) {
+    combineStage(dynamics[k], cost[k], element, workspaces_[p]);
+  }
+}
+
+void ParallelRiccatiSolver::combineStage(const VectorFunctionLinearApproximation& dynamics,
+                                         const ScalarFunctionQuadraticApproximation& cost, Element& element, Workspace& workspace) {
+  const matrix_t& B = dynamics.dfdu;
+  auto& llt = workspace.inputHessianLlt;
+
+  // Stage without inputs, e.g., an event node: C_k = 0
+  if (B.cols() == 0) {
+    // b <- A c + b, C <- C
+    element.b.noalias() += element.A * dynamics.f;
+    // eta <- F' (eta - J c) - q
+    workspace.w = element.eta;
+    workspace.w.noalias() -= element.J * dynamics.f;
+    element.eta = -cost.dfdx;
+    element.eta.noalias() += dynamics.dfdx.transpose() * workspace.w;
+    // J <- F' J F + Q
+    workspace.tmp.noalias() = element.J * dynamics.dfdx;
+    element.J = cost.dfdxx;
+    element.J.noalias() += dynamics.dfdx.transpose() * workspace.tmp;
+    symmetrize(element.J);
+    // A <- A F
+    workspace.AM = element.A;
+    element.A.noalias() = workspace.AM * dynamics.dfdx;
+    return;
+  }
+
+  // Eliminate the cross term with du = dv - R^{-1} (P dx + r)
+  computeLlt(llt, cost.dfduu);
+  workspace.RinvP = llt.solve(cost.dfdux);
+  workspace.Rinvr = llt.solve(cost.dfdu);
+  workspace.F = dynamics.dfdx;
+  workspace.F.noalias() -= B * workspace.RinvP;
+  workspace.c = dynamics.f;
+  workspace.c.noalias() -= B * workspace.Rinvr;
+  workspace.Qt = cost.dfdxx;
+  workspace.Qt.noalias() -= cost.dfdux.transpose() * workspace.RinvP;
+  workspace.qt = cost.dfdx;
+  workspace.qt.noalias() -= cost.dfdux.transpose() * workspace.Rinvr;
+
+  // With C_k = B R^{-1} B': (I + C_k J)^{-1} = I - B H^{-1} B' J, where H = R + B' J B
+  workspace.JB.noalias() = element.J * B;
+  workspace.tmp = cost.dfduu;
+  workspace.tmp.noalias() += B.transpose() * workspace.JB;
+  computeLlt(llt, workspace.tmp);
+  workspace.HinvJBt = llt.solve(workspace.JB.transpose());
+  workspace.AB.noalias() = element.A * B;
+
+  // b <- A (I + C_k J)^{-1} (c + C_k eta) + b
+  workspace.w = B.transpose() * element.eta;
+  workspace.w.noalias() -= workspace.JB.transpose() * workspace.c;
+  workspace.v = workspace.c;
+  workspace.v.noalias() += B * llt.solve(workspace.w);
+  element.b.noalias() += element.A * workspace.v;
+
+  // C <- A (I + C_k J)^{-1} C_k A' + C
+  element.C.noalias() += workspace.AB * llt.solve(workspace.AB.transpose());
+  symmetrize(element.C);
+
+  // eta <- F' (I + J C_k)^{-1} (eta - J c) - qt
+  workspace.w = element.eta;
+  workspace.w.noalias() -= element.J * workspace.c;
+  workspace.v = workspace.w;
+  workspace.v.noalias() -= workspace.JB * llt.solve(B.transpose() * workspace.w);
+  element.eta = -workspace.qt;
+  element.eta.noalias() += workspace.F.transpose() * workspace.v;
+
+  // J <- F' (I + J C_k)^{-1} J F + Qt
+  element.J.noalias() -= workspace.JB * workspace.HinvJBt;
+  workspace.tmp.noalias() = element.J * workspace.F;
+  element.J = workspace.Qt;
+  element.J.noalias() += workspace.F.transpose() * workspace.tmp;
+  symmetrize(element.J);
+
+  // A <- A (I + C_k J)^{-1} F
+  workspace.AM = element.A;
+  workspace.AM.noalias() -= workspace.AB * workspace.HinvJBt;
+  element.A.noalias() = workspace.AM * workspace.F;
+}
+
+void ParallelRiccatiSolver::solveSegment(int p, const std::vector<VectorFunctionLinearApproximation>& dynamics,
+                                         const std::vector<ScalarFunctionQuadraticApproximation>& cost, vector_array_t& stateTrajectory,
+                                         vector_array_t& inputTrajectory) {
+  const int first = boundaries_[p];
+  const int last = boundaries_[p + 1];
+  auto& workspace = workspaces_[p];
+  auto& llt = workspace.inputHessianLlt;
+
+  // Backward Riccati recursion from the boundary value function. The value function at the first node of the segment was computed
+  // when combining the segments and is read concurrently by the previous segment, hence it is not overwritten.
+  for (int k = last - 1; k >= first; k--) {
+    const matrix_t& A = dynamics[k].dfdx;
+    const matrix_t& B = dynamics[k].dfdu;
+    const matrix_t& S = costToGoMatrix_[k + 1];
+    const vector_t& s = costToGoVector_[k + 1];
+
+    // Stage without inputs, e.g., an event node
+    if (B.cols() == 0) {
+      feedback_[k].setZero(0, A.cols());
+      feedforward_[k].setZero(0);
+      if (k > first || p == 0) {
+        workspace.tmp.noalias() = S * A;
+        costToGoMatrix_[k] = cost[k].dfdxx;
+        costToGoMatrix_[k].noalias() += A.transpose() * workspace.tmp;
+        symmetrize(costToGoMatrix_[k]);
+        workspace.w = s;
+        workspace.w.noalias() += S * dynamics[k].f;
+        costToGoVector_[k] = cost[k].dfdx;
+        costToGoVector_[k].noalias() += A.transpose() * workspace.w;
+      }
+      continue;
+    }
+
+    // H = R + B' S B, G = P + B' S A, g = r + B' (s + S b)
+    workspace.JB.noalias() = S * B;
+    workspace.tmp = cost[k].dfduu;
+    workspace.tmp.noalias() += B.transpose() * workspace.JB;
+    computeLlt(llt, workspace.tmp);
+    workspace.AM = cost[k].dfdux;
+    workspace.AM.noalias() += workspace.JB.transpose() * A;
+    workspace.w = s;
+    workspace.w.noalias() += S * dynamics[k].f;
+    workspace.v = cost[k].dfdu;
+    workspace.v.noalias() += B.transpose() * workspace.w;
+
+    feedback_[k] = -llt.solve(workspace.AM);
+    feedforward_[k] = -llt.solve(workspace.v);
+
+    if (k > first || p == 0) {
+      costToGoMatrix_[k] = cost[k].dfdxx;
+      costToGoMatrix_[k].noalias() += A.transpose() * (S * A);
+      costToGoMatrix_[k].noalias() += workspace.AM.transpose() * feedback_[k];
+      symmetrize(costToGoMatrix_[k]);
+      costToGoVector_[k] = cost[k].dfdx;
+      costToGoVector_[k].noalias() += A.transpose() * workspace.w;
+      costToGoVector_[k].noalias() += workspace.AM.transpose() * feedforward_[k];
+    }
+  }
+
+  // Forward rollout from the boundary state. The final state of the segment is the initial state of the next one.
+  for (int k = first; k < last; k++) {
+    inputTrajectory[k] = feedforward_[k];
+    inputTrajectory[k].noalias() += feedback_[k] * stateTrajectory[k];
+    if (k + 1 < last || last == static_cast<int>(dynamics.size())) {
+      stateTrajectory[k + 1] = dynamics[k].f;
+      stateTrajectory[k + 1].noalias() += dynamics[k].dfdx * stateTrajectory[k];
+      stateTrajectory[k + 1].noalias() += dynamics[k].dfdu * inputTrajectory[k];
+    }
+  }
+}
+
+}  // namespace multiple_shooting
+}  // namespace ocs2
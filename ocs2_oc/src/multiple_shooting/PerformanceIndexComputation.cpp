@@ -54,6 +54,18 @@ PerformanceIndex computePerformanceIndex(const Transcription& transcription, sca
   performance.inequalityConstraintsSSE =
       dt * (getIneqConstraintsSSE(transcription.stateIneqConstraints.f) + getIneqConstraintsSSE(transcription.stateInputIneqConstraints.f));
 
+  // Box constraints, the bounds are defined for the deviation from the current state and input.
+  if (transcription.stateBoxConstraints.size() > 0) {
+    const vector_t dx = vector_t::Zero(transcription.dynamics.dfdx.cols());
+    performance.inequalityConstraintsSSE += dt * getIneqConstraintsSSE(getHardBoxConstraintValue(transcription.stateBoxConstraints, dx));
+    performance.cost += getSoftBoxConstraintPenalty(transcription.stateBoxConstraints, dx);
+  }
+  if (transcription.inputBoxConstraints.size() > 0) {
+    const vector_t du = vector_t::Zero(transcription.dynamics.dfdu.cols());
+    performance.inequalityConstraintsSSE += dt * getIneqConstraintsSSE(getHardBoxConstraintValue(transcription.inputBoxConstraints, du));
+    performance.cost += getSoftBoxConstraintPenalty(transcription.inputBoxConstraints, du);
+  }
+
   return performance;
 }
 
@@ -71,6 +83,13 @@ PerformanceIndex computePerformanceIndex(const EventTranscription& transcription
   // State inequality constraints.
   performance.inequalityConstraintsSSE = getIneqConstraintsSSE(transcription.ineqConstraints.f);
 
+  // Box constraints, the bounds are defined for the deviation from the current state.
+  if (transcription.stateBoxConstraints.size() > 0) {
+    const vector_t dx = vector_t::Zero(transcription.dynamics.dfdx.cols());
+    performance.inequalityConstraintsSSE += getIneqConstraintsSSE(getHardBoxConstraintValue(transcription.stateBoxConstraints, dx));
+    performance.cost += getSoftBoxConstraintPenalty(transcription.stateBoxConstraints, dx);
+  }
+
   return performance;
 }
 
@@ -85,6 +104,13 @@ PerformanceIndex computePerformanceIndex(const TerminalTranscription& transcript
   // State inequality constraints.
   performance.inequalityConstraintsSSE = getIneqConstraintsSSE(transcription.ineqConstraints.f);
 
+  // Box constraints, the bounds are defined for the deviation from the current state.
+  if (transcription.stateBoxConstraints.size() > 0) {
+    const vector_t dx = vector_t::Zero(transcription.cost.dfdx.size());
+    performance.inequalityConstraintsSSE += getIneqConstraintsSSE(getHardBoxConstraintValue(transcription.stateBoxConstraints, dx));
+    performance.cost += getSoftBoxConstraintPenalty(transcription.stateBoxConstraints, dx);
+  }
+
   return performance;
 }
 
@@ -37,10 +37,37 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 namespace ocs2 {
 namespace multiple_shooting {
 
+namespace {
+/** Evaluates the box constraints at time t and shifts the bounds to the deviation from the given operating point v. */
+void setupBoxConstraints(const BoxConstraintCollection& boxConstraints, scalar_t t, const vector_t& v, BoxConstraintBounds& bounds) {
+  if (boxConstraints.empty()) {
+    bounds.clear();
+    return;
+  }
+
+  boxConstraints.getBounds(t, bounds);
+  for (int i = 0; i < bounds.size(); ++i) {
+    const int index = bounds.indices[i];
+    if (index >= v.size()) {
+      throw std::runtime_error("[multiple_shooting::setupBoxConstraints] Box constraint index " + std::to_string(index) +
+                               " exceeds the vector size " + std::to_string(v.size()));
+    }
+    bounds.lowerBound[i] -= v[index];
+    bounds.upperBound[i] -= v[index];
+  }
+}
+}  // anonymous namespace
+
 Transcription setupIntermediateNode(OptimalControlProblem& optimalControlProblem, DynamicsSensitivityDiscretizer& sensitivityDiscretizer,
                                     scalar_t t, scalar_t dt, const vector_t& x, const vector_t& x_next, const vector_t& u) {
-  // Results and short-hand notation
   Transcription transcription;
+  setupIntermediateNode(optimalControlProblem, sensitivityDiscretizer, t, dt, x, x_next, u, transcription);
+  return transcription;
+}
+
+void setupIntermediateNode(OptimalControlProblem& optimalControlProblem, DynamicsSensitivityDiscretizer& sensitivityDiscretizer, scalar_t t,
+                           scalar_t dt, const vector_t& x, const vector_t& x_next, const vector_t& u, Transcription& transcription) {
+  // Short-hand notation
   auto& cost = transcription.cost;
   auto& dynamics = transcription.dynamics;
   auto& constraintsSize = transcription.constraintsSize;
@@ -49,9 +76,15 @@ Transcription setupIntermediateNode(OptimalControlProblem& optimalControlProblem
   auto& stateIneqConstraints = transcription.stateIneqConstraints;
   auto& stateInputIneqConstraints = transcription.stateInputIneqConstraints;
 
+  // Clear the results of a previous projection. With state-input equality constraints, their memory is kept for projectTranscription().
+  if (optimalControlProblem.equalityConstraintPtr->empty()) {
+    transcription.constraintsProjection = VectorFunctionLinearApproximation();
+    transcription.projectionMultiplierCoefficients = ProjectionMultiplierCoefficients();
+  }
+
   // Dynamics
   // Discretization returns x_{k+1} = A_{k} * dx_{k} + B_{k} * du_{k} + b_{k}
-  dynamics = sensitivityDiscretizer(*optimalControlProblem.dynamicsPtr, t, x, u, dt);
+  sensitivityDiscretizer(*optimalControlProblem.dynamicsPtr, t, x, u, dt, dynamics);
   dynamics.f -= x_next;  // make it dx_{k+1} = ...
 
   // Precomputation for other terms
@@ -59,38 +92,52 @@ Transcription setupIntermediateNode(OptimalControlProblem& optimalControlProblem
   optimalControlProblem.preComputationPtr->request(request, t, x, u);
 
   // Costs: Approximate the integral with forward euler
-  cost = approximateCost(optimalControlProblem, t, x, u);
+  approximateCost(optimalControlProblem, t, x, u, cost);
   cost *= dt;
 
   // State equality constraints
   if (!optimalControlProblem.stateEqualityConstraintPtr->empty()) {
     constraintsSize.stateEq = optimalControlProblem.stateEqualityConstraintPtr->getTermsSize(t);
-    stateEqConstraints =
-        optimalControlProblem.stateEqualityConstraintPtr->getLinearApproximation(t, x, *optimalControlProblem.preComputationPtr);
+    optimalControlProblem.stateEqualityConstraintPtr->getLinearApproximation(t, x, *optimalControlProblem.preComputationPtr,
+                                                                             stateEqConstraints);
+  } else {
+    constraintsSize.stateEq.clear();
+    stateEqConstraints = VectorFunctionLinearApproximation();
   }
 
   // State-input equality constraints
   if (!optimalControlProblem.equalityConstraintPtr->empty()) {
     constraintsSize.stateInputEq = optimalControlProblem.equalityConstraintPtr->getTermsSize(t);
-    stateInputEqConstraints =
-        optimalControlProblem.equalityConstraintPtr->getLinearApproximation(t, x, u, *optimalControlProblem.preComputationPtr);
+    optimalControlProblem.equalityConstraintPtr->getLinearApproximation(t, x, u, *optimalControlProblem.preComputationPtr,
+                                                                        stateInputEqConstraints);
+  } else {
+    constraintsSize.stateInputEq.clear();
+    stateInputEqConstraints = VectorFunctionLinearApproximation();
   }
 
   // State inequality constraints.
   if (!optimalControlProblem.stateInequalityConstraintPtr->empty()) {
     constraintsSize.stateIneq = optimalControlProblem.stateInequalityConstraintPtr->getTermsSize(t);
-    stateIneqConstraints =
-        optimalControlProblem.stateInequalityConstraintPtr->getLinearApproximation(t, x, *optimalControlProblem.preComputationPtr);
+    optimalControlProblem.stateInequalityConstraintPtr->getLinearApproximation(t, x, *optimalControlProblem.preComputationPtr,
+                                                                               stateIneqConstraints);
+  } else {
+    constraintsSize.stateIneq.clear();
+    stateIneqConstraints = VectorFunctionLinearApproximation();
   }
 
   // State-input inequality constraints.
   if (!optimalControlProblem.inequalityConstraintPtr->empty()) {
     constraintsSize.stateInputIneq = optimalControlProblem.inequalityConstraintPtr->getTermsSize(t);
-    stateInputIneqConstraints =
-        optimalControlProblem.inequalityConstraintPtr->getLinearApproximation(t, x, u, *optimalControlProblem.preComputationPtr);
+    optimalControlProblem.inequalityConstraintPtr->getLinearApproximation(t, x, u, *optimalControlProblem.preComputationPtr,
+                                                                          stateInputIneqConstraints);
+  } else {
+    constraintsSize.stateInputIneq.clear();
+    stateInputIneqConstraints = VectorFunctionLinearApproximation();
   }
 
-  return transcription;
+  // Box constraints
+  setupBoxConstraints(*optimalControlProblem.stateBoxConstraintPtr, t, x, transcription.stateBoxConstraints);
+  setupBoxConstraints(*optimalControlProblem.inputBoxConstraintPtr, t, u, transcription.inputBoxConstraints);
 }
 
 void projectTranscription(Transcription& transcription, bool extractProjectionMultiplier) {
@@ -102,13 +149,17 @@ void projectTranscription(Transcription& transcription, bool extractProjectionMu
   auto& projectionMultiplierCoefficients = transcription.projectionMultiplierCoefficients;
 
   if (stateInputEqConstraints.f.size() > 0) {
+    if (transcription.inputBoxConstraints.size() > 0) {
+      throw std::runtime_error("[multiple_shooting::projectTranscription] Input box constraints can not be combined with the projection.");
+    }
+
     // Projection stored instead of constraint, // TODO: benchmark between lu and qr method. LU seems slightly faster.
     if (extractProjectionMultiplier) {
       matrix_t constraintPseudoInverse;
-      std::tie(projection, constraintPseudoInverse) = LinearAlgebra::qrConstraintProjection(stateInputEqConstraints);
+      LinearAlgebra::qrConstraintProjection(stateInputEqConstraints, projection, constraintPseudoInverse);
       projectionMultiplierCoefficients.compute(cost, dynamics, projection, constraintPseudoInverse);
     } else {
-      projection = LinearAlgebra::luConstraintProjection(stateInputEqConstraints).first;
+      LinearAlgebra::luConstraintProjection(stateInputEqConstraints, projection);
       projectionMultiplierCoefficients = ProjectionMultiplierCoefficients();
     }
     stateInputEqConstraints = VectorFunctionLinearApproximation();
@@ -123,8 +174,13 @@ void projectTranscription(Transcription& transcription, bool extractProjectionMu
 }
 
 TerminalTranscription setupTerminalNode(OptimalControlProblem& optimalControlProblem, scalar_t t, const vector_t& x) {
-  // Results and short-hand notation
   TerminalTranscription transcription;
+  setupTerminalNode(optimalControlProblem, t, x, transcription);
+  return transcription;
+}
+
+void setupTerminalNode(OptimalControlProblem& optimalControlProblem, scalar_t t, const vector_t& x, TerminalTranscription& transcription) {
+  // Short-hand notation
   auto& cost = transcription.cost;
   auto& constraintsSize = transcription.constraintsSize;
   auto& eqConstraints = transcription.eqConstraints;
@@ -134,13 +190,16 @@ TerminalTranscription setupTerminalNode(OptimalControlProblem& optimalControlPro
   optimalControlProblem.preComputationPtr->requestFinal(request, t, x);
 
   // Costs
-  cost = approximateFinalCost(optimalControlProblem, t, x);
+  approximateFinalCost(optimalControlProblem, t, x, cost);
 
   // State equality constraints.
   if (!optimalControlProblem.finalEqualityConstraintPtr->empty()) {
     constraintsSize.stateEq = optimalControlProblem.finalEqualityConstraintPtr->getTermsSize(t);
     eqConstraints =
         optimalControlProblem.finalEqualityConstraintPtr->getLinearApproximation(t, x, *optimalControlProblem.preComputationPtr);
+  } else {
+    constraintsSize.stateEq.clear();
+    eqConstraints = VectorFunctionLinearApproximation();
   }
 
   // State inequality constraints.
@@ -148,14 +207,24 @@ TerminalTranscription setupTerminalNode(OptimalControlProblem& optimalControlPro
     constraintsSize.stateIneq = optimalControlProblem.finalInequalityConstraintPtr->getTermsSize(t);
     ineqConstraints =
         optimalControlProblem.finalInequalityConstraintPtr->getLinearApproximation(t, x, *optimalControlProblem.preComputationPtr);
+  } else {
+    constraintsSize.stateIneq.clear();
+    ineqConstraints = VectorFunctionLinearApproximation();
   }
 
-  return transcription;
+  // Box constraints
+  setupBoxConstraints(*optimalControlProblem.finalStateBoxConstraintPtr, t, x, transcription.stateBoxConstraints);
 }
 
 EventTranscription setupEventNode(OptimalControlProblem& optimalControlProblem, scalar_t t, const vector_t& x, const vector_t& x_next) {
-  // Results and short-hand notation
   EventTranscription transcription;
+  setupEventNode(optimalControlProblem, t, x, x_next, transcription);
+  return transcription;
+}
+
+void setupEventNode(OptimalControlProblem& optimalControlProblem, scalar_t t, const vector_t& x, const vector_t& x_next,
+                    EventTranscription& transcription) {
+  // Short-hand notation
   auto& cost = transcription.cost;
   auto& dynamics = transcription.dynamics;
   auto& constraintsSize = transcription.constraintsSize;
@@ -172,13 +241,16 @@ EventTranscription setupEventNode(OptimalControlProblem& optimalControlProblem,
   dynamics.dfdu.setZero(x.size(), 0);  // Overwrite derivative that shouldn't exist.
 
   // Costs
-  cost = approximateEventCost(optimalControlProblem, t, x);
+  approximateEventCost(optimalControlProblem, t, x, cost);
 
   // State equality constraints.
   if (!optimalControlProblem.preJumpEqualityConstraintPtr->empty()) {
     constraintsSize.stateEq = optimalControlProblem.preJumpEqualityConstraintPtr->getTermsSize(t);
     eqConstraints =
         optimalControlProblem.preJumpEqualityConstraintPtr->getLinearApproximation(t, x, *optimalControlProblem.preComputationPtr);
+  } else {
+    constraintsSize.stateEq.clear();
+    eqConstraints = VectorFunctionLinearApproximation();
   }
 
   // State inequality constraints.
@@ -186,9 +258,13 @@ EventTranscription setupEventNode(OptimalControlProblem& optimalControlProblem,
     constraintsSize.stateIneq = optimalControlProblem.preJumpInequalityConstraintPtr->getTermsSize(t);
     ineqConstraints =
         optimalControlProblem.preJumpInequalityConstraintPtr->getLinearApproximation(t, x, *optimalControlProblem.preComputationPtr);
+  } else {
+    constraintsSize.stateIneq.clear();
+    ineqConstraints = VectorFunctionLinearApproximation();
   }
 
-  return transcription;
+  // Box constraints, the intermediate state box also holds for the pre-event state.
+  setupBoxConstraints(*optimalControlProblem.stateBoxConstraintPtr, t, x, transcription.stateBoxConstraints);
 }
 
 }  // namespace multiple_shooting
@@ -0,0 +1,170 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include "ocs2_oc/oc_problem/BlockBandedKkt.h"
+
+namespace ocs2 {
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void BlockBandedCostMatrix::multiply(const vector_t& x, vector_t& y) const {
+  y.resize(rows());
+  for (size_t k = 0; k < blocks.size(); ++k) {
+    const int offset = segmentOffsets[k];
+    const int size = segmentOffsets[k + 1] - offset;
+    y.segment(offset, size).noalias() = blocks[k] * x.segment(offset, size);
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void BlockBandedCostMatrix::multiplyAdd(scalar_t alpha, const vector_t& x, vector_t& y) const {
+  for (size_t k = 0; k < blocks.size(); ++k) {
+    const int offset = segmentOffsets[k];
+    const int size = segmentOffsets[k + 1] - offset;
+    y.segment(offset, size).noalias() += alpha * (blocks[k] * x.segment(offset, size));
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+matrix_t BlockBandedCostMatrix::toDense() const {
+  matrix_t H = matrix_t::Zero(rows(), cols());
+  for (size_t k = 0; k < blocks.size(); ++k) {
+    const int offset = segmentOffsets[k];
+    const int size = segmentOffsets[k + 1] - offset;
+    H.block(offset, offset, size, size) = blocks[k];
+  }
+  return H;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void BlockBandedConstraintMatrix::multiply(const vector_t& x, vector_t& y) const {
+  y.resize(rows());
+
+  // dynamics rows: -[Ak, Bk] * Z_k + diag(sk) * x_{k+1}
+  for (size_t k = 0; k < dynamicsBlocks.size(); ++k) {
+    const int row = dynamicsRowOffsets[k];
+    const int numRows = dynamicsRowOffsets[k + 1] - row;
+    const int col = segmentOffsets[k];
+    const int numCols = segmentOffsets[k + 1] - col;
+    y.segment(row, numRows).noalias() = dynamicsBlocks[k] * x.segment(col, numCols);
+    y.segment(row, numRows).array() += dynamicsDiagonals[k].array() * x.segment(segmentOffsets[k + 1], numRows).array();
+  }
+
+  // constraint rows: [Ck, Dk] * Z_k
+  for (size_t k = 0; k < constraintBlocks.size(); ++k) {
+    const int row = constraintRowOffsets[k];
+    const int numRows = constraintRowOffsets[k + 1] - row;
+    if (numRows > 0) {
+      const int col = segmentOffsets[k];
+      const int numCols = segmentOffsets[k + 1] - col;
+      y.segment(row, numRows).noalias() = constraintBlocks[k] * x.segment(col, numCols);
+    }
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void BlockBandedConstraintMatrix::multiplyAdd(scalar_t alpha, const vector_t& x, vector_t& y) const {
+  for (size_t k = 0; k < dynamicsBlocks.size(); ++k) {
+    const int row = dynamicsRowOffsets[k];
+    const int numRows = dynamicsRowOffsets[k + 1] - row;
+    const int col = segmentOffsets[k];
+    const int numCols = segmentOffsets[k + 1] - col;
+    y.segment(row, numRows).noalias() += alpha * (dynamicsBlocks[k] * x.segment(col, numCols));
+    y.segment(row, numRows).array() += alpha * dynamicsDiagonals[k].array() * x.segment(segmentOffsets[k + 1], numRows).array();
+  }
+
+  for (size_t k = 0; k < constraintBlocks.size(); ++k) {
+    const int row = constraintRowOffsets[k];
+    const int numRows = constraintRowOffsets[k + 1] - row;
+    if (numRows > 0) {
+      const int col = segmentOffsets[k];
+      const int numCols = segmentOffsets[k + 1] - col;
+      y.segment(row, numRows).noalias() += alpha * (constraintBlocks[k] * x.segment(col, numCols));
+    }
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void BlockBandedConstraintMatrix::transposeMultiplyAdd(scalar_t alpha, const vector_t& x, vector_t& y) const {
+  for (size_t k = 0; k < dynamicsBlocks.size(); ++k) {
+    const int row = dynamicsRowOffsets[k];
+    const int numRows = dynamicsRowOffsets[k + 1] - row;
+    const int col = segmentOffsets[k];
+    const int numCols = segmentOffsets[k + 1] - col;
+    y.segment(col, numCols).noalias() += alpha * (dynamicsBlocks[k].transpose() * x.segment(row, numRows));
+    y.segment(segmentOffsets[k + 1], numRows).array() += alpha * dynamicsDiagonals[k].array() * x.segment(row, numRows).array();
+  }
+
+  for (size_t k = 0; k < constraintBlocks.size(); ++k) {
+    const int row = constraintRowOffsets[k];
+    const int numRows = constraintRowOffsets[k + 1] - row;
+    if (numRows > 0) {
+      const int col = segmentOffsets[k];
+      const int numCols = segmentOffsets[k + 1] - col;
+      y.segment(col, numCols).noalias() += alpha * (constraintBlocks[k].transpose() * x.segment(row, numRows));
+    }
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+matrix_t BlockBandedConstraintMatrix::toDense() const {
+  matrix_t G = matrix_t::Zero(rows(), cols());
+  for (size_t k = 0; k < dynamicsBlocks.size(); ++k) {
+    const int row = dynamicsRowOffsets[k];
+    const int numRows = dynamicsRowOffsets[k + 1] - row;
+    const int col = segmentOffsets[k];
+    const int numCols = segmentOffsets[k + 1] - col;
+    G.block(row, col, numRows, numCols) = dynamicsBlocks[k];
+    G.block(row, segmentOffsets[k + 1], numRows, numRows) = dynamicsDiagonals[k].asDiagonal();
+  }
+
+  for (size_t k = 0; k < constraintBlocks.size(); ++k) {
+    const int row = constraintRowOffsets[k];
+    const int numRows = constraintRowOffsets[k + 1] - row;
+    const int col = segmentOffsets[k];
+    const int numCols = segmentOffsets[k + 1] - col;
+    G.block(row, col, numRows, numCols) = constraintBlocks[k];
+  }
+  return G;
+}
+
+}  // namespace ocs2
@@ -47,9 +47,23 @@ bool operator==(const OcpSize& lhs, const OcpSize& rhs) noexcept {
 OcpSize extractSizesFromProblem(const std::vector<VectorFunctionLinearApproximation>& dynamics,
                                 const std::vector<ScalarFunctionQuadraticApproximation>& cost,
                                 const std::vector<VectorFunctionLinearApproximation>* constraints) {
+  OcpSize problemSize(dynamics.size());
+  extractSizesFromProblem(dynamics, cost, constraints, problemSize);
+  return problemSize;
+}
+
+void extractSizesFromProblem(const std::vector<VectorFunctionLinearApproximation>& dynamics,
+                             const std::vector<ScalarFunctionQuadraticApproximation>& cost,
+                             const std::vector<VectorFunctionLinearApproximation>* constraints, OcpSize& problemSize) {
   const int numStages = dynamics.size();
 
-  OcpSize problemSize(dynamics.size());
+  // Reset the sizes, all vectors have size N+1
+  problemSize.numStages = numStages;
+  for (auto* sizes : {&problemSize.numInputs, &problemSize.numStates, &problemSize.numInputBoxConstraints,
+                      &problemSize.numStateBoxConstraints, &problemSize.numIneqConstraints, &problemSize.numInputBoxSlack,
+                      &problemSize.numStateBoxSlack, &problemSize.numIneqSlack}) {
+    sizes->assign(numStages + 1, 0);
+  }
 
   // State inputs
   for (int k = 0; k < numStages; k++) {
@@ -65,8 +79,25 @@ OcpSize extractSizesFromProblem(const std::vector<VectorFunctionLinearApproximat
       problemSize.numIneqConstraints[k] = (*constraints)[k].f.size();
     }
   }
+}
 
-  return problemSize;
+void extractBoxConstraintSizes(const std::vector<BoxConstraintBounds>* stateBoxConstraints,
+                               const std::vector<BoxConstraintBounds>* inputBoxConstraints, OcpSize& problemSize) {
+  const int numStages = problemSize.numStages;
+
+  if (stateBoxConstraints != nullptr) {
+    for (int k = 0; k < numStages + 1; k++) {
+      problemSize.numStateBoxConstraints[k] = (*stateBoxConstraints)[k].size();
+      problemSize.numStateBoxSlack[k] = (*stateBoxConstraints)[k].numSoft();
+    }
+  }
+
+  if (inputBoxConstraints != nullptr) {
+    for (int k = 0; k < numStages; k++) {
+      problemSize.numInputBoxConstraints[k] = (*inputBoxConstraints)[k].size();
+      problemSize.numInputBoxSlack[k] = (*inputBoxConstraints)[k].numSoft();
+    }
+  }
 }
 
 }  // namespace ocs2
\ No newline at end of file
@@ -46,6 +46,18 @@ int getNumDynamicsConstraints(const OcpSize& ocpSize) {
 int getNumGeneralEqualityConstraints(const OcpSize& ocpSize) {
   return std::accumulate(ocpSize.numIneqConstraints.begin(), ocpSize.numIneqConstraints.end(), (int)0);
 }
+
+// Start indices of the stage segments [u_{0}], [x_{1}; u_{1}], ..., [x_{n}; u_{n}], [x_{n+1}] of Z, followed by the size of Z.
+void getSegmentOffsets(const OcpSize& ocpSize, std::vector<int>& segmentOffsets) {
+  const int N = ocpSize.numStages;
+  segmentOffsets.resize(N + 2);
+  segmentOffsets[0] = 0;
+  segmentOffsets[1] = ocpSize.numInputs[0];
+  for (int k = 1; k < N; ++k) {
+    segmentOffsets[k + 1] = segmentOffsets[k] + ocpSize.numStates[k] + ocpSize.numInputs[k];
+  }
+  segmentOffsets[N + 1] = segmentOffsets[N] + ocpSize.numStates[N];
+}
 }  // namespace
 
 void getConstraintMatrix(const OcpSize& ocpSize, const vector_t& x0, const std::vector<VectorFunctionLinearApproximation>& dynamics,
@@ -300,6 +312,102 @@ void getConstraintMatrixSparse(const OcpSize& ocpSize, const vector_t& x0, const
   assert(G.nonZeros() <= nnz);
 }
 
+void getConstraintMatrixBlockBanded(const OcpSize& ocpSize, const vector_t& x0,
+                                    const std::vector<VectorFunctionLinearApproximation>& dynamics,
+                                    const std::vector<VectorFunctionLinearApproximation>* constraintsPtr,
+                                    const vector_array_t* scalingVectorsPtr, BlockBandedConstraintMatrix& G, vector_t& g) {
+  const int N = ocpSize.numStages;
+  if (N < 1) {
+    throw std::runtime_error("[getConstraintMatrixBlockBanded] The number of stages cannot be less than 1.");
+  }
+  if (scalingVectorsPtr != nullptr && scalingVectorsPtr->size() != N) {
+    throw std::runtime_error("[getConstraintMatrixBlockBanded] The size of scalingVectors doesn't match the number of stage.");
+  }
+
+  const int numDynamicsConstraints = getNumDynamicsConstraints(ocpSize);
+  if (constraintsPtr == nullptr) {
+    g.setZero(numDynamicsConstraints);
+  } else {
+    g.setZero(numDynamicsConstraints + getNumGeneralEqualityConstraints(ocpSize));
+  }
+
+  getSegmentOffsets(ocpSize, G.segmentOffsets);
+  G.dynamicsRowOffsets.resize(N + 1);
+  G.dynamicsRowOffsets[0] = 0;
+  G.dynamicsBlocks.resize(N);
+  G.dynamicsDiagonals.resize(N);
+
+  // k = 0. Absorb initial state into dynamics
+  //    x[1] = B[0]*u[0] + (b[0] + A[0]*x[0])
+  const int nx_1 = ocpSize.numStates[1];
+  G.dynamicsBlocks[0] = -dynamics.front().dfdu;
+  g.head(nx_1) = dynamics.front().f;
+  g.head(nx_1).noalias() += dynamics.front().dfdx * x0;
+
+  for (int k = 1; k < N; ++k) {
+    const auto& dynamics_k = dynamics[k];
+    const int nx_k = ocpSize.numStates[k];
+    const int nu_k = ocpSize.numInputs[k];
+    const int nx_next = ocpSize.numStates[k + 1];
+    const int currRow = G.dynamicsRowOffsets[k] = G.dynamicsRowOffsets[k - 1] + ocpSize.numStates[k];
+
+    // Add -[A, B]
+    G.dynamicsBlocks[k].resize(nx_next, nx_k + nu_k);
+    G.dynamicsBlocks[k] << -dynamics_k.dfdx, -dynamics_k.dfdu;
+
+    // Add [b]
+    g.segment(currRow, nx_next) = dynamics_k.f;
+  }
+  G.dynamicsRowOffsets[N] = numDynamicsConstraints;
+
+  // Add I (or the scaling vectors)
+  for (int k = 0; k < N; ++k) {
+    if (scalingVectorsPtr == nullptr) {
+      G.dynamicsDiagonals[k].setOnes(ocpSize.numStates[k + 1]);
+    } else {
+      G.dynamicsDiagonals[k] = (*scalingVectorsPtr)[k];
+    }
+  }
+
+  G.constraintRowOffsets.assign(N + 2, numDynamicsConstraints);
+  if (constraintsPtr == nullptr) {
+    G.constraintBlocks.clear();
+    return;
+  }
+
+  // === Constraints ===
+  // for ocs2 --> C*dx + D*du + e = 0
+  // for pipg --> C*dx + D*du = -e
+  G.constraintBlocks.resize(N + 1);
+  for (int k = 0; k <= N; ++k) {
+    const int nc_k = ocpSize.numIneqConstraints[k];
+    const int currRow = G.constraintRowOffsets[k];
+    G.constraintRowOffsets[k + 1] = currRow + nc_k;
+
+    auto& block = G.constraintBlocks[k];
+    block.resize(nc_k, G.segmentOffsets[k + 1] - G.segmentOffsets[k]);
+    if (nc_k == 0) {
+      continue;
+    }
+
+    const auto& constraints_k = (*constraintsPtr)[k];
+    if (k == 0) {
+      // Add [D] and absorb the initial state
+      block = constraints_k.dfdu;
+      g.segment(currRow, nc_k) = -constraints_k.f;
+      g.segment(currRow, nc_k) -= constraints_k.dfdx * x0;
+    } else if (k == N) {
+      // Add [C]
+      block = constraints_k.dfdx;
+      g.segment(currRow, nc_k) = -constraints_k.f;
+    } else {
+      // Add [C, D]
+      block << constraints_k.dfdx, constraints_k.dfdu;
+      g.segment(currRow, nc_k) = -constraints_k.f;
+    }
+  }
+}
+
 void getCostMatrix(const OcpSize& ocpSize, const vector_t& x0, const std::vector<ScalarFunctionQuadraticApproximation>& cost,
                    ScalarFunctionQuadraticApproximation& res) {
   const int N = ocpSize.numStages;
@@ -407,6 +515,39 @@ void getCostMatrixSparse(const OcpSize& ocpSize, const vector_t& x0, const std::
   assert(H.nonZeros() <= nnz);
 }
 
+void getCostMatrixBlockBanded(const OcpSize& ocpSize, const vector_t& x0, const std::vector<ScalarFunctionQuadraticApproximation>& cost,
+                              BlockBandedCostMatrix& H, vector_t& h) {
+  const int N = ocpSize.numStages;
+
+  getSegmentOffsets(ocpSize, H.segmentOffsets);
+  H.blocks.resize(N + 1);
+  h.setZero(getNumDecisionVariables(ocpSize));
+
+  // k = 0. Elimination of initial state requires cost adaptation
+  const int nu_0 = ocpSize.numInputs[0];
+  H.blocks[0] = cost[0].dfduu;
+  h.head(nu_0) = cost[0].dfdu;
+  h.head(nu_0).noalias() += cost[0].dfdux * x0;
+
+  for (int k = 1; k < N; ++k) {
+    const int nx_k = ocpSize.numStates[k];
+    const int nu_k = ocpSize.numInputs[k];
+    const int currRow = H.segmentOffsets[k];
+
+    // Add [ Q, P'
+    //       P, Q ]
+    H.blocks[k].resize(nx_k + nu_k, nx_k + nu_k);
+    H.blocks[k] << cost[k].dfdxx, cost[k].dfdux.transpose(), cost[k].dfdux, cost[k].dfduu;
+
+    // Add [ q, r]
+    h.segment(currRow, nx_k + nu_k) << cost[k].dfdx, cost[k].dfdu;
+  }
+
+  const int nx_N = ocpSize.numStates[N];
+  H.blocks[N] = cost[N].dfdxx;
+  h.tail(nx_N) = cost[N].dfdx;
+}
+
 void toOcpSolution(const OcpSize& ocpSize, const vector_t& stackedSolution, const vector_t x0, vector_array_t& xTrajectory,
                    vector_array_t& uTrajectory) {
   const int N = ocpSize.numStages;
@@ -55,6 +55,10 @@ OptimalControlProblem::OptimalControlProblem()
       stateInequalityConstraintPtr(new StateConstraintCollection),
       preJumpInequalityConstraintPtr(new StateConstraintCollection),
       finalInequalityConstraintPtr(new StateConstraintCollection),
+      /* Box constraints */
+      stateBoxConstraintPtr(new BoxConstraintCollection),
+      inputBoxConstraintPtr(new BoxConstraintCollection),
+      finalStateBoxConstraintPtr(new BoxConstraintCollection),
       /* Lagrangians */
       equalityLagrangianPtr(new StateInputAugmentedLagrangianCollection),
       stateEqualityLagrangianPtr(new StateAugmentedLagrangianCollection),
@@ -92,6 +96,10 @@ OptimalControlProblem::OptimalControlProblem(const OptimalControlProblem& other)
       stateInequalityConstraintPtr(other.stateInequalityConstraintPtr->clone()),
       preJumpInequalityConstraintPtr(other.preJumpInequalityConstraintPtr->clone()),
       finalInequalityConstraintPtr(other.finalInequalityConstraintPtr->clone()),
+      /* Box constraints */
+      stateBoxConstraintPtr(other.stateBoxConstraintPtr->clone()),
+      inputBoxConstraintPtr(other.inputBoxConstraintPtr->clone()),
+      finalStateBoxConstraintPtr(other.finalStateBoxConstraintPtr->clone()),
       /* Lagrangians */
       equalityLagrangianPtr(other.equalityLagrangianPtr->clone()),
       stateEqualityLagrangianPtr(other.stateEqualityLagrangianPtr->clone()),
@@ -146,6 +154,11 @@ void OptimalControlProblem::swap(OptimalControlProblem& other) noexcept {
   preJumpInequalityConstraintPtr.swap(other.preJumpInequalityConstraintPtr);
   finalInequalityConstraintPtr.swap(other.finalInequalityConstraintPtr);
 
+  /* Box constraints */
+  stateBoxConstraintPtr.swap(other.stateBoxConstraintPtr);
+  inputBoxConstraintPtr.swap(other.inputBoxConstraintPtr);
+  finalStateBoxConstraintPtr.swap(other.finalStateBoxConstraintPtr);
+
   /* Lagrangians */
   equalityLagrangianPtr.swap(other.equalityLagrangianPtr);
   stateEqualityLagrangianPtr.swap(other.stateEqualityLagrangianPtr);
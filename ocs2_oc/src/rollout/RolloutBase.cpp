@@ -67,6 +67,19 @@ std::vector<std::pair<scalar_t, scalar_t>> RolloutBase::findActiveModesTimeInter
   return timeIntervalArray;
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+vector_t RolloutBase::run(scalar_t initTime, const vector_t& initState, scalar_t finalTime, ControllerBase* controller,
+                          ModeSchedule& modeSchedule, ContiguousTrajectory& trajectory) {
+  vector_array_t stateTrajectory, inputTrajectory;
+  vector_t finalState = run(initTime, initState, finalTime, controller, modeSchedule, trajectory.timeTrajectory,
+                            trajectory.postEventIndices, stateTrajectory, inputTrajectory);
+  trajectory.stateTrajectory.assign(stateTrajectory);
+  trajectory.inputTrajectory.assign(inputTrajectory);
+  return finalState;
+}
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
@@ -146,4 +159,24 @@ void RolloutBase::checkNumericalStability(const ControllerBase& controller, cons
     }
   }  // end of i loop
 }
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void RolloutBase::checkNumericalStability(const ControllerBase& controller, const scalar_array_t& timeTrajectory,
+                                          const size_array_t& postEventIndices, const ContiguousVectorArray& stateTrajectory,
+                                          const ContiguousVectorArray& inputTrajectory) const {
+  if (!rolloutSettings_.checkNumericalStability) {
+    return;
+  }
+
+  const size_t numNodes = timeTrajectory.size();
+  const bool isStateFinite = stateTrajectory.data().leftCols(numNodes).allFinite();
+  const bool isInputFinite = !rolloutSettings_.reconstructInputTrajectory || inputTrajectory.data().leftCols(numNodes).allFinite();
+  if (!isStateFinite || !isInputFinite) {
+    // reports the first non-finite node and throws
+    checkNumericalStability(controller, timeTrajectory, postEventIndices, stateTrajectory.toVectorArray(), inputTrajectory.toVectorArray());
+  }
+}
+
 }  // namespace ocs2
@@ -46,6 +46,26 @@ TimeTriggeredRollout::TimeTriggeredRollout(const ControlledSystemBase& systemDyn
 vector_t TimeTriggeredRollout::run(scalar_t initTime, const vector_t& initState, scalar_t finalTime, ControllerBase* controller,
                                    ModeSchedule& modeSchedule, scalar_array_t& timeTrajectory, size_array_t& postEventIndices,
                                    vector_array_t& stateTrajectory, vector_array_t& inputTrajectory) {
+  return runImpl(initTime, initState, finalTime, controller, modeSchedule, timeTrajectory, postEventIndices, stateTrajectory,
+                 inputTrajectory);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+vector_t TimeTriggeredRollout::run(scalar_t initTime, const vector_t& initState, scalar_t finalTime, ControllerBase* controller,
+                                   ModeSchedule& modeSchedule, ContiguousTrajectory& trajectory) {
+  return runImpl(initTime, initState, finalTime, controller, modeSchedule, trajectory.timeTrajectory, trajectory.postEventIndices,
+                 trajectory.stateTrajectory, trajectory.inputTrajectory);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+template <typename StateTrajectory>
+vector_t TimeTriggeredRollout::runImpl(scalar_t initTime, const vector_t& initState, scalar_t finalTime, ControllerBase* controller,
+                                       ModeSchedule& modeSchedule, scalar_array_t& timeTrajectory, size_array_t& postEventIndices,
+                                       StateTrajectory& stateTrajectory, StateTrajectory& inputTrajectory) {
   if (initTime > finalTime) {
     throw std::runtime_error("[TimeTriggeredRollout::run] The initial time should be less-equal to the final time!");
   }
@@ -97,7 +117,7 @@ vector_t TimeTriggeredRollout::run(scalar_t initTime, const vector_t& initState,
     // compute control input trajectory and concatenate to inputTrajectory
     if (this->settings().reconstructInputTrajectory) {
       for (; k_u < timeTrajectory.size(); k_u++) {
-        inputTrajectory.emplace_back(systemDynamicsPtr_->controllerPtr()->computeInput(timeTrajectory[k_u], stateTrajectory[k_u]));
+        inputTrajectory.push_back(systemDynamicsPtr_->controllerPtr()->computeInput(timeTrajectory[k_u], stateTrajectory[k_u]));
       }  // end of k_u loop
     }
 
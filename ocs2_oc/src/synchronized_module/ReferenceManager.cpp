@@ -29,21 +29,179 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "ocs2_oc/synchronized_module/ReferenceManager.h"
 
+#include <algorithm>
+#include <stdexcept>
+
 namespace ocs2 {
 
+namespace {
+
+/** Writes the value at the given index, which is at most the size of the trajectory. */
+template <typename T>
+void assignOrPushBack(std::vector<T>& trajectory, size_t index, const T& value) {
+  if (index < trajectory.size()) {
+    trajectory[index] = value;
+  } else {
+    trajectory.push_back(value);
+  }
+}
+
+/**
+ * Drops the points before initTime from the first numPoints points of the TargetTrajectories. The last point at or before
+ * initTime is kept for the interpolation. The dropped points are rotated behind the remaining ones, so their storage can be
+ * reused.
+ *
+ * @return The number of remaining points.
+ */
+size_t trimTargetTrajectories(scalar_t initTime, size_t numPoints, bool hasInput, TargetTrajectories& targetTrajectories) {
+  const auto timeBegin = targetTrajectories.timeTrajectory.begin();
+  const auto firstAfterInitTime = std::upper_bound(timeBegin, timeBegin + numPoints, initTime);
+  if (firstAfterInitTime - timeBegin < 2) {
+    return numPoints;
+  }
+
+  const size_t numDropped = firstAfterInitTime - timeBegin - 1;
+  const auto rotate = [&](auto& trajectory) {
+    std::rotate(trajectory.begin(), trajectory.begin() + numDropped, trajectory.begin() + numPoints);
+  };
+  rotate(targetTrajectories.timeTrajectory);
+  rotate(targetTrajectories.stateTrajectory);
+  if (hasInput) {
+    rotate(targetTrajectories.inputTrajectory);
+  }
+  return numPoints - numDropped;
+}
+
+}  // unnamed namespace
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
-ReferenceManager::ReferenceManager(TargetTrajectories initialTargetTrajectories, ModeSchedule initialModeSchedule)
-    : targetTrajectories_(std::move(initialTargetTrajectories)), modeSchedule_(std::move(initialModeSchedule)) {}
+ReferenceManager::ReferenceManager(TargetTrajectories initialTargetTrajectories, ModeSchedule initialModeSchedule,
+                                   size_t appendBufferCapacity)
+    : modeSchedule_(std::move(initialModeSchedule)),
+      targetTrajectories_(std::move(initialTargetTrajectories)),
+      appendedTargets_(appendBufferCapacity),
+      appendedTargetsHasInput_(appendBufferCapacity, false) {
+  if (appendBufferCapacity == 0) {
+    throw std::runtime_error("[ReferenceManager] appendBufferCapacity should be positive!");
+  }
+}
 
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
 void ReferenceManager::preSolverRun(scalar_t initTime, scalar_t finalTime, const vector_t& initState) {
-  targetTrajectories_.updateFromBuffer();
+  {
+    std::lock_guard<std::mutex> lock(appendedTargetsMutex_);
+    targetTrajectories_.updateFromBuffer();
+    if (numAppendedTargets_ > 0) {
+      mergeAppendedTargets(initTime);
+    }
+  }
   modeSchedule_.updateFromBuffer();
   modifyReferences(initTime, finalTime, initState, targetTrajectories_.get(), modeSchedule_.get());
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void ReferenceManager::setTargetTrajectories(const TargetTrajectories& targetTrajectories) {
+  std::lock_guard<std::mutex> lock(appendedTargetsMutex_);
+  // the new TargetTrajectories supersedes the previously appended points
+  numAppendedTargets_ = 0;
+  targetTrajectories_.setBuffer(targetTrajectories);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void ReferenceManager::setTargetTrajectories(TargetTrajectories&& targetTrajectories) {
+  std::lock_guard<std::mutex> lock(appendedTargetsMutex_);
+  // the new TargetTrajectories supersedes the previously appended points
+  numAppendedTargets_ = 0;
+  targetTrajectories_.setBuffer(std::move(targetTrajectories));
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void ReferenceManager::appendTargetTrajectories(const TargetTrajectories& targetTrajectories) {
+  const bool hasInput = !targetTrajectories.inputTrajectory.empty();
+  if (targetTrajectories.stateTrajectory.size() != targetTrajectories.size() ||
+      (hasInput && targetTrajectories.inputTrajectory.size() != targetTrajectories.size())) {
+    throw std::runtime_error("[ReferenceManager] The appended TargetTrajectories has inconsistent sizes!");
+  }
+
+  std::lock_guard<std::mutex> lock(appendedTargetsMutex_);
+  const size_t capacity = appendedTargets_.size();
+  for (size_t i = 0; i < targetTrajectories.size(); i++) {
+    size_t index;
+    if (numAppendedTargets_ < capacity) {
+      index = (appendedTargetsBegin_ + numAppendedTargets_) % capacity;
+      ++numAppendedTargets_;
+    } else {
+      // the buffer is full: overwrite the oldest point
+      index = appendedTargetsBegin_;
+      appendedTargetsBegin_ = (appendedTargetsBegin_ + 1) % capacity;
+    }
+
+    // the slots keep their storage, so copying vectors of the same size does not allocate
+    appendedTargets_.timeTrajectory[index] = targetTrajectories.timeTrajectory[i];
+    appendedTargets_.stateTrajectory[index] = targetTrajectories.stateTrajectory[i];
+    if (hasInput) {
+      appendedTargets_.inputTrajectory[index] = targetTrajectories.inputTrajectory[i];
+    }
+    appendedTargetsHasInput_[index] = hasInput;
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void ReferenceManager::mergeAppendedTargets(scalar_t initTime) {
+  auto& targetTrajectories = targetTrajectories_.get();
+  auto& timeTrajectory = targetTrajectories.timeTrajectory;
+  bool hasInput = !targetTrajectories.inputTrajectory.empty();
+
+  // drop the outdated points first, so that their storage is reused by the appended points
+  size_t numPoints = trimTargetTrajectories(initTime, timeTrajectory.size(), hasInput, targetTrajectories);
+
+  for (size_t i = 0; i < numAppendedTargets_; i++) {
+    const size_t index = (appendedTargetsBegin_ + i) % appendedTargets_.size();
+    const scalar_t time = appendedTargets_.timeTrajectory[index];
+
+    // the appended point replaces the points at or after its time
+    numPoints = std::lower_bound(timeTrajectory.begin(), timeTrajectory.begin() + numPoints, time) - timeTrajectory.begin();
+
+    // the input trajectory is kept as long as all the points have an input
+    if (numPoints == 0) {
+      hasInput = appendedTargetsHasInput_[index];
+    } else if (!appendedTargetsHasInput_[index]) {
+      hasInput = false;
+    }
+
+    assignOrPushBack(timeTrajectory, numPoints, time);
+    assignOrPushBack(targetTrajectories.stateTrajectory, numPoints, appendedTargets_.stateTrajectory[index]);
+    if (hasInput) {
+      assignOrPushBack(targetTrajectories.inputTrajectory, numPoints, appendedTargets_.inputTrajectory[index]);
+    }
+    ++numPoints;
+  }  // end of i loop
+
+  appendedTargetsBegin_ = 0;
+  numAppendedTargets_ = 0;
+
+  // the appended points might be outdated as well
+  numPoints = trimTargetTrajectories(initTime, numPoints, hasInput, targetTrajectories);
+
+  timeTrajectory.resize(numPoints);
+  targetTrajectories.stateTrajectory.resize(numPoints);
+  if (hasInput) {
+    targetTrajectories.inputTrajectory.resize(numPoints);
+  } else {
+    targetTrajectories.inputTrajectory.clear();
+  }
+}
+
 }  // namespace ocs2
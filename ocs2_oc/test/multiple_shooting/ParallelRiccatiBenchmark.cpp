@@ -0,0 +1,79 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <ocs2_oc/multiple_shooting/ParallelRiccatiSolver.h>
+
+#include "ocs2_oc/test/testProblemsGeneration.h"
+
+namespace {
+
+/**
+ * Solves a QP of state.range(0) stages with 24 states and 12 inputs split into state.range(1) partitions, using the same number
+ * of threads as SqpSolver with nThreads = state.range(1). With a single partition, this is the sequential Riccati recursion, which is
+ * also what the solver falls back to with fewer than four partitions.
+ * When the machine has fewer cores than partitions, the reported time is the total work of the partitioned algorithm instead
+ * of its wall time on a multi-core machine.
+ */
+void parallelRiccatiSolve(benchmark::State& state) {
+  constexpr int stateDim = 24;
+  constexpr int inputDim = 12;
+  const int numStages = state.range(0);
+  const int numPartitions = state.range(1);
+
+  srand(0);
+  const ocs2::vector_t x0 = ocs2::vector_t::Random(stateDim);
+  std::vector<ocs2::VectorFunctionLinearApproximation> dynamics;
+  std::vector<ocs2::ScalarFunctionQuadraticApproximation> cost;
+  for (int k = 0; k < numStages; k++) {
+    dynamics.push_back(ocs2::getRandomDynamics(stateDim, inputDim));
+    dynamics.back().dfdx = ocs2::matrix_t::Identity(stateDim, stateDim) + 0.1 * dynamics.back().dfdx;
+    cost.push_back(ocs2::getRandomCost(stateDim, inputDim));
+    cost.back().dfduu.diagonal().array() += 0.1;
+  }
+  cost.push_back(ocs2::getRandomCost(stateDim, 0));
+
+  ocs2::ThreadPool threadPool(numPartitions - 1);
+  ocs2::multiple_shooting::ParallelRiccatiSolver solver(numPartitions);
+  ocs2::vector_array_t stateTrajectory, inputTrajectory;
+  for (auto _ : state) {
+    solver.solve(threadPool, x0, dynamics, cost, stateTrajectory, inputTrajectory);
+    benchmark::DoNotOptimize(stateTrajectory.back().data());
+  }
+  state.SetItemsProcessed(state.iterations() * numStages);
+}
+
+}  // unnamed namespace
+
+BENCHMARK(parallelRiccatiSolve)->ArgsProduct({{1000}, {1, 4, 8}})->UseRealTime()->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,113 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <ocs2_oc/multiple_shooting/NodePartition.h>
+
+using namespace ocs2;
+
+namespace {
+void checkCoverage(const multiple_shooting::NodePartition& partition, int numNodes) {
+  ASSERT_EQ(partition.begin(0), 0);
+  ASSERT_EQ(partition.end(partition.numPartitions() - 1), numNodes);
+  for (size_t p = 1; p < partition.numPartitions(); p++) {
+    ASSERT_EQ(partition.begin(p), partition.end(p - 1));
+    ASSERT_LE(partition.begin(p), partition.end(p));
+  }
+}
+}  // unnamed namespace
+
+TEST(testNodePartition, uniformCost) {
+  multiple_shooting::NodePartition partition(4, 0.2);
+  EXPECT_TRUE(partition.update(101));
+  checkCoverage(partition, 101);
+  for (size_t p = 0; p < partition.numPartitions(); p++) {
+    EXPECT_NEAR(partition.end(p) - partition.begin(p), 25, 1);
+  }
+
+  // Same size and balanced cost: no rebalancing
+  EXPECT_FALSE(partition.update(101));
+}
+
+TEST(testNodePartition, rebalanceOnCostShift) {
+  constexpr int numNodes = 100;
+  multiple_shooting::NodePartition partition(4, 0.2);
+  partition.update(numNodes);
+  const std::vector<int> initialBoundaries{partition.begin(1), partition.begin(2), partition.begin(3)};
+
+  // Small noise does not trigger rebalancing
+  for (int i = 0; i < numNodes; i++) {
+    partition.setNodeCost(i, (i % 2 == 0) ? 1.05 : 0.95);
+  }
+  EXPECT_FALSE(partition.update(numNodes));
+  EXPECT_EQ(partition.begin(1), initialBoundaries[0]);
+  EXPECT_EQ(partition.begin(2), initialBoundaries[1]);
+  EXPECT_EQ(partition.begin(3), initialBoundaries[2]);
+
+  // The first 10 nodes become 10 times more expensive
+  for (int i = 0; i < numNodes; i++) {
+    partition.setNodeCost(i, (i < 10) ? 10.0 : 1.0);
+  }
+  EXPECT_TRUE(partition.update(numNodes));
+  checkCoverage(partition, numNodes);
+  EXPECT_LT(partition.end(0), initialBoundaries[0]);
+
+  // The new partition is balanced
+  EXPECT_FALSE(partition.update(numNodes));
+}
+
+TEST(testNodePartition, changingNumberOfNodes) {
+  multiple_shooting::NodePartition partition(3, 0.2);
+  for (int numNodes : {10, 11, 9, 2, 0, 50}) {
+    partition.update(numNodes);
+    checkCoverage(partition, numNodes);
+  }
+}
+
+TEST(testNodePartition, run) {
+  constexpr int numNodes = 57;
+  ThreadPool threadPool(3);
+  multiple_shooting::NodePartition partition(4, 0.2);
+
+  for (int iter = 0; iter < 3; iter++) {
+    std::vector<int> visited(numNodes, 0);
+    std::vector<int> workerOfNode(numNodes, -1);
+    partition.run(threadPool, numNodes, [&](int workerId, int i) {
+      visited[i]++;
+      workerOfNode[i] = workerId;
+    });
+
+    for (int i = 0; i < numNodes; i++) {
+      EXPECT_EQ(visited[i], 1);
+      EXPECT_GE(workerOfNode[i], 0);
+      EXPECT_LT(workerOfNode[i], 4);
+    }
+  }
+}
@@ -0,0 +1,186 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <ocs2_oc/multiple_shooting/ParallelRiccatiSolver.h>
+#include <ocs2_oc/oc_problem/OcpSize.h>
+#include <ocs2_oc/oc_problem/OcpToKkt.h>
+
+#include "ocs2_oc/test/testProblemsGeneration.h"
+
+using namespace ocs2;
+
+class ParallelRiccatiSolverTest : public testing::Test {
+ protected:
+  static constexpr int N_ = 50;
+  static constexpr int nx_ = 4;
+  static constexpr int nu_ = 3;
+  static constexpr scalar_t tol_ = 1e-7;
+
+  ParallelRiccatiSolverTest() : ocpSize_(N_, nx_, nu_), threadPool_(3) {
+    srand(0);
+    x0_ = vector_t::Random(nx_);
+    for (int k = 0; k < N_; k++) {
+      dynamics_.push_back(getRandomDynamics(nx_, nu_));
+      dynamics_.back().dfdx = matrix_t::Identity(nx_, nx_) + 0.1 * dynamics_.back().dfdx;  // avoid an exploding state trajectory
+      cost_.push_back(getRandomCost(nx_, nu_));
+      cost_.back().dfduu.diagonal().array() += 0.1;
+    }
+    cost_.push_back(getRandomCost(nx_, 0));
+    computeReferenceSolution();
+  }
+
+  /** Reference solution of the KKT conditions */
+  void computeReferenceSolution() {
+    ScalarFunctionQuadraticApproximation costApproximation;
+    VectorFunctionLinearApproximation constraintsApproximation;
+    getCostMatrix(ocpSize_, x0_, cost_, costApproximation);
+    getConstraintMatrix(ocpSize_, x0_, dynamics_, nullptr, nullptr, constraintsApproximation);
+    const int nz = costApproximation.dfdx.size();
+    const int nc = constraintsApproximation.f.size();
+    matrix_t kkt = matrix_t::Zero(nz + nc, nz + nc);
+    kkt.topLeftCorner(nz, nz) = costApproximation.dfdxx;
+    kkt.topRightCorner(nz, nc) = constraintsApproximation.dfdx.transpose();
+    kkt.bottomLeftCorner(nc, nz) = constraintsApproximation.dfdx;
+    vector_t rhs(nz + nc);
+    rhs << -costApproximation.dfdx, constraintsApproximation.f;
+    const vector_t sol = kkt.lu().solve(rhs);
+    toOcpSolution(ocpSize_, sol.head(nz), x0_, xRef_, uRef_);
+  }
+
+  void checkSolution(const vector_array_t& x, const vector_array_t& u) const {
+    ASSERT_EQ(x.size(), N_ + 1);
+    ASSERT_EQ(u.size(), N_);
+    for (int k = 0; k < N_; k++) {
+      EXPECT_TRUE(x[k].isApprox(xRef_[k], tol_)) << "k = " << k;
+      EXPECT_TRUE(u[k].isApprox(uRef_[k], tol_)) << "k = " << k;
+    }
+    EXPECT_TRUE(x[N_].isApprox(xRef_[N_], tol_));
+  }
+
+  OcpSize ocpSize_;
+  ThreadPool threadPool_;
+  vector_t x0_;
+  std::vector<VectorFunctionLinearApproximation> dynamics_;
+  std::vector<ScalarFunctionQuadraticApproximation> cost_;
+  vector_array_t xRef_;
+  vector_array_t uRef_;
+};
+
+constexpr int ParallelRiccatiSolverTest::N_;
+constexpr int ParallelRiccatiSolverTest::nx_;
+constexpr int ParallelRiccatiSolverTest::nu_;
+constexpr scalar_t ParallelRiccatiSolverTest::tol_;
+
+TEST_F(ParallelRiccatiSolverTest, singlePartition) {
+  multiple_shooting::ParallelRiccatiSolver solver(1);
+  vector_array_t x, u;
+  solver.solve(threadPool_, x0_, dynamics_, cost_, x, u);
+  checkSolution(x, u);
+}
+
+TEST_F(ParallelRiccatiSolverTest, multiplePartitions) {
+  multiple_shooting::ParallelRiccatiSolver sequentialSolver(1);
+  vector_array_t x, u;
+  sequentialSolver.solve(threadPool_, x0_, dynamics_, cost_, x, u);
+  const auto costToGoRef = sequentialSolver.getRiccatiCostToGo();
+  const auto feedbackRef = sequentialSolver.getRiccatiFeedback();
+
+  // Includes uneven segments and more partitions than threads
+  for (int numPartitions : {4, 7}) {
+    multiple_shooting::ParallelRiccatiSolver solver(numPartitions);
+    solver.solve(threadPool_, x0_, dynamics_, cost_, x, u);
+    checkSolution(x, u);
+
+    const auto costToGo = solver.getRiccatiCostToGo();
+    ASSERT_EQ(costToGo.size(), N_ + 1);
+    for (int k = 0; k <= N_; k++) {
+      EXPECT_TRUE(costToGo[k].dfdxx.isApprox(costToGoRef[k].dfdxx, tol_)) << "k = " << k;
+      EXPECT_TRUE(costToGo[k].dfdx.isApprox(costToGoRef[k].dfdx, tol_)) << "k = " << k;
+    }
+    for (int k = 0; k < N_; k++) {
+      EXPECT_TRUE(solver.getRiccatiFeedback()[k].isApprox(feedbackRef[k], tol_)) << "k = " << k;
+    }
+  }
+}
+
+TEST_F(ParallelRiccatiSolverTest, stagesWithoutInputs) {
+  // Stages without inputs, including one at a segment boundary
+  const std::vector<int> eventStages{10, 24, 25};
+  for (int k : eventStages) {
+    dynamics_[k].dfdu.setZero(nx_, 0);
+    cost_[k].dfdu.setZero(0);
+    cost_[k].dfdux.setZero(0, nx_);
+    cost_[k].dfduu.setZero(0, 0);
+    ocpSize_.numInputs[k] = 0;
+  }
+  computeReferenceSolution();
+
+  // The event nodes of the multiple shooting transcription leave the input derivatives of the cost empty
+  for (int k : eventStages) {
+    cost_[k].dfdux = matrix_t();
+  }
+
+  for (int numPartitions : {1, 4, 7}) {
+    multiple_shooting::ParallelRiccatiSolver solver(numPartitions);
+    vector_array_t x, u;
+    solver.solve(threadPool_, x0_, dynamics_, cost_, x, u);
+    checkSolution(x, u);
+  }
+}
+
+TEST_F(ParallelRiccatiSolverTest, fallbackToSequential) {
+  for (int numPartitions : {0, 1, 2, 3}) {
+    multiple_shooting::ParallelRiccatiSolver solver(numPartitions);
+    EXPECT_EQ(solver.numPartitions(), 1);
+    vector_array_t x, u;
+    solver.solve(threadPool_, x0_, dynamics_, cost_, x, u);
+    checkSolution(x, u);
+  }
+  EXPECT_EQ(multiple_shooting::ParallelRiccatiSolver(4).numPartitions(), 4);
+}
+
+TEST_F(ParallelRiccatiSolverTest, morePartitionsThanStages) {
+  dynamics_.resize(3);
+  cost_.resize(4);
+  cost_.back() = getRandomCost(nx_, 0);
+
+  multiple_shooting::ParallelRiccatiSolver sequentialSolver(1);
+  vector_array_t xRef, uRef;
+  sequentialSolver.solve(threadPool_, x0_, dynamics_, cost_, xRef, uRef);
+
+  multiple_shooting::ParallelRiccatiSolver solver(8);
+  vector_array_t x, u;
+  solver.solve(threadPool_, x0_, dynamics_, cost_, x, u);
+  for (int k = 0; k < 3; k++) {
+    EXPECT_TRUE(x[k + 1].isApprox(xRef[k + 1], tol_));
+    EXPECT_TRUE(u[k].isApprox(uRef[k], tol_));
+  }
+}
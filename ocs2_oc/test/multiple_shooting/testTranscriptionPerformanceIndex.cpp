@@ -29,6 +29,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <gtest/gtest.h>
 
+#include <ocs2_core/test/testTools.h>
+
 #include <ocs2_oc/multiple_shooting/Transcription.h>
 #include <ocs2_oc/multiple_shooting/PerformanceIndexComputation.h>
 
@@ -65,6 +67,40 @@ TEST(test_transcription_performance, intermediate) {
   ASSERT_TRUE(performance.isApprox(multiple_shooting::computePerformanceIndex(transcription, dt), 1e-12));
 }
 
+TEST(test_transcription_performance, intermediateBoxConstraints) {
+  constexpr int nx = 2;
+  constexpr int nu = 2;
+
+  // optimal control problem
+  OptimalControlProblem problem = createCircularKinematicsProblem("/tmp/sqp_test_generated");
+
+  // box constraints, violated at the evaluation point below
+  std::unique_ptr<BoxConstraint> stateBox(new BoxConstraint({0, 1}, vector_t::Constant(2, -0.5), vector_t::Constant(2, 0.5), 10.0, 1.0));
+  std::unique_ptr<BoxConstraint> inputBox(new BoxConstraint({1}, vector_t::Constant(1, -1.0), vector_t::Ones(1)));
+  problem.stateBoxConstraintPtr->add("stateBox", std::move(stateBox));
+  problem.inputBoxConstraintPtr->add("inputBox", std::move(inputBox));
+
+  auto discretizer = selectDynamicsDiscretization(SensitivityIntegratorType::RK4);
+  auto sensitivityDiscretizer = selectDynamicsSensitivityDiscretization(SensitivityIntegratorType::RK4);
+
+  const scalar_t t = 0.5;
+  const scalar_t dt = 0.1;
+  const vector_t x = (vector_t(nx) << 1.0, 0.1).finished();
+  const vector_t x_next = (vector_t(nx) << 1.1, 0.2).finished();
+  const vector_t u = (vector_t(nu) << 0.1, 1.3).finished();
+  const auto transcription = multiple_shooting::setupIntermediateNode(problem, sensitivityDiscretizer, t, dt, x, x_next, u);
+  const auto performance = multiple_shooting::computeIntermediatePerformance(problem, discretizer, t, dt, x, x_next, u);
+
+  // bounds are on the deviation from x and u
+  ASSERT_EQ(transcription.stateBoxConstraints.size(), 2);
+  ASSERT_EQ(transcription.stateBoxConstraints.numSoft(), 2);
+  ASSERT_EQ(transcription.inputBoxConstraints.size(), 1);
+  ASSERT_DOUBLE_EQ(transcription.inputBoxConstraints.upperBound[0], 1.0 - u[1]);
+
+  ASSERT_GT(performance.inequalityConstraintsSSE, 0.0);
+  ASSERT_TRUE(performance.isApprox(multiple_shooting::computePerformanceIndex(transcription, dt), 1e-12));
+}
+
 TEST(test_transcription_performance, event) {
   constexpr int nx = 2;
 
@@ -95,6 +131,39 @@ TEST(test_transcription_performance, event) {
   ASSERT_TRUE(performance.isApprox(multiple_shooting::computePerformanceIndex(transcription), 1e-12));
 }
 
+TEST(test_transcription_performance, eventBoxConstraints) {
+  constexpr int nx = 2;
+
+  // optimal control problem
+  OptimalControlProblem problem;
+  const auto dynamics = getRandomDynamics(nx, 0);
+  problem.dynamicsPtr.reset(new LinearSystemDynamics(dynamics.dfdx, dynamics.dfdu, matrix_t::Random(nx, nx)));
+  problem.preJumpCostPtr->add("eventCost", getOcs2StateCost(getRandomCost(nx, 0)));
+
+  // the intermediate state box also holds for the pre-event state, violated at the evaluation point below
+  std::unique_ptr<BoxConstraint> softStateBox(new BoxConstraint({0}, vector_t::Constant(1, -0.5), vector_t::Constant(1, 0.5), 10.0, 1.0));
+  std::unique_ptr<BoxConstraint> hardStateBox(new BoxConstraint({1}, vector_t::Constant(1, -0.05), vector_t::Constant(1, 0.05)));
+  problem.stateBoxConstraintPtr->add("softStateBox", std::move(softStateBox));
+  problem.stateBoxConstraintPtr->add("hardStateBox", std::move(hardStateBox));
+
+  const TargetTrajectories targetTrajectories({0.0}, {vector_t::Random(nx)}, {vector_t::Random(0)});
+  problem.targetTrajectoriesPtr = &targetTrajectories;
+
+  const scalar_t t = 0.5;
+  const vector_t x = (vector_t(nx) << 1.0, 0.1).finished();
+  const vector_t x_next = (vector_t(nx) << 1.1, 0.2).finished();
+  const auto transcription = multiple_shooting::setupEventNode(problem, t, x, x_next);
+  const auto performance = multiple_shooting::computeEventPerformance(problem, t, x, x_next);
+
+  // bounds are on the deviation from x
+  ASSERT_EQ(transcription.stateBoxConstraints.size(), 2);
+  ASSERT_EQ(transcription.stateBoxConstraints.numSoft(), 1);
+  ASSERT_DOUBLE_EQ(transcription.stateBoxConstraints.upperBound[1], 0.05 - x[1]);
+
+  ASSERT_GT(performance.inequalityConstraintsSSE, 0.0);
+  ASSERT_TRUE(performance.isApprox(multiple_shooting::computePerformanceIndex(transcription), 1e-12));
+}
+
 TEST(test_transcription_performance, terminal) {
   constexpr int nx = 3;
 
@@ -119,3 +188,47 @@ TEST(test_transcription_performance, terminal) {
 
   ASSERT_TRUE(performance.isApprox(multiple_shooting::computePerformanceIndex(transcription), 1e-12));
 }
+
+TEST(test_transcription_performance, intermediateInPlace) {
+  constexpr int nx = 3;
+  constexpr int nu = 2;
+
+  // optimal control problem without constraints
+  OptimalControlProblem unconstrainedProblem;
+  const auto dynamics = getRandomDynamics(nx, nu);
+  unconstrainedProblem.dynamicsPtr.reset(new LinearSystemDynamics(dynamics.dfdx, dynamics.dfdu));
+  unconstrainedProblem.costPtr->add("cost", getOcs2Cost(getRandomCost(nx, nu)));
+
+  const TargetTrajectories targetTrajectories({0.0}, {vector_t::Random(nx)}, {vector_t::Random(nu)});
+  unconstrainedProblem.targetTrajectoriesPtr = &targetTrajectories;
+
+  // same problem with constraints
+  OptimalControlProblem constrainedProblem = unconstrainedProblem;
+  constrainedProblem.equalityConstraintPtr->add("equalityConstraint", getOcs2Constraints(getRandomConstraints(nx, nu, 1)));
+  constrainedProblem.inequalityConstraintPtr->add("inequalityConstraint", getOcs2Constraints(getRandomConstraints(nx, nu, 3)));
+
+  auto sensitivityDiscretizer = selectDynamicsSensitivityDiscretization(SensitivityIntegratorType::RK4);
+
+  const scalar_t t = 0.5;
+  const scalar_t dt = 0.1;
+  const vector_t x = vector_t::Random(nx);
+  const vector_t x_next = vector_t::Random(nx);
+  const vector_t u = vector_t::Random(nu);
+
+  // Reuse a transcription that holds the projected result of the constrained problem
+  multiple_shooting::Transcription transcription;
+  multiple_shooting::setupIntermediateNode(constrainedProblem, sensitivityDiscretizer, t, dt, x, x_next, u, transcription);
+  multiple_shooting::projectTranscription(transcription, true);
+  multiple_shooting::setupIntermediateNode(unconstrainedProblem, sensitivityDiscretizer, t, dt, x, x_next, u, transcription);
+
+  const auto expected = multiple_shooting::setupIntermediateNode(unconstrainedProblem, sensitivityDiscretizer, t, dt, x, x_next, u);
+  ASSERT_TRUE(isApprox(transcription.cost, expected.cost));
+  ASSERT_TRUE(isApprox(transcription.dynamics, expected.dynamics));
+  ASSERT_TRUE(transcription.constraintsSize.stateInputEq.empty());
+  ASSERT_TRUE(transcription.constraintsSize.stateInputIneq.empty());
+  ASSERT_EQ(transcription.stateInputEqConstraints.f.size(), 0);
+  ASSERT_EQ(transcription.stateInputIneqConstraints.f.size(), 0);
+  ASSERT_EQ(transcription.constraintsProjection.f.size(), 0);
+  ASSERT_EQ(transcription.projectionMultiplierCoefficients.f.size(), 0);
+  ASSERT_TRUE(computePerformanceIndex(transcription, dt).isApprox(computePerformanceIndex(expected, dt), 1e-12));
+}
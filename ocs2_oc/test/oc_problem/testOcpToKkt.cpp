@@ -92,3 +92,59 @@ TEST_F(OcpToKktTest, sparseCostApproximation) {
   EXPECT_TRUE(costApproximation.dfdxx.isApprox(H.toDense()));
   EXPECT_TRUE(costApproximation.dfdx.isApprox(h));
 }
+
+TEST_F(OcpToKktTest, blockBandedConstraintsApproximation) {
+  ocs2::vector_array_t scalingVectors(N_);
+  for (auto& v : scalingVectors) {
+    v = ocs2::vector_t::Random(nx_);
+  }
+
+  for (const auto* constraintsPtr : {&constraintsArray, static_cast<decltype(constraintsArray)*>(nullptr)}) {
+    ocs2::BlockBandedConstraintMatrix G;
+    ocs2::vector_t g;
+    ocs2::VectorFunctionLinearApproximation constraintsApproximation;
+    ocs2::getConstraintMatrix(ocpSize_, x0, dynamicsArray, constraintsPtr, &scalingVectors, constraintsApproximation);
+    ocs2::getConstraintMatrixBlockBanded(ocpSize_, x0, dynamicsArray, constraintsPtr, &scalingVectors, G, g);
+    const ocs2::matrix_t& GDense = constraintsApproximation.dfdx;
+
+    ASSERT_EQ(G.rows(), GDense.rows());
+    ASSERT_EQ(G.cols(), GDense.cols());
+    EXPECT_TRUE(GDense.isApprox(G.toDense()));
+    EXPECT_TRUE(constraintsApproximation.f.isApprox(g));
+
+    const ocs2::vector_t x = ocs2::vector_t::Random(G.cols());
+    const ocs2::vector_t y = ocs2::vector_t::Random(G.rows());
+    ocs2::vector_t Gx;
+    G.multiply(x, Gx);
+    EXPECT_TRUE(Gx.isApprox(GDense * x));
+
+    ocs2::vector_t GxAccumulated = y;
+    G.multiplyAdd(-2.0, x, GxAccumulated);
+    EXPECT_TRUE(GxAccumulated.isApprox(y - 2.0 * GDense * x));
+
+    ocs2::vector_t GTy = x;
+    G.transposeMultiplyAdd(0.5, y, GTy);
+    EXPECT_TRUE(GTy.isApprox(x + 0.5 * GDense.transpose() * y));
+  }
+}
+
+TEST_F(OcpToKktTest, blockBandedCostApproximation) {
+  ocs2::BlockBandedCostMatrix H;
+  ocs2::vector_t h;
+
+  ocs2::ScalarFunctionQuadraticApproximation costApproximation;
+  ocs2::getCostMatrix(ocpSize_, x0, costArray, costApproximation);
+  ocs2::getCostMatrixBlockBanded(ocpSize_, x0, costArray, H, h);
+
+  EXPECT_TRUE(costApproximation.dfdxx.isApprox(H.toDense()));
+  EXPECT_TRUE(costApproximation.dfdx.isApprox(h));
+
+  const ocs2::vector_t x = ocs2::vector_t::Random(H.cols());
+  ocs2::vector_t Hx;
+  H.multiply(x, Hx);
+  EXPECT_TRUE(Hx.isApprox(costApproximation.dfdxx * x));
+
+  ocs2::vector_t HxAccumulated = x;
+  H.multiplyAdd(-1.0, x, HxAccumulated);
+  EXPECT_TRUE(HxAccumulated.isApprox(x - costApproximation.dfdxx * x));
+}
@@ -84,4 +84,21 @@ TEST(time_rollout_test, time_rollout_test) {
   const auto totalSize = timeTrajectory.size();
   ASSERT_EQ(totalSize, stateTrajectory.size());
   ASSERT_EQ(totalSize, inputTrajectory.size());
+
+  // the contiguous variants give the same rollout, also when the trajectory memory is reused
+  ContiguousTrajectory trajectory;
+  for (const bool useDefaultImplementation : {false, false, true}) {
+    const vector_t finalState =
+        useDefaultImplementation ? rolloutPtr->RolloutBase::run(initTime, initState, finalTime, &controller, modeSchedule, trajectory)
+                                 : rolloutPtr->run(initTime, initState, finalTime, &controller, modeSchedule, trajectory);
+    EXPECT_TRUE(finalState.isApprox(stateTrajectory.back()));
+    EXPECT_EQ(trajectory.timeTrajectory, timeTrajectory);
+    EXPECT_EQ(trajectory.postEventIndices, postEventIndices);
+    ASSERT_EQ(trajectory.stateTrajectory.size(), totalSize);
+    ASSERT_EQ(trajectory.inputTrajectory.size(), totalSize);
+    for (size_t k = 0; k < totalSize; k++) {
+      EXPECT_TRUE(trajectory.stateTrajectory[k].isApprox(stateTrajectory[k])) << "k = " << k;
+      EXPECT_TRUE(trajectory.inputTrajectory[k].isApprox(inputTrajectory[k])) << "k = " << k;
+    }
+  }
 }
@@ -0,0 +1,201 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <set>
+#include <thread>
+
+#include "ocs2_oc/synchronized_module/ReferenceManager.h"
+
+using namespace ocs2;
+
+namespace {
+constexpr size_t stateDim = 3;
+constexpr size_t inputDim = 2;
+
+/** Creates the points (t, [t, 2t, 3t], [-t, -2t]) for the given times. */
+TargetTrajectories getTargetTrajectories(const scalar_array_t& timeTrajectory, bool hasInput = true) {
+  TargetTrajectories targetTrajectories;
+  for (const auto t : timeTrajectory) {
+    targetTrajectories.timeTrajectory.push_back(t);
+    targetTrajectories.stateTrajectory.push_back(t * vector_t::LinSpaced(stateDim, 1.0, stateDim));
+    if (hasInput) {
+      targetTrajectories.inputTrajectory.push_back(-t * vector_t::LinSpaced(inputDim, 1.0, inputDim));
+    }
+  }
+  return targetTrajectories;
+}
+
+scalar_array_t getTimeTrajectory(scalar_t initTime, scalar_t timeStep, size_t numPoints) {
+  scalar_array_t timeTrajectory(numPoints);
+  for (size_t i = 0; i < numPoints; i++) {
+    timeTrajectory[i] = initTime + i * timeStep;
+  }
+  return timeTrajectory;
+}
+}  // unnamed namespace
+
+TEST(testReferenceManager, appendAndTrim) {
+  ReferenceManager referenceManager(getTargetTrajectories(getTimeTrajectory(0.0, 0.1, 11)));
+  referenceManager.appendTargetTrajectories(getTargetTrajectories({1.1, 1.2}));
+  referenceManager.appendTargetTrajectories(getTargetTrajectories({1.3}));
+  referenceManager.preSolverRun(0.35, 1.0, vector_t::Zero(stateDim));
+
+  // the point at 0.3 is kept for the interpolation at the initial time
+  const auto& targetTrajectories = referenceManager.getTargetTrajectories();
+  ASSERT_EQ(targetTrajectories.size(), 11);
+  ASSERT_EQ(targetTrajectories.inputTrajectory.size(), 11);
+  EXPECT_DOUBLE_EQ(targetTrajectories.timeTrajectory.front(), 0.3);
+  EXPECT_DOUBLE_EQ(targetTrajectories.timeTrajectory.back(), 1.3);
+  EXPECT_TRUE(std::is_sorted(targetTrajectories.timeTrajectory.begin(), targetTrajectories.timeTrajectory.end()));
+
+  const auto expected = getTargetTrajectories({0.35, 1.25});
+  EXPECT_TRUE(targetTrajectories.getDesiredState(0.35).isApprox(expected.stateTrajectory[0]));
+  EXPECT_TRUE(targetTrajectories.getDesiredInput(0.35).isApprox(expected.inputTrajectory[0]));
+  EXPECT_TRUE(targetTrajectories.getDesiredState(1.25).isApprox(expected.stateTrajectory[1]));
+  EXPECT_TRUE(targetTrajectories.getDesiredInput(1.25).isApprox(expected.inputTrajectory[1]));
+
+  // without appended points, the active TargetTrajectories is not modified
+  referenceManager.preSolverRun(0.75, 1.5, vector_t::Zero(stateDim));
+  EXPECT_EQ(targetTrajectories.size(), 11);
+}
+
+TEST(testReferenceManager, replaceTail) {
+  ReferenceManager referenceManager(getTargetTrajectories(getTimeTrajectory(0.0, 0.1, 11)));
+
+  auto appendedPoints = getTargetTrajectories({0.55, 0.65});
+  appendedPoints.stateTrajectory[0].setConstant(10.0);
+  referenceManager.appendTargetTrajectories(appendedPoints);
+  referenceManager.preSolverRun(0.0, 1.0, vector_t::Zero(stateDim));
+
+  const auto& targetTrajectories = referenceManager.getTargetTrajectories();
+  auto expectedTimeTrajectory = getTimeTrajectory(0.0, 0.1, 6);
+  expectedTimeTrajectory.insert(expectedTimeTrajectory.end(), {0.55, 0.65});
+  EXPECT_EQ(targetTrajectories.timeTrajectory, expectedTimeTrajectory);
+  EXPECT_TRUE(targetTrajectories.stateTrajectory[6].isApprox(vector_t::Constant(stateDim, 10.0)));
+  EXPECT_TRUE(targetTrajectories.stateTrajectory[7].isApprox(appendedPoints.stateTrajectory[1]));
+}
+
+TEST(testReferenceManager, setAndAppend) {
+  ReferenceManager referenceManager(getTargetTrajectories(getTimeTrajectory(0.0, 0.1, 11)));
+
+  // setTargetTrajectories discards the points appended before it
+  referenceManager.appendTargetTrajectories(getTargetTrajectories({1.1}));
+  referenceManager.setTargetTrajectories(getTargetTrajectories({2.0, 3.0}));
+  referenceManager.appendTargetTrajectories(getTargetTrajectories({4.0}));
+  referenceManager.preSolverRun(0.0, 1.0, vector_t::Zero(stateDim));
+
+  EXPECT_EQ(referenceManager.getTargetTrajectories().timeTrajectory, scalar_array_t({2.0, 3.0, 4.0}));
+}
+
+TEST(testReferenceManager, fullBuffer) {
+  ReferenceManager referenceManager(getTargetTrajectories({0.0}), ModeSchedule(), 3);
+
+  // only the three most recent points are kept
+  referenceManager.appendTargetTrajectories(getTargetTrajectories({0.1, 0.2, 0.3}));
+  referenceManager.appendTargetTrajectories(getTargetTrajectories({0.4, 0.5}));
+  referenceManager.preSolverRun(0.0, 1.0, vector_t::Zero(stateDim));
+
+  EXPECT_EQ(referenceManager.getTargetTrajectories().timeTrajectory, scalar_array_t({0.0, 0.3, 0.4, 0.5}));
+  EXPECT_THROW(ReferenceManager(TargetTrajectories(), ModeSchedule(), 0), std::runtime_error);
+}
+
+TEST(testReferenceManager, withoutInput) {
+  ReferenceManager referenceManager(getTargetTrajectories(getTimeTrajectory(0.0, 0.1, 11)));
+
+  // the input trajectory is dropped once a point without input is appended
+  referenceManager.appendTargetTrajectories(getTargetTrajectories({1.1}, false));
+  referenceManager.preSolverRun(0.0, 1.0, vector_t::Zero(stateDim));
+  EXPECT_EQ(referenceManager.getTargetTrajectories().size(), 12);
+  EXPECT_TRUE(referenceManager.getTargetTrajectories().inputTrajectory.empty());
+
+  // a point with input which replaces all the points starts a new input trajectory
+  referenceManager.appendTargetTrajectories(getTargetTrajectories({-1.0, 2.0}));
+  referenceManager.preSolverRun(0.0, 1.0, vector_t::Zero(stateDim));
+  EXPECT_EQ(referenceManager.getTargetTrajectories().timeTrajectory, scalar_array_t({-1.0, 2.0}));
+  EXPECT_EQ(referenceManager.getTargetTrajectories().inputTrajectory.size(), 2);
+}
+
+TEST(testReferenceManager, noReallocation) {
+  constexpr scalar_t timeStep = 0.01;
+  constexpr size_t numPoints = 50;
+  ReferenceManager referenceManager(getTargetTrajectories(getTimeTrajectory(0.0, timeStep, numPoints)));
+  const auto& targetTrajectories = referenceManager.getTargetTrajectories();
+
+  const auto getStorage = [&]() {
+    std::set<const scalar_t*> storage{targetTrajectories.timeTrajectory.data()};
+    for (size_t i = 0; i < targetTrajectories.size(); i++) {
+      storage.insert(targetTrajectories.stateTrajectory[i].data());
+      storage.insert(targetTrajectories.inputTrajectory[i].data());
+    }
+    return storage;
+  };
+  const auto initialStorage = getStorage();
+
+  // receding horizon: each update drops one point at the front and appends one at the back
+  for (size_t k = 1; k < 200; k++) {
+    const scalar_t initTime = k * timeStep;
+    referenceManager.appendTargetTrajectories(getTargetTrajectories({(k + numPoints - 1) * timeStep}));
+    referenceManager.preSolverRun(initTime, initTime + 1.0, vector_t::Zero(stateDim));
+
+    ASSERT_EQ(targetTrajectories.size(), numPoints);
+    ASSERT_DOUBLE_EQ(targetTrajectories.timeTrajectory.front(), initTime);
+    ASSERT_TRUE(targetTrajectories.getDesiredState(initTime).isApprox(initTime * vector_t::LinSpaced(stateDim, 1.0, stateDim)));
+  }
+  EXPECT_TRUE(getStorage() == initialStorage);
+}
+
+TEST(testReferenceManager, concurrentAppend) {
+  ReferenceManager referenceManager(getTargetTrajectories({0.0}));
+  const auto& targetTrajectories = referenceManager.getTargetTrajectories();
+
+  constexpr size_t numAppends = 2000;
+  std::atomic_bool isDone{false};
+  std::thread producer([&]() {
+    for (size_t i = 1; i <= numAppends; i++) {
+      referenceManager.appendTargetTrajectories(getTargetTrajectories({0.001 * i}));
+    }
+    isDone = true;
+  });
+
+  while (!isDone) {
+    referenceManager.preSolverRun(0.0, 1.0, vector_t::Zero(stateDim));
+    ASSERT_TRUE(std::is_sorted(targetTrajectories.timeTrajectory.begin(), targetTrajectories.timeTrajectory.end()));
+    ASSERT_EQ(targetTrajectories.stateTrajectory.size(), targetTrajectories.size());
+    ASSERT_EQ(targetTrajectories.inputTrajectory.size(), targetTrajectories.size());
+  }
+  producer.join();
+  referenceManager.preSolverRun(0.0, 1.0, vector_t::Zero(stateDim));
+
+  // with initTime of zero nothing is dropped, so all the points have arrived, except those overwritten in a full buffer
+  EXPECT_DOUBLE_EQ(targetTrajectories.timeTrajectory.back(), 0.001 * numAppends);
+  EXPECT_TRUE(std::is_sorted(targetTrajectories.timeTrajectory.begin(), targetTrajectories.timeTrajectory.end()));
+}
@@ -39,6 +39,8 @@ namespace ocs2 {
 class DistanceTransformInterface {
  public:
   using vector3_t = Eigen::Matrix<scalar_t, 3, 1>;
+  /** A batch of 3D points, one point per row. */
+  using points_t = Eigen::Matrix<scalar_t, Eigen::Dynamic, 3>;
 
   DistanceTransformInterface() = default;
   virtual ~DistanceTransformInterface() = default;
@@ -56,6 +58,37 @@ class DistanceTransformInterface {
 
   /** Gets the distance's value and its gradient at the given point. */
   virtual std::pair<scalar_t, vector3_t> getLinearApproximation(const vector3_t& p) const = 0;
+
+  /**
+   * Gets the distances to a batch of points. The default implementation queries the points one by one.
+   *
+   * @param [in] points: The queried points, one point per row.
+   * @param [out] values: The distance to each point.
+   */
+  virtual void getBatchedValue(const points_t& points, vector_t& values) const {
+    values.resize(points.rows());
+    for (int i = 0; i < points.rows(); i++) {
+      values(i) = getValue(points.row(i).transpose());
+    }
+  }
+
+  /**
+   * Gets the distances' values and their gradients at a batch of points. The default implementation queries the points one by one.
+   * Implementations with a sampled field should override it to interpolate all the points at once.
+   *
+   * @param [in] points: The queried points, one point per row.
+   * @param [out] values: The distance to each point.
+   * @param [out] gradients: The gradient at each point, one point per row.
+   */
+  virtual void getBatchedLinearApproximation(const points_t& points, vector_t& values, points_t& gradients) const {
+    values.resize(points.rows());
+    gradients.resize(points.rows(), 3);
+    for (int i = 0; i < points.rows(); i++) {
+      const auto valueGradient = getLinearApproximation(points.row(i).transpose());
+      values(i) = valueGradient.first;
+      gradients.row(i) = valueGradient.second.transpose();
+    }
+  }
 };
 
 /** Identity distance transform with constant zero value and zero gradients. */
@@ -67,6 +100,11 @@ class IdentityDistanceTransform : public DistanceTransformInterface {
   scalar_t getValue(const vector3_t&) const override { return 0.0; }
   vector3_t getProjectedPoint(const vector3_t& p) const override { return p; }
   std::pair<scalar_t, vector3_t> getLinearApproximation(const vector3_t&) const override { return {0.0, vector3_t::Zero()}; }
+  void getBatchedValue(const points_t& points, vector_t& values) const override { values.setZero(points.rows()); }
+  void getBatchedLinearApproximation(const points_t& points, vector_t& values, points_t& gradients) const override {
+    values.setZero(points.rows());
+    gradients.setZero(points.rows(), 3);
+  }
 };
 
 }  // namespace ocs2
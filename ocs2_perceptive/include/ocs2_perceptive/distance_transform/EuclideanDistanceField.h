@@ -0,0 +1,122 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <ocs2_core/Types.h>
+#include <ocs2_core/thread_support/ThreadPool.h>
+
+namespace ocs2 {
+
+/**
+ * Euclidean distance field of a 3D voxel occupancy grid (a 2.5D map is a grid with sizeZ = 1). The field is built by the separable
+ * distance transform of computeDistanceTransform, i.e., by three passes of the 1D transform along the x rows, the y columns, and the
+ * z lines of the grid. The lines of each pass are processed in parallel on a ThreadPool.
+ *
+ * The field is updated incrementally: changing the occupancy of a voxel marks its x row dirty. A line of the next pass is only
+ * recomputed if one of its inputs has changed in the previous pass, therefore a local change of the map only touches the sub-volume
+ * whose distances are actually affected by it.
+ *
+ * The voxel (x, y, z) is stored at index x + sizeX * (y + sizeY * z).
+ */
+class EuclideanDistanceField {
+ public:
+  /**
+   * Constructor. All voxels are initialized as free.
+   *
+   * @param [in] sizeX: The number of voxels along x.
+   * @param [in] sizeY: The number of voxels along y.
+   * @param [in] sizeZ: The number of voxels along z.
+   * @param [in] resolution: The edge length of a voxel.
+   */
+  EuclideanDistanceField(size_t sizeX, size_t sizeY, size_t sizeZ, scalar_t resolution);
+
+  /** Sets the occupancy of the given voxel. The distances are updated on the next call to update(). */
+  void setOccupancy(size_t x, size_t y, size_t z, bool occupied);
+
+  /** Gets the occupancy of the given voxel. */
+  bool isOccupied(size_t x, size_t y, size_t z) const { return occupancy_[index(x, y, z)] == 0; }
+
+  /**
+   * Updates the distance field for the occupancy changes since the last call.
+   *
+   * @param [in] threadPool: The thread pool used to process the lines of each pass in parallel.
+   */
+  void update(ThreadPool& threadPool);
+
+  /** Gets the distance of the given voxel to the nearest occupied voxel. */
+  scalar_t getDistance(size_t x, size_t y, size_t z) const { return std::sqrt(squaredDistance_[index(x, y, z)]) * resolution_; }
+
+  /** Gets the squared distances of all voxels in the unit of voxels. */
+  const std::vector<float>& getSquaredDistances() const { return squaredDistance_; }
+
+  size_t sizeX() const { return sizeX_; }
+  size_t sizeY() const { return sizeY_; }
+  size_t sizeZ() const { return sizeZ_; }
+  scalar_t resolution() const { return resolution_; }
+
+  /** The squared distance of the voxels if there is no occupied voxel in the grid. */
+  static constexpr float maxSquaredDistance = 1e20f;
+
+ private:
+  size_t index(size_t x, size_t y, size_t z) const { return x + sizeX_ * (y + sizeY_ * z); }
+
+  const size_t sizeX_;
+  const size_t sizeY_;
+  const size_t sizeZ_;
+  const scalar_t resolution_;
+
+  // The input of the first pass: 0 for occupied and maxSquaredDistance for free voxels.
+  std::vector<float> occupancy_;
+  // The outputs of the x and y passes, which are kept for the incremental updates.
+  std::vector<float> rowPass_;
+  std::vector<float> columnPass_;
+  std::vector<float> squaredDistance_;
+
+  // Per-voxel flags of the changed outputs of the x and y passes.
+  std::vector<uint8_t> rowPassChanged_;
+  std::vector<uint8_t> columnPassChanged_;
+
+  // The x rows with changed occupancy, indexed by y + sizeY * z.
+  std::vector<uint8_t> dirtyRows_;
+  std::vector<int> dirtyRowIndices_;
+  // The z slices which contain a dirty row.
+  std::vector<uint8_t> dirtySlices_;
+  std::vector<int> dirtyColumnIndices_;
+
+  // The buffers of computeDistanceTransform for each worker of the thread pool.
+  std::vector<std::vector<size_t>> vBuffers_;
+  std::vector<std::vector<float>> zBuffers_;
+};
+
+}  // namespace ocs2
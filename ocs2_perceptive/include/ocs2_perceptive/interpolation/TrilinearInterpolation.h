@@ -67,6 +67,26 @@ std::pair<Scalar, Eigen::Matrix<Scalar, 3, 1>> getLinearApproximation(Scalar res
                                                                       const std::array<Scalar, 8>& cornerValues,
                                                                       const Eigen::Matrix<Scalar, 3, 1>& position);
 
+/**
+ * Computes first-order approximations of the function at a batch of queried positions using tri-linear interpolation on a 3D-grid.
+ * The points are stored row-wise, such that each coordinate is a contiguous column and the interpolation of several points runs in
+ * one SIMD lane.
+ *
+ * @param resolution The resolution of the grid.
+ * @param referenceCorners The reference positions on the 3-D grid closest to the points, one point per row.
+ * @param cornerValues The values around each reference corner, one point per row, in the order:
+ *  (0, 0, 0), (1, 0, 0), (0, 1, 0), (1, 1, 0), (0, 0, 1), (1, 0, 1), (0, 1, 1), (1, 1, 1).
+ * @param positions The queried positions, one point per row.
+ * @param values The interpolated function's values at the queried positions.
+ * @param gradients The gradients at the queried positions, one point per row.
+ * @tparam Scalar : The Scalar type.
+ */
+template <typename Scalar>
+void getLinearApproximation(Scalar resolution, const Eigen::Matrix<Scalar, Eigen::Dynamic, 3>& referenceCorners,
+                            const Eigen::Matrix<Scalar, Eigen::Dynamic, 8>& cornerValues,
+                            const Eigen::Matrix<Scalar, Eigen::Dynamic, 3>& positions, Eigen::Matrix<Scalar, Eigen::Dynamic, 1>& values,
+                            Eigen::Matrix<Scalar, Eigen::Dynamic, 3>& gradients);
+
 }  // namespace trilinear_interpolation
 }  // namespace ocs2
 
@@ -94,5 +94,42 @@ std::pair<Scalar, Eigen::Matrix<Scalar, 3, 1>> getLinearApproximation(Scalar res
   return {value, gradient};
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+template <typename Scalar>
+void getLinearApproximation(Scalar resolution, const Eigen::Matrix<Scalar, Eigen::Dynamic, 3>& referenceCorners,
+                            const Eigen::Matrix<Scalar, Eigen::Dynamic, 8>& cornerValues,
+                            const Eigen::Matrix<Scalar, Eigen::Dynamic, 3>& positions, Eigen::Matrix<Scalar, Eigen::Dynamic, 1>& values,
+                            Eigen::Matrix<Scalar, Eigen::Dynamic, 3>& gradients) {
+  using array_t = Eigen::Array<Scalar, Eigen::Dynamic, 1>;
+  const auto c = [&cornerValues](int i) { return cornerValues.col(i).array(); };
+
+  /// auxiliary variables, each one holding all the points
+  const Scalar r_inv = 1.0 / resolution;
+  const array_t x = (positions.col(0) - referenceCorners.col(0)).array() * r_inv;
+  const array_t y = (positions.col(1) - referenceCorners.col(1)).array() * r_inv;
+  const array_t z = (positions.col(2) - referenceCorners.col(2)).array() * r_inv;
+  const array_t xFlip = 1 - x;
+  const array_t yFlip = 1 - y;
+  const array_t zFlip = 1 - z;
+  const array_t f00 = xFlip * c(0) + x * c(1);  // f_00 = (1 - x) f_000 + x f_100
+  const array_t f10 = xFlip * c(2) + x * c(3);  // f_10 = (1 - x) f_010 + x f_110
+  const array_t f01 = xFlip * c(4) + x * c(5);  // f_01 = (1 - x) f_001 + x f_101
+  const array_t f11 = xFlip * c(6) + x * c(7);  // f_11 = (1 - x) f_011 + x f_111
+  const array_t f0 = yFlip * f00 + y * f10;     // f_0 = (1 - y) f_00 + y f_10
+  const array_t f1 = yFlip * f01 + y * f11;     // f_1 = (1 - y) f_01 + y f_11
+
+  // f = (1 - z) f_0 + z f_1
+  values = (zFlip * f0 + z * f1).matrix();
+
+  gradients.resize(positions.rows(), 3);
+  gradients.col(2) = ((f1 - f0) * r_inv).matrix();
+  gradients.col(1) = ((zFlip * (f10 - f00) + z * (f11 - f01)) * r_inv).matrix();
+  gradients.col(0) = ((zFlip * yFlip * (c(1) - c(0)) + zFlip * y * (c(3) - c(2)) + z * yFlip * (c(5) - c(4)) + z * y * (c(7) - c(6))) *
+                      r_inv)
+                         .matrix();
+}
+
 }  // namespace trilinear_interpolation
 }  // namespace ocs2
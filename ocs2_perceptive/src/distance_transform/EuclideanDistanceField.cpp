@@ -0,0 +1,167 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include "ocs2_perceptive/distance_transform/EuclideanDistanceField.h"
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+
+#include "ocs2_perceptive/distance_transform/ComputeDistanceTransform.h"
+
+namespace ocs2 {
+
+constexpr float EuclideanDistanceField::maxSquaredDistance;
+
+namespace {
+// The number of consecutive lines processed by a worker at once.
+constexpr int lineGrain = 16;
+}  // namespace
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+EuclideanDistanceField::EuclideanDistanceField(size_t sizeX, size_t sizeY, size_t sizeZ, scalar_t resolution)
+    : sizeX_(sizeX),
+      sizeY_(sizeY),
+      sizeZ_(sizeZ),
+      resolution_(resolution),
+      occupancy_(sizeX * sizeY * sizeZ, maxSquaredDistance),
+      rowPass_(occupancy_.size(), maxSquaredDistance),
+      columnPass_(occupancy_.size(), maxSquaredDistance),
+      squaredDistance_(occupancy_.size(), maxSquaredDistance),
+      rowPassChanged_(occupancy_.size(), 0),
+      columnPassChanged_(occupancy_.size(), 0),
+      dirtyRows_(sizeY * sizeZ, 0),
+      dirtySlices_(sizeZ, 0) {
+  if (sizeX == 0 || sizeY == 0 || sizeZ == 0) {
+    throw std::runtime_error("[EuclideanDistanceField] The grid size should be positive along all the axes!");
+  }
+  if (resolution <= 0.0) {
+    throw std::runtime_error("[EuclideanDistanceField] The resolution should be positive!");
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void EuclideanDistanceField::setOccupancy(size_t x, size_t y, size_t z, bool occupied) {
+  assert(x < sizeX_ && y < sizeY_ && z < sizeZ_);
+
+  const float value = occupied ? 0.0f : maxSquaredDistance;
+  auto& voxel = occupancy_[index(x, y, z)];
+  if (voxel != value) {
+    voxel = value;
+    const size_t row = y + sizeY_ * z;
+    if (dirtyRows_[row] == 0) {
+      dirtyRows_[row] = 1;
+      dirtyRowIndices_.push_back(row);
+    }
+    dirtySlices_[z] = 1;
+  }
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void EuclideanDistanceField::update(ThreadPool& threadPool) {
+  if (dirtyRowIndices_.empty()) {
+    return;
+  }
+
+  // worker indices of parallelFor are in [0, numThreads]
+  vBuffers_.resize(threadPool.numThreads() + 1);
+  zBuffers_.resize(threadPool.numThreads() + 1);
+
+  // Runs the 1D transform on a line of the grid and flags the outputs which have changed.
+  auto transformLine = [this](size_t numSamples, size_t offset, size_t stride, const std::vector<float>& input, std::vector<float>& output,
+                              std::vector<uint8_t>* changedPtr, int workerIndex) {
+    auto getValue = [&](size_t i) { return input[offset + i * stride]; };
+    auto setValue = [&](size_t i, float value) {
+      auto& out = output[offset + i * stride];
+      if (out != value) {
+        out = value;
+        if (changedPtr != nullptr) {
+          (*changedPtr)[offset + i * stride] = 1;
+        }
+      }
+    };
+    computeDistanceTransform(numSamples, getValue, setValue, 0, numSamples, vBuffers_[workerIndex], zBuffers_[workerIndex]);
+  };
+
+  // Clears the change flags of a line and returns true if any of them was set.
+  auto consumeChanges = [](size_t numSamples, size_t offset, size_t stride, std::vector<uint8_t>& changed) {
+    bool hasChanged = false;
+    for (size_t i = 0; i < numSamples; i++) {
+      hasChanged = hasChanged || changed[offset + i * stride] != 0;
+      changed[offset + i * stride] = 0;
+    }
+    return hasChanged;
+  };
+
+  // x pass: only the rows with changed occupancy
+  threadPool.parallelFor(0, dirtyRowIndices_.size(), lineGrain, [&](int i, int workerIndex) {
+    transformLine(sizeX_, sizeX_ * dirtyRowIndices_[i], 1, occupancy_, rowPass_, &rowPassChanged_, workerIndex);
+  });
+
+  // y pass: only the columns of the slices with a dirty row, and among them, the ones with a changed input
+  dirtyColumnIndices_.clear();
+  for (size_t z = 0; z < sizeZ_; z++) {
+    if (dirtySlices_[z] != 0) {
+      for (size_t x = 0; x < sizeX_; x++) {
+        dirtyColumnIndices_.push_back(x + sizeX_ * z);
+      }
+    }
+  }
+  threadPool.parallelFor(0, dirtyColumnIndices_.size(), lineGrain, [&](int i, int workerIndex) {
+    const size_t x = dirtyColumnIndices_[i] % sizeX_;
+    const size_t z = dirtyColumnIndices_[i] / sizeX_;
+    const size_t offset = index(x, 0, z);
+    if (consumeChanges(sizeY_, offset, sizeX_, rowPassChanged_)) {
+      transformLine(sizeY_, offset, sizeX_, rowPass_, columnPass_, &columnPassChanged_, workerIndex);
+    }
+  });
+
+  // z pass: the lines with a changed input
+  const size_t sliceSize = sizeX_ * sizeY_;
+  threadPool.parallelFor(0, sliceSize, lineGrain, [&](int i, int workerIndex) {
+    if (consumeChanges(sizeZ_, i, sliceSize, columnPassChanged_)) {
+      transformLine(sizeZ_, i, sliceSize, columnPass_, squaredDistance_, nullptr, workerIndex);
+    }
+  });
+
+  // reset the dirty flags
+  for (const auto row : dirtyRowIndices_) {
+    dirtyRows_[row] = 0;
+  }
+  dirtyRowIndices_.clear();
+  std::fill(dirtySlices_.begin(), dirtySlices_.end(), 0);
+}
+
+}  // namespace ocs2
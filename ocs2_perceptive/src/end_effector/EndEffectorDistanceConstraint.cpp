@@ -103,9 +103,15 @@ vector_t EndEffectorDistanceConstraint::getValue(scalar_t time, const vector_t&
   const auto numEEs = kinematicsPtr_->getIds().size();
   const auto eePositions = kinematicsPtr_->getPosition(state);
 
-  vector_t g(numEEs);
+  DistanceTransformInterface::points_t points(numEEs, 3);
   for (size_t i = 0; i < numEEs; i++) {
-    g(i) = weight_ * (distanceTransformPtr_->getValue(eePositions[i]) - clearances_[i]);
+    points.row(i) = eePositions[i].transpose();
+  }  // end of i loop
+
+  vector_t g;
+  distanceTransformPtr_->getBatchedValue(points, g);
+  for (size_t i = 0; i < numEEs; i++) {
+    g(i) = weight_ * (g(i) - clearances_[i]);
   }  // end of i loop
 
   return g;
@@ -123,11 +129,18 @@ VectorFunctionLinearApproximation EndEffectorDistanceConstraint::getLinearApprox
   const auto numEEs = kinematicsPtr_->getIds().size();
   const auto eePosLinApprox = kinematicsPtr_->getPositionLinearApproximation(state);
 
+  // query all the end-effectors at once, the distances are written into approx.f
+  DistanceTransformInterface::points_t points(numEEs, 3);
+  for (size_t i = 0; i < numEEs; i++) {
+    points.row(i) = eePosLinApprox[i].f.transpose();
+  }  // end of i loop
   VectorFunctionLinearApproximation approx = VectorFunctionLinearApproximation::Zero(numEEs, stateDim_, 0);
+  DistanceTransformInterface::points_t distanceGradients;
+  distanceTransformPtr_->getBatchedLinearApproximation(points, approx.f, distanceGradients);
+
   for (size_t i = 0; i < numEEs; i++) {
-    const auto distanceValueGradient = distanceTransformPtr_->getLinearApproximation(eePosLinApprox[i].f);
-    approx.f(i) = weight_ * (distanceValueGradient.first - clearances_[i]);
-    approx.dfdx.row(i).noalias() = weight_ * (distanceValueGradient.second.transpose() * eePosLinApprox[i].dfdx);
+    approx.f(i) = weight_ * (approx.f(i) - clearances_[i]);
+    approx.dfdx.row(i).noalias() = weight_ * (distanceGradients.row(i) * eePosLinApprox[i].dfdx);
   }  // end of i loop
 
   return approx;
@@ -0,0 +1,139 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+
+#include <gtest/gtest.h>
+
+#include "ocs2_perceptive/distance_transform/EuclideanDistanceField.h"
+
+namespace ocs2 {
+
+class TestEuclideanDistanceField : public ::testing::Test {
+ protected:
+  TestEuclideanDistanceField() : distanceField(sizeX, sizeY, sizeZ, resolution), threadPool(3, 0) { srand(0); }
+
+  void randomlyFlipVoxels(size_t numVoxels) {
+    for (size_t i = 0; i < numVoxels; i++) {
+      const size_t x = rand() % sizeX;
+      const size_t y = rand() % sizeY;
+      const size_t z = rand() % sizeZ;
+      distanceField.setOccupancy(x, y, z, !distanceField.isOccupied(x, y, z));
+    }
+  }
+
+  /** Checks the squared distances against a brute-force search over the occupied voxels. */
+  void checkAgainstBruteForce() const {
+    const auto& squaredDistances = distanceField.getSquaredDistances();
+    for (size_t z = 0; z < sizeZ; z++) {
+      for (size_t y = 0; y < sizeY; y++) {
+        for (size_t x = 0; x < sizeX; x++) {
+          float trueSquaredDistance = EuclideanDistanceField::maxSquaredDistance;
+          for (size_t k = 0; k < sizeZ; k++) {
+            for (size_t j = 0; j < sizeY; j++) {
+              for (size_t i = 0; i < sizeX; i++) {
+                if (distanceField.isOccupied(i, j, k)) {
+                  const float dx = static_cast<float>(i) - x;
+                  const float dy = static_cast<float>(j) - y;
+                  const float dz = static_cast<float>(k) - z;
+                  trueSquaredDistance = std::min(trueSquaredDistance, dx * dx + dy * dy + dz * dz);
+                }
+              }
+            }
+          }
+          ASSERT_EQ(squaredDistances[x + sizeX * (y + sizeY * z)], trueSquaredDistance)
+              << "at voxel (" << x << ", " << y << ", " << z << ")";
+        }
+      }
+    }
+  }
+
+  static constexpr size_t sizeX = 13;
+  static constexpr size_t sizeY = 9;
+  static constexpr size_t sizeZ = 7;
+  static constexpr scalar_t resolution = 0.1;
+
+  EuclideanDistanceField distanceField;
+  ThreadPool threadPool;
+};
+
+constexpr size_t TestEuclideanDistanceField::sizeX;
+constexpr size_t TestEuclideanDistanceField::sizeY;
+constexpr size_t TestEuclideanDistanceField::sizeZ;
+constexpr scalar_t TestEuclideanDistanceField::resolution;
+
+TEST_F(TestEuclideanDistanceField, fullBuild) {
+  // empty grid
+  distanceField.update(threadPool);
+  checkAgainstBruteForce();
+
+  randomlyFlipVoxels(10);
+  distanceField.update(threadPool);
+  checkAgainstBruteForce();
+
+  distanceField.setOccupancy(0, 0, 0, true);
+  distanceField.setOccupancy(3, 4, 0, false);
+  distanceField.update(threadPool);
+  EXPECT_DOUBLE_EQ(distanceField.getDistance(0, 0, 0), 0.0);
+}
+
+TEST_F(TestEuclideanDistanceField, incrementalUpdate) {
+  randomlyFlipVoxels(20);
+  distanceField.update(threadPool);
+  checkAgainstBruteForce();
+
+  // both adding and removing obstacles
+  for (size_t i = 0; i < 10; i++) {
+    randomlyFlipVoxels(3);
+    distanceField.update(threadPool);
+    checkAgainstBruteForce();
+  }
+
+  // clear the map
+  for (size_t z = 0; z < sizeZ; z++) {
+    for (size_t y = 0; y < sizeY; y++) {
+      for (size_t x = 0; x < sizeX; x++) {
+        distanceField.setOccupancy(x, y, z, false);
+      }
+    }
+  }
+  distanceField.update(threadPool);
+  checkAgainstBruteForce();
+}
+
+TEST_F(TestEuclideanDistanceField, flatGrid) {
+  EuclideanDistanceField distanceField2d(sizeX, sizeY, 1, resolution);
+  distanceField2d.setOccupancy(2, 3, 0, true);
+  distanceField2d.update(threadPool);
+  EXPECT_DOUBLE_EQ(distanceField2d.getDistance(2, 3, 0), 0.0);
+  EXPECT_NEAR(distanceField2d.getDistance(5, 7, 0), 5.0 * resolution, 1e-6);
+}
+
+}  // namespace ocs2
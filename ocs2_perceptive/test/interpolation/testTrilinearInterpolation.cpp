@@ -176,5 +176,35 @@ TEST_F(TestTrilinearInterpolation, testTrilinearInterpolation) {
   }  // end of i loop
 }
 
+TEST_F(TestTrilinearInterpolation, testBatchedLinearApproximation) {
+  Eigen::Matrix<scalar_t, Eigen::Dynamic, 3> referenceCorners(numSamples, 3);
+  Eigen::Matrix<scalar_t, Eigen::Dynamic, 8> cornerValues(numSamples, 8);
+  Eigen::Matrix<scalar_t, Eigen::Dynamic, 3> positions(numSamples, 3);
+  referenceCorners.setRandom();
+  cornerValues.setRandom();
+  positions.setRandom();
+  // place each position inside its voxel
+  positions = referenceCorners + (0.5 * resolution) * (positions.array() + 1.0).matrix();
+
+  vector_t values;
+  Eigen::Matrix<scalar_t, Eigen::Dynamic, 3> gradients;
+  trilinear_interpolation::getLinearApproximation(resolution, referenceCorners, cornerValues, positions, values, gradients);
+
+  ASSERT_EQ(values.size(), numSamples);
+  ASSERT_EQ(gradients.rows(), numSamples);
+  for (size_t i = 0; i < numSamples; i++) {
+    const vector3_t referenceCorner = referenceCorners.row(i).transpose();
+    const vector3_t position = positions.row(i).transpose();
+    const array8_t corners = {cornerValues(i, 0), cornerValues(i, 1), cornerValues(i, 2), cornerValues(i, 3),
+                              cornerValues(i, 4), cornerValues(i, 5), cornerValues(i, 6), cornerValues(i, 7)};
+    const auto linApprox = trilinear_interpolation::getLinearApproximation(resolution, referenceCorner, corners, position);
+
+    EXPECT_NEAR(values(i), linApprox.first, precision) << "at sample " << i;
+    EXPECT_TRUE(gradients.row(i).transpose().isApprox(linApprox.second, precision))
+        << "at sample " << i << ": the batched gradient is (" << gradients.row(i) << ") while the gradient is ("
+        << linApprox.second.transpose() << ")";
+  }  // end of i loop
+}
+
 }  // namespace trilinear_interpolation
 }  // namespace ocs2
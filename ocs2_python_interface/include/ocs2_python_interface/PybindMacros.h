@@ -29,6 +29,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #pragma once
 
+#include <mutex>
+#include <utility>
+
 #include <pybind11/eigen.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
@@ -37,6 +40,26 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 using namespace pybind11::literals;
 
+namespace ocs2 {
+namespace python {
+
+/**
+ * Wraps a member function of a Python interface for the bindings. The wrapper releases the GIL and then locks the interface's
+ * mutex for the duration of the call. Therefore, the calls on one interface are serialized, while other Python threads and other
+ * interfaces keep running. The GIL is released before locking, such that a thread waiting for the interface does not block Python.
+ */
+template <typename Interface, typename Return, typename Base, typename... Args>
+auto lockedMethod(Return (Base::*method)(Args...)) {
+  return [method](Interface& self, Args... args) -> Return {
+    pybind11::gil_scoped_release releaseGil;
+    std::lock_guard<std::mutex> lock(self.getMutex());
+    return (self.*method)(std::forward<Args>(args)...);
+  };
+}
+
+}  // namespace python
+}  // namespace ocs2
+
 //! convenience macro to bind all kinds of std::vector-like types
 #define VECTOR_TYPE_BINDING(VTYPE, NAME)                                                    \
   pybind11::class_<VTYPE>(m, NAME)                                                          \
@@ -97,28 +120,39 @@ using namespace pybind11::literals;
     /* bind TargetTrajectories class */                                                                                                    \
     pybind11::class_<ocs2::TargetTrajectories>(m, "TargetTrajectories")                                                                    \
         .def(pybind11::init<ocs2::scalar_array_t, ocs2::vector_array_t, ocs2::vector_array_t>());                                          \
+    /* threading: except for the dimensions, every call releases the GIL and locks the interface, see ocs2::python::lockedMethod */        \
+    const auto locked = [](auto method) { return ocs2::python::lockedMethod<PY_INTERFACE>(method); };                                      \
     /* bind the actual mpc interface */                                                                                                    \
     pybind11::class_<PY_INTERFACE>(m, "mpc_interface")                                                                                     \
         .def(pybind11::init<const std::string&, const std::string&, const std::string&>(), "taskFile"_a, "libFolder"_a, "urdfFile"_a = "") \
         .def("getStateDim", &PY_INTERFACE::getStateDim)                                                                                    \
         .def("getInputDim", &PY_INTERFACE::getInputDim)                                                                                    \
-        .def("setObservation", &PY_INTERFACE::setObservation, "t"_a, "x"_a.noconvert(), "u"_a.noconvert())                                 \
-        .def("setTargetTrajectories", &PY_INTERFACE::setTargetTrajectories, "targetTrajectories"_a)                                        \
-        .def("reset", &PY_INTERFACE::reset, "targetTrajectories"_a)                                                                        \
-        .def("advanceMpc", &PY_INTERFACE::advanceMpc)                                                                                      \
-        .def("getMpcSolution", &PY_INTERFACE::getMpcSolution, "t"_a.noconvert(), "x"_a.noconvert(), "u"_a.noconvert())                     \
-        .def("getLinearFeedbackGain", &PY_INTERFACE::getLinearFeedbackGain, "t"_a.noconvert())                                             \
-        .def("flowMap", &PY_INTERFACE::flowMap, "t"_a, "x"_a.noconvert(), "u"_a.noconvert())                                               \
-        .def("flowMapLinearApproximation", &PY_INTERFACE::flowMapLinearApproximation, "t"_a, "x"_a.noconvert(), "u"_a.noconvert())         \
-        .def("cost", &PY_INTERFACE::cost, "t"_a, "x"_a.noconvert(), "u"_a.noconvert())                                                     \
-        .def("costQuadraticApproximation", &PY_INTERFACE::costQuadraticApproximation, "t"_a, "x"_a.noconvert(), "u"_a.noconvert())         \
-        .def("valueFunction", &PY_INTERFACE::valueFunction, "t"_a, "x"_a.noconvert())                                                      \
-        .def("valueFunctionStateDerivative", &PY_INTERFACE::valueFunctionStateDerivative, "t"_a, "x"_a.noconvert())                        \
-        .def("stateInputEqualityConstraint", &PY_INTERFACE::stateInputEqualityConstraint, "t"_a, "x"_a.noconvert(), "u"_a.noconvert())     \
-        .def("stateInputEqualityConstraintLinearApproximation", &PY_INTERFACE::stateInputEqualityConstraintLinearApproximation, "t"_a,     \
+        .def("setObservation", locked(&PY_INTERFACE::setObservation), "t"_a, "x"_a.noconvert(), "u"_a.noconvert())                         \
+        .def("setTargetTrajectories", locked(&PY_INTERFACE::setTargetTrajectories), "targetTrajectories"_a)                                \
+        .def("reset", locked(&PY_INTERFACE::reset), "targetTrajectories"_a)                                                                \
+        .def("advanceMpc", locked(&PY_INTERFACE::advanceMpc))                                                                              \
+        .def("getMpcSolution", locked(&PY_INTERFACE::getMpcSolution), "t"_a.noconvert(), "x"_a.noconvert(), "u"_a.noconvert())             \
+        .def("getMpcSolutionArrays", locked(&PY_INTERFACE::getMpcSolutionArrays))                                                          \
+        .def("getLinearFeedbackGain", locked(&PY_INTERFACE::getLinearFeedbackGain), "t"_a.noconvert())                                     \
+        .def("flowMap", locked(&PY_INTERFACE::flowMap), "t"_a, "x"_a.noconvert(), "u"_a.noconvert())                                       \
+        .def("flowMapLinearApproximation", locked(&PY_INTERFACE::flowMapLinearApproximation), "t"_a, "x"_a.noconvert(),                    \
+             "u"_a.noconvert())                                                                                                            \
+        .def("flowMapBatch", locked(&PY_INTERFACE::flowMapBatch), "t"_a.noconvert(), "x"_a.noconvert(), "u"_a.noconvert())                 \
+        .def("flowMapLinearApproximationBatch", locked(&PY_INTERFACE::flowMapLinearApproximationBatch), "t"_a.noconvert(),                 \
              "x"_a.noconvert(), "u"_a.noconvert())                                                                                         \
-        .def("stateInputEqualityConstraintLagrangian", &PY_INTERFACE::stateInputEqualityConstraintLagrangian, "t"_a, "x"_a.noconvert(),    \
+        .def("cost", locked(&PY_INTERFACE::cost), "t"_a, "x"_a.noconvert(), "u"_a.noconvert())                                             \
+        .def("costQuadraticApproximation", locked(&PY_INTERFACE::costQuadraticApproximation), "t"_a, "x"_a.noconvert(),                    \
              "u"_a.noconvert())                                                                                                            \
-        .def("visualizeTrajectory", &PY_INTERFACE::visualizeTrajectory, "t"_a.noconvert(), "x"_a.noconvert(), "u"_a.noconvert(),           \
-             "speed"_a);                                                                                                                   \
+        .def("costQuadraticApproximationBatch", locked(&PY_INTERFACE::costQuadraticApproximationBatch), "t"_a.noconvert(),                 \
+             "x"_a.noconvert(), "u"_a.noconvert())                                                                                         \
+        .def("valueFunction", locked(&PY_INTERFACE::valueFunction), "t"_a, "x"_a.noconvert())                                              \
+        .def("valueFunctionStateDerivative", locked(&PY_INTERFACE::valueFunctionStateDerivative), "t"_a, "x"_a.noconvert())                \
+        .def("stateInputEqualityConstraint", locked(&PY_INTERFACE::stateInputEqualityConstraint), "t"_a, "x"_a.noconvert(),                \
+             "u"_a.noconvert())                                                                                                            \
+        .def("stateInputEqualityConstraintLinearApproximation", locked(&PY_INTERFACE::stateInputEqualityConstraintLinearApproximation),    \
+             "t"_a, "x"_a.noconvert(), "u"_a.noconvert())                                                                                  \
+        .def("stateInputEqualityConstraintLagrangian", locked(&PY_INTERFACE::stateInputEqualityConstraintLagrangian), "t"_a,               \
+             "x"_a.noconvert(), "u"_a.noconvert())                                                                                         \
+        .def("visualizeTrajectory", locked(&PY_INTERFACE::visualizeTrajectory), "t"_a.noconvert(), "x"_a.noconvert(),                      \
+             "u"_a.noconvert(), "speed"_a);                                                                                                \
   }
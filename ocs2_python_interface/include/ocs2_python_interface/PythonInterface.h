@@ -29,8 +29,14 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #pragma once
 
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <tuple>
+
 #include <ocs2_core/dynamics/SystemDynamicsBase.h>
 #include <ocs2_core/penalties/penalties/PenaltyBase.h>
+#include <ocs2_core/thread_support/ThreadPool.h>
 #include <ocs2_mpc/MPC_MRT_Interface.h>
 #include <ocs2_oc/oc_problem/OptimalControlProblem.h>
 #include <ocs2_robotic_tools/common/RobotInterface.h>
@@ -40,8 +46,16 @@ namespace ocs2 {
 /**
  * PythonInterface provides a unified interface for all systems
  * to the MPC_MRT_Interface to be used for Python bindings
+ *
+ * Threading: the methods share the MPC solver, the optimal control problem, and the solution buffers, hence they are not thread-safe.
+ * The Python bindings lock getMutex() for the duration of each call (after releasing the GIL), such that several Python threads
+ * can use the same interface, while distinct interfaces run in parallel. C++ users calling from several threads should do the same.
  */
 class PythonInterface {
+ public:
+  /** Row-major matrix type, such that each time node of a trajectory is a contiguous row, as in a C-ordered NumPy array. */
+  using row_matrix_t = Eigen::Matrix<scalar_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
  protected:
   /** Constructor */
   PythonInterface() = default;
@@ -51,8 +65,10 @@ class PythonInterface {
    * @note This should be called from derived class constructor.
    * @param [in] robot: Robot interface.
    * @param [in] mpcPtr: The Python interface takes ownership of the mpcPtr
+   * @param [in] numBatchThreads: The number of threads evaluating the batched calls, including the calling thread. If larger than 1,
+   *                              the thread pool and a clone of the problem per thread are created on the first batched call.
    */
-  void init(const RobotInterface& robot, std::unique_ptr<MPC_BASE> mpcPtr);
+  void init(const RobotInterface& robot, std::unique_ptr<MPC_BASE> mpcPtr, size_t numBatchThreads = 1);
 
  public:
   /** Destructor */
@@ -72,6 +88,9 @@ class PythonInterface {
    */
   int getInputDim() const { return inputDim_; }
 
+  /** The mutex which serializes the calls on this interface, see the class description. */
+  std::mutex& getMutex() const { return mutex_; }
+
   /**
    * @brief resets MPC to its original state
    * @param[in] targetTrajectories: The new target to be optimized for after resetting
@@ -106,6 +125,13 @@ class PythonInterface {
    */
   void getMpcSolution(scalar_array_t& t, vector_array_t& x, vector_array_t& u);
 
+  /**
+   * @brief Obtain the full MPC solution as contiguous arrays with one time node per row. The Python bindings hand the returned
+   * buffers over to NumPy without another copy.
+   * @return The time (N), state (N x stateDim), and input (N x inputDim) trajectories.
+   */
+  std::tuple<vector_t, row_matrix_t, row_matrix_t> getMpcSolutionArrays();
+
   /**
    * @brief Obtains feedback gain matrix, if the underlying MPC algorithm computes it
    * @param[in] t: Query time
@@ -119,12 +145,40 @@ class PythonInterface {
   /** System dynamics linearization */
   VectorFunctionLinearApproximation flowMapLinearApproximation(scalar_t t, Eigen::Ref<const vector_t> x, Eigen::Ref<const vector_t> u);
 
+  /**
+   * System dynamics for a batch of samples, evaluated in parallel.
+   * @param[in] t: The sample times (N).
+   * @param[in] x: The sample states (N x stateDim), one sample per row.
+   * @param[in] u: The sample inputs (N x inputDim), one sample per row.
+   * @return The flow maps (N x stateDim), one sample per row.
+   */
+  row_matrix_t flowMapBatch(Eigen::Ref<const vector_t> t, Eigen::Ref<const row_matrix_t> x, Eigen::Ref<const row_matrix_t> u);
+
+  /**
+   * System dynamics linearization for a batch of samples, evaluated in parallel. The jacobians are stacked row-wise, such that
+   * they can be viewed as (N x stateDim x stateDim) and (N x stateDim x inputDim) arrays.
+   * @return The tuple (f, dfdx, dfdu) with sizes (N x stateDim), (N * stateDim x stateDim), and (N * stateDim x inputDim).
+   */
+  std::tuple<row_matrix_t, row_matrix_t, row_matrix_t> flowMapLinearApproximationBatch(Eigen::Ref<const vector_t> t,
+                                                                                       Eigen::Ref<const row_matrix_t> x,
+                                                                                       Eigen::Ref<const row_matrix_t> u);
+
   /** Cost function with added penalty term */
   scalar_t cost(scalar_t t, Eigen::Ref<const vector_t> x, Eigen::Ref<const vector_t> u);
 
   /** Cost function quadratic approximation with added penalty term */
   ScalarFunctionQuadraticApproximation costQuadraticApproximation(scalar_t t, Eigen::Ref<const vector_t> x, Eigen::Ref<const vector_t> u);
 
+  /**
+   * Cost function quadratic approximation with added penalty term for a batch of samples, evaluated in parallel. The hessians are
+   * stacked row-wise, such that they can be viewed as 3D arrays with the sample index as the first dimension.
+   * @note The Lagrangian terms use the dual solution of the last MPC run.
+   * @return The tuple (f, dfdx, dfdu, dfdxx, dfdux, dfduu) with sizes (N), (N x stateDim), (N x inputDim), (N * stateDim x stateDim),
+   *         (N * inputDim x stateDim), and (N * inputDim x inputDim).
+   */
+  std::tuple<vector_t, row_matrix_t, row_matrix_t, row_matrix_t, row_matrix_t, row_matrix_t> costQuadraticApproximationBatch(
+      Eigen::Ref<const vector_t> t, Eigen::Ref<const row_matrix_t> x, Eigen::Ref<const row_matrix_t> u);
+
   /**
    * The solver's internal value function
    * @param t query time
@@ -186,11 +240,23 @@ class PythonInterface {
   int inputDim_ = -1;  // -1 indicates that it is not initialized
 
  private:
+  ScalarFunctionQuadraticApproximation costQuadraticApproximationImpl(OptimalControlProblem& problem, scalar_t t, const vector_t& x,
+                                                                      const vector_t& u);
+
+  /** Runs task(sampleIndex, problem) over the batch in parallel, where problem is the clone of the evaluating thread. */
+  void runBatch(Eigen::Index numSamples, const std::function<void(int, OptimalControlProblem&)>& task);
+
   std::unique_ptr<MPC_BASE> mpcPtr_;
   std::unique_ptr<MPC_MRT_Interface> mpcMrtInterface_;
 
   TargetTrajectories targetTrajectories_;
   OptimalControlProblem problem_;
+
+  size_t numBatchThreads_ = 1;
+  std::unique_ptr<ThreadPool> batchThreadPoolPtr_;
+  std::vector<OptimalControlProblem> batchProblems_;  // a clone of problem_ for each thread of the batched calls
+
+  mutable std::mutex mutex_;
 };
 
 }  // namespace ocs2
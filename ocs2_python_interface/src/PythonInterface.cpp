@@ -29,17 +29,27 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "ocs2_python_interface/PythonInterface.h"
 
+#include <algorithm>
+
 #include <ocs2_core/misc/LinearAlgebra.h>
 #include <ocs2_core/penalties/MultidimensionalPenalty.h>
 
 #include <ocs2_oc/approximate_model/LinearQuadraticApproximator.h>
 
 namespace ocs2 {
+namespace {
+void checkBatchSize(const Eigen::Ref<const vector_t>& t, const Eigen::Ref<const PythonInterface::row_matrix_t>& x,
+                    const Eigen::Ref<const PythonInterface::row_matrix_t>& u) {
+  if (x.rows() != t.size() || u.rows() != t.size()) {
+    throw std::runtime_error("[PythonInterface] The number of rows of the states and the inputs should match the number of times.");
+  }
+}
+}  // namespace
 
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
-void PythonInterface::init(const RobotInterface& robot, std::unique_ptr<MPC_BASE> mpcPtr) {
+void PythonInterface::init(const RobotInterface& robot, std::unique_ptr<MPC_BASE> mpcPtr, size_t numBatchThreads) {
   if (!mpcPtr) {
     throw std::runtime_error("[PythonInterface] Mpc pointer must be initialized before passing to the Python interface.");
   }
@@ -48,6 +58,11 @@ void PythonInterface::init(const RobotInterface& robot, std::unique_ptr<MPC_BASE
   mpcMrtInterface_.reset(new MPC_MRT_Interface(*mpcPtr_));
 
   problem_ = robot.getOptimalControlProblem();
+
+  // the thread pool and the clones of the problem are created on the first batched call
+  numBatchThreads_ = std::max(numBatchThreads, size_t(1));
+  batchThreadPoolPtr_.reset();
+  batchProblems_.clear();
 }
 
 /******************************************************************************************************/
@@ -57,6 +72,9 @@ void PythonInterface::reset(TargetTrajectories targetTrajectories) {
   targetTrajectories_ = std::move(targetTrajectories);
   mpcMrtInterface_->resetMpcNode(targetTrajectories_);
   problem_.targetTrajectoriesPtr = &targetTrajectories_;
+  for (auto& problem : batchProblems_) {
+    problem.targetTrajectoriesPtr = &targetTrajectories_;
+  }
 }
 
 /******************************************************************************************************/
@@ -76,6 +94,9 @@ void PythonInterface::setObservation(scalar_t t, Eigen::Ref<const vector_t> x, E
 void PythonInterface::setTargetTrajectories(TargetTrajectories targetTrajectories) {
   targetTrajectories_ = std::move(targetTrajectories);
   problem_.targetTrajectoriesPtr = &targetTrajectories_;
+  for (auto& problem : batchProblems_) {
+    problem.targetTrajectoriesPtr = &targetTrajectories_;
+  }
   mpcMrtInterface_->getReferenceManager().setTargetTrajectories(targetTrajectories_);
 }
 
@@ -96,6 +117,34 @@ void PythonInterface::getMpcSolution(scalar_array_t& t, vector_array_t& x, vecto
   u = mpcMrtInterface_->getPolicy().inputTrajectory_;
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+auto PythonInterface::getMpcSolutionArrays() -> std::tuple<vector_t, row_matrix_t, row_matrix_t> {
+  mpcMrtInterface_->updatePolicy();
+  const auto& policy = mpcMrtInterface_->getPolicy();
+
+  const size_t N = policy.timeTrajectory_.size();
+  const int stateDim = (N > 0) ? policy.stateTrajectory_.front().size() : stateDim_;
+  const int inputDim = (N > 0) ? policy.inputTrajectory_.front().size() : inputDim_;
+  if (policy.stateTrajectory_.size() != N || policy.inputTrajectory_.size() != N) {
+    throw std::runtime_error("[PythonInterface] The state and input trajectories should have the same length as the time trajectory.");
+  }
+
+  vector_t t = Eigen::Map<const vector_t>(policy.timeTrajectory_.data(), N);
+  row_matrix_t x(N, stateDim);
+  row_matrix_t u(N, inputDim);
+  for (size_t i = 0; i < N; i++) {
+    if (policy.stateTrajectory_[i].size() != stateDim || policy.inputTrajectory_[i].size() != inputDim) {
+      throw std::runtime_error("[PythonInterface] The state and input dimensions should be constant over time.");
+    }
+    x.row(i) = policy.stateTrajectory_[i].transpose();
+    u.row(i) = policy.inputTrajectory_[i].transpose();
+  }
+
+  return std::make_tuple(std::move(t), std::move(x), std::move(u));
+}
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
@@ -118,6 +167,42 @@ VectorFunctionLinearApproximation PythonInterface::flowMapLinearApproximation(sc
   return problem_.dynamicsPtr->linearApproximation(t, x, u);
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+auto PythonInterface::flowMapBatch(Eigen::Ref<const vector_t> t, Eigen::Ref<const row_matrix_t> x, Eigen::Ref<const row_matrix_t> u)
+    -> row_matrix_t {
+  checkBatchSize(t, x, u);
+  row_matrix_t f(t.size(), x.cols());
+  runBatch(t.size(), [&](int i, OptimalControlProblem& problem) {
+    f.row(i) = problem.dynamicsPtr->computeFlowMap(t(i), x.row(i).transpose(), u.row(i).transpose()).transpose();
+  });
+  return f;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+auto PythonInterface::flowMapLinearApproximationBatch(Eigen::Ref<const vector_t> t, Eigen::Ref<const row_matrix_t> x,
+                                                      Eigen::Ref<const row_matrix_t> u)
+    -> std::tuple<row_matrix_t, row_matrix_t, row_matrix_t> {
+  checkBatchSize(t, x, u);
+  const Eigen::Index N = t.size();
+  const Eigen::Index stateDim = x.cols();
+  const Eigen::Index inputDim = u.cols();
+
+  row_matrix_t f(N, stateDim);
+  row_matrix_t dfdx(N * stateDim, stateDim);
+  row_matrix_t dfdu(N * stateDim, inputDim);
+  runBatch(N, [&](int i, OptimalControlProblem& problem) {
+    const auto approx = problem.dynamicsPtr->linearApproximation(t(i), x.row(i).transpose(), u.row(i).transpose());
+    f.row(i) = approx.f.transpose();
+    dfdx.middleRows(i * stateDim, stateDim) = approx.dfdx;
+    dfdu.middleRows(i * stateDim, stateDim) = approx.dfdu;
+  });
+  return std::make_tuple(std::move(f), std::move(dfdx), std::move(dfdu));
+}
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
@@ -152,32 +237,69 @@ scalar_t PythonInterface::cost(scalar_t t, Eigen::Ref<const vector_t> x, Eigen::
 /******************************************************************************************************/
 ScalarFunctionQuadraticApproximation PythonInterface::costQuadraticApproximation(scalar_t t, Eigen::Ref<const vector_t> x,
                                                                                  Eigen::Ref<const vector_t> u) {
-  auto& preComputation = *problem_.preComputationPtr;
+  return costQuadraticApproximationImpl(problem_, t, x, u);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+auto PythonInterface::costQuadraticApproximationBatch(Eigen::Ref<const vector_t> t, Eigen::Ref<const row_matrix_t> x,
+                                                      Eigen::Ref<const row_matrix_t> u)
+    -> std::tuple<vector_t, row_matrix_t, row_matrix_t, row_matrix_t, row_matrix_t, row_matrix_t> {
+  checkBatchSize(t, x, u);
+  const Eigen::Index N = t.size();
+  const Eigen::Index stateDim = x.cols();
+  const Eigen::Index inputDim = u.cols();
+
+  vector_t f(N);
+  row_matrix_t dfdx(N, stateDim);
+  row_matrix_t dfdu(N, inputDim);
+  row_matrix_t dfdxx(N * stateDim, stateDim);
+  row_matrix_t dfdux(N * inputDim, stateDim);
+  row_matrix_t dfduu(N * inputDim, inputDim);
+  runBatch(N, [&](int i, OptimalControlProblem& problem) {
+    const auto approx = costQuadraticApproximationImpl(problem, t(i), x.row(i).transpose(), u.row(i).transpose());
+    f(i) = approx.f;
+    dfdx.row(i) = approx.dfdx.transpose();
+    dfdu.row(i) = approx.dfdu.transpose();
+    dfdxx.middleRows(i * stateDim, stateDim) = approx.dfdxx;
+    dfdux.middleRows(i * inputDim, inputDim) = approx.dfdux;
+    dfduu.middleRows(i * inputDim, inputDim) = approx.dfduu;
+  });
+  return std::make_tuple(std::move(f), std::move(dfdx), std::move(dfdu), std::move(dfdxx), std::move(dfdux), std::move(dfduu));
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+ScalarFunctionQuadraticApproximation PythonInterface::costQuadraticApproximationImpl(OptimalControlProblem& problem, scalar_t t,
+                                                                                     const vector_t& x, const vector_t& u) {
+  auto& preComputation = *problem.preComputationPtr;
   const auto request = Request::Cost + Request::SoftConstraint + Request::Constraint + Request::Approximation;
   preComputation.request(request, t, x, u);
 
   // cost
-  auto cost = approximateCost(problem_, t, x, u);
+  auto cost = approximateCost(problem, t, x, u);
 
   // Lagrangians
   const auto m = mpcMrtInterface_->getIntermediateDualSolution(t);
-  if (!problem_.stateEqualityLagrangianPtr->empty()) {
-    auto approx = problem_.stateEqualityLagrangianPtr->getQuadraticApproximation(t, x, m.stateEq, preComputation);
+  if (!problem.stateEqualityLagrangianPtr->empty()) {
+    auto approx = problem.stateEqualityLagrangianPtr->getQuadraticApproximation(t, x, m.stateEq, preComputation);
     cost.f += approx.f;
     cost.dfdx += approx.dfdx;
     cost.dfdxx += approx.dfdxx;
   }
-  if (!problem_.stateInequalityLagrangianPtr->empty()) {
-    auto approx = problem_.stateInequalityLagrangianPtr->getQuadraticApproximation(t, x, m.stateIneq, preComputation);
+  if (!problem.stateInequalityLagrangianPtr->empty()) {
+    auto approx = problem.stateInequalityLagrangianPtr->getQuadraticApproximation(t, x, m.stateIneq, preComputation);
     cost.f += approx.f;
     cost.dfdx += approx.dfdx;
     cost.dfdxx += approx.dfdxx;
   }
-  if (!problem_.equalityLagrangianPtr->empty()) {
-    cost += problem_.equalityLagrangianPtr->getQuadraticApproximation(t, x, u, m.stateInputEq, preComputation);
+  if (!problem.equalityLagrangianPtr->empty()) {
+    cost += problem.equalityLagrangianPtr->getQuadraticApproximation(t, x, u, m.stateInputEq, preComputation);
   }
-  if (!problem_.inequalityLagrangianPtr->empty()) {
-    cost += problem_.inequalityLagrangianPtr->getQuadraticApproximation(t, x, u, m.stateInputIneq, preComputation);
+  if (!problem.inequalityLagrangianPtr->empty()) {
+    cost += problem.inequalityLagrangianPtr->getQuadraticApproximation(t, x, u, m.stateInputIneq, preComputation);
   }
 
   return cost;
@@ -240,4 +362,26 @@ vector_t PythonInterface::stateInputEqualityConstraintLagrangian(scalar_t t, Eig
   return DmDager.transpose() * (R * DmDager * c - r - B.transpose() * costate);
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void PythonInterface::runBatch(Eigen::Index numSamples, const std::function<void(int, OptimalControlProblem&)>& task) {
+  if (numBatchThreads_ == 1) {
+    for (int i = 0; i < numSamples; i++) {
+      task(i, problem_);
+    }
+    return;
+  }
+
+  // the calling thread evaluates the batched calls as well
+  if (batchThreadPoolPtr_ == nullptr) {
+    batchThreadPoolPtr_.reset(new ThreadPool(numBatchThreads_ - 1));
+    batchProblems_.assign(numBatchThreads_, problem_);
+  }
+
+  // the samples are cheap to evaluate, therefore the workers claim them in chunks
+  constexpr int grain = 32;
+  batchThreadPoolPtr_->parallelFor(0, numSamples, grain, [&](int i, int workerIndex) { task(i, batchProblems_[workerIndex]); });
+}
+
 }  // namespace ocs2
@@ -86,15 +86,87 @@ class DummyPyBindings final : public PythonInterface {
  public:
   using Base = PythonInterface;
 
+  static constexpr size_t numBatchThreads = 3;
+
   DummyPyBindings() {
     DummyInterface robot;
-    PythonInterface::init(robot, robot.getMpc());
+    PythonInterface::init(robot, robot.getMpc(), numBatchThreads);
   }
 };
 
+constexpr size_t DummyPyBindings::numBatchThreads;
+
 }  // namespace pybindings_test
 }  // namespace ocs2
 
 TEST(OCS2PyBindingsTest, createDummyPyBindings) {
   ocs2::pybindings_test::DummyPyBindings dummy;
 }
+
+TEST(OCS2PyBindingsTest, getMpcSolutionArrays) {
+  ocs2::pybindings_test::DummyPyBindings dummy;
+  dummy.reset(ocs2::TargetTrajectories({0.0}, {ocs2::vector_t::Zero(2)}, {ocs2::vector_t::Zero(1)}));
+  dummy.setObservation(0.0, ocs2::vector_t::Ones(2), ocs2::vector_t::Zero(1));
+  dummy.advanceMpc();
+
+  ocs2::scalar_array_t t;
+  ocs2::vector_array_t x, u;
+  dummy.getMpcSolution(t, x, u);
+
+  ocs2::vector_t tArray;
+  ocs2::PythonInterface::row_matrix_t xArray, uArray;
+  std::tie(tArray, xArray, uArray) = dummy.getMpcSolutionArrays();
+
+  ASSERT_EQ(tArray.size(), t.size());
+  ASSERT_EQ(xArray.rows(), x.size());
+  ASSERT_EQ(uArray.rows(), u.size());
+  for (size_t i = 0; i < t.size(); i++) {
+    EXPECT_EQ(tArray(i), t[i]);
+    EXPECT_TRUE(xArray.row(i).transpose().isApprox(x[i]));
+    EXPECT_TRUE(uArray.row(i).transpose().isApprox(u[i]));
+  }
+}
+
+TEST(OCS2PyBindingsTest, batchedEvaluation) {
+  ocs2::pybindings_test::DummyPyBindings dummy;
+  dummy.reset(ocs2::TargetTrajectories({0.0}, {ocs2::vector_t::Zero(2)}, {ocs2::vector_t::Zero(1)}));
+  // the cost approximation requires the dual solution of the MPC
+  dummy.setObservation(0.0, ocs2::vector_t::Ones(2), ocs2::vector_t::Zero(1));
+  dummy.advanceMpc();
+
+  constexpr int N = 100;
+  const ocs2::vector_t t = ocs2::vector_t::LinSpaced(N, 0.0, 1.0);
+  const ocs2::PythonInterface::row_matrix_t x = ocs2::PythonInterface::row_matrix_t::Random(N, 2);
+  const ocs2::PythonInterface::row_matrix_t u = ocs2::PythonInterface::row_matrix_t::Random(N, 1);
+
+  const auto f = dummy.flowMapBatch(t, x, u);
+  ocs2::PythonInterface::row_matrix_t fLin, A, B;
+  std::tie(fLin, A, B) = dummy.flowMapLinearApproximationBatch(t, x, u);
+  ocs2::vector_t L;
+  ocs2::PythonInterface::row_matrix_t dLdx, dLdu, dLdxx, dLdux, dLduu;
+  std::tie(L, dLdx, dLdu, dLdxx, dLdux, dLduu) = dummy.costQuadraticApproximationBatch(t, x, u);
+
+  ASSERT_EQ(f.rows(), N);
+  ASSERT_EQ(A.rows(), 2 * N);
+  ASSERT_EQ(dLduu.rows(), N);
+  for (int i = 0; i < N; i++) {
+    const ocs2::vector_t xi = x.row(i).transpose();
+    const ocs2::vector_t ui = u.row(i).transpose();
+    EXPECT_TRUE(f.row(i).transpose().isApprox(dummy.flowMap(t(i), xi, ui)));
+
+    const auto dynamics = dummy.flowMapLinearApproximation(t(i), xi, ui);
+    EXPECT_TRUE(fLin.row(i).transpose().isApprox(dynamics.f));
+    EXPECT_TRUE(A.middleRows(2 * i, 2).isApprox(dynamics.dfdx));
+    EXPECT_TRUE(B.middleRows(2 * i, 2).isApprox(dynamics.dfdu));
+
+    const auto cost = dummy.costQuadraticApproximation(t(i), xi, ui);
+    EXPECT_DOUBLE_EQ(L(i), cost.f);
+    EXPECT_TRUE(dLdx.row(i).transpose().isApprox(cost.dfdx));
+    EXPECT_TRUE(dLdu.row(i).transpose().isApprox(cost.dfdu));
+    EXPECT_TRUE(dLdxx.middleRows(2 * i, 2).isApprox(cost.dfdxx));
+    EXPECT_TRUE(dLdux.middleRows(i, 1).isApprox(cost.dfdux));
+    EXPECT_TRUE(dLduu.middleRows(i, 1).isApprox(cost.dfduu));
+  }
+
+  EXPECT_ANY_THROW(dummy.flowMapBatch(t.head(N - 1), x, u));
+}
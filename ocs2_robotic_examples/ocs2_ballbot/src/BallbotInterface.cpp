@@ -32,6 +32,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "ocs2_ballbot/BallbotInterface.h"
 
+#include <ocs2_core/automatic_differentiation/CppAdModelBatch.h>
 #include <ocs2_core/cost/QuadraticStateCost.h>
 #include <ocs2_core/cost/QuadraticStateInputCost.h>
 #include <ocs2_core/initialization/DefaultInitializer.h>
@@ -78,6 +79,9 @@ BallbotInterface::BallbotInterface(const std::string& taskFile, const std::strin
   /*
    * Optimal control problem
    */
+  // The CppAD libraries of all terms are loaded or compiled together by modelBatch.prepare()
+  CppAdModelBatch modelBatch;
+
   // Cost
   matrix_t Q(STATE_DIM, STATE_DIM);
   matrix_t R(INPUT_DIM, INPUT_DIM);
@@ -97,6 +101,9 @@ BallbotInterface::BallbotInterface(const std::string& taskFile, const std::strin
   ocs2::loadData::loadCppDataType(taskFile, "ballbot_interface.recompileLibraries", recompileLibraries);
   problem_.dynamicsPtr.reset(new BallbotSystemDynamics(libraryFolder, recompileLibraries));
 
+  // The libraries have to be available before the terms are cloned
+  modelBatch.prepare();
+
   // Rollout
   auto rolloutSettings = rollout::loadSettings(taskFile, "rollout");
   rolloutPtr_.reset(new TimeTriggeredRollout(*problem_.dynamicsPtr, rolloutSettings));
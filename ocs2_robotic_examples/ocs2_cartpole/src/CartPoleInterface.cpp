@@ -34,6 +34,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "ocs2_cartpole/dynamics/CartPoleSystemDynamics.h"
 
 #include <ocs2_core/augmented_lagrangian/AugmentedLagrangian.h>
+#include <ocs2_core/automatic_differentiation/CppAdModelBatch.h>
 #include <ocs2_core/constraint/LinearStateInputConstraint.h>
 #include <ocs2_core/cost/QuadraticStateCost.h>
 #include <ocs2_core/cost/QuadraticStateInputCost.h>
@@ -79,6 +80,9 @@ CartPoleInterface::CartPoleInterface(const std::string& taskFile, const std::str
   /*
    * Optimal control problem
    */
+  // The CppAD libraries of all terms are loaded or compiled together by modelBatch.prepare()
+  CppAdModelBatch modelBatch;
+
   // Cost
   matrix_t Q(STATE_DIM, STATE_DIM);
   matrix_t R(INPUT_DIM, INPUT_DIM);
@@ -100,10 +104,6 @@ CartPoleInterface::CartPoleInterface(const std::string& taskFile, const std::str
   cartPoleParameters.loadSettings(taskFile, "cartpole_parameters", verbose);
   problem_.dynamicsPtr.reset(new CartPoleSytemDynamics(cartPoleParameters, libraryFolder, verbose));
 
-  // Rollout
-  auto rolloutSettings = rollout::loadSettings(taskFile, "rollout", verbose);
-  rolloutPtr_.reset(new TimeTriggeredRollout(*problem_.dynamicsPtr, rolloutSettings));
-
   // Constraints
   auto getPenalty = [&]() {
     // one can use either augmented::SlacknessSquaredHingePenalty or augmented::ModifiedRelaxedBarrierPenalty
@@ -121,6 +121,13 @@ CartPoleInterface::CartPoleInterface(const std::string& taskFile, const std::str
   };
   problem_.inequalityLagrangianPtr->add("InputLimits", create(getConstraint(), getPenalty()));
 
+  // The libraries have to be available before the terms are cloned
+  modelBatch.prepare();
+
+  // Rollout
+  auto rolloutSettings = rollout::loadSettings(taskFile, "rollout", verbose);
+  rolloutPtr_.reset(new TimeTriggeredRollout(*problem_.dynamicsPtr, rolloutSettings));
+
   // Initialization
   cartPoleInitializerPtr_.reset(new DefaultInitializer(INPUT_DIM));
 }
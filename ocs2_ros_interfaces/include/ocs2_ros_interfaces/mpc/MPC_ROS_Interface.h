@@ -31,6 +31,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <atomic>
 #include <condition_variable>
+#include <future>
 #include <iostream>
 #include <memory>
 #include <mutex>
@@ -51,8 +52,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ocs2_core/control/FeedforwardController.h>
 #include <ocs2_core/control/LinearController.h>
 #include <ocs2_core/misc/Benchmark.h>
+#include <ocs2_core/thread_support/ThreadPool.h>
 #include <ocs2_mpc/CommandData.h>
 #include <ocs2_mpc/MPC_BASE.h>
+#include <ocs2_mpc/PolicyCodec.h>
 #include <ocs2_mpc/SystemObservation.h>
 #include <ocs2_oc/oc_data/PrimalSolution.h>
 
@@ -70,8 +73,12 @@ class MPC_ROS_Interface {
    *
    * @param [in] mpc: The underlying MPC class to be used.
    * @param [in] topicPrefix: The robot's name.
+   * @param [in] policyEncoding: The compact encoding of the policy messages. With PolicyEncoding::NONE, the policy is sent
+   * uncompressed. Otherwise, the controller data is quantized, see
+   * encodePolicy().
    */
-  explicit MPC_ROS_Interface(MPC_BASE& mpc, std::string topicPrefix = "anonymousRobot");
+  explicit MPC_ROS_Interface(MPC_BASE& mpc, std::string topicPrefix = "anonymousRobot",
+                             PolicyEncoding policyEncoding = PolicyEncoding::NONE);
 
   /**
    * Destructor.
@@ -122,6 +129,13 @@ class MPC_ROS_Interface {
   static ocs2_msgs::mpc_flattened_controller createMpcPolicyMsg(const PrimalSolution& primalSolution, const CommandData& commandData,
                                                                 const PerformanceIndex& performanceIndices);
 
+  /**
+   * Moves the state, input, and controller data trajectories of the policy message into its compact encoding.
+   *
+   * @param [in, out] mpcPolicyMsg: The MPC policy message.
+   */
+  void compressPolicyMsg(ocs2_msgs::mpc_flattened_controller& mpcPolicyMsg) const;
+
   /**
    * Handles ROS publishing thread.
    */
@@ -136,12 +150,16 @@ class MPC_ROS_Interface {
 
   /**
    * The callback method which receives the current observation, invokes the MPC algorithm,
-   * and finally publishes the optimized policy.
+   * and finally publishes the optimized policy. After publishing, the next MPC iteration is prepared asynchronously
+   * (see MPC_BASE::prepare) for the expected time of the next observation.
    *
    * @param [in] msg: The observation message.
    */
   void mpcObservationCallback(const ocs2_msgs::mpc_observation::ConstPtr& msg);
 
+  /** Waits for the preparation of the next MPC iteration, if any, and rethrows its exception. */
+  void waitForPreparation();
+
  protected:
   /*
    * Variables
@@ -167,6 +185,8 @@ class MPC_ROS_Interface {
 
   mutable std::mutex bufferMutex_;  // for policy variables with prefix (buffer*)
 
+  const PolicyEncoding policyEncoding_;
+
   // multi-threading for publishers
   std::atomic_bool terminateThread_{false};
   std::atomic_bool readyToPublish_{false};
@@ -176,6 +196,10 @@ class MPC_ROS_Interface {
 
   benchmark::RepeatedTimer mpcTimer_;
 
+  // the preparation of the next MPC iteration runs on this thread, off the path from the observation to the policy
+  ThreadPool preparationThreadPool_{1};
+  std::future<void> preparationFuture_;
+
   // MPC reset
   std::mutex resetMutex_;
   std::atomic_bool resetRequestedEver_{false};
@@ -46,6 +46,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ocs2_msgs/reset.h>
 
 #include <ocs2_mpc/MRT_BASE.h>
+#include <ocs2_mpc/PolicyCodec.h>
 
 #include "ocs2_ros_interfaces/common/RosMsgConversions.h"
 
@@ -115,8 +116,8 @@ class MRT_ROS_Interface : public MRT_BASE {
    * @param [out] primalSolution: The MPC policy data
    * @param [out] performanceIndices: The MPC performance indices data
    */
-  static void readPolicyMsg(const ocs2_msgs::mpc_flattened_controller& msg, CommandData& commandData, PrimalSolution& primalSolution,
-                            PerformanceIndex& performanceIndices);
+  void readPolicyMsg(const ocs2_msgs::mpc_flattened_controller& msg, CommandData& commandData, PrimalSolution& primalSolution,
+                     PerformanceIndex& performanceIndices);
 
   /**
    * A thread function which sends the current state and checks for a new MPC update.
@@ -138,6 +139,9 @@ class MRT_ROS_Interface : public MRT_BASE {
   ::ros::CallbackQueue mrtCallbackQueue_;
   ::ros::TransportHints mrtTransportHints_;
 
+  // the decoded compact policy messages
+  FlatPolicy decodedPolicy_;
+
   // Multi-threading for publishers
   bool terminateThread_;
   bool readyToPublish_;
@@ -36,7 +36,7 @@ namespace ocs2 {
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
-MPC_ROS_Interface::MPC_ROS_Interface(MPC_BASE& mpc, std::string topicPrefix)
+MPC_ROS_Interface::MPC_ROS_Interface(MPC_BASE& mpc, std::string topicPrefix, PolicyEncoding policyEncoding)
     : mpc_(mpc),
       topicPrefix_(std::move(topicPrefix)),
       bufferPrimalSolutionPtr_(new PrimalSolution()),
@@ -44,7 +44,8 @@ MPC_ROS_Interface::MPC_ROS_Interface(MPC_BASE& mpc, std::string topicPrefix)
       bufferCommandPtr_(new CommandData()),
       publisherCommandPtr_(new CommandData()),
       bufferPerformanceIndicesPtr_(new PerformanceIndex),
-      publisherPerformanceIndicesPtr_(new PerformanceIndex) {
+      publisherPerformanceIndicesPtr_(new PerformanceIndex),
+      policyEncoding_(policyEncoding) {
   // start thread for publishing
 #ifdef PUBLISH_THREAD
   publisherWorker_ = std::thread(&MPC_ROS_Interface::publisherWorker, this);
@@ -63,6 +64,7 @@ MPC_ROS_Interface::~MPC_ROS_Interface() {
 /******************************************************************************************************/
 void MPC_ROS_Interface::resetMpcNode(TargetTrajectories&& initTargetTrajectories) {
   std::lock_guard<std::mutex> resetLock(resetMutex_);
+  waitForPreparation();
   mpc_.reset();
   mpc_.getSolverPtr()->getReferenceManager().setTargetTrajectories(std::move(initTargetTrajectories));
   mpcTimer_.reset();
@@ -177,6 +179,30 @@ ocs2_msgs::mpc_flattened_controller MPC_ROS_Interface::createMpcPolicyMsg(const
   return mpcPolicyMsg;
 }
 
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void MPC_ROS_Interface::compressPolicyMsg(ocs2_msgs::mpc_flattened_controller& mpcPolicyMsg) const {
+  const size_t N = mpcPolicyMsg.timeTrajectory.size();
+
+  FlatPolicy policy;
+  policy.timeTrajectory = mpcPolicyMsg.timeTrajectory;
+  policy.stateTrajectory.reserve(N);
+  policy.inputTrajectory.reserve(N);
+  policy.controllerData.reserve(N);
+  for (size_t k = 0; k < N; k++) {
+    policy.stateTrajectory.emplace_back(std::move(mpcPolicyMsg.stateTrajectory[k].value));
+    policy.inputTrajectory.emplace_back(std::move(mpcPolicyMsg.inputTrajectory[k].value));
+    policy.controllerData.emplace_back(std::move(mpcPolicyMsg.data[k].data));
+  }
+  mpcPolicyMsg.stateTrajectory.clear();
+  mpcPolicyMsg.inputTrajectory.clear();
+  mpcPolicyMsg.data.clear();
+
+  mpcPolicyMsg.encoding = static_cast<uint8_t>(policyEncoding_);
+  mpcPolicyMsg.compactData = encodePolicy(policyEncoding_, policy);
+}
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
@@ -199,6 +225,9 @@ void MPC_ROS_Interface::publisherWorker() {
 
     ocs2_msgs::mpc_flattened_controller mpcPolicyMsg =
         createMpcPolicyMsg(*publisherPrimalSolutionPtr_, *publisherCommandPtr_, *publisherPerformanceIndicesPtr_);
+    if (policyEncoding_ != PolicyEncoding::NONE) {
+      compressPolicyMsg(mpcPolicyMsg);
+    }
 
     // publish the message
     mpcPolicyPublisher_.publish(mpcPolicyMsg);
@@ -248,6 +277,9 @@ void MPC_ROS_Interface::mpcObservationCallback(const ocs2_msgs::mpc_observation:
   // measure the delay in running MPC
   mpcTimer_.startTimer();
 
+  // the solver is used by the preparation of this iteration until it is completed
+  waitForPreparation();
+
   // run MPC
   bool controllerIsUpdated = mpc_.run(currentObservation.time, currentObservation.state);
   if (!controllerIsUpdated) {
@@ -285,14 +317,37 @@ void MPC_ROS_Interface::mpcObservationCallback(const ocs2_msgs::mpc_observation:
 #else
   ocs2_msgs::mpc_flattened_controller mpcPolicyMsg =
       createMpcPolicyMsg(*bufferPrimalSolutionPtr_, *bufferCommandPtr_, *bufferPerformanceIndicesPtr_);
+  if (policyEncoding_ != PolicyEncoding::NONE) {
+    compressPolicyMsg(mpcPolicyMsg);
+  }
   mpcPolicyPublisher_.publish(mpcPolicyMsg);
 #endif
+
+  // prepare the next iteration, expected after one MPC period, while waiting for the next observation
+  const scalar_t mpcPeriod = (mpc_.settings().mpcDesiredFrequency_ > 0) ? 1.0 / mpc_.settings().mpcDesiredFrequency_
+                                                                        : mpcTimer_.getAverageInMilliseconds() * 1e-3;
+  const scalar_t nextTime = currentObservation.time + mpcPeriod;
+  preparationFuture_ = preparationThreadPool_.run([this, nextTime](int) { mpc_.prepare(nextTime); });
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+void MPC_ROS_Interface::waitForPreparation() {
+  if (preparationFuture_.valid()) {
+    preparationFuture_.get();
+  }
 }
 
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
 void MPC_ROS_Interface::shutdownNode() {
+  // the preparation uses the MPC, hence it should be completed before the node is shut down
+  if (preparationFuture_.valid()) {
+    preparationFuture_.wait();
+  }
+
 #ifdef PUBLISH_THREAD
   ROS_INFO_STREAM("Shutting down workers ...");
 
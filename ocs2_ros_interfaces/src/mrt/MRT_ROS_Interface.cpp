@@ -132,11 +132,31 @@ void MRT_ROS_Interface::readPolicyMsg(const ocs2_msgs::mpc_flattened_controller&
   if (N == 0) {
     throw std::runtime_error("[MRT_ROS_Interface::readPolicyMsg] controller message is empty!");
   }
-  if (msg.stateTrajectory.size() != N && msg.inputTrajectory.size() != N) {
-    throw std::runtime_error("[MRT_ROS_Interface::readPolicyMsg] state and input trajectories must have same length!");
-  }
-  if (msg.data.size() != N) {
-    throw std::runtime_error("[MRT_ROS_Interface::readPolicyMsg] Data has the wrong length!");
+
+  // the state, input, and controller data of each node
+  std::vector<std::vector<float> const*> stateDataPtrArray(N, nullptr);
+  std::vector<std::vector<float> const*> inputDataPtrArray(N, nullptr);
+  std::vector<std::vector<float> const*> controllerDataPtrArray(N, nullptr);
+  if (msg.encoding == ocs2_msgs::mpc_flattened_controller::ENCODING_NONE) {
+    if (msg.stateTrajectory.size() != N && msg.inputTrajectory.size() != N) {
+      throw std::runtime_error("[MRT_ROS_Interface::readPolicyMsg] state and input trajectories must have same length!");
+    }
+    if (msg.data.size() != N) {
+      throw std::runtime_error("[MRT_ROS_Interface::readPolicyMsg] Data has the wrong length!");
+    }
+    for (size_t i = 0; i < N; i++) {
+      stateDataPtrArray[i] = &(msg.stateTrajectory[i].value);
+      inputDataPtrArray[i] = &(msg.inputTrajectory[i].value);
+      controllerDataPtrArray[i] = &(msg.data[i].data);
+    }
+
+  } else {
+    decodePolicy(msg.timeTrajectory, msg.compactData, decodedPolicy_);
+    for (size_t i = 0; i < N; i++) {
+      stateDataPtrArray[i] = &(decodedPolicy_.stateTrajectory[i]);
+      inputDataPtrArray[i] = &(decodedPolicy_.inputTrajectory[i]);
+      controllerDataPtrArray[i] = &(decodedPolicy_.controllerData[i]);
+    }
   }
 
   primalSolution.clear();
@@ -149,13 +169,13 @@ void MRT_ROS_Interface::readPolicyMsg(const ocs2_msgs::mpc_flattened_controller&
   primalSolution.stateTrajectory_.reserve(N);
   primalSolution.inputTrajectory_.reserve(N);
   for (size_t i = 0; i < N; i++) {
-    stateDim[i] = msg.stateTrajectory[i].value.size();
-    inputDim[i] = msg.inputTrajectory[i].value.size();
+    stateDim[i] = stateDataPtrArray[i]->size();
+    inputDim[i] = inputDataPtrArray[i]->size();
     primalSolution.timeTrajectory_.emplace_back(msg.timeTrajectory[i]);
     primalSolution.stateTrajectory_.emplace_back(
-        Eigen::Map<const Eigen::VectorXf>(msg.stateTrajectory[i].value.data(), stateDim[i]).cast<scalar_t>());
+        Eigen::Map<const Eigen::VectorXf>(stateDataPtrArray[i]->data(), stateDim[i]).cast<scalar_t>());
     primalSolution.inputTrajectory_.emplace_back(
-        Eigen::Map<const Eigen::VectorXf>(msg.inputTrajectory[i].value.data(), inputDim[i]).cast<scalar_t>());
+        Eigen::Map<const Eigen::VectorXf>(inputDataPtrArray[i]->data(), inputDim[i]).cast<scalar_t>());
   }
 
   primalSolution.postEventIndices_.reserve(msg.postEventIndices.size());
@@ -163,11 +183,6 @@ void MRT_ROS_Interface::readPolicyMsg(const ocs2_msgs::mpc_flattened_controller&
     primalSolution.postEventIndices_.emplace_back(static_cast<size_t>(ind));
   }
 
-  std::vector<std::vector<float> const*> controllerDataPtrArray(N, nullptr);
-  for (int i = 0; i < N; i++) {
-    controllerDataPtrArray[i] = &(msg.data[i].data);
-  }
-
   // instantiate the correct controller
   switch (msg.controllerType) {
     case ocs2_msgs::mpc_flattened_controller::CONTROLLER_FEEDFORWARD: {
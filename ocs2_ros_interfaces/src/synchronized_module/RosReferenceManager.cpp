@@ -63,6 +63,14 @@ void RosReferenceManager::subscribe(ros::NodeHandle& nodeHandle) {
   };
   targetTrajectoriesSubscriber_ =
       nodeHandle.subscribe<ocs2_msgs::mpc_target_trajectories>(topicPrefix_ + "_mpc_target", 1, targetTrajectoriesCallback);
+
+  // Appended TargetTrajectories
+  auto appendedTargetTrajectoriesCallback = [this](const ocs2_msgs::mpc_target_trajectories::ConstPtr& msg) {
+    const auto targetTrajectories = ros_msg_conversions::readTargetTrajectoriesMsg(*msg);
+    referenceManagerPtr_->appendTargetTrajectories(targetTrajectories);
+  };
+  appendedTargetTrajectoriesSubscriber_ = nodeHandle.subscribe<ocs2_msgs::mpc_target_trajectories>(
+      topicPrefix_ + "_mpc_target_append", 10, appendedTargetTrajectoriesCallback);
 }
 
 }  // namespace ocs2
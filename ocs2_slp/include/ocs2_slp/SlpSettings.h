@@ -73,6 +73,8 @@ struct Settings {
   // Threading
   size_t nThreads = 4;
   int threadPriority = 50;
+  bool nodePartitioning = false;             // Pin contiguous ranges of time nodes to fixed workers instead of dynamic scheduling
+  scalar_t nodePartitionImbalanceTol = 0.2;  // Rebalance the node ranges if the slowest worker exceeds the average by this fraction
 
   // LP subproblem solver settings
   pipg::Settings pipgSettings = pipg::Settings();
@@ -34,6 +34,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ocs2_core/misc/Benchmark.h>
 #include <ocs2_core/thread_support/ThreadPool.h>
 
+#include <ocs2_oc/multiple_shooting/NodePartition.h>
 #include <ocs2_oc/multiple_shooting/ProjectionMultiplierCoefficients.h>
 #include <ocs2_oc/oc_data/TimeDiscretization.h>
 #include <ocs2_oc/oc_problem/OptimalControlProblem.h>
@@ -115,6 +116,12 @@ class SlpSolver : public SolverBase {
   /** Run a task in parallel with settings.nThreads */
   void runParallel(std::function<void(int)> taskFunction);
 
+  /**
+   * Run a task for each time node in [0, numNodes) in parallel with settings.nThreads. The node task takes the worker index and the
+   * node index. If settings.nodePartitioning is set, each worker processes a fixed range of nodes.
+   */
+  void runParallelOverNodes(int numNodes, const std::function<void(int, int)>& nodeTask, bool measureCost);
+
   /** Get profiling information as a string */
   std::string getBenchmarkingInformation() const;
 
@@ -160,6 +167,7 @@ class SlpSolver : public SolverBase {
 
   // Threading
   ThreadPool threadPool_;
+  multiple_shooting::NodePartition nodePartition_;
 
   // Solution
   PrimalSolution primalSolution_;
@@ -42,6 +42,14 @@ struct Settings {
   scalar_t relativeTolerance = 1e-2;
   /** Number of iterations between consecutive calculation of termination conditions. **/
   size_t checkTerminationInterval = 1;
+  /**
+   * If true, each thread updates a fixed block of stages over all the iterations and the threads are synchronized with a spin
+   * barrier. Otherwise, the stages are dispatched dynamically in every iteration. The persistent workers have a lower
+   * synchronization overhead, but they keep the threads of the pool busy-waiting during the solve. The workers are the calling
+   * thread and the threads of the pool which are available at the start of the solve, hence the pool should not be larger than
+   * the number of cores.
+   */
+  bool persistentWorkers = false;
   /** The static lower bound of the cost hessian H. **/
   scalar_t lowerBoundH = 5e-6;
   /** This value determines to display the a summary log. */
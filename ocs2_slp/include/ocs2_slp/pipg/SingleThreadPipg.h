@@ -30,6 +30,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <Eigen/Sparse>
 
 #include <ocs2_core/misc/Benchmark.h>
+#include <ocs2_oc/oc_problem/BlockBandedKkt.h>
 #include <ocs2_oc/oc_problem/OcpSize.h>
 
 #include "ocs2_slp/pipg/PipgBounds.h"
@@ -83,5 +84,14 @@ SolverStatus singleThreadPipg(const pipg::Settings& settings, const Eigen::Spars
                               const Eigen::SparseMatrix<scalar_t>& G, const vector_t& g, const vector_t& EInv, const PipgBounds& pipgBounds,
                               vector_t& stackedSolution);
 
+/**
+ * Same as the above method, but H and G are given in the block-banded format. The mat-vec products then run as dense per-stage block
+ * products instead of generic sparse products. For constructing H and G, refer to getCostMatrixBlockBanded and
+ * getConstraintMatrixBlockBanded in "ocs2_oc/oc_problem/OcpToKkt.h".
+ */
+SolverStatus singleThreadPipg(const pipg::Settings& settings, const BlockBandedCostMatrix& H, const vector_t& h,
+                              const BlockBandedConstraintMatrix& G, const vector_t& g, const vector_t& EInv, const PipgBounds& pipgBounds,
+                              vector_t& stackedSolution);
+
 }  // namespace pipg
 }  // namespace ocs2
@@ -72,6 +72,8 @@ Settings loadSettings(const std::string& filename, const std::string& fieldName,
   loadData::loadPtreeValue(pt, settings.printLinesearch, fieldName + ".printLinesearch", verbose);
   loadData::loadPtreeValue(pt, settings.nThreads, fieldName + ".nThreads", verbose);
   loadData::loadPtreeValue(pt, settings.threadPriority, fieldName + ".threadPriority", verbose);
+  loadData::loadPtreeValue(pt, settings.nodePartitioning, fieldName + ".nodePartitioning", verbose);
+  loadData::loadPtreeValue(pt, settings.nodePartitionImbalanceTol, fieldName + ".nodePartitionImbalanceTol", verbose);
   settings.pipgSettings = pipg::loadSettings(filename, fieldName + ".pipg", verbose);
 
   if (verbose) {
@@ -48,10 +48,16 @@ namespace ocs2 {
 SlpSolver::SlpSolver(slp::Settings settings, const OptimalControlProblem& optimalControlProblem, const Initializer& initializer)
     : settings_(std::move(settings)),
       pipgSolver_(settings_.pipgSettings),
-      threadPool_(std::max(settings_.nThreads - 1, size_t(1)) - 1, settings_.threadPriority) {
+      threadPool_(std::max(settings_.nThreads - 1, size_t(1)) - 1, settings_.threadPriority),
+      nodePartition_(settings_.nThreads, settings_.nodePartitionImbalanceTol) {
   Eigen::setNbThreads(1);  // No multithreading within Eigen.
   Eigen::initParallel();
 
+  if (!optimalControlProblem.stateBoxConstraintPtr->empty() || !optimalControlProblem.inputBoxConstraintPtr->empty() ||
+      !optimalControlProblem.finalStateBoxConstraintPtr->empty()) {
+    throw std::runtime_error("[SlpSolver] Box constraints are not supported, use the SQP solver or inequality constraints instead!");
+  }
+
   // Dynamics discretization
   discretizer_ = selectDynamicsDiscretization(settings_.integratorType);
   sensitivityDiscretizer_ = selectDynamicsSensitivityDiscretization(settings_.integratorType);
@@ -236,6 +242,20 @@ void SlpSolver::runParallel(std::function<void(int)> taskFunction) {
   threadPool_.runParallel(std::move(taskFunction), settings_.nThreads);
 }
 
+void SlpSolver::runParallelOverNodes(int numNodes, const std::function<void(int, int)>& nodeTask, bool measureCost) {
+  if (settings_.nodePartitioning) {
+    nodePartition_.run(threadPool_, numNodes, nodeTask, measureCost);
+  } else {
+    std::atomic_int nodeIndex{0};
+    runParallel([&](int workerId) {
+      int i;
+      while ((i = nodeIndex++) < numNodes) {
+        nodeTask(workerId, i);
+      }
+    });
+  }
+}
+
 SlpSolver::OcpSubproblemSolution SlpSolver::getOCPSolution(const vector_t& delta_x0) {
   // Solve the QP
   OcpSubproblemSolution solution;
@@ -313,59 +333,49 @@ PerformanceIndex SlpSolver::setupQuadraticSubproblem(const std::vector<Annotated
   projectionMultiplierCoefficients_.resize(N);
   metrics.resize(N + 1);
 
-  std::atomic_int timeIndex{0};
-  auto parallelTask = [&](int workerId) {
+  auto nodeTask = [&](int workerId, int i) {
     // Get worker specific resources
     OptimalControlProblem& ocpDefinition = ocpDefinitions_[workerId];
-    PerformanceIndex workerPerformance;  // Accumulate performance in local variable
-
-    int i = timeIndex++;
-    while (i < N) {
-      if (time[i].event == AnnotatedTime::Event::PreEvent) {
-        // Event node
-        auto result = multiple_shooting::setupEventNode(ocpDefinition, time[i].time, x[i], x[i + 1]);
-        metrics[i] = multiple_shooting::computeMetrics(result);
-        workerPerformance += multiple_shooting::computePerformanceIndex(result);
-        cost_[i] = std::move(result.cost);
-        dynamics_[i] = std::move(result.dynamics);
-        stateInputEqConstraints_[i].resize(0, x[i].size());
-        stateIneqConstraints_[i] = std::move(result.ineqConstraints);
-        stateInputIneqConstraints_[i].resize(0, x[i].size());
-        constraintsProjection_[i].resize(0, x[i].size());
-        projectionMultiplierCoefficients_[i] = multiple_shooting::ProjectionMultiplierCoefficients();
-      } else {
-        // Normal, intermediate node
-        const scalar_t ti = getIntervalStart(time[i]);
-        const scalar_t dt = getIntervalDuration(time[i], time[i + 1]);
-        auto result = multiple_shooting::setupIntermediateNode(ocpDefinition, sensitivityDiscretizer_, ti, dt, x[i], x[i + 1], u[i]);
-        metrics[i] = multiple_shooting::computeMetrics(result);
-        workerPerformance += multiple_shooting::computePerformanceIndex(result, dt);
-        multiple_shooting::projectTranscription(result, settings_.extractProjectionMultiplier);
-        cost_[i] = std::move(result.cost);
-        dynamics_[i] = std::move(result.dynamics);
-        stateInputEqConstraints_[i] = std::move(result.stateInputEqConstraints);
-        stateIneqConstraints_[i] = std::move(result.stateIneqConstraints);
-        stateInputIneqConstraints_[i] = std::move(result.stateInputIneqConstraints);
-        constraintsProjection_[i] = std::move(result.constraintsProjection);
-        projectionMultiplierCoefficients_[i] = std::move(result.projectionMultiplierCoefficients);
-      }
+    PerformanceIndex& workerPerformance = performance[workerId];
 
-      i = timeIndex++;
-    }
-
-    if (i == N) {  // Only one worker will execute this
+    if (i == N) {
+      // Terminal node
       const scalar_t tN = getIntervalStart(time[N]);
       auto result = multiple_shooting::setupTerminalNode(ocpDefinition, tN, x[N]);
       metrics[i] = multiple_shooting::computeMetrics(result);
       workerPerformance += multiple_shooting::computePerformanceIndex(result);
       cost_[i] = std::move(result.cost);
       stateIneqConstraints_[i] = std::move(result.ineqConstraints);
+    } else if (time[i].event == AnnotatedTime::Event::PreEvent) {
+      // Event node
+      auto result = multiple_shooting::setupEventNode(ocpDefinition, time[i].time, x[i], x[i + 1]);
+      metrics[i] = multiple_shooting::computeMetrics(result);
+      workerPerformance += multiple_shooting::computePerformanceIndex(result);
+      cost_[i] = std::move(result.cost);
+      dynamics_[i] = std::move(result.dynamics);
+      stateInputEqConstraints_[i].resize(0, x[i].size());
+      stateIneqConstraints_[i] = std::move(result.ineqConstraints);
+      stateInputIneqConstraints_[i].resize(0, x[i].size());
+      constraintsProjection_[i].resize(0, x[i].size());
+      projectionMultiplierCoefficients_[i] = multiple_shooting::ProjectionMultiplierCoefficients();
+    } else {
+      // Normal, intermediate node
+      const scalar_t ti = getIntervalStart(time[i]);
+      const scalar_t dt = getIntervalDuration(time[i], time[i + 1]);
+      auto result = multiple_shooting::setupIntermediateNode(ocpDefinition, sensitivityDiscretizer_, ti, dt, x[i], x[i + 1], u[i]);
+      metrics[i] = multiple_shooting::computeMetrics(result);
+      workerPerformance += multiple_shooting::computePerformanceIndex(result, dt);
+      multiple_shooting::projectTranscription(result, settings_.extractProjectionMultiplier);
+      cost_[i] = std::move(result.cost);
+      dynamics_[i] = std::move(result.dynamics);
+      stateInputEqConstraints_[i] = std::move(result.stateInputEqConstraints);
+      stateIneqConstraints_[i] = std::move(result.stateIneqConstraints);
+      stateInputIneqConstraints_[i] = std::move(result.stateInputIneqConstraints);
+      constraintsProjection_[i] = std::move(result.constraintsProjection);
+      projectionMultiplierCoefficients_[i] = std::move(result.projectionMultiplierCoefficients);
     }
-
-    // Accumulate! Same worker might run multiple tasks
-    performance[workerId] += workerPerformance;
   };
-  runParallel(std::move(parallelTask));
+  runParallelOverNodes(N + 1, nodeTask, true);
 
   // Account for init state in performance
   performance.front().dynamicsViolationSSE += (initState - x.front()).squaredNorm();
@@ -384,35 +394,28 @@ PerformanceIndex SlpSolver::computePerformance(const std::vector<AnnotatedTime>&
   metrics.resize(N + 1);
 
   std::vector<PerformanceIndex> performance(settings_.nThreads, PerformanceIndex());
-  std::atomic_int timeIndex{0};
-  auto parallelTask = [&](int workerId) {
+  auto nodeTask = [&](int workerId, int i) {
     // Get worker specific resources
     OptimalControlProblem& ocpDefinition = ocpDefinitions_[workerId];
 
-    int i = timeIndex++;
-    while (i < N) {
-      if (time[i].event == AnnotatedTime::Event::PreEvent) {
-        // Event node
-        metrics[i] = multiple_shooting::computeEventMetrics(ocpDefinition, time[i].time, x[i], x[i + 1]);
-        performance[workerId] += toPerformanceIndex(metrics[i]);
-      } else {
-        // Normal, intermediate node
-        const scalar_t ti = getIntervalStart(time[i]);
-        const scalar_t dt = getIntervalDuration(time[i], time[i + 1]);
-        metrics[i] = multiple_shooting::computeIntermediateMetrics(ocpDefinition, discretizer_, ti, dt, x[i], x[i + 1], u[i]);
-        performance[workerId] += toPerformanceIndex(metrics[i], dt);
-      }
-
-      i = timeIndex++;
-    }
-
-    if (i == N) {  // Only one worker will execute this
+    if (i == N) {
+      // Terminal node
       const scalar_t tN = getIntervalStart(time[N]);
       metrics[N] = multiple_shooting::computeTerminalMetrics(ocpDefinition, tN, x[N]);
       performance[workerId] += toPerformanceIndex(metrics[N]);
+    } else if (time[i].event == AnnotatedTime::Event::PreEvent) {
+      // Event node
+      metrics[i] = multiple_shooting::computeEventMetrics(ocpDefinition, time[i].time, x[i], x[i + 1]);
+      performance[workerId] += toPerformanceIndex(metrics[i]);
+    } else {
+      // Normal, intermediate node
+      const scalar_t ti = getIntervalStart(time[i]);
+      const scalar_t dt = getIntervalDuration(time[i], time[i + 1]);
+      metrics[i] = multiple_shooting::computeIntermediateMetrics(ocpDefinition, discretizer_, ti, dt, x[i], x[i + 1], u[i]);
+      performance[workerId] += toPerformanceIndex(metrics[i], dt);
     }
   };
-  runParallel(std::move(parallelTask));
+  runParallelOverNodes(N + 1, nodeTask, false);
 
   // Account for initial state in performance
   const vector_t initDynamicsViolation = initState - x.front();
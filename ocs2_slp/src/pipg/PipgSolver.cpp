@@ -29,10 +29,15 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "ocs2_slp/pipg/PipgSolver.h"
 
+#include <algorithm>
+#include <chrono>
 #include <condition_variable>
 #include <iostream>
 #include <mutex>
 #include <numeric>
+#include <thread>
+
+#include <ocs2_core/thread_support/SpinBarrier.h>
 
 namespace ocs2 {
 
@@ -71,164 +76,241 @@ pipg::SolverStatus PipgSolver::solve(ThreadPool& threadPool, const vector_t& x0,
   scalar_array_t solutionSEArray(N);
   scalar_array_t solutionSquaredNormArray(N);
 
-  // initial state
-  X_[0] = x0;
-  XNew_[0] = x0;
-  // cold start
-  for (int t = 0; t < N; t++) {
-    X_[t + 1].setZero(dynamics[t].dfdx.rows());
-    U_[t].setZero(dynamics[t].dfdu.cols());
-    W_[t].setZero(dynamics[t].dfdx.rows());
-    // WNew_ will NOT be filled, but will be swapped to W_ in iteration 0. Thus, initialize WNew_ here.
-    WNew_[t].setZero(dynamics[t].dfdx.rows());
-  }
-
   scalar_t alpha = pipgBounds.primalStepSize(0);
   scalar_t beta = pipgBounds.primalStepSize(0);
   scalar_t betaLast = 0;
 
   size_t k = 0;
-  std::atomic_int timeIndex{1}, finishedTaskCounter{0};
-  std::atomic_bool keepRunning{true}, shouldWait{true};
+  std::atomic_bool keepRunning{true};
   bool isConverged = false;
-
-  std::mutex mux;
-  std::condition_variable iterationFinished;
   std::vector<int> threadsWorkloadCounter(threadPool.numThreads() + 1U, 0);
 
-  auto updateVariablesTask = [&](int workerId) {
-    int t;
-    int workerOrder;
-
-    while (keepRunning) {
-      // Reset workerOrder in case all tasks have been assigned and some workers cannot enter the following while loop, keeping the
-      // workerOrder from previous iterations.
-      workerOrder = 0;
-      while ((t = timeIndex++) <= N) {
-        if (t == N) {
-          std::lock_guard<std::mutex> lk(mux);
-          shouldWait = true;
-        }
-        // Multi-thread performance analysis
-        ++threadsWorkloadCounter[workerId];
-
-        // PIPG algorithm
-        const auto& A = dynamics[t - 1].dfdx;
-        const auto& B = dynamics[t - 1].dfdu;
-        const auto& C = scalingVectors[t - 1];
-        const auto& b = dynamics[t - 1].f;
-
-        const auto& R = cost[t - 1].dfduu;
-        const auto& Q = cost[t].dfdxx;
-        const auto& P = cost[t - 1].dfdux;
-        const auto& q = cost[t].dfdx;
-        const auto& r = cost[t - 1].dfdu;
-
-        if (k != 0) {
-          // Update W of the iteration k - 1. Move the update of W to the front of the calculation of V to prevent data race.
-          // vector_t primalResidual = C * X_[t] - A * X_[t - 1] - B * U_[t - 1] - b;
-          primalResidualArray[t - 1] = -b;
-          primalResidualArray[t - 1].array() += C.array() * X_[t].array();
-          primalResidualArray[t - 1].noalias() -= A * X_[t - 1];
-          primalResidualArray[t - 1].noalias() -= B * U_[t - 1];
-          if (EInv != nullptr) {
-            constraintsViolationInfNormArray[t - 1] = (*EInv)[t - 1].cwiseProduct(primalResidualArray[t - 1]).lpNorm<Eigen::Infinity>();
-          } else {
-            constraintsViolationInfNormArray[t - 1] = primalResidualArray[t - 1].lpNorm<Eigen::Infinity>();
-          }
+  // initial state
+  X_[0] = x0;
+  XNew_[0] = x0;
+  // cold start of the stages in [firstStage, lastStage)
+  auto coldStart = [&](int firstStage, int lastStage) {
+    for (int t = firstStage; t < lastStage; t++) {
+      X_[t].setZero(dynamics[t - 1].dfdx.rows());
+      U_[t - 1].setZero(dynamics[t - 1].dfdu.cols());
+      W_[t - 1].setZero(dynamics[t - 1].dfdx.rows());
+      // WNew_ will NOT be filled, but will be swapped to W_ in iteration 0. Thus, initialize WNew_ here.
+      WNew_[t - 1].setZero(dynamics[t - 1].dfdx.rows());
+    }
+  };
 
-          WNew_[t - 1] = W_[t - 1] + betaLast * primalResidualArray[t - 1];
+  // PIPG algorithm for the stage t in iteration k. It only writes the variables of the stage t.
+  auto updateStage = [&](int t) {
+    const auto& A = dynamics[t - 1].dfdx;
+    const auto& B = dynamics[t - 1].dfdu;
+    const auto& C = scalingVectors[t - 1];
+    const auto& b = dynamics[t - 1].f;
+
+    const auto& R = cost[t - 1].dfduu;
+    const auto& Q = cost[t].dfdxx;
+    const auto& P = cost[t - 1].dfdux;
+    const auto& q = cost[t].dfdx;
+    const auto& r = cost[t - 1].dfdu;
+
+    if (k != 0) {
+      // Update W of the iteration k - 1. Move the update of W to the front of the calculation of V to prevent data race.
+      // vector_t primalResidual = C * X_[t] - A * X_[t - 1] - B * U_[t - 1] - b;
+      primalResidualArray[t - 1] = -b;
+      primalResidualArray[t - 1].array() += C.array() * X_[t].array();
+      primalResidualArray[t - 1].noalias() -= A * X_[t - 1];
+      primalResidualArray[t - 1].noalias() -= B * U_[t - 1];
+      if (EInv != nullptr) {
+        constraintsViolationInfNormArray[t - 1] = (*EInv)[t - 1].cwiseProduct(primalResidualArray[t - 1]).lpNorm<Eigen::Infinity>();
+      } else {
+        constraintsViolationInfNormArray[t - 1] = primalResidualArray[t - 1].lpNorm<Eigen::Infinity>();
+      }
 
-          // What stored in UNew and XNew is the solution of iteration k - 2 and what stored in U and X is the solution of iteration k
-          // - 1. By convention, iteration starts from 0 and the solution of iteration -1 is the initial value. Reuse UNew and XNew
-          // memory to store the difference between the last solution and the one before last solution.
-          UNew_[t - 1] -= U_[t - 1];
-          XNew_[t] -= X_[t];
+      WNew_[t - 1] = W_[t - 1] + betaLast * primalResidualArray[t - 1];
 
-          solutionSEArray[t - 1] = UNew_[t - 1].squaredNorm() + XNew_[t].squaredNorm();
-          solutionSquaredNormArray[t - 1] = U_[t - 1].squaredNorm() + X_[t].squaredNorm();
-        }
+      // What stored in UNew and XNew is the solution of iteration k - 2 and what stored in U and X is the solution of iteration k
+      // - 1. By convention, iteration starts from 0 and the solution of iteration -1 is the initial value. Reuse UNew and XNew
+      // memory to store the difference between the last solution and the one before last solution.
+      UNew_[t - 1] -= U_[t - 1];
+      XNew_[t] -= X_[t];
 
-        // V_[t - 1] = W_[t - 1] + (beta + betaLast) * (C * X_[t] - A * X_[t - 1] - B * U_[t - 1] - b);
-        V_[t - 1] = W_[t - 1] - (beta + betaLast) * b;
-        V_[t - 1].array() += (beta + betaLast) * C.array() * X_[t].array();
-        V_[t - 1].noalias() -= (beta + betaLast) * (A * X_[t - 1]);
-        V_[t - 1].noalias() -= (beta + betaLast) * (B * U_[t - 1]);
-
-        // UNew_[t - 1] = U_[t - 1] - alpha * (R * U_[t - 1] + P * X_[t - 1] + r - B.transpose() * V_[t - 1]);
-        UNew_[t - 1] = U_[t - 1] - alpha * r;
-        UNew_[t - 1].noalias() -= alpha * (R * U_[t - 1]);
-        UNew_[t - 1].noalias() -= alpha * (P * X_[t - 1]);
-        UNew_[t - 1].noalias() += alpha * (B.transpose() * V_[t - 1]);
-
-        // XNew_[t] = X_[t] - alpha * (Q * X_[t] + q + C * V_[t - 1]);
-        XNew_[t] = X_[t] - alpha * q;
-        XNew_[t].array() -= alpha * C.array() * V_[t - 1].array();
-        XNew_[t].noalias() -= alpha * (Q * X_[t]);
-
-        if (t != N) {
-          const auto& ANext = dynamics[t].dfdx;
-          const auto& BNext = dynamics[t].dfdu;
-          const auto& CNext = scalingVectors[t];
-          const auto& bNext = dynamics[t].f;
-
-          // dfdux
-          const auto& PNext = cost[t].dfdux;
-
-          // vector_t VNext = W_[t] + (beta + betaLast) * (CNext * X_[t + 1] - ANext * X_[t] - BNext * U_[t] - bNext);
-          vector_t VNext = W_[t] - (beta + betaLast) * bNext;
-          VNext.array() += (beta + betaLast) * CNext.array() * X_[t + 1].array();
-          VNext.noalias() -= (beta + betaLast) * (ANext * X_[t]);
-          VNext.noalias() -= (beta + betaLast) * (BNext * U_[t]);
-
-          XNew_[t].noalias() += alpha * (ANext.transpose() * VNext);
-          // Add dfdxu * du if it is not the final state.
-          XNew_[t].noalias() -= alpha * (PNext.transpose() * U_[t]);
-        }
+      solutionSEArray[t - 1] = UNew_[t - 1].squaredNorm() + XNew_[t].squaredNorm();
+      solutionSquaredNormArray[t - 1] = U_[t - 1].squaredNorm() + X_[t].squaredNorm();
+    }
 
-        workerOrder = ++finishedTaskCounter;
-      }
+    // V_[t - 1] = W_[t - 1] + (beta + betaLast) * (C * X_[t] - A * X_[t - 1] - B * U_[t - 1] - b);
+    V_[t - 1] = W_[t - 1] - (beta + betaLast) * b;
+    V_[t - 1].array() += (beta + betaLast) * C.array() * X_[t].array();
+    V_[t - 1].noalias() -= (beta + betaLast) * (A * X_[t - 1]);
+    V_[t - 1].noalias() -= (beta + betaLast) * (B * U_[t - 1]);
+
+    // UNew_[t - 1] = U_[t - 1] - alpha * (R * U_[t - 1] + P * X_[t - 1] + r - B.transpose() * V_[t - 1]);
+    UNew_[t - 1] = U_[t - 1] - alpha * r;
+    UNew_[t - 1].noalias() -= alpha * (R * U_[t - 1]);
+    UNew_[t - 1].noalias() -= alpha * (P * X_[t - 1]);
+    UNew_[t - 1].noalias() += alpha * (B.transpose() * V_[t - 1]);
+
+    // XNew_[t] = X_[t] - alpha * (Q * X_[t] + q + C * V_[t - 1]);
+    XNew_[t] = X_[t] - alpha * q;
+    XNew_[t].array() -= alpha * C.array() * V_[t - 1].array();
+    XNew_[t].noalias() -= alpha * (Q * X_[t]);
+
+    if (t != N) {
+      const auto& ANext = dynamics[t].dfdx;
+      const auto& BNext = dynamics[t].dfdu;
+      const auto& CNext = scalingVectors[t];
+      const auto& bNext = dynamics[t].f;
+
+      // dfdux
+      const auto& PNext = cost[t].dfdux;
+
+      // vector_t VNext = W_[t] + (beta + betaLast) * (CNext * X_[t + 1] - ANext * X_[t] - BNext * U_[t] - bNext);
+      vector_t VNext = W_[t] - (beta + betaLast) * bNext;
+      VNext.array() += (beta + betaLast) * CNext.array() * X_[t + 1].array();
+      VNext.noalias() -= (beta + betaLast) * (ANext * X_[t]);
+      VNext.noalias() -= (beta + betaLast) * (BNext * U_[t]);
+
+      XNew_[t].noalias() += alpha * (ANext.transpose() * VNext);
+      // Add dfdxu * du if it is not the final state.
+      XNew_[t].noalias() -= alpha * (PNext.transpose() * U_[t]);
+    }
+  };
 
-      if (workerOrder != N) {
-        std::unique_lock<std::mutex> lk(mux);
-        iterationFinished.wait(lk, [&shouldWait] { return !shouldWait; });
-        lk.unlock();
-      } else {
-        betaLast = beta;
-        // Adaptive step size
-        beta = pipgBounds.dualStepSize(k);
-        alpha = pipgBounds.primalStepSize(k);
+  // The termination criteria are evaluated at the end of the iterations where this function returns true.
+  auto isTerminationCheckIteration = [&]() { return k != 0 && k % settings().checkTerminationInterval == 0; };
+
+  // Updates the step sizes, checks the termination and swaps the solution buffers. It should be called by a single thread once all
+  // the stages of iteration k are updated.
+  auto finishIteration = [&]() {
+    betaLast = beta;
+    // Adaptive step size
+    beta = pipgBounds.dualStepSize(k);
+    alpha = pipgBounds.primalStepSize(k);
+
+    if (isTerminationCheckIteration()) {
+      isConverged = constraintsViolationInfNorm <= settings().absoluteTolerance &&
+                    (solutionSSE <= settings().relativeTolerance * settings().relativeTolerance * solutionSquaredNorm ||
+                     solutionSSE <= settings().absoluteTolerance);
+
+      keepRunning = k < settings().maxNumIterations && !isConverged;
+    }
+
+    XNew_.swap(X_);
+    UNew_.swap(U_);
+    WNew_.swap(W_);
+
+    ++k;
+  };
 
-        if (k != 0 && k % settings().checkTerminationInterval == 0) {
-          constraintsViolationInfNorm =
-              *(std::max_element(constraintsViolationInfNormArray.begin(), constraintsViolationInfNormArray.end()));
+  if (settings().persistentWorkers) {
+    // Each worker owns a fixed block of stages for all the iterations. The workers are synchronized by a spin barrier and the last
+    // arriving worker finishes the iteration. The termination criteria are reduced per block, so that the serial part is independent
+    // of the number of stages.
+    // The workers run as a gang, which guarantees that they run concurrently. The gang might be smaller than requested, e.g. if the
+    // workers of the pool are busy, therefore the barrier is created by the first worker once the gang size is known.
+    const int maxNumWorkers = std::min(static_cast<int>(threadPool.numThreads()) + 1, N);
+    std::once_flag barrierFlag;
+    std::unique_ptr<SpinBarrier> barrierPtr;
+    scalar_array_t blockConstraintsViolationInfNorm(maxNumWorkers);
+    scalar_array_t blockSolutionSSE(maxNumWorkers);
+    scalar_array_t blockSolutionSquaredNorm(maxNumWorkers);
+
+    auto persistentWorkerTask = [&](int workerIndex, int numWorkers) {
+      std::call_once(barrierFlag, [&]() { barrierPtr.reset(new SpinBarrier(numWorkers)); });
+      auto& barrier = *barrierPtr;
+      const int firstStage = 1 + workerIndex * N / numWorkers;
+      const int lastStage = 1 + (workerIndex + 1) * N / numWorkers;
+      bool localSense = false;
+
+      // The owner worker initializes the stages such that their memory is allocated close to it.
+      coldStart(firstStage, lastStage);
+      barrier.arriveAndWait(localSense);
+
+      while (keepRunning) {
+        for (int t = firstStage; t < lastStage; t++) {
+          updateStage(t);
+        }
+        threadsWorkloadCounter[workerIndex] += lastStage - firstStage;
+
+        if (isTerminationCheckIteration()) {
+          const int first = firstStage - 1;
+          const int last = lastStage - 1;
+          blockConstraintsViolationInfNorm[workerIndex] =
+              *std::max_element(constraintsViolationInfNormArray.begin() + first, constraintsViolationInfNormArray.begin() + last);
+          blockSolutionSSE[workerIndex] = std::accumulate(solutionSEArray.begin() + first, solutionSEArray.begin() + last, 0.0);
+          blockSolutionSquaredNorm[workerIndex] =
+              std::accumulate(solutionSquaredNormArray.begin() + first, solutionSquaredNormArray.begin() + last, 0.0);
+        }
 
-          solutionSSE = std::accumulate(solutionSEArray.begin(), solutionSEArray.end(), 0.0);
-          solutionSquaredNorm = std::accumulate(solutionSquaredNormArray.begin(), solutionSquaredNormArray.end(), 0.0);
+        barrier.arriveAndWait(localSense, [&]() {
+          if (isTerminationCheckIteration()) {
+            constraintsViolationInfNorm =
+                *std::max_element(blockConstraintsViolationInfNorm.begin(), blockConstraintsViolationInfNorm.begin() + numWorkers);
+            solutionSSE = std::accumulate(blockSolutionSSE.begin(), blockSolutionSSE.begin() + numWorkers, 0.0);
+            solutionSquaredNorm = std::accumulate(blockSolutionSquaredNorm.begin(), blockSolutionSquaredNorm.begin() + numWorkers, 0.0);
+          }
+          finishIteration();
+        });
+      }
+    };
+    // the gang does not wait for the workers which are busy with other tasks, instead their stages are shared by the others
+    constexpr auto maxJoinTime = std::chrono::milliseconds(1);
+    threadPool.runGang(std::move(persistentWorkerTask), maxNumWorkers, maxJoinTime);
+
+  } else {
+    coldStart(1, N + 1);
+
+    std::atomic_int timeIndex{1}, finishedTaskCounter{0};
+    std::atomic_bool shouldWait{true};
+    std::mutex mux;
+    std::condition_variable iterationFinished;
+
+    auto updateVariablesTask = [&](int workerId) {
+      int t;
+      int workerOrder;
+
+      while (keepRunning) {
+        // Reset workerOrder in case all tasks have been assigned and some workers cannot enter the following while loop, keeping the
+        // workerOrder from previous iterations.
+        workerOrder = 0;
+        while ((t = timeIndex++) <= N) {
+          if (t == N) {
+            std::lock_guard<std::mutex> lk(mux);
+            shouldWait = true;
+          }
+          // Multi-thread performance analysis
+          ++threadsWorkloadCounter[workerId];
 
-          isConverged = constraintsViolationInfNorm <= settings().absoluteTolerance &&
-                        (solutionSSE <= settings().relativeTolerance * settings().relativeTolerance * solutionSquaredNorm ||
-                         solutionSSE <= settings().absoluteTolerance);
+          updateStage(t);
 
-          keepRunning = k < settings().maxNumIterations && !isConverged;
+          workerOrder = ++finishedTaskCounter;
         }
 
-        XNew_.swap(X_);
-        UNew_.swap(U_);
-        WNew_.swap(W_);
+        if (workerOrder != N) {
+          std::unique_lock<std::mutex> lk(mux);
+          iterationFinished.wait(lk, [&shouldWait] { return !shouldWait; });
+          lk.unlock();
+        } else {
+          if (isTerminationCheckIteration()) {
+            constraintsViolationInfNorm =
+                *(std::max_element(constraintsViolationInfNormArray.begin(), constraintsViolationInfNormArray.end()));
+
+            solutionSSE = std::accumulate(solutionSEArray.begin(), solutionSEArray.end(), 0.0);
+            solutionSquaredNorm = std::accumulate(solutionSquaredNormArray.begin(), solutionSquaredNormArray.end(), 0.0);
+          }
+          finishIteration();
 
-        ++k;
-        finishedTaskCounter = 0;
-        timeIndex = 1;
-        {
-          std::lock_guard<std::mutex> lk(mux);
-          shouldWait = false;
+          finishedTaskCounter = 0;
+          timeIndex = 1;
+          {
+            std::lock_guard<std::mutex> lk(mux);
+            shouldWait = false;
+          }
+          iterationFinished.notify_all();
         }
-        iterationFinished.notify_all();
       }
-    }
-  };
-  threadPool.runParallel(std::move(updateVariablesTask), threadPool.numThreads() + 1U);
+    };
+    threadPool.runParallel(std::move(updateVariablesTask), threadPool.numThreads() + 1U);
+  }
 
   xTrajectory = X_;
   uTrajectory = U_;
@@ -35,9 +35,34 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 namespace ocs2 {
 namespace pipg {
 
-SolverStatus singleThreadPipg(const pipg::Settings& settings, const Eigen::SparseMatrix<scalar_t>& H, const vector_t& h,
-                              const Eigen::SparseMatrix<scalar_t>& G, const vector_t& g, const vector_t& EInv, const PipgBounds& pipgBounds,
-                              vector_t& stackedSolution) {
+namespace {
+void multiply(const Eigen::SparseMatrix<scalar_t>& A, const vector_t& x, vector_t& y) {
+  y.noalias() = A * x;
+}
+
+void multiply(const BlockBandedConstraintMatrix& A, const vector_t& x, vector_t& y) {
+  A.multiply(x, y);
+}
+
+void subtractProduct(const Eigen::SparseMatrix<scalar_t>& A, const vector_t& x, vector_t& y) {
+  y.noalias() -= A * x;
+}
+
+void subtractProduct(const BlockBandedCostMatrix& A, const vector_t& x, vector_t& y) {
+  A.multiplyAdd(-1.0, x, y);
+}
+
+void subtractTransposeProduct(const Eigen::SparseMatrix<scalar_t>& A, const vector_t& x, vector_t& y) {
+  y.noalias() -= A.transpose() * x;
+}
+
+void subtractTransposeProduct(const BlockBandedConstraintMatrix& A, const vector_t& x, vector_t& y) {
+  A.transposeMultiplyAdd(-1.0, x, y);
+}
+
+template <typename CostMatrix, typename ConstraintMatrix>
+SolverStatus singleThreadPipgImpl(const pipg::Settings& settings, const CostMatrix& H, const vector_t& h, const ConstraintMatrix& G,
+                                  const vector_t& g, const vector_t& EInv, const PipgBounds& pipgBounds, vector_t& stackedSolution) {
   // Cold start
   vector_t z = vector_t::Zero(H.cols());
   vector_t z_old = vector_t::Zero(H.cols());
@@ -45,6 +70,9 @@ SolverStatus singleThreadPipg(const pipg::Settings& settings, const Eigen::Spars
   vector_t v = vector_t::Zero(g.rows());
   vector_t w = vector_t::Zero(g.rows());
   vector_t constraintsViolation(g.rows());
+  // G * z and G * z_old. They are swapped together with the primal iterates, so that G * z is evaluated once per iteration.
+  vector_t Gz = vector_t::Zero(g.rows());
+  vector_t Gz_old = vector_t::Zero(g.rows());
 
   // Iteration number
   size_t k = 0;
@@ -55,28 +83,30 @@ SolverStatus singleThreadPipg(const pipg::Settings& settings, const Eigen::Spars
     const auto alpha = pipgBounds.primalStepSize(k);
 
     z_old.swap(z);
+    Gz_old.swap(Gz);
 
     // v = w + beta * (G * z - g);
     v = -g;
-    v.noalias() += G * z;
+    v += Gz;
     v *= beta;
     v += w;
 
     // z = z_old - alpha * (H * z_old + h + G.transpose() * v);
     z = -h;
-    z.noalias() -= (H * z_old);
-    z.noalias() -= (G.transpose() * v);
+    subtractProduct(H, z_old, z);
+    subtractTransposeProduct(G, v, z);
     z *= alpha;
     z.noalias() += z_old;
 
     // w = w + beta * (G * z - g);
+    multiply(G, z, Gz);
     w -= beta * g;
-    w.noalias() += beta * (G * z);
+    w.noalias() += beta * Gz;
 
     if (k % settings.checkTerminationInterval == 0) {
       const scalar_t zNorm = z.squaredNorm();
 
-      constraintsViolation.noalias() = G * z;
+      constraintsViolation = Gz;
       constraintsViolation -= g;
       constraintsViolation.cwiseProduct(EInv);
       constraintsViolationInfNorm = constraintsViolation.lpNorm<Eigen::Infinity>();
@@ -107,5 +137,19 @@ SolverStatus singleThreadPipg(const pipg::Settings& settings, const Eigen::Spars
   return status;
 }
 
+}  // namespace
+
+SolverStatus singleThreadPipg(const pipg::Settings& settings, const Eigen::SparseMatrix<scalar_t>& H, const vector_t& h,
+                              const Eigen::SparseMatrix<scalar_t>& G, const vector_t& g, const vector_t& EInv, const PipgBounds& pipgBounds,
+                              vector_t& stackedSolution) {
+  return singleThreadPipgImpl(settings, H, h, G, g, EInv, pipgBounds, stackedSolution);
+}
+
+SolverStatus singleThreadPipg(const pipg::Settings& settings, const BlockBandedCostMatrix& H, const vector_t& h,
+                              const BlockBandedConstraintMatrix& G, const vector_t& g, const vector_t& EInv, const PipgBounds& pipgBounds,
+                              vector_t& stackedSolution) {
+  return singleThreadPipgImpl(settings, H, h, G, g, EInv, pipgBounds, stackedSolution);
+}
+
 }  // namespace pipg
 }  // namespace ocs2
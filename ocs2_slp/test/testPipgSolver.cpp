@@ -30,6 +30,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <gtest/gtest.h>
 #include <Eigen/Sparse>
 
+#include <future>
+
 #include <ocs2_oc/oc_problem/OcpToKkt.h>
 #include <ocs2_oc/test/testProblemsGeneration.h>
 #include <ocs2_qp_solver/QpSolver.h>
@@ -49,6 +51,28 @@ ocs2::pipg::Settings configurePipg(size_t maxNumIterations, ocs2::scalar_t absol
   return settings;
 }
 
+namespace {
+/** The iterates of the original single-thread PIPG loop, without the termination check. */
+ocs2::vector_t referencePipgIterate(size_t numIterations, const Eigen::SparseMatrix<ocs2::scalar_t>& H, const ocs2::vector_t& h,
+                                    const Eigen::SparseMatrix<ocs2::scalar_t>& G, const ocs2::vector_t& g,
+                                    const ocs2::pipg::PipgBounds& pipgBounds) {
+  ocs2::vector_t z = ocs2::vector_t::Zero(H.cols());
+  ocs2::vector_t z_old = ocs2::vector_t::Zero(H.cols());
+  ocs2::vector_t v = ocs2::vector_t::Zero(g.rows());
+  ocs2::vector_t w = ocs2::vector_t::Zero(g.rows());
+
+  for (size_t k = 0; k < numIterations; ++k) {
+    const auto beta = pipgBounds.dualStepSize(k);
+    const auto alpha = pipgBounds.primalStepSize(k);
+    z_old.swap(z);
+    v = w + beta * (G * z - g);
+    z = z_old - alpha * (H * z_old + h + G.transpose() * v);
+    w = w + beta * (G * z - g);
+  }
+  return z;
+}
+}  // unnamed namespace
+
 class PIPGSolverTest : public testing::Test {
  protected:
   // x_0, x_1, ... x_{N - 1}, X_{N}
@@ -183,4 +207,125 @@ TEST_F(PIPGSolverTest, correctness) {
   ASSERT_TRUE(std::abs(PIPGConstraintViolation) < solver.settings().absoluteTolerance);
   EXPECT_TRUE(std::abs(QPConstraintViolation - PIPGConstraintViolation) < solver.settings().absoluteTolerance * 10.0);
   EXPECT_TRUE(std::abs(PIPGParallelCConstraintViolation - PIPGConstraintViolation) < solver.settings().absoluteTolerance * 10.0);
-}
\ No newline at end of file
+}
+TEST_F(PIPGSolverTest, persistentWorkers) {
+  Eigen::JacobiSVD<ocs2::matrix_t> svd(costApproximation.dfdxx);
+  ocs2::vector_t s = svd.singularValues();
+  const ocs2::scalar_t lambda = s(0);
+  const ocs2::scalar_t mu = s(svd.rank() - 1);
+  Eigen::JacobiSVD<ocs2::matrix_t> svdGTG(constraintsApproximation.dfdx.transpose() * constraintsApproximation.dfdx);
+  const ocs2::scalar_t sigma = svdGTG.singularValues()(0);
+  const ocs2::pipg::PipgBounds pipgBounds{mu, lambda, sigma};
+
+  const ocs2::vector_array_t scalingVectors(N_, ocs2::vector_t::Ones(nx_));
+
+  // A small pool, such that three workers share the stages independent of the number of cores. With a busy worker, the persistent
+  // workers run on the remaining threads.
+  ocs2::ThreadPool smallThreadPool(2);
+  for (size_t checkTerminationInterval : {1, 7}) {
+    for (bool busyWorker : {false, true}) {
+      auto settings = configurePipg(30000, 1e-10, 1e-3, false);
+      settings.checkTerminationInterval = checkTerminationInterval;
+      ocs2::PipgSolver dynamicSolver(settings);
+      settings.persistentWorkers = true;
+      ocs2::PipgSolver persistentSolver(settings);
+      dynamicSolver.resize(solver.size());
+      persistentSolver.resize(solver.size());
+
+      std::promise<void> release;
+      std::shared_future<void> released = release.get_future().share();
+      std::future<void> blockingTask;
+      if (busyWorker) {
+        blockingTask = smallThreadPool.run([released](int) { released.wait(); });
+      }
+
+      ocs2::vector_array_t X, U, XPersistent, UPersistent;
+      const auto status =
+          dynamicSolver.solve(smallThreadPool, x0, dynamicsArray, costArray, nullptr, scalingVectors, nullptr, pipgBounds, X, U);
+      const auto statusPersistent = persistentSolver.solve(smallThreadPool, x0, dynamicsArray, costArray, nullptr, scalingVectors,
+                                                           nullptr, pipgBounds, XPersistent, UPersistent);
+
+      if (busyWorker) {
+        release.set_value();
+        blockingTask.get();
+      }
+
+      // Both variants run the same iterations, hence the solutions are identical.
+      EXPECT_EQ(status, statusPersistent);
+      ASSERT_EQ(X.size(), XPersistent.size());
+      ASSERT_EQ(U.size(), UPersistent.size());
+      for (size_t i = 0; i < X.size(); i++) {
+        EXPECT_TRUE(X[i].isApprox(XPersistent[i], 1e-12)) << "State mismatch at stage " << i;
+      }
+      for (size_t i = 0; i < U.size(); i++) {
+        EXPECT_TRUE(U[i].isApprox(UPersistent[i], 1e-12)) << "Input mismatch at stage " << i;
+      }
+    }
+  }
+}
+
+TEST_F(PIPGSolverTest, blockBandedSingleThread) {
+  Eigen::JacobiSVD<ocs2::matrix_t> svd(costApproximation.dfdxx);
+  ocs2::vector_t s = svd.singularValues();
+  const ocs2::scalar_t lambda = s(0);
+  const ocs2::scalar_t mu = s(svd.rank() - 1);
+  Eigen::JacobiSVD<ocs2::matrix_t> svdGTG(constraintsApproximation.dfdx.transpose() * constraintsApproximation.dfdx);
+  const ocs2::scalar_t sigma = svdGTG.singularValues()(0);
+  const ocs2::pipg::PipgBounds pipgBounds{mu, lambda, sigma};
+  const auto settings = configurePipg(30000, 1e-10, 1e-3, false);
+  const ocs2::vector_t EInv = ocs2::vector_t::Ones(solver.getNumDynamicsConstraints());
+
+  ocs2::vector_t primalSolutionSparse;
+  const auto statusSparse = ocs2::pipg::singleThreadPipg(settings, costApproximation.dfdxx.sparseView(), costApproximation.dfdx,
+                                                         constraintsApproximation.dfdx.sparseView(), constraintsApproximation.f, EInv,
+                                                         pipgBounds, primalSolutionSparse);
+
+  ocs2::BlockBandedCostMatrix H;
+  ocs2::BlockBandedConstraintMatrix G;
+  ocs2::vector_t h, g;
+  ocs2::getCostMatrixBlockBanded(solver.size(), x0, costArray, H, h);
+  ocs2::getConstraintMatrixBlockBanded(solver.size(), x0, dynamicsArray, nullptr, nullptr, G, g);
+
+  ocs2::vector_t primalSolutionBlockBanded;
+  const auto statusBlockBanded = ocs2::pipg::singleThreadPipg(settings, H, h, G, g, EInv, pipgBounds, primalSolutionBlockBanded);
+
+  EXPECT_EQ(statusSparse, statusBlockBanded);
+  EXPECT_TRUE(primalSolutionBlockBanded.isApprox(primalSolutionSparse, settings.absoluteTolerance * 10.0))
+      << "Inf-norm of (sparse - blockBanded): " << (primalSolutionSparse - primalSolutionBlockBanded).cwiseAbs().maxCoeff();
+}
+
+TEST_F(PIPGSolverTest, iteratesMatchReference) {
+  Eigen::JacobiSVD<ocs2::matrix_t> svd(costApproximation.dfdxx);
+  ocs2::vector_t s = svd.singularValues();
+  const ocs2::scalar_t lambda = s(0);
+  const ocs2::scalar_t mu = s(svd.rank() - 1);
+  Eigen::JacobiSVD<ocs2::matrix_t> svdGTG(constraintsApproximation.dfdx.transpose() * constraintsApproximation.dfdx);
+  const ocs2::scalar_t sigma = svdGTG.singularValues()(0);
+  const ocs2::pipg::PipgBounds pipgBounds{mu, lambda, sigma};
+  const ocs2::vector_t EInv = ocs2::vector_t::Ones(solver.getNumDynamicsConstraints());
+
+  const Eigen::SparseMatrix<ocs2::scalar_t> H = costApproximation.dfdxx.sparseView();
+  const Eigen::SparseMatrix<ocs2::scalar_t> G = constraintsApproximation.dfdx.sparseView();
+
+  ocs2::BlockBandedCostMatrix HBlockBanded;
+  ocs2::BlockBandedConstraintMatrix GBlockBanded;
+  ocs2::vector_t h, g;
+  ocs2::getCostMatrixBlockBanded(solver.size(), x0, costArray, HBlockBanded, h);
+  ocs2::getConstraintMatrixBlockBanded(solver.size(), x0, dynamicsArray, nullptr, nullptr, GBlockBanded, g);
+
+  for (const size_t numIterations : {1, 2, 3, 10, 100}) {
+    // zero tolerances, so that exactly numIterations iterations are run
+    const auto settings = configurePipg(numIterations, 0.0, 0.0, false);
+    const ocs2::vector_t reference =
+        referencePipgIterate(numIterations, H, costApproximation.dfdx, G, constraintsApproximation.f, pipgBounds);
+
+    ocs2::vector_t primalSolutionSparse;
+    std::ignore = ocs2::pipg::singleThreadPipg(settings, H, costApproximation.dfdx, G, constraintsApproximation.f, EInv, pipgBounds,
+                                               primalSolutionSparse);
+    EXPECT_TRUE(primalSolutionSparse.isApprox(reference, 1e-12)) << "numIterations: " << numIterations;
+
+    ocs2::vector_t primalSolutionBlockBanded;
+    std::ignore = ocs2::pipg::singleThreadPipg(settings, HBlockBanded, h, GBlockBanded, g, EInv, pipgBounds, primalSolutionBlockBanded);
+    EXPECT_TRUE(primalSolutionBlockBanded.isApprox(reference, 1e-12)) << "numIterations: " << numIterations;
+  }
+}
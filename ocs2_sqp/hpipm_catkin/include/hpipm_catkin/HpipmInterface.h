@@ -36,6 +36,7 @@ extern "C" {
 }
 
 #include <ocs2_core/Types.h>
+#include <ocs2_core/constraint/BoxConstraint.h>
 #include <ocs2_oc/oc_problem/OcpSize.h>
 
 #include "hpipm_catkin/HpipmInterfaceSettings.h"
@@ -59,12 +60,13 @@ class HpipmInterface {
   /** Destructor */
   ~HpipmInterface();
 
-  /** Resize the problem */
-  void resize(OcpSize ocpSize);
+  /** Resize the problem. Does not allocate memory if the size did not change since the last call. */
+  void resize(const OcpSize& ocpSize);
 
   /**
    * Solves a discrete linear quadratic optimal control problem. The interface needs to be resized to a consistent OcpSize before calling
-   * this function
+   * this function. After a first solve, repeated solves of a problem with the same size do not allocate memory if the given output
+   * trajectories are reused.
    *
    * The problem should be consistently defined in absolute or delta decision variables in x and u.
    *
@@ -86,6 +88,50 @@ class HpipmInterface {
                      std::vector<ScalarFunctionQuadraticApproximation>& cost, std::vector<VectorFunctionLinearApproximation>* constraints,
                      vector_array_t& stateTrajectory, vector_array_t& inputTrajectory, bool verbose = false);
 
+  /**
+   * Solves a discrete linear quadratic optimal control problem with box constraints on the states and inputs. The box constraints are
+   * passed to HPIPM in their native form, soft box constraints are handled with HPIPM's slack variables. The OcpSize given to resize()
+   * must contain the matching number of box constraints and slack variables, see extractBoxConstraintSizes().
+   *
+   * The state box constraint of the initial node is ignored, since the initial state is not a decision variable.
+   *
+   * @param x0 : Initial state (deviation).
+   * @param dynamics : Linearized approximation of the discrete dynamics.
+   * @param cost : Quadratic approximation of the cost.
+   * @param constraints : Linearized approximation of constraints, all constraints are mapped to inequality constraints in HPIPM.
+   * @param stateBoxConstraints : Box constraints on the state (deviation) for all N+1 nodes, nullptr if there are none.
+   * @param inputBoxConstraints : Box constraints on the input (deviation) for the N stages, nullptr if there are none.
+   * @param [out] stateTrajectory : Solution state (deviation) trajectory.
+   * @param [out] inputTrajectory : Solution input (deviation) trajectory.
+   * @param verbose : Prints the HPIPM iteration statistics if true.
+   * @return HPIPM returned with flag hpipm_status.
+   */
+  hpipm_status solve(const vector_t& x0, std::vector<VectorFunctionLinearApproximation>& dynamics,
+                     std::vector<ScalarFunctionQuadraticApproximation>& cost, std::vector<VectorFunctionLinearApproximation>* constraints,
+                     std::vector<BoxConstraintBounds>* stateBoxConstraints, std::vector<BoxConstraintBounds>* inputBoxConstraints,
+                     vector_array_t& stateTrajectory, vector_array_t& inputTrajectory, bool verbose = false);
+
+  /**
+   * Time-shifts the dual solution (pi, lam, t) of the previous solve onto the nodes of the next problem. Each new node takes the solution
+   * of the previous node that is closest in time. The shifted solution is the initial guess of the next solve if warm_start = 2 in the
+   * settings, otherwise this function does nothing. Without a call to this function, the next solve is warm started with the
+   * unshifted solution of the previous solve. The primal deviations (x, u) are always initialized with zero, since the QP is posed around
+   * a new linearization point.
+   *
+   * Nodes for which the previous solution has inconsistent dimensions are initialized as in a cold start. If previousTime does not match
+   * the number of nodes of the previous solution, the next solve is cold started.
+   *
+   * @param previousTime : Time of the nodes of the previously solved problem.
+   * @param time : Time of the nodes of the next problem.
+   */
+  void shiftSolution(const scalar_array_t& previousTime, const scalar_array_t& time);
+
+  /** Discards the solution of the previous solve, such that the next solve is cold started. */
+  void resetInitialGuess();
+
+  /** Returns the number of interior point iterations of the previous solve. */
+  int getNumIterations() const;
+
   /**
    * Return the Riccati cost-to-go for the previously solved problem.
    * Extra information about the initial stage is needed to complete calculation.
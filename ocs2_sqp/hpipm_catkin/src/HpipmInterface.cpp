@@ -29,6 +29,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "hpipm_catkin/HpipmInterface.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include <ocs2_core/misc/LinearAlgebra.h>
 
 extern "C" {
@@ -87,19 +90,23 @@ namespace ocs2 {
 
 class HpipmInterface::Impl {
  public:
-  Impl(OcpSize ocpSize, Settings settings) : settings_(std::move(settings)) { initializeMemory(std::move(ocpSize), true); }
-
-  void initializeMemory(OcpSize ocpSize, bool forceInitialization = false) {
-    // We will remove the initial state from the decision variables before passing the data to HPIPM.
-    // This removes the need for adding constraints to enforce x[0] = x_init
-    ocpSize.numStates[0] = 0;
+  Impl(const OcpSize& ocpSize, Settings settings) : settings_(std::move(settings)) { initializeMemory(ocpSize, true); }
 
-    // Skip memory initialization if problem size didn't change.
-    if (!forceInitialization && ocpSize_ == ocpSize) {
+  void initializeMemory(const OcpSize& ocpSize, bool forceInitialization = false) {
+    // Skip memory initialization if problem size didn't change. Compared against the size as requested by the user, such that no copy is
+    // needed in the common case of a constant problem size.
+    if (!forceInitialization && requestedOcpSize_ == ocpSize) {
       return;
     }
 
-    ocpSize_ = std::move(ocpSize);
+    requestedOcpSize_ = ocpSize;
+    ocpSize_ = ocpSize;
+
+    // We will remove the initial state from the decision variables before passing the data to HPIPM.
+    // This removes the need for adding constraints to enforce x[0] = x_init
+    ocpSize_.numStates[0] = 0;
+    ocpSize_.numStateBoxConstraints[0] = 0;
+    ocpSize_.numStateBoxSlack[0] = 0;
 
     const int dim_size = d_ocp_qp_dim_memsize(ocpSize_.numStages);
     dimMem_.reserve(dim_size);
@@ -126,6 +133,9 @@ class HpipmInterface::Impl {
     const int ipm_size = d_ocp_qp_ipm_ws_memsize(&dim_, &arg_);
     ipmMem_.reserve(ipm_size);
     d_ocp_qp_ipm_ws_create(&dim_, &arg_, &workspace_, ipmMem_.get());
+
+    // Data buffers that are passed to HPIPM in every solve
+    qpData_.resize(ocpSize_);
   }
 
   void applySettings(Settings& settings) {
@@ -145,7 +155,8 @@ class HpipmInterface::Impl {
 
   void verifySizes(const vector_t& x0, std::vector<VectorFunctionLinearApproximation>& dynamics,
                    std::vector<ScalarFunctionQuadraticApproximation>& cost,
-                   std::vector<VectorFunctionLinearApproximation>* constraints) const {
+                   std::vector<VectorFunctionLinearApproximation>* constraints, std::vector<BoxConstraintBounds>* stateBoxConstraints,
+                   std::vector<BoxConstraintBounds>* inputBoxConstraints) const {
     if (dynamics.size() != ocpSize_.numStages) {
       throw std::runtime_error("[HpipmInterface] Inconsistent size of dynamics: " + std::to_string(dynamics.size()) + " with " +
                                std::to_string(ocpSize_.numStages) + " number of stages.");
@@ -160,19 +171,46 @@ class HpipmInterface::Impl {
                                  std::to_string(ocpSize_.numStages + 1) + " nodes.");
       }
     }
+    if (stateBoxConstraints != nullptr && stateBoxConstraints->size() != ocpSize_.numStages + 1) {
+      throw std::runtime_error("[HpipmInterface] Inconsistent size of state box constraints: " +
+                               std::to_string(stateBoxConstraints->size()) + " with " + std::to_string(ocpSize_.numStages + 1) + " nodes.");
+    }
+    if (inputBoxConstraints != nullptr && inputBoxConstraints->size() != ocpSize_.numStages) {
+      throw std::runtime_error("[HpipmInterface] Inconsistent size of input box constraints: " +
+                               std::to_string(inputBoxConstraints->size()) + " with " + std::to_string(ocpSize_.numStages) +
+                               " number of stages.");
+    }
+    for (int k = 1; k < ocpSize_.numStages + 1; k++) {
+      const int numBoxes = (stateBoxConstraints != nullptr) ? (*stateBoxConstraints)[k].size() : 0;
+      const int numSoft = (stateBoxConstraints != nullptr) ? (*stateBoxConstraints)[k].numSoft() : 0;
+      if (numBoxes != ocpSize_.numStateBoxConstraints[k] || numSoft != ocpSize_.numStateBoxSlack[k]) {
+        throw std::runtime_error("[HpipmInterface] Inconsistent size of state box constraints at node " + std::to_string(k));
+      }
+    }
+    for (int k = 0; k < ocpSize_.numStages; k++) {
+      const int numBoxes = (inputBoxConstraints != nullptr) ? (*inputBoxConstraints)[k].size() : 0;
+      const int numSoft = (inputBoxConstraints != nullptr) ? (*inputBoxConstraints)[k].numSoft() : 0;
+      if (numBoxes != ocpSize_.numInputBoxConstraints[k] || numSoft != ocpSize_.numInputBoxSlack[k]) {
+        throw std::runtime_error("[HpipmInterface] Inconsistent size of input box constraints at node " + std::to_string(k));
+      }
+    }
     // TODO: expand with state-input size checks
   }
 
   hpipm_status solve(const vector_t& x0, std::vector<VectorFunctionLinearApproximation>& dynamics,
                      std::vector<ScalarFunctionQuadraticApproximation>& cost, std::vector<VectorFunctionLinearApproximation>* constraints,
+                     std::vector<BoxConstraintBounds>* stateBoxConstraints, std::vector<BoxConstraintBounds>* inputBoxConstraints,
                      vector_array_t& stateTrajectory, vector_array_t& inputTrajectory, bool verbose) {
     const int N = ocpSize_.numStages;
-    verifySizes(x0, dynamics, cost, constraints);
+    verifySizes(x0, dynamics, cost, constraints, stateBoxConstraints, inputBoxConstraints);
+
+    // Clear pointers of a previous solve, stages without data are passed as nullptr
+    qpData_.clearPointers();
 
     // === Dynamics ===
-    std::vector<scalar_t*> AA(N, nullptr);
-    std::vector<scalar_t*> BB(N, nullptr);
-    std::vector<scalar_t*> bb(N, nullptr);
+    auto& AA = qpData_.AA;
+    auto& BB = qpData_.BB;
+    auto& bb = qpData_.bb;
 
     // k = 0. Absorb initial state into dynamics
     // The initial state is removed from the decision variables
@@ -181,7 +219,8 @@ class HpipmInterface::Impl {
     //         = B[0]*u[0] + (b[0] + A[0]*x[0])
     //         = B[0]*u[0] + \tilde{b}[0]
     // numState[0] = 0 --> No need to specify A[0] here
-    vector_t b0 = dynamics[0].f;
+    vector_t& b0 = qpData_.b0;
+    b0 = dynamics[0].f;
     b0.noalias() += dynamics[0].dfdx * x0;
     BB[0] = dynamics[0].dfdu.data();
     bb[0] = b0.data();
@@ -194,16 +233,17 @@ class HpipmInterface::Impl {
     }
 
     // === Costs ===
-    std::vector<scalar_t*> QQ(N + 1, nullptr);
-    std::vector<scalar_t*> RR(N + 1, nullptr);
-    std::vector<scalar_t*> SS(N + 1, nullptr);
-    std::vector<scalar_t*> qq(N + 1, nullptr);
-    std::vector<scalar_t*> rr(N + 1, nullptr);
+    auto& QQ = qpData_.QQ;
+    auto& RR = qpData_.RR;
+    auto& SS = qpData_.SS;
+    auto& qq = qpData_.qq;
+    auto& rr = qpData_.rr;
 
     // k = 0. Elimination of initial state requires cost adaptation
     // numState[0] = 0 --> No need to specify Q[0], S[0], q[0] here
-    vector_t r0 = cost[0].dfdu;
-    r0 += cost[0].dfdux * x0;
+    vector_t& r0 = qpData_.r0;
+    r0 = cost[0].dfdu;
+    r0.noalias() += cost[0].dfdux * x0;
     RR[0] = cost[0].dfduu.data();
     rr[0] = r0.data();
 
@@ -223,15 +263,14 @@ class HpipmInterface::Impl {
     // === Constraints ===
     // for ocs2 --> C*dx + D*du + e = 0
     // for hpipm --> ug >= C*dx + D*du >= lg
-    std::vector<scalar_t*> CC(N + 1, nullptr);
-    std::vector<scalar_t*> DD(N + 1, nullptr);
-    std::vector<scalar_t*> llg(N + 1, nullptr);
-    std::vector<scalar_t*> uug(N + 1, nullptr);
-    std::vector<ocs2::vector_t> boundData;  // Declare at this scope to keep the data alive while HPIPM has the pointers
+    auto& CC = qpData_.CC;
+    auto& DD = qpData_.DD;
+    auto& llg = qpData_.llg;
+    auto& uug = qpData_.uug;
+    auto& boundData = qpData_.boundData;  // Member, to keep the data alive while HPIPM has the pointers
 
     if (constraints != nullptr) {
       auto& constr = *constraints;
-      boundData.resize(N + 1);
 
       // k = 0, eliminate initial state
       // numState[0] = 0 --> No need to specify C[0] here
@@ -263,25 +302,89 @@ class HpipmInterface::Impl {
       }
     }
 
-    // === Unused ===
-    int** hidxbx = nullptr;
-    scalar_t** hlbx = nullptr;
-    scalar_t** hubx = nullptr;
-    int** hidxbu = nullptr;
-    scalar_t** hlbu = nullptr;
-    scalar_t** hubu = nullptr;
-    scalar_t** hZl = nullptr;
-    scalar_t** hZu = nullptr;
-    scalar_t** hzl = nullptr;
-    scalar_t** hzu = nullptr;
-    int** hidxs = nullptr;
-    scalar_t** hlls = nullptr;
-    scalar_t** hlus = nullptr;
+    // === Box constraints ===
+    // for hpipm --> ubu >= du[idxbu] >= lbu, ubx >= dx[idxbx] >= lbx
+    auto& idxbx = qpData_.idxbx;
+    auto& lbx = qpData_.lbx;
+    auto& ubx = qpData_.ubx;
+    auto& idxbu = qpData_.idxbu;
+    auto& lbu = qpData_.lbu;
+    auto& ubu = qpData_.ubu;
+
+    if (inputBoxConstraints != nullptr) {
+      for (int k = 0; k < N; k++) {
+        auto& box = (*inputBoxConstraints)[k];
+        if (box.size() > 0) {
+          idxbu[k] = box.indices.data();
+          lbu[k] = box.lowerBound.data();
+          ubu[k] = box.upperBound.data();
+        }
+      }
+    }
+
+    // k = 0, the initial state is not a decision variable, its box constraint is skipped.
+    if (stateBoxConstraints != nullptr) {
+      for (int k = 1; k < N + 1; k++) {
+        auto& box = (*stateBoxConstraints)[k];
+        if (box.size() > 0) {
+          idxbx[k] = box.indices.data();
+          lbx[k] = box.lowerBound.data();
+          ubx[k] = box.upperBound.data();
+        }
+      }
+    }
+
+    // === Soft box constraints ===
+    // The soft constraints are indexed in the stacked box constraints [bu; bx; g] of each stage. The same penalty is used for the lower
+    // and the upper bound slack, and the slack variables are bounded from below by zero.
+    auto& Zl = qpData_.Zl;
+    auto& Zu = qpData_.Zu;
+    auto& zl = qpData_.zl;
+    auto& zu = qpData_.zu;
+    auto& idxs = qpData_.idxs;
+    auto& lls = qpData_.lls;
+    auto& lus = qpData_.lus;
+
+    for (int k = 0; k < N + 1; k++) {
+      const int numInputSoft = ocpSize_.numInputBoxSlack[k];
+      const int numStateSoft = ocpSize_.numStateBoxSlack[k];
+      if (numInputSoft + numStateSoft > 0) {
+        auto& slackIndices = qpData_.slackIndices[k];
+        auto& slackQuadraticPenalty = qpData_.slackQuadraticPenalty[k];
+        auto& slackLinearPenalty = qpData_.slackLinearPenalty[k];
+        if (numInputSoft > 0) {
+          const auto& box = (*inputBoxConstraints)[k];
+          std::copy(box.softIndices.begin(), box.softIndices.end(), slackIndices.begin());
+          slackQuadraticPenalty.head(numInputSoft) = box.slackQuadraticPenalty;
+          slackLinearPenalty.head(numInputSoft) = box.slackLinearPenalty;
+        }
+        if (numStateSoft > 0) {
+          const auto& box = (*stateBoxConstraints)[k];
+          const int numInputBoxes = ocpSize_.numInputBoxConstraints[k];
+          std::transform(box.softIndices.begin(), box.softIndices.end(), slackIndices.begin() + numInputSoft,
+                         [numInputBoxes](int i) { return numInputBoxes + i; });
+          slackQuadraticPenalty.tail(numStateSoft) = box.slackQuadraticPenalty;
+          slackLinearPenalty.tail(numStateSoft) = box.slackLinearPenalty;
+        }
+        idxs[k] = slackIndices.data();
+        Zl[k] = slackQuadraticPenalty.data();
+        Zu[k] = slackQuadraticPenalty.data();
+        zl[k] = slackLinearPenalty.data();
+        zu[k] = slackLinearPenalty.data();
+        lls[k] = qpData_.slackLowerBound[k].data();
+        lus[k] = qpData_.slackLowerBound[k].data();
+      }
+    }
 
     // === Set and solve ===
-    d_ocp_qp_set_all(AA.data(), BB.data(), bb.data(), QQ.data(), SS.data(), RR.data(), qq.data(), rr.data(), hidxbx, hlbx, hubx, hidxbu,
-                     hlbu, hubu, CC.data(), DD.data(), llg.data(), uug.data(), hZl, hZu, hzl, hzu, hidxs, hlls, hlus, &qp_);
+    d_ocp_qp_set_all(AA.data(), BB.data(), bb.data(), QQ.data(), SS.data(), RR.data(), qq.data(), rr.data(), idxbx.data(), lbx.data(),
+                     ubx.data(), idxbu.data(), lbu.data(), ubu.data(), CC.data(), DD.data(), llg.data(), uug.data(), Zl.data(), Zu.data(),
+                     zl.data(), zu.data(), idxs.data(), lls.data(), lus.data(), &qp_);
+    if (settings_.warm_start > 0) {
+      setInitialGuess();
+    }
     d_ocp_qp_ipm_solve(&qp_, &qpSol_, &arg_, &workspace_);
+    d_ocp_qp_ipm_get_iter(&workspace_, &numIterations_);
 
     if (verbose) {
       printStatus();
@@ -294,13 +397,49 @@ class HpipmInterface::Impl {
       return hpipm_status::NAN_SOL;
     }
 
+    if (settings_.warm_start > 1) {
+      storeSolution(initialGuess_);
+      hasInitialGuess_ = true;
+    }
+
     // Return solver status
     int hpipmStatus = -1;
     d_ocp_qp_ipm_get_status(&workspace_, &hpipmStatus);
     return hpipm_status(hpipmStatus);
   }
 
+  void shiftSolution(const scalar_array_t& previousTime, const scalar_array_t& time) {
+    if (settings_.warm_start < 2 || !hasInitialGuess_) {
+      return;
+    }
+    // The previous solution does not belong to the given time, fall back to a cold start.
+    if (previousTime.size() != initialGuess_.lam.size()) {
+      hasInitialGuess_ = false;
+      return;
+    }
+
+    const int numNodes = time.size();
+    shiftedGuess_.resize(numNodes);
+    for (int k = 0; k < numNodes; k++) {
+      // Closest previous node in time
+      const auto upper = std::lower_bound(previousTime.begin(), previousTime.end(), time[k]);
+      int j = std::distance(previousTime.begin(), upper);
+      if (j == static_cast<int>(previousTime.size()) || (j > 0 && time[k] - previousTime[j - 1] < previousTime[j] - time[k])) {
+        --j;
+      }
+      shiftedGuess_.pi[k] = initialGuess_.pi[j];
+      shiftedGuess_.lam[k] = initialGuess_.lam[j];
+      shiftedGuess_.t[k] = initialGuess_.t[j];
+    }
+    std::swap(initialGuess_, shiftedGuess_);
+  }
+
+  void resetInitialGuess() { hasInitialGuess_ = false; }
+
+  int getNumIterations() const { return numIterations_; }
+
   bool getStateSolution(const vector_t& x0, vector_array_t& stateTrajectory) {
+    // Resizing is a no-op when the given trajectory was already used for a problem of the same size.
     stateTrajectory.resize(ocpSize_.numStages + 1);
     stateTrajectory.front() = x0;
     for (int k = 1; k < (ocpSize_.numStages + 1); ++k) {
@@ -503,8 +642,148 @@ class HpipmInterface::Impl {
   }
 
  private:
+  /**
+   * Pointers to the problem data as passed to HPIPM, and the buffers for data that is modified before passing it to HPIPM. Sized once
+   * for the problem size, such that a solve does not allocate memory.
+   */
+  struct QpData {
+    std::vector<scalar_t*> AA, BB, bb;
+    std::vector<scalar_t*> QQ, RR, SS, qq, rr;
+    std::vector<scalar_t*> CC, DD, llg, uug;
+    std::vector<int*> idxbx, idxbu, idxs;
+    std::vector<scalar_t*> lbx, ubx, lbu, ubu;
+    std::vector<scalar_t*> Zl, Zu, zl, zu, lls, lus;
+    vector_array_t boundData;
+    std::vector<std::vector<int>> slackIndices;
+    vector_array_t slackQuadraticPenalty;
+    vector_array_t slackLinearPenalty;
+    vector_array_t slackLowerBound;
+    vector_t b0;
+    vector_t r0;
+
+    void resize(const OcpSize& ocpSize) {
+      const int N = ocpSize.numStages;
+      for (auto* v : {&AA, &BB, &bb}) {
+        v->resize(N);
+      }
+      for (auto* v : {&QQ, &RR, &SS, &qq, &rr, &CC, &DD, &llg, &uug, &lbx, &ubx, &lbu, &ubu, &Zl, &Zu, &zl, &zu, &lls, &lus}) {
+        v->resize(N + 1);
+      }
+      for (auto* v : {&idxbx, &idxbu, &idxs}) {
+        v->resize(N + 1);
+      }
+      boundData.resize(N + 1);
+      slackIndices.resize(N + 1);
+      slackQuadraticPenalty.resize(N + 1);
+      slackLinearPenalty.resize(N + 1);
+      slackLowerBound.resize(N + 1);
+      for (int k = 0; k < N + 1; k++) {
+        boundData[k].resize(ocpSize.numIneqConstraints[k]);
+        const int numSlack = ocpSize.numInputBoxSlack[k] + ocpSize.numStateBoxSlack[k];
+        slackIndices[k].resize(numSlack);
+        slackQuadraticPenalty[k].resize(numSlack);
+        slackLinearPenalty[k].resize(numSlack);
+        slackLowerBound[k].setZero(numSlack);
+      }
+      if (N > 0) {
+        b0.resize(ocpSize.numStates[1]);
+        r0.resize(ocpSize.numInputs[0]);
+      }
+    }
+
+    void clearPointers() {
+      for (auto* v : {&AA, &BB, &bb, &QQ, &RR, &SS, &qq, &rr, &CC, &DD, &llg, &uug, &lbx, &ubx, &lbu, &ubu, &Zl, &Zu, &zl, &zu, &lls,
+                      &lus}) {
+        std::fill(v->begin(), v->end(), nullptr);
+      }
+      for (auto* v : {&idxbx, &idxbu, &idxs}) {
+        std::fill(v->begin(), v->end(), nullptr);
+      }
+    }
+  };
+
+  /**
+   * Dual part of the HPIPM iterate for each node: the dynamics multiplier pi, and the inequality multiplier lam and slack t of the stacked
+   * inequalities. The primal part is not kept since the QP is posed in deviations from the linearization point, which moves by the
+   * previous solution before the next QP is built.
+   */
+  struct QpIterate {
+    vector_array_t pi, lam, t;
+
+    void resize(int numNodes) {
+      for (auto* v : {&pi, &lam, &t}) {
+        v->resize(numNodes);
+      }
+    }
+  };
+
+  /** Copies the dual solution of the last solve out of HPIPM. */
+  void storeSolution(QpIterate& iterate) {
+    const int N = ocpSize_.numStages;
+    iterate.resize(N + 1);
+    for (int k = 0; k < N + 1; k++) {
+      if (k < N) {
+        iterate.pi[k].resize(ocpSize_.numStates[k + 1]);
+        d_ocp_qp_sol_get_pi(k, &qpSol_, iterate.pi[k].data());
+      } else {
+        iterate.pi[k].resize(0);
+      }
+      iterate.lam[k] = Eigen::Map<const vector_t>(qpSol_.lam[k].pa, qpSol_.lam[k].m);
+      iterate.t[k] = Eigen::Map<const vector_t>(qpSol_.t[k].pa, qpSol_.t[k].m);
+    }
+  }
+
+  /**
+   * Writes the initial guess into the HPIPM solution, which HPIPM uses as starting point when warm_start is enabled. The primal deviations
+   * start at zero, i.e. at the current linearization point. With warm_start = 1, HPIPM initializes the dual variables from the constraint
+   * residuals of this primal guess. With warm_start = 2, the dual variables are set to the stored guess. Nodes without a consistent guess
+   * get zero dynamics multipliers, and lam = t = sqrt(mu0) for the inequalities.
+   */
+  void setInitialGuess() {
+    const int N = ocpSize_.numStages;
+    for (int k = 0; k < N + 1; k++) {
+      Eigen::Map<vector_t> ux(qpSol_.ux[k].pa, qpSol_.ux[k].m);
+      ux.setZero();
+    }
+    if (settings_.warm_start < 2) {
+      return;
+    }
+
+    const int numGuessNodes = hasInitialGuess_ ? initialGuess_.lam.size() : 0;
+    const scalar_t defaultMultiplier = std::sqrt(settings_.mu0);
+    for (int k = 0; k < N + 1; k++) {
+      Eigen::Map<vector_t> lam(qpSol_.lam[k].pa, qpSol_.lam[k].m);
+      Eigen::Map<vector_t> t(qpSol_.t[k].pa, qpSol_.t[k].m);
+
+      const bool hasGuess = k < numGuessNodes;
+      if (hasGuess && initialGuess_.lam[k].size() == lam.size() && initialGuess_.t[k].size() == t.size()) {
+        lam = initialGuess_.lam[k];
+        t = initialGuess_.t[k];
+      } else {
+        lam.setConstant(defaultMultiplier);
+        t.setConstant(defaultMultiplier);
+      }
+      if (k < N) {
+        Eigen::Map<vector_t> pi(qpSol_.pi[k].pa, qpSol_.pi[k].m);
+        if (hasGuess && initialGuess_.pi[k].size() == pi.size()) {
+          pi = initialGuess_.pi[k];
+        } else {
+          pi.setZero();
+        }
+      }
+    }
+  }
+
   Settings settings_;
+  OcpSize requestedOcpSize_;
   OcpSize ocpSize_;
+  QpData qpData_;
+
+  // Warm start
+  QpIterate initialGuess_;
+  QpIterate shiftedGuess_;
+  bool hasInitialGuess_ = false;
+  int numIterations_ = 0;
 
   MemoryBlock dimMem_;
   d_ocp_qp_dim dim_;
@@ -522,20 +801,41 @@ class HpipmInterface::Impl {
   d_ocp_qp_ipm_ws workspace_;
 };
 
-HpipmInterface::HpipmInterface(OcpSize ocpSize, const Settings& settings)
-    : pImpl_(new HpipmInterface::Impl(std::move(ocpSize), settings)) {}
+HpipmInterface::HpipmInterface(OcpSize ocpSize, const Settings& settings) : pImpl_(new HpipmInterface::Impl(ocpSize, settings)) {}
 
 HpipmInterface::~HpipmInterface() = default;
 
-void HpipmInterface::resize(OcpSize ocpSize) {
-  pImpl_->initializeMemory(std::move(ocpSize));
+void HpipmInterface::resize(const OcpSize& ocpSize) {
+  pImpl_->initializeMemory(ocpSize);
 }
 
 hpipm_status HpipmInterface::solve(const vector_t& x0, std::vector<VectorFunctionLinearApproximation>& dynamics,
                                    std::vector<ScalarFunctionQuadraticApproximation>& cost,
                                    std::vector<VectorFunctionLinearApproximation>* constraints, vector_array_t& stateTrajectory,
                                    vector_array_t& inputTrajectory, bool verbose) {
-  return pImpl_->solve(x0, dynamics, cost, constraints, stateTrajectory, inputTrajectory, verbose);
+  return pImpl_->solve(x0, dynamics, cost, constraints, nullptr, nullptr, stateTrajectory, inputTrajectory, verbose);
+}
+
+hpipm_status HpipmInterface::solve(const vector_t& x0, std::vector<VectorFunctionLinearApproximation>& dynamics,
+                                   std::vector<ScalarFunctionQuadraticApproximation>& cost,
+                                   std::vector<VectorFunctionLinearApproximation>* constraints,
+                                   std::vector<BoxConstraintBounds>* stateBoxConstraints,
+                                   std::vector<BoxConstraintBounds>* inputBoxConstraints, vector_array_t& stateTrajectory,
+                                   vector_array_t& inputTrajectory, bool verbose) {
+  return pImpl_->solve(x0, dynamics, cost, constraints, stateBoxConstraints, inputBoxConstraints, stateTrajectory, inputTrajectory,
+                       verbose);
+}
+
+void HpipmInterface::shiftSolution(const scalar_array_t& previousTime, const scalar_array_t& time) {
+  pImpl_->shiftSolution(previousTime, time);
+}
+
+void HpipmInterface::resetInitialGuess() {
+  pImpl_->resetInitialGuess();
+}
+
+int HpipmInterface::getNumIterations() const {
+  return pImpl_->getNumIterations();
 }
 
 std::vector<ScalarFunctionQuadraticApproximation> HpipmInterface::getRiccatiCostToGo(const VectorFunctionLinearApproximation& dynamics0,
@@ -0,0 +1,104 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <ocs2_oc/oc_problem/OcpSize.h>
+#include <ocs2_oc/test/testProblemsGeneration.h>
+
+#include "hpipm_catkin/HpipmInterface.h"
+
+namespace {
+
+/**
+ * Solves a sequence of QPs of 100 stages with 12 states and 6 inputs whose input bounds are active on part of the horizon, as in
+ * consecutive MPC calls. The QPs only differ by their initial state. state.range(0) is the warm_start setting of HPIPM: 0 is a cold start,
+ * 1 starts from zero primal deviations, and 2 additionally starts from the dual solution of the previous QP. The counter "iterations" is
+ * the average number of interior point iterations per QP.
+ */
+void hpipmWarmStart(benchmark::State& state) {
+  constexpr int stateDim = 12;
+  constexpr int inputDim = 6;
+  constexpr int numStages = 100;
+  constexpr int numInitialStates = 10;
+
+  srand(0);
+  std::vector<ocs2::VectorFunctionLinearApproximation> dynamics;
+  std::vector<ocs2::ScalarFunctionQuadraticApproximation> cost;
+  std::vector<ocs2::BoxConstraintBounds> inputBoxConstraints(numStages);
+  for (int k = 0; k < numStages; k++) {
+    dynamics.push_back(ocs2::getRandomDynamics(stateDim, inputDim));
+    dynamics.back().dfdx = ocs2::matrix_t::Identity(stateDim, stateDim) + 0.1 * dynamics.back().dfdx;
+    cost.push_back(ocs2::getRandomCost(stateDim, inputDim));
+    auto& bounds = inputBoxConstraints[k];
+    for (int i = 0; i < inputDim; i++) {
+      bounds.indices.push_back(i);
+    }
+    bounds.lowerBound = ocs2::vector_t::Constant(inputDim, -0.5);
+    bounds.upperBound = ocs2::vector_t::Constant(inputDim, 0.5);
+  }
+  cost.push_back(ocs2::getRandomCost(stateDim, 0));
+
+  // Initial states of consecutive calls
+  const ocs2::vector_t nominalInitialState = ocs2::vector_t::Random(stateDim);
+  std::vector<ocs2::vector_t> initialStates;
+  for (int i = 0; i < numInitialStates; i++) {
+    initialStates.push_back(nominalInitialState + 0.05 * ocs2::vector_t::Random(stateDim));
+  }
+
+  auto ocpSize = ocs2::extractSizesFromProblem(dynamics, cost, nullptr);
+  ocs2::extractBoxConstraintSizes(nullptr, &inputBoxConstraints, ocpSize);
+  ocs2::HpipmInterface::Settings settings;
+  settings.warm_start = state.range(0);
+  ocs2::HpipmInterface hpipmInterface(ocpSize, settings);
+
+  ocs2::vector_array_t stateTrajectory, inputTrajectory;
+  int numSolves = 0;
+  int numIterations = 0;
+  for (auto _ : state) {
+    const auto& x0 = initialStates[numSolves % numInitialStates];
+    const auto status = hpipmInterface.solve(x0, dynamics, cost, nullptr, nullptr, &inputBoxConstraints, stateTrajectory, inputTrajectory);
+    if (status != hpipm_status::SUCCESS) {
+      state.SkipWithError("HPIPM failed to solve the QP");
+      break;
+    }
+    benchmark::DoNotOptimize(inputTrajectory.front().data());
+    numIterations += hpipmInterface.getNumIterations();
+    ++numSolves;
+  }
+  state.counters["iterations"] = benchmark::Counter(numIterations, benchmark::Counter::kAvgIterations);
+}
+
+}  // unnamed namespace
+
+BENCHMARK(hpipmWarmStart)->Arg(0)->Arg(1)->Arg(2)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,104 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+
+#include <gtest/gtest.h>
+
+#include <tuple>
+
+#include "hpipm_catkin/HpipmInterface.h"
+
+#include <ocs2_core/test/AllocationCounter.h>
+#include <ocs2_oc/test/testProblemsGeneration.h>
+
+class HpipmAllocationTest : public testing::Test {
+ protected:
+  static constexpr int nx = 3;
+  static constexpr int nu = 2;
+  static constexpr int nc = 1;
+  static constexpr int N = 10;
+
+  HpipmAllocationTest() : ocpSize(N, nx, nu), x0(ocs2::vector_t::Random(nx)) {
+    for (int k = 0; k < N; k++) {
+      dynamics.emplace_back(ocs2::getRandomDynamics(nx, nu));
+      cost.emplace_back(ocs2::getRandomCost(nx, nu));
+      constraints.emplace_back(ocs2::getRandomConstraints(nx, nu, nc));
+    }
+    cost.emplace_back(ocs2::getRandomCost(nx, 0));
+    constraints.emplace_back(ocs2::getRandomConstraints(nx, 0, nc));
+  }
+
+  ocs2::OcpSize ocpSize;
+  ocs2::vector_t x0;
+  std::vector<ocs2::VectorFunctionLinearApproximation> dynamics;
+  std::vector<ocs2::ScalarFunctionQuadraticApproximation> cost;
+  std::vector<ocs2::VectorFunctionLinearApproximation> constraints;
+};
+
+constexpr int HpipmAllocationTest::nx;
+constexpr int HpipmAllocationTest::nu;
+constexpr int HpipmAllocationTest::nc;
+constexpr int HpipmAllocationTest::N;
+
+TEST_F(HpipmAllocationTest, noAllocationAfterWarmStart) {
+  ocs2::HpipmInterface hpipmInterface(ocpSize);
+  ocs2::vector_array_t xSol;
+  ocs2::vector_array_t uSol;
+
+  // First solve sizes the solution trajectories
+  ASSERT_EQ(hpipmInterface.solve(x0, dynamics, cost, nullptr, xSol, uSol), hpipm_status::SUCCESS);
+
+  size_t numAllocationsPerSolve;
+  {
+    ocs2::AllocationCounter counter;
+    hpipmInterface.resize(ocpSize);
+    std::ignore = hpipmInterface.solve(x0, dynamics, cost, nullptr, xSol, uSol);
+    numAllocationsPerSolve = counter.count();
+  }
+  ASSERT_EQ(numAllocationsPerSolve, 0);
+}
+
+TEST_F(HpipmAllocationTest, noAllocationAfterWarmStartWithConstraints) {
+  std::fill(ocpSize.numIneqConstraints.begin(), ocpSize.numIneqConstraints.end(), nc);
+  ocs2::HpipmInterface hpipmInterface(ocpSize);
+  ocs2::vector_array_t xSol;
+  ocs2::vector_array_t uSol;
+
+  // First solve sizes the solution trajectories
+  ASSERT_EQ(hpipmInterface.solve(x0, dynamics, cost, &constraints, xSol, uSol), hpipm_status::SUCCESS);
+
+  size_t numAllocationsPerSolve;
+  {
+    ocs2::AllocationCounter counter;
+    hpipmInterface.resize(ocpSize);
+    std::ignore = hpipmInterface.solve(x0, dynamics, cost, &constraints, xSol, uSol);
+    numAllocationsPerSolve = counter.count();
+  }
+  ASSERT_EQ(numAllocationsPerSolve, 0);
+}
@@ -151,6 +151,116 @@ TEST(test_hpiphm_interface, knownSolution) {
   ASSERT_TRUE(ocs2::isEqual(uSolGiven, uSol, 1e-9));
 }
 
+TEST(test_hpiphm_interface, warmStart) {
+  int nx = 3;
+  int nu = 2;
+  int nc = 1;
+  int N = 5;
+
+  // Problem setup
+  ocs2::vector_t x0 = ocs2::vector_t::Random(nx);
+  std::vector<ocs2::VectorFunctionLinearApproximation> system;
+  std::vector<ocs2::VectorFunctionLinearApproximation> constraints;
+  std::vector<ocs2::ScalarFunctionQuadraticApproximation> cost;
+  ocs2::scalar_array_t time;
+  for (int k = 0; k < N; k++) {
+    system.emplace_back(ocs2::getRandomDynamics(nx, nu));
+    cost.emplace_back(ocs2::getRandomCost(nx, nu));
+    constraints.emplace_back(ocs2::getRandomConstraints(nx, nu, nc));
+    time.push_back(0.1 * k);
+  }
+  cost.emplace_back(ocs2::getRandomCost(nx, 0));
+  constraints.emplace_back(ocs2::getRandomConstraints(nx, 0, nc));
+  time.push_back(0.1 * N);
+
+  const auto ocpSize = ocs2::extractSizesFromProblem(system, cost, &constraints);
+  ocs2::HpipmInterface coldInterface(ocpSize);
+
+  // Reference solution without warm start
+  std::vector<ocs2::vector_t> xSolCold;
+  std::vector<ocs2::vector_t> uSolCold;
+  ASSERT_EQ(coldInterface.solve(x0, system, cost, &constraints, xSolCold, uSolCold), hpipm_status::SUCCESS);
+
+  // Primal and primal-dual warm start
+  for (int warmStart : {1, 2}) {
+    ocs2::HpipmInterface::Settings settings;
+    settings.warm_start = warmStart;
+    ocs2::HpipmInterface hpipmInterface(ocpSize, settings);
+
+    // Solve from scratch, from the previous solution, from the shifted previous solution, and after a shift with inconsistent time.
+    std::vector<ocs2::vector_t> xSol;
+    std::vector<ocs2::vector_t> uSol;
+    for (int i = 0; i < 4; i++) {
+      if (i == 2) {
+        hpipmInterface.shiftSolution(time, time);
+      } else if (i == 3) {
+        hpipmInterface.shiftSolution({0.0}, time);
+      }
+      ASSERT_EQ(hpipmInterface.solve(x0, system, cost, &constraints, xSol, uSol), hpipm_status::SUCCESS);
+      ASSERT_TRUE(ocs2::isEqual(xSolCold, xSol, 1e-6));
+      ASSERT_TRUE(ocs2::isEqual(uSolCold, uSol, 1e-6));
+    }
+  }
+}
+
+TEST(test_hpiphm_interface, warmStartIterations) {
+  int nx = 3;
+  int nu = 2;
+  int nc = 1;
+  int N = 5;
+
+  // Problem setup
+  ocs2::vector_t x0 = ocs2::vector_t::Random(nx);
+  std::vector<ocs2::VectorFunctionLinearApproximation> system;
+  std::vector<ocs2::VectorFunctionLinearApproximation> constraints;
+  std::vector<ocs2::ScalarFunctionQuadraticApproximation> cost;
+  for (int k = 0; k < N; k++) {
+    system.emplace_back(ocs2::getRandomDynamics(nx, nu));
+    cost.emplace_back(ocs2::getRandomCost(nx, nu));
+    constraints.emplace_back(ocs2::getRandomConstraints(nx, nu, nc));
+  }
+  cost.emplace_back(ocs2::getRandomCost(nx, 0));
+  constraints.emplace_back(ocs2::getRandomConstraints(nx, 0, nc));
+
+  const auto ocpSize = ocs2::extractSizesFromProblem(system, cost, &constraints);
+  ocs2::HpipmInterface::Settings settings;
+  settings.warm_start = 2;
+  ocs2::HpipmInterface hpipmInterface(ocpSize, settings);
+
+  // First solve is a cold start
+  std::vector<ocs2::vector_t> xSol;
+  std::vector<ocs2::vector_t> uSol;
+  ASSERT_EQ(hpipmInterface.solve(x0, system, cost, &constraints, xSol, uSol), hpipm_status::SUCCESS);
+  const int coldIterations = hpipmInterface.getNumIterations();
+
+  // Pose the same problem in deviations from its solution, as the next SQP iteration does. The optimal deviation is zero.
+  for (int k = 0; k < N; k++) {
+    system[k].f += system[k].dfdx * xSol[k] + system[k].dfdu * uSol[k] - xSol[k + 1];
+    constraints[k].f += constraints[k].dfdx * xSol[k] + constraints[k].dfdu * uSol[k];
+    cost[k].dfdx += cost[k].dfdxx * xSol[k] + cost[k].dfdux.transpose() * uSol[k];
+    cost[k].dfdu += cost[k].dfduu * uSol[k] + cost[k].dfdux * xSol[k];
+  }
+  constraints[N].f += constraints[N].dfdx * xSol[N];
+  cost[N].dfdx += cost[N].dfdxx * xSol[N];
+  const ocs2::vector_t dx0 = ocs2::vector_t::Zero(nx);
+
+  // The warm start from the previous dual solution and zero primal deviations needs fewer iterations
+  std::vector<ocs2::vector_t> dxSol;
+  std::vector<ocs2::vector_t> duSol;
+  ASSERT_EQ(hpipmInterface.solve(dx0, system, cost, &constraints, dxSol, duSol), hpipm_status::SUCCESS);
+  EXPECT_LT(hpipmInterface.getNumIterations(), coldIterations);
+  for (int k = 0; k < N; k++) {
+    ASSERT_LT(duSol[k].norm(), 1e-6);
+  }
+
+  // The warm start does not survive a reset
+  hpipmInterface.resetInitialGuess();
+  ocs2::HpipmInterface freshInterface(ocpSize, settings);
+  ASSERT_EQ(freshInterface.solve(dx0, system, cost, &constraints, dxSol, duSol), hpipm_status::SUCCESS);
+  ASSERT_EQ(hpipmInterface.solve(dx0, system, cost, &constraints, dxSol, duSol), hpipm_status::SUCCESS);
+  EXPECT_EQ(hpipmInterface.getNumIterations(), freshInterface.getNumIterations());
+}
+
 TEST(test_hpiphm_interface, with_constraints) {
   // Initialize without size
   ocs2::HpipmInterface hpipmInterface;
@@ -205,6 +315,73 @@ TEST(test_hpiphm_interface, with_constraints) {
   }
 }
 
+TEST(test_hpiphm_interface, with_box_constraints) {
+  int nx = 3;
+  int nu = 2;
+  int N = 5;
+
+  // Problem setup with known unconstrained solution.
+  std::vector<ocs2::vector_t> xSolGiven;
+  std::vector<ocs2::vector_t> uSolGiven;
+  xSolGiven.emplace_back(ocs2::vector_t::Random(nx));
+  std::vector<ocs2::VectorFunctionLinearApproximation> system;
+  std::vector<ocs2::ScalarFunctionQuadraticApproximation> cost;
+  for (int k = 0; k < N; k++) {
+    uSolGiven.emplace_back(ocs2::vector_t::Random(nu));
+    system.emplace_back(ocs2::getRandomDynamics(nx, nu));
+    xSolGiven.emplace_back(system[k].f + system[k].dfdx * xSolGiven[k] + system[k].dfdu * uSolGiven[k]);
+    cost.emplace_back(ocs2::getRandomCost(nx, nu));
+    cost[k].dfdx = -(cost[k].dfdxx * xSolGiven[k] + cost[k].dfdux.transpose() * uSolGiven[k]);
+    cost[k].dfdu = -(cost[k].dfduu * uSolGiven[k] + cost[k].dfdux * xSolGiven[k]);
+  }
+  cost.emplace_back(ocs2::getRandomCost(nx, 0));
+  cost[N].dfdx = -cost[N].dfdxx * xSolGiven[N];
+
+  // Box constraints that are inactive at the solution, the state box at the initial node is ignored.
+  std::vector<ocs2::BoxConstraintBounds> stateBoxes(N + 1);
+  std::vector<ocs2::BoxConstraintBounds> inputBoxes(N);
+  for (int k = 0; k < N + 1; k++) {
+    stateBoxes[k].indices = {0, 2};
+    stateBoxes[k].lowerBound = ocs2::vector_t::Constant(2, -1e3);
+    stateBoxes[k].upperBound = ocs2::vector_t::Constant(2, 1e3);
+    stateBoxes[k].softIndices = {1};
+    stateBoxes[k].slackQuadraticPenalty = ocs2::vector_t::Constant(1, 1e2);
+    stateBoxes[k].slackLinearPenalty = ocs2::vector_t::Zero(1);
+  }
+  for (int k = 0; k < N; k++) {
+    inputBoxes[k].indices = {1};
+    inputBoxes[k].lowerBound = ocs2::vector_t::Constant(1, -1e3);
+    inputBoxes[k].upperBound = ocs2::vector_t::Constant(1, 1e3);
+  }
+
+  auto ocpSize = ocs2::extractSizesFromProblem(system, cost, nullptr);
+  ocs2::extractBoxConstraintSizes(&stateBoxes, &inputBoxes, ocpSize);
+  ocs2::HpipmInterface hpipmInterface(ocpSize);
+
+  std::vector<ocs2::vector_t> xSol;
+  std::vector<ocs2::vector_t> uSol;
+  auto status = hpipmInterface.solve(xSolGiven[0], system, cost, nullptr, &stateBoxes, &inputBoxes, xSol, uSol, true);
+  ASSERT_EQ(status, hpipm_status::SUCCESS);
+  ASSERT_TRUE(ocs2::isEqual(xSolGiven, xSol, 1e-6));
+  ASSERT_TRUE(ocs2::isEqual(uSolGiven, uSol, 1e-6));
+
+  // Tighten the hard input bounds around a point that excludes the unconstrained solution.
+  for (int k = 0; k < N; k++) {
+    inputBoxes[k].lowerBound[0] = uSolGiven[k][1] + 0.1;
+    inputBoxes[k].upperBound[0] = uSolGiven[k][1] + 0.2;
+  }
+  status = hpipmInterface.solve(xSolGiven[0], system, cost, nullptr, &stateBoxes, &inputBoxes, xSol, uSol, true);
+  ASSERT_EQ(status, hpipm_status::SUCCESS);
+
+  // Check dynamic feasibility and bounds
+  ASSERT_TRUE(xSol[0].isApprox(xSolGiven[0]));
+  for (int k = 0; k < N; k++) {
+    ASSERT_TRUE(xSol[k + 1].isApprox(system[k].dfdx * xSol[k] + system[k].dfdu * uSol[k] + system[k].f, 1e-9));
+    ASSERT_GE(uSol[k][1], inputBoxes[k].lowerBound[0] - 1e-6);
+    ASSERT_LE(uSol[k][1], inputBoxes[k].upperBound[0] + 1e-6);
+  }
+}
+
 TEST(test_hpiphm_interface, noInputs) {
   // Initialize without size
   ocs2::HpipmInterface hpipmInterface;
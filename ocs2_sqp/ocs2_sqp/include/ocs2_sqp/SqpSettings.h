@@ -37,12 +37,19 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 namespace ocs2 {
 namespace sqp {
 
+/** Solver of the QP subproblems */
+enum class QpSolverType { HPIPM, PARALLEL_RICCATI };
+
 struct Settings {
   // Sqp settings
   size_t sqpIteration = 10;  // Maximum number of SQP iterations
   scalar_t deltaTol = 1e-6;  // Termination condition : RMS update of x(t) and u(t) are both below this value
   scalar_t costTol = 1e-4;   // Termination condition : (cost{i+1} - (cost{i}) < costTol AND constraints{i+1} < g_min
 
+  // Real-time iteration: one full SQP step per call, split into a preparation phase (SolverBase::prepare) and a feedback phase (run).
+  // The prepared QP uses the target trajectories known at preparation, i.e., reference updates take effect one call later.
+  bool realTimeIteration = false;
+
   // Linesearch - step size rules
   scalar_t alpha_decay = 0.5;  // multiply the step size by this factor every time a linesearch step is rejected.
   scalar_t alpha_min = 1e-4;   // terminate linesearch if the attempted step size is below this threshold
@@ -58,6 +65,7 @@ struct Settings {
   bool createValueFunction = false;  // true to store the value function, false to ignore it
 
   // QP subproblem solver settings
+  QpSolverType qpSolverType = QpSolverType::HPIPM;  // PARALLEL_RICCATI: parallel in time over nThreads, requires a QP without constraints
   hpipm_interface::Settings hpipmSettings = hpipm_interface::Settings();
 
   // Discretization method
@@ -79,8 +87,22 @@ struct Settings {
   // Threading
   size_t nThreads = 4;
   int threadPriority = 50;
+  bool nodePartitioning = false;             // Pin contiguous ranges of time nodes to fixed workers instead of dynamic scheduling
+  scalar_t nodePartitionImbalanceTol = 0.2;  // Rebalance the node ranges if the slowest worker exceeds the average by this fraction
 };
 
+/**
+ * Get string name of the QP solver type
+ * @param qpSolverType: QP solver type enum
+ */
+std::string toString(QpSolverType qpSolverType);
+
+/**
+ * Get the QP solver type from string name, useful for reading config file
+ * @param name: QP solver name
+ */
+QpSolverType fromString(const std::string& name);
+
 /**
  * Loads the multiple shooting SQP settings from a given file.
  *
@@ -34,6 +34,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <ocs2_core/misc/Benchmark.h>
 #include <ocs2_core/thread_support/ThreadPool.h>
 
+#include <ocs2_oc/multiple_shooting/NodePartition.h>
+#include <ocs2_oc/multiple_shooting/ParallelRiccatiSolver.h>
 #include <ocs2_oc/multiple_shooting/ProjectionMultiplierCoefficients.h>
 #include <ocs2_oc/oc_data/TimeDiscretization.h>
 #include <ocs2_oc/oc_problem/OptimalControlProblem.h>
@@ -44,6 +46,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "ocs2_sqp/SqpSettings.h"
 #include "ocs2_sqp/SqpSolverStatus.h"
+#include "ocs2_sqp/SqpWorkspace.h"
 
 namespace ocs2 {
 
@@ -111,9 +114,41 @@ class SqpSolver : public SolverBase {
     runImpl(initTime, initState, finalTime);
   }
 
+  /**
+   * Real-time iteration: prepares the QP of the next call around the solution of the previous call, for the initial state predicted by
+   * that solution. Does nothing if settings.realTimeIteration is false or no solution is available yet.
+   *
+   * The QP is built with the target trajectories and the mode schedule that are known at this point, i.e., before the
+   * SolverSynchronizedModules and the ReferenceManager are updated in the next run(). A changed mode schedule makes run() prepare the QP
+   * again, while updated target trajectories only take effect in the QP of the following call (one-call reference lag).
+   */
+  void prepareImpl(scalar_t initTime, scalar_t finalTime) override;
+
+  /**
+   * Determines the time discretization for the given horizon, taking into account event times. Also updates the references, spreads the
+   * previous solution to the current mode schedule and shifts the HPIPM warm start to the new time discretization.
+   */
+  std::vector<AnnotatedTime> setupTimeDiscretization(scalar_t initTime, scalar_t finalTime);
+
+  /** Real-time iteration, preparation phase: linearizes around the shifted solution and solves the QP for the given initial state. */
+  void prepareRealTimeIteration(scalar_t initTime, scalar_t finalTime, const vector_t& initState);
+
+  /**
+   * Real-time iteration, feedback phase: corrects the prepared QP solution for the deviation of the actual initial state by propagating it
+   * through the QP's Riccati feedback, and takes a full step. The first node of the solution is moved to the actual initial time, which
+   * may differ from the prepared one by less than half a time step and must precede the second node.
+   */
+  void realTimeIterationFeedback(scalar_t initTime, const vector_t& initState);
+
   /** Run a task in parallel with settings.nThreads */
   void runParallel(std::function<void(int)> taskFunction);
 
+  /**
+   * Run a task for each time node in [0, numNodes) in parallel with settings.nThreads. The node task takes the worker index and the
+   * node index. If settings.nodePartitioning is set, each worker processes a fixed range of nodes.
+   */
+  void runParallelOverNodes(int numNodes, const std::function<void(int, int)>& nodeTask, bool measureCost);
+
   /** Get profiling information as a string */
   std::string getBenchmarkingInformation() const;
 
@@ -125,13 +160,12 @@ class SqpSolver : public SolverBase {
   PerformanceIndex computePerformance(const std::vector<AnnotatedTime>& time, const vector_t& initState, const vector_array_t& x,
                                       const vector_array_t& u, std::vector<Metrics>& metrics);
 
-  /** Returns solution of the QP subproblem in delta coordinates: */
-  struct OcpSubproblemSolution {
-    vector_array_t deltaXSol;      // delta_x(t)
-    vector_array_t deltaUSol;      // delta_u(t)
-    scalar_t armijoDescentMetric;  // inner product of the cost gradient and decision variable step
-  };
-  OcpSubproblemSolution getOCPSolution(const vector_t& delta_x0);
+  /** Returns solution of the QP subproblem in delta coordinates. The solution is stored in the workspace. */
+  using OcpSubproblemSolution = SqpWorkspace::OcpSubproblemSolution;
+  const OcpSubproblemSolution& getOCPSolution(const vector_t& delta_x0);
+
+  /** Riccati feedback matrices of the last solved QP, w.r.t. the QP inputs */
+  matrix_array_t getRiccatiFeedback();
 
   /** Extract the value function based on the last solved QP */
   void extractValueFunction(const std::vector<AnnotatedTime>& time, const vector_array_t& x);
@@ -157,9 +191,12 @@ class SqpSolver : public SolverBase {
 
   // Solver interface
   HpipmInterface hpipmInterface_;
+  scalar_array_t qpNodeTimes_;  // node times of the last QP, used to time-shift the HPIPM warm start
+  multiple_shooting::ParallelRiccatiSolver parallelRiccatiSolver_;
 
   // Threading
   ThreadPool threadPool_;
+  multiple_shooting::NodePartition nodePartition_;
 
   // Solution
   PrimalSolution primalSolution_;
@@ -167,16 +204,20 @@ class SqpSolver : public SolverBase {
   // Value function in absolute state coordinates (without the constant value)
   std::vector<ScalarFunctionQuadraticApproximation> valueFunction_;
 
-  // LQ approximation
-  std::vector<ScalarFunctionQuadraticApproximation> cost_;
-  std::vector<VectorFunctionLinearApproximation> dynamics_;
-  std::vector<VectorFunctionLinearApproximation> stateInputEqConstraints_;
-  std::vector<VectorFunctionLinearApproximation> stateIneqConstraints_;
-  std::vector<VectorFunctionLinearApproximation> stateInputIneqConstraints_;
-  std::vector<VectorFunctionLinearApproximation> constraintsProjection_;
-
-  // Lagrange multipliers
-  std::vector<multiple_shooting::ProjectionMultiplierCoefficients> projectionMultiplierCoefficients_;
+  // Memory reused across iterations: LQ approximation, Lagrange multipliers, QP solution, and linesearch buffers
+  SqpWorkspace workspace_;
+  OcpSize trajectorySize_;
+
+  // Real-time iteration: the QP prepared for the next call
+  bool realTimeIterationIsPrepared_ = false;
+  std::vector<AnnotatedTime> realTimeIterationTime_;
+  scalar_array_t realTimeIterationEventTimes_;
+  vector_array_t realTimeIterationX_;
+  vector_array_t realTimeIterationU_;
+  std::vector<Metrics> realTimeIterationMetrics_;
+  PerformanceIndex realTimeIterationPerformance_;
+  matrix_array_t realTimeIterationQpFeedback_;  // Riccati feedback of the QP inputs, which are projected if projection is used
+  matrix_array_t realTimeIterationFeedback_;    // Riccati feedback of the inputs
 
   // Iteration performance log
   std::vector<PerformanceIndex> performanceIndeces_;
@@ -0,0 +1,100 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+
+#pragma once
+
+#include <ocs2_core/Types.h>
+#include <ocs2_core/model_data/Metrics.h>
+
+#include <ocs2_oc/multiple_shooting/ProjectionMultiplierCoefficients.h>
+#include <ocs2_oc/multiple_shooting/Transcription.h>
+#include <ocs2_oc/oc_data/PerformanceIndex.h>
+#include <ocs2_oc/oc_problem/OcpSize.h>
+
+namespace ocs2 {
+
+/**
+ * Memory that is used in every SQP iteration. The workspace is owned by the solver and reused across iterations and MPC cycles, such that
+ * in steady-state (constant problem size) the containers below are not reallocated.
+ */
+struct SqpWorkspace {
+  /** Returns solution of the QP subproblem in delta coordinates: */
+  struct OcpSubproblemSolution {
+    vector_array_t deltaXSol;      // delta_x(t)
+    vector_array_t deltaUSol;      // delta_u(t)
+    scalar_t armijoDescentMetric;  // inner product of the cost gradient and decision variable step
+  };
+
+  // Size of the QP passed to HPIPM
+  OcpSize ocpSize;
+
+  // LQ approximation
+  std::vector<ScalarFunctionQuadraticApproximation> cost;
+  std::vector<VectorFunctionLinearApproximation> dynamics;
+  std::vector<VectorFunctionLinearApproximation> stateInputEqConstraints;
+  std::vector<VectorFunctionLinearApproximation> stateIneqConstraints;
+  std::vector<VectorFunctionLinearApproximation> stateInputIneqConstraints;
+  std::vector<VectorFunctionLinearApproximation> constraintsProjection;
+
+  // Box constraints on the state and input deviation
+  std::vector<BoxConstraintBounds> stateBoxConstraints;
+  std::vector<BoxConstraintBounds> inputBoxConstraints;
+
+  // Lagrange multipliers
+  std::vector<multiple_shooting::ProjectionMultiplierCoefficients> projectionMultiplierCoefficients;
+
+  // Transcription buffers, one for each worker
+  std::vector<multiple_shooting::Transcription> intermediateTranscriptions;
+  std::vector<multiple_shooting::EventTranscription> eventTranscriptions;
+  std::vector<multiple_shooting::TerminalTranscription> terminalTranscriptions;
+
+  // Performance accumulated by each worker
+  std::vector<PerformanceIndex> performance;
+
+  // QP initial state deviation and solution
+  vector_t deltaX0;
+  OcpSubproblemSolution subproblemSolution;
+
+  // Linesearch candidate
+  vector_array_t xNew;
+  vector_array_t uNew;
+  std::vector<Metrics> metricsNew;
+
+  /**
+   * Sizes the workspace for the given problem. The trajectories are allocated with the state and input dimensions of each node. Does not
+   * allocate memory if the workspace was already sized for the same problem.
+   *
+   * @param problemSize : The size of the optimal control problem, i.e. the state and input dimension for each node.
+   * @param numWorkers : The number of workers that transcribe nodes in parallel.
+   */
+  void resize(const OcpSize& problemSize, size_t numWorkers);
+};
+
+}  // namespace ocs2
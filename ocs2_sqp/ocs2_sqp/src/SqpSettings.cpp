@@ -29,6 +29,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "ocs2_sqp/SqpSettings.h"
 
+#include <unordered_map>
+
 #include <boost/property_tree/info_parser.hpp>
 #include <boost/property_tree/ptree.hpp>
 
@@ -37,6 +39,20 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 namespace ocs2 {
 namespace sqp {
 
+std::string toString(QpSolverType qpSolverType) {
+  static const std::unordered_map<QpSolverType, std::string> qpSolverMap = {{QpSolverType::HPIPM, "HPIPM"},
+                                                                            {QpSolverType::PARALLEL_RICCATI, "PARALLEL_RICCATI"}};
+
+  return qpSolverMap.at(qpSolverType);
+}
+
+QpSolverType fromString(const std::string& name) {
+  static const std::unordered_map<std::string, QpSolverType> qpSolverMap = {{"HPIPM", QpSolverType::HPIPM},
+                                                                            {"PARALLEL_RICCATI", QpSolverType::PARALLEL_RICCATI}};
+
+  return qpSolverMap.at(name);
+}
+
 Settings loadSettings(const std::string& filename, const std::string& fieldName, bool verbose) {
   boost::property_tree::ptree pt;
   boost::property_tree::read_info(filename, pt);
@@ -57,6 +73,7 @@ Settings loadSettings(const std::string& filename, const std::string& fieldName,
   loadData::loadPtreeValue(pt, settings.g_min, fieldName + ".g_min", verbose);
   loadData::loadPtreeValue(pt, settings.armijoFactor, fieldName + ".armijoFactor", verbose);
   loadData::loadPtreeValue(pt, settings.costTol, fieldName + ".costTol", verbose);
+  loadData::loadPtreeValue(pt, settings.realTimeIteration, fieldName + ".realTimeIteration", verbose);
   loadData::loadPtreeValue(pt, settings.dt, fieldName + ".dt", verbose);
   loadData::loadPtreeValue(pt, settings.useFeedbackPolicy, fieldName + ".useFeedbackPolicy", verbose);
   loadData::loadPtreeValue(pt, settings.createValueFunction, fieldName + ".createValueFunction", verbose);
@@ -72,6 +89,12 @@ Settings loadSettings(const std::string& filename, const std::string& fieldName,
   loadData::loadPtreeValue(pt, settings.printLinesearch, fieldName + ".printLinesearch", verbose);
   loadData::loadPtreeValue(pt, settings.nThreads, fieldName + ".nThreads", verbose);
   loadData::loadPtreeValue(pt, settings.threadPriority, fieldName + ".threadPriority", verbose);
+  loadData::loadPtreeValue(pt, settings.nodePartitioning, fieldName + ".nodePartitioning", verbose);
+  loadData::loadPtreeValue(pt, settings.nodePartitionImbalanceTol, fieldName + ".nodePartitionImbalanceTol", verbose);
+  auto qpSolverName = toString(settings.qpSolverType);
+  loadData::loadPtreeValue(pt, qpSolverName, fieldName + ".qpSolverType", verbose);
+  settings.qpSolverType = fromString(qpSolverName);
+  loadData::loadPtreeValue(pt, settings.hpipmSettings.warm_start, fieldName + ".hpipmWarmStart", verbose);
 
   if (verbose) {
     std::cerr << settings.hpipmSettings;
@@ -29,6 +29,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "ocs2_sqp/SqpSolver.h"
 
+#include <algorithm>
+#include <cmath>
 #include <iomanip>
 #include <iostream>
 #include <numeric>
@@ -51,15 +53,49 @@ sqp::Settings rectifySettings(const OptimalControlProblem& ocp, sqp::Settings&&
   }
   return settings;
 }
+
+/** Extracts the state and input dimension of each node from the given trajectories */
+void extractSizesFromTrajectories(const vector_array_t& x, const vector_array_t& u, OcpSize& problemSize) {
+  const int N = static_cast<int>(u.size());
+  problemSize.numStages = N;
+  problemSize.numStates.resize(N + 1);
+  problemSize.numInputs.resize(N + 1);
+  for (int k = 0; k < N; k++) {
+    problemSize.numStates[k] = x[k].size();
+    problemSize.numInputs[k] = u[k].size();
+  }
+  problemSize.numStates[N] = x[N].size();
+  problemSize.numInputs[N] = 0;
+}
 }  // anonymous namespace
 
 SqpSolver::SqpSolver(sqp::Settings settings, const OptimalControlProblem& optimalControlProblem, const Initializer& initializer)
     : settings_(rectifySettings(optimalControlProblem, std::move(settings))),
       hpipmInterface_(OcpSize(), settings_.hpipmSettings),
-      threadPool_(std::max(settings_.nThreads, size_t(1)) - 1, settings_.threadPriority) {
+      parallelRiccatiSolver_(settings_.nThreads),
+      threadPool_(std::max(settings_.nThreads, size_t(1)) - 1, settings_.threadPriority),
+      nodePartition_(settings_.nThreads, settings_.nodePartitionImbalanceTol) {
   Eigen::setNbThreads(1);  // No multithreading within Eigen.
   Eigen::initParallel();
 
+  if (settings_.projectStateInputEqualityConstraints && !optimalControlProblem.equalityConstraintPtr->empty() &&
+      !optimalControlProblem.inputBoxConstraintPtr->empty()) {
+    throw std::runtime_error(
+        "[SqpSolver] Input box constraints cannot be combined with the projection of the state-input equality constraints.");
+  }
+  if (settings_.qpSolverType == sqp::QpSolverType::PARALLEL_RICCATI) {
+    const bool hasBoxConstraints = !optimalControlProblem.stateBoxConstraintPtr->empty() ||
+                                   !optimalControlProblem.inputBoxConstraintPtr->empty() ||
+                                   !optimalControlProblem.finalStateBoxConstraintPtr->empty();
+    const bool hasGeneralConstraints =
+        !settings_.projectStateInputEqualityConstraints && !optimalControlProblem.equalityConstraintPtr->empty();
+    if (hasBoxConstraints || hasGeneralConstraints) {
+      throw std::runtime_error(
+          "[SqpSolver] The parallel Riccati QP solver requires the projection of the state-input equality constraints and does not "
+          "support box constraints.");
+    }
+  }
+
   // Dynamics discretization
   discretizer_ = selectDynamicsDiscretization(settings_.integratorType);
   sensitivityDiscretizer_ = selectDynamicsSensitivityDiscretization(settings_.integratorType);
@@ -90,6 +126,11 @@ void SqpSolver::reset() {
   primalSolution_ = PrimalSolution();
   valueFunction_.clear();
   performanceIndeces_.clear();
+  realTimeIterationIsPrepared_ = false;
+
+  // Clear the HPIPM warm start
+  hpipmInterface_.resetInitialGuess();
+  qpNodeTimes_.clear();
 
   // reset timers
   totalNumIterations_ = 0;
@@ -161,25 +202,30 @@ void SqpSolver::runImpl(scalar_t initTime, const vector_t& initState, scalar_t f
     std::cerr << "\n++++++++++++++++++++++++++++++++++++++++++++++++++++++\n";
   }
 
-  // Determine time discretization, taking into account event times.
-  const auto& eventTimes = this->getReferenceManager().getModeSchedule().eventTimes;
-  const auto timeDiscretization = timeDiscretizationWithEvents(initTime, finalTime, settings_.dt, eventTimes);
-
-  // Initialize references
-  for (auto& ocpDefinition : ocpDefinitions_) {
-    const auto& targetTrajectories = this->getReferenceManager().getTargetTrajectories();
-    ocpDefinition.targetTrajectoriesPtr = &targetTrajectories;
+  if (settings_.realTimeIteration) {
+    // The prepared QP is used if it was prepared for the nearest node in time and for the current event times. Its first node is then
+    // moved to initTime, which requires initTime to precede the second node.
+    const bool isPrepared = realTimeIterationIsPrepared_ && realTimeIterationTime_.size() > 1 &&
+                            std::abs(realTimeIterationTime_.front().time - initTime) <= 0.5 * settings_.dt &&
+                            initTime < realTimeIterationTime_[1].time &&
+                            realTimeIterationEventTimes_ == this->getReferenceManager().getModeSchedule().eventTimes;
+    if (!isPrepared) {
+      prepareRealTimeIteration(initTime, finalTime, initState);
+    }
+    realTimeIterationFeedback(initTime, initState);
+    return;
   }
 
-  // Trajectory spread of primalSolution_
-  if (!primalSolution_.timeTrajectory_.empty()) {
-    std::ignore = trajectorySpread(primalSolution_.modeSchedule_, this->getReferenceManager().getModeSchedule(), primalSolution_);
-  }
+  const auto timeDiscretization = setupTimeDiscretization(initTime, finalTime);
 
   // Initialize the state and input
   vector_array_t x, u;
   multiple_shooting::initializeStateInputTrajectories(initState, timeDiscretization, primalSolution_, *initializerPtr_, x, u);
 
+  // Size the workspace. Memory is only allocated if the problem size changed since the last call.
+  extractSizesFromTrajectories(x, u, trajectorySize_);
+  workspace_.resize(trajectorySize_, settings_.nThreads);
+
   // Bookkeeping
   performanceIndeces_.clear();
   std::vector<Metrics> metrics;
@@ -197,8 +243,8 @@ void SqpSolver::runImpl(scalar_t initTime, const vector_t& initState, scalar_t f
 
     // Solve QP
     solveQpTimer_.startTimer();
-    const vector_t delta_x0 = initState - x[0];
-    const auto deltaSolution = getOCPSolution(delta_x0);
+    workspace_.deltaX0 = initState - x[0];
+    const auto& deltaSolution = getOCPSolution(workspace_.deltaX0);
     extractValueFunction(timeDiscretization, x);
     solveQpTimer_.endTimer();
 
@@ -229,44 +275,200 @@ void SqpSolver::runImpl(scalar_t initTime, const vector_t& initState, scalar_t f
   }
 }
 
+void SqpSolver::prepareImpl(scalar_t initTime, scalar_t finalTime) {
+  if (!settings_.realTimeIteration || primalSolution_.timeTrajectory_.empty()) {
+    return;
+  }
+  const vector_t predictedInitState =
+      LinearInterpolation::interpolate(initTime, primalSolution_.timeTrajectory_, primalSolution_.stateTrajectory_);
+  prepareRealTimeIteration(initTime, finalTime, predictedInitState);
+}
+
+std::vector<AnnotatedTime> SqpSolver::setupTimeDiscretization(scalar_t initTime, scalar_t finalTime) {
+  // Determine time discretization, taking into account event times.
+  const auto& eventTimes = this->getReferenceManager().getModeSchedule().eventTimes;
+  auto timeDiscretization = timeDiscretizationWithEvents(initTime, finalTime, settings_.dt, eventTimes);
+
+  // Shift the dual QP solution of the previous call onto the new time discretization for the primal-dual warm start of HPIPM
+  if (settings_.hpipmSettings.warm_start > 1) {
+    auto qpNodeTimes = toTime(timeDiscretization);
+    if (!qpNodeTimes_.empty()) {
+      hpipmInterface_.shiftSolution(qpNodeTimes_, qpNodeTimes);
+    }
+    qpNodeTimes_ = std::move(qpNodeTimes);
+  }
+
+  // Initialize references
+  for (auto& ocpDefinition : ocpDefinitions_) {
+    const auto& targetTrajectories = this->getReferenceManager().getTargetTrajectories();
+    ocpDefinition.targetTrajectoriesPtr = &targetTrajectories;
+  }
+
+  // Trajectory spread of primalSolution_
+  if (!primalSolution_.timeTrajectory_.empty()) {
+    std::ignore = trajectorySpread(primalSolution_.modeSchedule_, this->getReferenceManager().getModeSchedule(), primalSolution_);
+  }
+
+  return timeDiscretization;
+}
+
+void SqpSolver::prepareRealTimeIteration(scalar_t initTime, scalar_t finalTime, const vector_t& initState) {
+  realTimeIterationTime_ = setupTimeDiscretization(initTime, finalTime);
+  realTimeIterationEventTimes_ = this->getReferenceManager().getModeSchedule().eventTimes;
+  const auto& timeDiscretization = realTimeIterationTime_;
+  auto& x = realTimeIterationX_;
+  auto& u = realTimeIterationU_;
+
+  // Initialize the state and input
+  multiple_shooting::initializeStateInputTrajectories(initState, timeDiscretization, primalSolution_, *initializerPtr_, x, u);
+
+  // Size the workspace. Memory is only allocated if the problem size changed since the last call.
+  extractSizesFromTrajectories(x, u, trajectorySize_);
+  workspace_.resize(trajectorySize_, settings_.nThreads);
+
+  // Make QP approximation, the linearization is consistent with the initial state.
+  linearQuadraticApproximationTimer_.startTimer();
+  realTimeIterationPerformance_ = setupQuadraticSubproblem(timeDiscretization, x.front(), x, u, realTimeIterationMetrics_);
+  linearQuadraticApproximationTimer_.endTimer();
+
+  // Solve QP for the linearization state, the feedback phase corrects the solution for the actual initial state.
+  solveQpTimer_.startTimer();
+  const vector_t delta_x0 = vector_t::Zero(x.front().size());
+  std::ignore = getOCPSolution(delta_x0);
+  extractValueFunction(timeDiscretization, x);
+  realTimeIterationQpFeedback_ = getRiccatiFeedback();
+  realTimeIterationFeedback_ = realTimeIterationQpFeedback_;
+  if (settings_.projectStateInputEqualityConstraints) {
+    multiple_shooting::remapProjectedGain(workspace_.constraintsProjection, realTimeIterationFeedback_);
+  }
+  solveQpTimer_.endTimer();
+
+  realTimeIterationIsPrepared_ = true;
+}
+
+void SqpSolver::realTimeIterationFeedback(scalar_t initTime, const vector_t& initState) {
+  computeControllerTimer_.startTimer();
+  // The policy starts at the actual initial time. The first interval keeps the linearization of the prepared one.
+  auto& timeDiscretization = realTimeIterationTime_;
+  timeDiscretization.front().time = initTime;
+  const auto& deltaXSol = workspace_.subproblemSolution.deltaXSol;
+  const auto& deltaUSol = workspace_.subproblemSolution.deltaUSol;
+  auto& x = realTimeIterationX_;
+  auto& u = realTimeIterationU_;
+  const int N = static_cast<int>(timeDiscretization.size()) - 1;
+
+  // Propagate the deviation of the initial state through the closed loop of the QP: e[k+1] = (A[k] + B[k] * K[k]) * e[k]
+  vector_t e = initState - x.front();
+  vector_t eNext;
+  for (int i = 0; i < N; i++) {
+    const auto& dynamics = workspace_.dynamics[i];
+    eNext.noalias() = dynamics.dfdx * e;
+    if (dynamics.dfdu.cols() > 0) {
+      eNext.noalias() += dynamics.dfdu * (realTimeIterationQpFeedback_[i] * e);
+    }
+    if (u[i].size() > 0) {  // no input at event nodes
+      u[i] += deltaUSol[i];
+      u[i].noalias() += realTimeIterationFeedback_[i] * e;
+    }
+    x[i] += deltaXSol[i];
+    x[i] += e;
+    e.swap(eNext);
+  }
+  x[N] += deltaXSol[N];
+  x[N] += e;
+
+  // The performance of the real-time iteration is the one at the linearization point.
+  performanceIndeces_.clear();
+  performanceIndeces_.push_back(realTimeIterationPerformance_);
+  ++totalNumIterations_;
+
+  ModeSchedule modeSchedule = this->getReferenceManager().getModeSchedule();
+  if (settings_.useFeedbackPolicy) {
+    primalSolution_ = multiple_shooting::toPrimalSolution(timeDiscretization, std::move(modeSchedule), std::move(x), std::move(u),
+                                                          std::move(realTimeIterationFeedback_));
+  } else {
+    primalSolution_ = multiple_shooting::toPrimalSolution(timeDiscretization, std::move(modeSchedule), std::move(x), std::move(u));
+  }
+  problemMetrics_ = multiple_shooting::toProblemMetrics(timeDiscretization, std::move(realTimeIterationMetrics_));
+  realTimeIterationIsPrepared_ = false;
+  computeControllerTimer_.endTimer();
+}
+
 void SqpSolver::runParallel(std::function<void(int)> taskFunction) {
   threadPool_.runParallel(std::move(taskFunction), settings_.nThreads);
 }
 
-SqpSolver::OcpSubproblemSolution SqpSolver::getOCPSolution(const vector_t& delta_x0) {
+void SqpSolver::runParallelOverNodes(int numNodes, const std::function<void(int, int)>& nodeTask, bool measureCost) {
+  if (settings_.nodePartitioning) {
+    nodePartition_.run(threadPool_, numNodes, nodeTask, measureCost);
+  } else {
+    std::atomic_int nodeIndex{0};
+    auto workerTask = [&](int workerId) {
+      int i;
+      while ((i = nodeIndex++) < numNodes) {
+        nodeTask(workerId, i);
+      }
+    };
+    runParallel(std::ref(workerTask));  // the std::function refers to the lambda instead of allocating a copy
+  }
+}
+
+const SqpSolver::OcpSubproblemSolution& SqpSolver::getOCPSolution(const vector_t& delta_x0) {
   // Solve the QP
-  OcpSubproblemSolution solution;
+  auto& solution = workspace_.subproblemSolution;
   auto& deltaXSol = solution.deltaXSol;
   auto& deltaUSol = solution.deltaUSol;
-  hpipm_status status;
-  const bool hasStateInputConstraints = !ocpDefinitions_.front().equalityConstraintPtr->empty();
-  if (hasStateInputConstraints && !settings_.projectStateInputEqualityConstraints) {
-    hpipmInterface_.resize(extractSizesFromProblem(dynamics_, cost_, &stateInputEqConstraints_));
-    status =
-        hpipmInterface_.solve(delta_x0, dynamics_, cost_, &stateInputEqConstraints_, deltaXSol, deltaUSol, settings_.printSolverStatus);
-  } else {  // without constraints, or when using projection, we have an unconstrained QP.
-    hpipmInterface_.resize(extractSizesFromProblem(dynamics_, cost_, nullptr));
-    status = hpipmInterface_.solve(delta_x0, dynamics_, cost_, nullptr, deltaXSol, deltaUSol, settings_.printSolverStatus);
-  }
+  const auto& ocpDefinition = ocpDefinitions_.front();
+  const bool hasStateInputConstraints = !ocpDefinition.equalityConstraintPtr->empty();
+  const bool hasStateBoxConstraints = !ocpDefinition.stateBoxConstraintPtr->empty() || !ocpDefinition.finalStateBoxConstraintPtr->empty();
+  const bool hasInputBoxConstraints = !ocpDefinition.inputBoxConstraintPtr->empty();
+
+  // without constraints, or when using projection, we have a QP without general constraints.
+  auto* constraints = (hasStateInputConstraints && !settings_.projectStateInputEqualityConstraints) ? &workspace_.stateInputEqConstraints
+                                                                                                    : nullptr;
+  // box constraints are passed to HPIPM in their native form
+  auto* stateBoxConstraints = hasStateBoxConstraints ? &workspace_.stateBoxConstraints : nullptr;
+  auto* inputBoxConstraints = hasInputBoxConstraints ? &workspace_.inputBoxConstraints : nullptr;
 
-  if (status != hpipm_status::SUCCESS) {
-    throw std::runtime_error("[SqpSolver] Failed to solve QP");
+  if (settings_.qpSolverType == sqp::QpSolverType::PARALLEL_RICCATI) {
+    parallelRiccatiSolver_.solve(threadPool_, delta_x0, workspace_.dynamics, workspace_.cost, deltaXSol, deltaUSol);
+
+  } else {
+    extractSizesFromProblem(workspace_.dynamics, workspace_.cost, constraints, workspace_.ocpSize);
+    extractBoxConstraintSizes(stateBoxConstraints, inputBoxConstraints, workspace_.ocpSize);
+    hpipmInterface_.resize(workspace_.ocpSize);
+    const auto status = hpipmInterface_.solve(delta_x0, workspace_.dynamics, workspace_.cost, constraints, stateBoxConstraints,
+                                              inputBoxConstraints, deltaXSol, deltaUSol, settings_.printSolverStatus);
+
+    if (status != hpipm_status::SUCCESS) {
+      throw std::runtime_error("[SqpSolver] Failed to solve QP");
+    }
   }
 
   // to determine if the solution is a descent direction for the cost: compute gradient(cost)' * [dx; du]
-  solution.armijoDescentMetric = armijoDescentMetric(cost_, deltaXSol, deltaUSol);
+  solution.armijoDescentMetric = armijoDescentMetric(workspace_.cost, deltaXSol, deltaUSol);
 
   // remap the tilde delta u to real delta u
   if (settings_.projectStateInputEqualityConstraints) {
-    multiple_shooting::remapProjectedInput(constraintsProjection_, deltaXSol, deltaUSol);
+    multiple_shooting::remapProjectedInput(workspace_.constraintsProjection, deltaXSol, deltaUSol);
   }
 
   return solution;
 }
 
+matrix_array_t SqpSolver::getRiccatiFeedback() {
+  if (settings_.qpSolverType == sqp::QpSolverType::PARALLEL_RICCATI) {
+    return parallelRiccatiSolver_.getRiccatiFeedback();
+  } else {
+    return hpipmInterface_.getRiccatiFeedback(workspace_.dynamics[0], workspace_.cost[0]);
+  }
+}
+
 void SqpSolver::extractValueFunction(const std::vector<AnnotatedTime>& time, const vector_array_t& x) {
   if (settings_.createValueFunction) {
-    valueFunction_ = hpipmInterface_.getRiccatiCostToGo(dynamics_[0], cost_[0]);
+    valueFunction_ = (settings_.qpSolverType == sqp::QpSolverType::PARALLEL_RICCATI)
+                         ? parallelRiccatiSolver_.getRiccatiCostToGo()
+                         : hpipmInterface_.getRiccatiCostToGo(workspace_.dynamics[0], workspace_.cost[0]);
     // Correct for linearization state
     for (int i = 0; i < time.size(); ++i) {
       valueFunction_[i].dfdx.noalias() -= valueFunction_[i].dfdxx * x[i];
@@ -277,9 +479,9 @@ void SqpSolver::extractValueFunction(const std::vector<AnnotatedTime>& time, con
 PrimalSolution SqpSolver::toPrimalSolution(const std::vector<AnnotatedTime>& time, vector_array_t&& x, vector_array_t&& u) {
   if (settings_.useFeedbackPolicy) {
     ModeSchedule modeSchedule = this->getReferenceManager().getModeSchedule();
-    matrix_array_t KMatrices = hpipmInterface_.getRiccatiFeedback(dynamics_[0], cost_[0]);
+    matrix_array_t KMatrices = getRiccatiFeedback();
     if (settings_.projectStateInputEqualityConstraints) {
-      multiple_shooting::remapProjectedGain(constraintsProjection_, KMatrices);
+      multiple_shooting::remapProjectedGain(workspace_.constraintsProjection, KMatrices);
     }
     return multiple_shooting::toPrimalSolution(time, std::move(modeSchedule), std::move(x), std::move(u), std::move(KMatrices));
 
@@ -294,77 +496,68 @@ PerformanceIndex SqpSolver::setupQuadraticSubproblem(const std::vector<Annotated
   // Problem horizon
   const int N = static_cast<int>(time.size()) - 1;
 
-  std::vector<PerformanceIndex> performance(settings_.nThreads, PerformanceIndex());
-  cost_.resize(N + 1);
-  dynamics_.resize(N);
-  stateInputEqConstraints_.resize(N + 1);  // +1 because of HpipmInterface size check
-  stateIneqConstraints_.resize(N + 1);
-  stateInputIneqConstraints_.resize(N);
-  constraintsProjection_.resize(N);
-  projectionMultiplierCoefficients_.resize(N);
+  auto& performance = workspace_.performance;
+  std::fill(performance.begin(), performance.end(), PerformanceIndex());
   metrics.resize(N + 1);
 
-  std::atomic_int timeIndex{0};
-  auto parallelTask = [&](int workerId) {
+  auto nodeTask = [&](int workerId, int i) {
     // Get worker specific resources
     OptimalControlProblem& ocpDefinition = ocpDefinitions_[workerId];
-    PerformanceIndex workerPerformance;  // Accumulate performance in local variable
-
-    int i = timeIndex++;
-    while (i < N) {
-      if (time[i].event == AnnotatedTime::Event::PreEvent) {
-        // Event node
-        auto result = multiple_shooting::setupEventNode(ocpDefinition, time[i].time, x[i], x[i + 1]);
-        metrics[i] = multiple_shooting::computeMetrics(result);
-        workerPerformance += multiple_shooting::computePerformanceIndex(result);
-        cost_[i] = std::move(result.cost);
-        dynamics_[i] = std::move(result.dynamics);
-        stateInputEqConstraints_[i].resize(0, x[i].size());
-        stateIneqConstraints_[i] = std::move(result.ineqConstraints);
-        stateInputIneqConstraints_[i].resize(0, x[i].size());
-        constraintsProjection_[i].resize(0, x[i].size());
-        projectionMultiplierCoefficients_[i] = multiple_shooting::ProjectionMultiplierCoefficients();
-      } else {
-        // Normal, intermediate node
-        const scalar_t ti = getIntervalStart(time[i]);
-        const scalar_t dt = getIntervalDuration(time[i], time[i + 1]);
-        auto result = multiple_shooting::setupIntermediateNode(ocpDefinition, sensitivityDiscretizer_, ti, dt, x[i], x[i + 1], u[i]);
-        metrics[i] = multiple_shooting::computeMetrics(result);
-        workerPerformance += multiple_shooting::computePerformanceIndex(result, dt);
-        if (settings_.projectStateInputEqualityConstraints) {
-          multiple_shooting::projectTranscription(result, settings_.extractProjectionMultiplier);
-        }
-        cost_[i] = std::move(result.cost);
-        dynamics_[i] = std::move(result.dynamics);
-        stateInputEqConstraints_[i] = std::move(result.stateInputEqConstraints);
-        stateIneqConstraints_[i] = std::move(result.stateIneqConstraints);
-        stateInputIneqConstraints_[i] = std::move(result.stateInputIneqConstraints);
-        constraintsProjection_[i] = std::move(result.constraintsProjection);
-        projectionMultiplierCoefficients_[i] = std::move(result.projectionMultiplierCoefficients);
-      }
-
-      i = timeIndex++;
-    }
+    PerformanceIndex& workerPerformance = performance[workerId];
 
-    if (i == N) {  // Only one worker will execute this
+    if (i == N) {
+      // Terminal node
       const scalar_t tN = getIntervalStart(time[N]);
-      auto result = multiple_shooting::setupTerminalNode(ocpDefinition, tN, x[N]);
+      auto& result = workspace_.terminalTranscriptions[workerId];
+      multiple_shooting::setupTerminalNode(ocpDefinition, tN, x[N], result);
       metrics[i] = multiple_shooting::computeMetrics(result);
       workerPerformance += multiple_shooting::computePerformanceIndex(result);
-      cost_[i] = std::move(result.cost);
-      stateInputEqConstraints_[i].resize(0, x[i].size());
-      stateIneqConstraints_[i] = std::move(result.ineqConstraints);
+      std::swap(workspace_.cost[i], result.cost);
+      workspace_.stateInputEqConstraints[i].resize(0, x[i].size());
+      std::swap(workspace_.stateIneqConstraints[i], result.ineqConstraints);
+      std::swap(workspace_.stateBoxConstraints[i], result.stateBoxConstraints);
+    } else if (time[i].event == AnnotatedTime::Event::PreEvent) {
+      // Event node
+      auto& result = workspace_.eventTranscriptions[workerId];
+      multiple_shooting::setupEventNode(ocpDefinition, time[i].time, x[i], x[i + 1], result);
+      metrics[i] = multiple_shooting::computeMetrics(result);
+      workerPerformance += multiple_shooting::computePerformanceIndex(result);
+      std::swap(workspace_.cost[i], result.cost);
+      std::swap(workspace_.dynamics[i], result.dynamics);
+      workspace_.stateInputEqConstraints[i].resize(0, x[i].size());
+      std::swap(workspace_.stateIneqConstraints[i], result.ineqConstraints);
+      workspace_.stateInputIneqConstraints[i].resize(0, x[i].size());
+      workspace_.constraintsProjection[i].resize(0, x[i].size());
+      workspace_.projectionMultiplierCoefficients[i] = multiple_shooting::ProjectionMultiplierCoefficients();
+      std::swap(workspace_.stateBoxConstraints[i], result.stateBoxConstraints);
+      workspace_.inputBoxConstraints[i].clear();
+    } else {
+      // Normal, intermediate node
+      const scalar_t ti = getIntervalStart(time[i]);
+      const scalar_t dt = getIntervalDuration(time[i], time[i + 1]);
+      auto& result = workspace_.intermediateTranscriptions[workerId];
+      multiple_shooting::setupIntermediateNode(ocpDefinition, sensitivityDiscretizer_, ti, dt, x[i], x[i + 1], u[i], result);
+      multiple_shooting::computeMetrics(result, metrics[i]);
+      workerPerformance += multiple_shooting::computePerformanceIndex(result, dt);
+      if (settings_.projectStateInputEqualityConstraints) {
+        multiple_shooting::projectTranscription(result, settings_.extractProjectionMultiplier);
+      }
+      std::swap(workspace_.cost[i], result.cost);
+      std::swap(workspace_.dynamics[i], result.dynamics);
+      std::swap(workspace_.stateInputEqConstraints[i], result.stateInputEqConstraints);
+      std::swap(workspace_.stateIneqConstraints[i], result.stateIneqConstraints);
+      std::swap(workspace_.stateInputIneqConstraints[i], result.stateInputIneqConstraints);
+      std::swap(workspace_.constraintsProjection[i], result.constraintsProjection);
+      std::swap(workspace_.projectionMultiplierCoefficients[i], result.projectionMultiplierCoefficients);
+      std::swap(workspace_.stateBoxConstraints[i], result.stateBoxConstraints);
+      std::swap(workspace_.inputBoxConstraints[i], result.inputBoxConstraints);
     }
-
-    // Accumulate! Same worker might run multiple tasks
-    performance[workerId] += workerPerformance;
   };
-  runParallel(std::move(parallelTask));
+  runParallelOverNodes(N + 1, std::cref(nodeTask), true);
 
   // Account for initial state in performance
-  const vector_t initDynamicsViolation = initState - x.front();
-  metrics.front().dynamicsViolation += initDynamicsViolation;
-  performance.front().dynamicsViolationSSE += initDynamicsViolation.squaredNorm();
+  metrics.front().dynamicsViolation += initState - x.front();
+  performance.front().dynamicsViolationSSE += (initState - x.front()).squaredNorm();
 
   // Sum performance of the threads
   PerformanceIndex totalPerformance = std::accumulate(std::next(performance.begin()), performance.end(), performance.front());
@@ -379,41 +572,34 @@ PerformanceIndex SqpSolver::computePerformance(const std::vector<AnnotatedTime>&
   const int N = static_cast<int>(time.size()) - 1;
   metrics.resize(N + 1);
 
-  std::vector<PerformanceIndex> performance(settings_.nThreads, PerformanceIndex());
-  std::atomic_int timeIndex{0};
-  auto parallelTask = [&](int workerId) {
+  auto& performance = workspace_.performance;
+  std::fill(performance.begin(), performance.end(), PerformanceIndex());
+  auto nodeTask = [&](int workerId, int i) {
     // Get worker specific resources
     OptimalControlProblem& ocpDefinition = ocpDefinitions_[workerId];
 
-    int i = timeIndex++;
-    while (i < N) {
-      if (time[i].event == AnnotatedTime::Event::PreEvent) {
-        // Event node
-        metrics[i] = multiple_shooting::computeEventMetrics(ocpDefinition, time[i].time, x[i], x[i + 1]);
-        performance[workerId] += toPerformanceIndex(metrics[i]);
-      } else {
-        // Normal, intermediate node
-        const scalar_t ti = getIntervalStart(time[i]);
-        const scalar_t dt = getIntervalDuration(time[i], time[i + 1]);
-        metrics[i] = multiple_shooting::computeIntermediateMetrics(ocpDefinition, discretizer_, ti, dt, x[i], x[i + 1], u[i]);
-        performance[workerId] += toPerformanceIndex(metrics[i], dt);
-      }
-
-      i = timeIndex++;
-    }
-
-    if (i == N) {  // Only one worker will execute this
+    if (i == N) {
+      // Terminal node
       const scalar_t tN = getIntervalStart(time[N]);
       metrics[N] = multiple_shooting::computeTerminalMetrics(ocpDefinition, tN, x[N]);
       performance[workerId] += toPerformanceIndex(metrics[N]);
+    } else if (time[i].event == AnnotatedTime::Event::PreEvent) {
+      // Event node
+      metrics[i] = multiple_shooting::computeEventMetrics(ocpDefinition, time[i].time, x[i], x[i + 1]);
+      performance[workerId] += toPerformanceIndex(metrics[i]);
+    } else {
+      // Normal, intermediate node
+      const scalar_t ti = getIntervalStart(time[i]);
+      const scalar_t dt = getIntervalDuration(time[i], time[i + 1]);
+      multiple_shooting::computeIntermediateMetrics(ocpDefinition, discretizer_, ti, dt, x[i], x[i + 1], u[i], metrics[i]);
+      performance[workerId] += toPerformanceIndex(metrics[i], dt);
     }
   };
-  runParallel(std::move(parallelTask));
+  runParallelOverNodes(N + 1, std::cref(nodeTask), false);
 
   // Account for initial state in performance
-  const vector_t initDynamicsViolation = initState - x.front();
-  metrics.front().dynamicsViolation += initDynamicsViolation;
-  performance.front().dynamicsViolationSSE += initDynamicsViolation.squaredNorm();
+  metrics.front().dynamicsViolation += initState - x.front();
+  performance.front().dynamicsViolationSSE += (initState - x.front()).squaredNorm();
 
   // Sum performance of the threads
   PerformanceIndex totalPerformance = std::accumulate(std::next(performance.begin()), performance.end(), performance.front());
@@ -447,9 +633,12 @@ sqp::StepInfo SqpSolver::takeStep(const PerformanceIndex& baseline, const std::v
   const auto deltaXnorm = multiple_shooting::trajectoryNorm(dx);
 
   scalar_t alpha = 1.0;
-  vector_array_t xNew(x.size());
-  vector_array_t uNew(u.size());
-  std::vector<Metrics> metricsNew(metrics.size());
+  auto& xNew = workspace_.xNew;
+  auto& uNew = workspace_.uNew;
+  auto& metricsNew = workspace_.metricsNew;
+  xNew.resize(x.size());
+  uNew.resize(u.size());
+  metricsNew.resize(metrics.size());
   do {
     // Compute step
     multiple_shooting::incrementTrajectory(u, du, alpha, uNew);
@@ -471,10 +660,10 @@ sqp::StepInfo SqpSolver::takeStep(const PerformanceIndex& baseline, const std::v
       std::cerr << performanceNew << "\n";
     }
 
-    if (stepAccepted) {  // Return if step accepted
-      x = std::move(xNew);
-      u = std::move(uNew);
-      metrics = std::move(metricsNew);
+    if (stepAccepted) {  // Return if step accepted, the previous trajectories are kept as buffers for the next linesearch
+      std::swap(x, xNew);
+      std::swap(u, uNew);
+      std::swap(metrics, metricsNew);
 
       // Prepare step info
       sqp::StepInfo stepInfo;
@@ -0,0 +1,69 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+
+#include "ocs2_sqp/SqpWorkspace.h"
+
+namespace ocs2 {
+
+namespace {
+void resizeTrajectory(const std::vector<int>& sizes, int numNodes, vector_array_t& trajectory) {
+  trajectory.resize(numNodes);
+  for (int k = 0; k < numNodes; k++) {
+    trajectory[k].resize(sizes[k]);
+  }
+}
+}  // anonymous namespace
+
+void SqpWorkspace::resize(const OcpSize& problemSize, size_t numWorkers) {
+  const int N = problemSize.numStages;
+
+  cost.resize(N + 1);
+  dynamics.resize(N);
+  stateInputEqConstraints.resize(N + 1);  // +1 because of HpipmInterface size check
+  stateIneqConstraints.resize(N + 1);
+  stateInputIneqConstraints.resize(N);
+  constraintsProjection.resize(N);
+  projectionMultiplierCoefficients.resize(N);
+  stateBoxConstraints.resize(N + 1);
+  inputBoxConstraints.resize(N);
+
+  intermediateTranscriptions.resize(numWorkers);
+  eventTranscriptions.resize(numWorkers);
+  terminalTranscriptions.resize(numWorkers);
+  performance.resize(numWorkers);
+
+  resizeTrajectory(problemSize.numStates, N + 1, subproblemSolution.deltaXSol);
+  resizeTrajectory(problemSize.numInputs, N, subproblemSolution.deltaUSol);
+  resizeTrajectory(problemSize.numStates, N + 1, xNew);
+  resizeTrajectory(problemSize.numInputs, N, uNew);
+  metricsNew.resize(N + 1);
+}
+
+}  // namespace ocs2
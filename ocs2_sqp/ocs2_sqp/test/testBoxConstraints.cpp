@@ -0,0 +1,144 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "ocs2_sqp/SqpSolver.h"
+
+#include <ocs2_core/initialization/DefaultInitializer.h>
+
+#include <ocs2_oc/synchronized_module/ReferenceManager.h>
+#include <ocs2_oc/test/testProblemsGeneration.h>
+
+namespace ocs2 {
+namespace {
+
+class BoxConstraintsTest : public testing::Test {
+ protected:
+  static constexpr int n_ = 3;
+  static constexpr int m_ = 2;
+  static constexpr scalar_t startTime_ = 0.0;
+  static constexpr scalar_t finalTime_ = 1.0;
+
+  BoxConstraintsTest()
+      : referenceManagerPtr_(std::make_shared<ReferenceManager>(TargetTrajectories({0.0}, {vector_t::Ones(n_)}, {vector_t::Ones(m_)}))),
+        zeroInitializer_(m_) {
+    srand(0);
+    problem_.dynamicsPtr = getOcs2Dynamics(getRandomDynamics(n_, m_));
+    const auto costMatrices = getRandomCost(n_, m_);
+    problem_.costPtr->add("intermediateCost", getOcs2Cost(costMatrices));
+    problem_.finalCostPtr->add("finalCost", getOcs2StateCost(costMatrices));
+    problem_.targetTrajectoriesPtr = &referenceManagerPtr_->getTargetTrajectories();
+
+    settings_.dt = 0.05;
+    settings_.sqpIteration = 10;
+    settings_.nThreads = 1;
+  }
+
+  std::pair<PrimalSolution, PerformanceIndex> solve() const {
+    SqpSolver solver(settings_, problem_, zeroInitializer_);
+    solver.setReferenceManager(referenceManagerPtr_);
+    solver.run(startTime_, vector_t::Ones(n_), finalTime_);
+    return {solver.primalSolution(finalTime_), solver.getPerformanceIndeces()};
+  }
+
+  OptimalControlProblem problem_;
+  std::shared_ptr<ReferenceManager> referenceManagerPtr_;
+  DefaultInitializer zeroInitializer_;
+  sqp::Settings settings_;
+};
+
+constexpr int BoxConstraintsTest::n_;
+constexpr int BoxConstraintsTest::m_;
+constexpr scalar_t BoxConstraintsTest::startTime_;
+constexpr scalar_t BoxConstraintsTest::finalTime_;
+
+}  // namespace
+}  // namespace ocs2
+
+using namespace ocs2;
+
+TEST_F(BoxConstraintsTest, inputBox) {
+  const auto unconstrained = solve();
+
+  // Bound the first input to half of its unconstrained range, such that the box is active on parts of the horizon
+  scalar_t maxInput = 0.0;
+  for (const auto& u : unconstrained.first.inputTrajectory_) {
+    maxInput = std::max(maxInput, std::abs(u(0)));
+  }
+  const scalar_t bound = 0.5 * maxInput;
+  auto inputBox = std::make_unique<BoxConstraint>(std::vector<int>{0}, vector_t::Constant(1, -bound), vector_t::Constant(1, bound));
+  problem_.inputBoxConstraintPtr->add("inputBox", std::move(inputBox));
+  const auto constrained = solve();
+
+  ASSERT_LT(constrained.second.dynamicsViolationSSE, 1e-6);
+  ASSERT_LT(constrained.second.inequalityConstraintsSSE, 1e-6);
+  ASSERT_GT(constrained.second.cost, unconstrained.second.cost);
+
+  const auto& inputTrajectory = constrained.first.inputTrajectory_;
+  bool isActive = false;
+  for (int i = 0; i < inputTrajectory.size() - 1; i++) {
+    ASSERT_LE(std::abs(inputTrajectory[i](0)), bound + 1e-6);
+    isActive = isActive || std::abs(inputTrajectory[i](0)) > bound - 1e-6;
+  }
+  EXPECT_TRUE(isActive);
+}
+
+TEST_F(BoxConstraintsTest, softStateBox) {
+  const auto unconstrained = solve();
+
+  // The state box does not apply to the given initial state
+  auto getMaxSecondState = [](const vector_array_t& stateTrajectory) {
+    scalar_t maxState = 0.0;
+    for (int i = 1; i < stateTrajectory.size(); i++) {
+      maxState = std::max(maxState, std::abs(stateTrajectory[i](1)));
+    }
+    return maxState;
+  };
+
+  // A soft bound on the second state, which the unconstrained solution violates, and a hard bound on the first final state
+  const scalar_t maxState = getMaxSecondState(unconstrained.first.stateTrajectory_);
+  const scalar_t bound = 0.5 * maxState;
+  constexpr scalar_t slackQuadraticPenalty = 1e3;
+  auto stateBox = std::make_unique<BoxConstraint>(std::vector<int>{1}, vector_t::Constant(1, -bound), vector_t::Constant(1, bound),
+                                                  slackQuadraticPenalty, 0.0);
+  problem_.stateBoxConstraintPtr->add("stateBox", std::move(stateBox));
+  const scalar_t finalBound = 0.5 * std::abs(unconstrained.first.stateTrajectory_.back()(0));
+  auto finalStateBox =
+      std::make_unique<BoxConstraint>(std::vector<int>{0}, vector_t::Constant(1, -finalBound), vector_t::Constant(1, finalBound));
+  problem_.finalStateBoxConstraintPtr->add("finalStateBox", std::move(finalStateBox));
+  const auto constrained = solve();
+
+  ASSERT_LT(constrained.second.dynamicsViolationSSE, 1e-6);
+  ASSERT_LT(constrained.second.inequalityConstraintsSSE, 1e-6);
+  ASSERT_LE(std::abs(constrained.first.stateTrajectory_.back()(0)), finalBound + 1e-6);
+
+  // The soft bound reduces the violation, but does not strictly enforce the bound
+  EXPECT_LT(getMaxSecondState(constrained.first.stateTrajectory_), maxState);
+}
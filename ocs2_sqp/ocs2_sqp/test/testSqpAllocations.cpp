@@ -0,0 +1,175 @@
+/******************************************************************************
+Copyright (c) 2020, Farbod Farshidian. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+* Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+* Neither the name of the copyright holder nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "ocs2_sqp/SqpSolver.h"
+
+#include <ocs2_core/initialization/DefaultInitializer.h>
+#include <ocs2_core/test/AllocationCounter.h>
+
+#include <ocs2_oc/synchronized_module/ReferenceManager.h>
+#include <ocs2_oc/test/testProblemsGeneration.h>
+
+namespace ocs2 {
+namespace {
+
+/**
+ * Quadratic cost around the origin which evaluates and accumulates its approximation without temporaries. The approximation doubles the
+ * curvature, such that an SQP step only moves part of the way to the optimum and the solver does not converge within a few iterations.
+ */
+class InPlaceStateInputCost final : public StateInputCost {
+ public:
+  InPlaceStateInputCost(matrix_t Q, matrix_t R) : Q_(std::move(Q)), R_(std::move(R)) {}
+  InPlaceStateInputCost* clone() const override { return new InPlaceStateInputCost(*this); }
+
+  scalar_t getValue(scalar_t time, const vector_t& state, const vector_t& input, const TargetTrajectories& targetTrajectories,
+                    const PreComputation& preComp) const override {
+    return 0.5 * state.dot(Q_.lazyProduct(state)) + 0.5 * input.dot(R_.lazyProduct(input));
+  }
+
+  ScalarFunctionQuadraticApproximation getQuadraticApproximation(scalar_t time, const vector_t& state, const vector_t& input,
+                                                                 const TargetTrajectories& targetTrajectories,
+                                                                 const PreComputation& preComp) const override {
+    ScalarFunctionQuadraticApproximation cost;
+    cost.setZero(state.size(), input.size());
+    addQuadraticApproximation(time, state, input, targetTrajectories, preComp, cost);
+    return cost;
+  }
+
+  void addQuadraticApproximation(scalar_t time, const vector_t& state, const vector_t& input, const TargetTrajectories& targetTrajectories,
+                                 const PreComputation& preComp, ScalarFunctionQuadraticApproximation& cost) const override {
+    cost.f += getValue(time, state, input, targetTrajectories, preComp);
+    cost.dfdx.noalias() += Q_ * state;
+    cost.dfdu.noalias() += R_ * input;
+    cost.dfdxx += 2.0 * Q_;
+    cost.dfduu += 2.0 * R_;
+  }
+
+ private:
+  matrix_t Q_;
+  matrix_t R_;
+};
+
+/** Final counterpart of InPlaceStateInputCost. */
+class InPlaceStateCost final : public StateCost {
+ public:
+  explicit InPlaceStateCost(matrix_t Q) : Q_(std::move(Q)) {}
+  InPlaceStateCost* clone() const override { return new InPlaceStateCost(*this); }
+
+  scalar_t getValue(scalar_t time, const vector_t& state, const TargetTrajectories& targetTrajectories,
+                    const PreComputation& preComp) const override {
+    return 0.5 * state.dot(Q_.lazyProduct(state));
+  }
+
+  ScalarFunctionQuadraticApproximation getQuadraticApproximation(scalar_t time, const vector_t& state,
+                                                                 const TargetTrajectories& targetTrajectories,
+                                                                 const PreComputation& preComp) const override {
+    ScalarFunctionQuadraticApproximation cost;
+    cost.setZero(state.size(), 0);
+    addQuadraticApproximation(time, state, targetTrajectories, preComp, cost);
+    return cost;
+  }
+
+  void addQuadraticApproximation(scalar_t time, const vector_t& state, const TargetTrajectories& targetTrajectories,
+                                 const PreComputation& preComp, ScalarFunctionQuadraticApproximation& cost) const override {
+    cost.f += getValue(time, state, targetTrajectories, preComp);
+    cost.dfdx.noalias() += Q_ * state;
+    cost.dfdxx += 2.0 * Q_;
+  }
+
+ private:
+  matrix_t Q_;
+};
+
+/**
+ * Runs the solver twice with the given maximum number of iterations.
+ * @return The number of allocations and the number of iterations of the second run.
+ */
+std::pair<size_t, size_t> countRunAllocations(const VectorFunctionLinearApproximation& dynamics,
+                                              const ScalarFunctionQuadraticApproximation& costs, size_t sqpIteration) {
+  const int n = dynamics.dfdu.rows();
+  const int m = dynamics.dfdu.cols();
+
+  OptimalControlProblem problem;
+  problem.dynamicsPtr = getOcs2Dynamics(dynamics);
+  problem.costPtr->add("intermediateCost", std::unique_ptr<StateInputCost>(new InPlaceStateInputCost(costs.dfdxx, costs.dfduu)));
+  problem.finalCostPtr->add("finalCost", std::unique_ptr<StateCost>(new InPlaceStateCost(costs.dfdxx)));
+
+  const TargetTrajectories targetTrajectories({0.0}, {vector_t::Zero(n)}, {vector_t::Zero(m)});
+  auto referenceManagerPtr = std::make_shared<ReferenceManager>(targetTrajectories);
+  problem.targetTrajectoriesPtr = &referenceManagerPtr->getTargetTrajectories();
+
+  DefaultInitializer zeroInitializer(m);
+
+  // The worker threads share a heap allocated region, hence the zero allocation claim only holds for a single thread.
+  sqp::Settings settings;
+  settings.dt = 0.05;
+  settings.sqpIteration = sqpIteration;
+  settings.deltaTol = 0.0;
+  settings.costTol = 0.0;
+  settings.nThreads = 1;
+  settings.qpSolverType = sqp::QpSolverType::HPIPM;
+  settings.printSolverStatistics = false;
+  settings.printSolverStatus = false;
+  settings.printLinesearch = false;
+
+  SqpSolver solver(settings, problem, zeroInitializer);
+  solver.setReferenceManager(referenceManagerPtr);
+
+  // The first run sizes the workspace and the trajectories. The workspace swaps its approximations with the transcription buffers,
+  // which only hold memory for all nodes after the second iteration.
+  const scalar_t startTime = 0.0;
+  const scalar_t finalTime = 1.0;
+  const vector_t initState = vector_t::Ones(n);
+  solver.run(startTime, initState, finalTime);
+
+  size_t numAllocations;
+  {
+    AllocationCounter counter;
+    solver.run(startTime, initState, finalTime);
+    numAllocations = counter.count();
+  }
+  return {numAllocations, solver.getIterationsLog().size()};
+}
+
+}  // namespace
+}  // namespace ocs2
+
+TEST(test_sqp_allocations, noAllocationPerIteration) {
+  // The allocations of the set up, the initialization, and the solution bookkeeping of a run do not depend on the number of iterations,
+  // such that the difference is the number of allocations of one SQP iteration.
+  const auto dynamics = ocs2::getRandomDynamics(6, 3);
+  const auto costs = ocs2::getRandomCost(6, 3);
+  const auto twoIterations = ocs2::countRunAllocations(dynamics, costs, 2);
+  const auto threeIterations = ocs2::countRunAllocations(dynamics, costs, 3);
+  ASSERT_EQ(twoIterations.second, 2);
+  ASSERT_EQ(threeIterations.second, 3);
+  EXPECT_EQ(threeIterations.first, twoIterations.first);
+}
@@ -41,7 +41,8 @@ namespace {
 
 std::pair<PrimalSolution, std::vector<PerformanceIndex>> solveWithFeedbackSetting(
     bool feedback, bool emptyConstraint, const VectorFunctionLinearApproximation& dynamicsMatrices,
-    const ScalarFunctionQuadraticApproximation& costMatrices) {
+    const ScalarFunctionQuadraticApproximation& costMatrices, bool nodePartitioning = false,
+    sqp::QpSolverType qpSolverType = sqp::QpSolverType::HPIPM) {
   int n = dynamicsMatrices.dfdu.rows();
   int m = dynamicsMatrices.dfdu.cols();
 
@@ -76,6 +77,8 @@ std::pair<PrimalSolution, std::vector<PerformanceIndex>> solveWithFeedbackSettin
   settings.printSolverStatus = true;
   settings.printLinesearch = true;
   settings.nThreads = 100;
+  settings.nodePartitioning = nodePartitioning;
+  settings.qpSolverType = qpSolverType;
 
   // Additional problem definitions
   const ocs2::scalar_t startTime = 0.0;
@@ -160,3 +163,168 @@ TEST(test_unconstrained, noFeedback) {
         withEmptyConstraint.controllerPtr_->computeInput(t, x).isApprox(withNullConstraint.controllerPtr_->computeInput(t, x), tol));
   }
 }
+
+TEST(test_unconstrained, nodePartitioning) {
+  int n = 3;
+  int m = 2;
+  const double tol = 1e-9;
+  const auto dynamics = ocs2::getRandomDynamics(n, m);
+  const auto costs = ocs2::getRandomCost(n, m);
+  const auto solDynamicScheduling = ocs2::solveWithFeedbackSetting(true, false, dynamics, costs, false);
+  const auto solNodePartitioning = ocs2::solveWithFeedbackSetting(true, false, dynamics, costs, true);
+
+  ASSERT_LE(solNodePartitioning.second.size(), 2);
+  ASSERT_LT(solNodePartitioning.second.back().dynamicsViolationSSE, tol);
+
+  // Compare
+  const auto& withDynamicScheduling = solDynamicScheduling.first;
+  const auto& withNodePartitioning = solNodePartitioning.first;
+  ASSERT_EQ(withDynamicScheduling.timeTrajectory_.size(), withNodePartitioning.timeTrajectory_.size());
+  for (int i = 0; i < withDynamicScheduling.timeTrajectory_.size(); i++) {
+    ASSERT_DOUBLE_EQ(withDynamicScheduling.timeTrajectory_[i], withNodePartitioning.timeTrajectory_[i]);
+    ASSERT_TRUE(withDynamicScheduling.stateTrajectory_[i].isApprox(withNodePartitioning.stateTrajectory_[i], tol));
+    ASSERT_TRUE(withDynamicScheduling.inputTrajectory_[i].isApprox(withNodePartitioning.inputTrajectory_[i], tol));
+  }
+}
+
+TEST(test_unconstrained, parallelRiccati) {
+  int n = 3;
+  int m = 2;
+  const double tol = 1e-7;
+  const auto dynamics = ocs2::getRandomDynamics(n, m);
+  const auto costs = ocs2::getRandomCost(n, m);
+  const auto solHpipm = ocs2::solveWithFeedbackSetting(true, true, dynamics, costs, false, ocs2::sqp::QpSolverType::HPIPM);
+  const auto solParallelRiccati =
+      ocs2::solveWithFeedbackSetting(true, true, dynamics, costs, false, ocs2::sqp::QpSolverType::PARALLEL_RICCATI);
+
+  ASSERT_LE(solParallelRiccati.second.size(), 2);
+  ASSERT_LT(solParallelRiccati.second.back().dynamicsViolationSSE, tol);
+
+  // Compare
+  const auto& withHpipm = solHpipm.first;
+  const auto& withParallelRiccati = solParallelRiccati.first;
+  ASSERT_EQ(withHpipm.timeTrajectory_.size(), withParallelRiccati.timeTrajectory_.size());
+  for (int i = 0; i < withHpipm.timeTrajectory_.size(); i++) {
+    ASSERT_DOUBLE_EQ(withHpipm.timeTrajectory_[i], withParallelRiccati.timeTrajectory_[i]);
+    ASSERT_TRUE(withHpipm.stateTrajectory_[i].isApprox(withParallelRiccati.stateTrajectory_[i], tol));
+    ASSERT_TRUE(withHpipm.inputTrajectory_[i].isApprox(withParallelRiccati.inputTrajectory_[i], tol));
+    const auto t = withHpipm.timeTrajectory_[i];
+    const auto& x = withHpipm.stateTrajectory_[i];
+    ASSERT_TRUE(withHpipm.controllerPtr_->computeInput(t, x).isApprox(withParallelRiccati.controllerPtr_->computeInput(t, x), tol));
+  }
+}
+
+TEST(test_unconstrained, realTimeIteration) {
+  int n = 3;
+  int m = 2;
+  const double tol = 1e-9;
+  const auto dynamics = ocs2::getRandomDynamics(n, m);
+  const auto costs = ocs2::getRandomCost(n, m);
+
+  ocs2::OptimalControlProblem problem;
+  problem.dynamicsPtr = ocs2::getOcs2Dynamics(dynamics);
+  problem.costPtr->add("intermediateCost", ocs2::getOcs2Cost(costs));
+  problem.finalCostPtr->add("finalCost", ocs2::getOcs2StateCost(costs));
+  ocs2::TargetTrajectories targetTrajectories({0.0}, {ocs2::vector_t::Ones(n)}, {ocs2::vector_t::Ones(m)});
+  auto referenceManagerPtr = std::make_shared<ocs2::ReferenceManager>(targetTrajectories);
+  problem.targetTrajectoriesPtr = &referenceManagerPtr->getTargetTrajectories();
+  ocs2::DefaultInitializer zeroInitializer(m);
+
+  ocs2::sqp::Settings settings;
+  settings.dt = 0.05;
+  settings.nThreads = 2;
+  ocs2::SqpSolver solver(settings, problem, zeroInitializer);
+  solver.setReferenceManager(referenceManagerPtr);
+
+  settings.realTimeIteration = true;
+  ocs2::SqpSolver rtiSolver(settings, problem, zeroInitializer);
+  rtiSolver.setReferenceManager(referenceManagerPtr);
+
+  // First call without preparation
+  const ocs2::scalar_t horizon = 1.0;
+  const ocs2::vector_t initState = ocs2::vector_t::Ones(n);
+  solver.run(0.0, initState, horizon);
+  rtiSolver.run(0.0, initState, horizon);
+
+  // Second call with preparation, the initial state deviates from the prediction.
+  const ocs2::scalar_t nextTime = 0.1;
+  const ocs2::vector_t nextState = ocs2::vector_t::Random(n);
+  rtiSolver.prepare(nextTime, nextTime + horizon);
+  rtiSolver.run(nextTime, nextState, nextTime + horizon);
+  solver.run(nextTime, nextState, nextTime + horizon);
+
+  // The problem is linear-quadratic, a single full step with the corrected initial state is the optimal solution.
+  const auto solution = solver.primalSolution(nextTime + horizon);
+  const auto rtiSolution = rtiSolver.primalSolution(nextTime + horizon);
+  ASSERT_EQ(solution.timeTrajectory_.size(), rtiSolution.timeTrajectory_.size());
+  for (int i = 0; i < solution.timeTrajectory_.size(); i++) {
+    ASSERT_DOUBLE_EQ(solution.timeTrajectory_[i], rtiSolution.timeTrajectory_[i]);
+    ASSERT_TRUE(solution.stateTrajectory_[i].isApprox(rtiSolution.stateTrajectory_[i], tol));
+    ASSERT_TRUE(solution.inputTrajectory_[i].isApprox(rtiSolution.inputTrajectory_[i], tol));
+  }
+}
+
+TEST(test_unconstrained, realTimeIterationObservationTiming) {
+  int n = 3;
+  int m = 2;
+  const double tol = 1e-9;
+  const auto dynamics = ocs2::getRandomDynamics(n, m);
+  const auto costs = ocs2::getRandomCost(n, m);
+
+  ocs2::OptimalControlProblem problem;
+  problem.dynamicsPtr = ocs2::getOcs2Dynamics(dynamics);
+  problem.costPtr->add("intermediateCost", ocs2::getOcs2Cost(costs));
+  problem.finalCostPtr->add("finalCost", ocs2::getOcs2StateCost(costs));
+  ocs2::TargetTrajectories targetTrajectories({0.0}, {ocs2::vector_t::Ones(n)}, {ocs2::vector_t::Ones(m)});
+  auto referenceManagerPtr = std::make_shared<ocs2::ReferenceManager>(targetTrajectories);
+  problem.targetTrajectoriesPtr = &referenceManagerPtr->getTargetTrajectories();
+  ocs2::DefaultInitializer zeroInitializer(m);
+
+  ocs2::sqp::Settings settings;
+  settings.dt = 0.05;
+  settings.nThreads = 2;
+  settings.realTimeIteration = true;
+
+  const ocs2::scalar_t horizon = 1.0;
+  const ocs2::scalar_t nextTime = 0.1;
+  const ocs2::vector_t initState = ocs2::vector_t::Ones(n);
+  const auto runPrepared = [&](ocs2::scalar_t observationTime, const ocs2::vector_t& observationState) {
+    ocs2::SqpSolver rtiSolver(settings, problem, zeroInitializer);
+    rtiSolver.setReferenceManager(referenceManagerPtr);
+    rtiSolver.run(0.0, initState, horizon);
+    rtiSolver.prepare(nextTime, nextTime + horizon);
+    rtiSolver.run(observationTime, observationState, observationTime + horizon);
+    return rtiSolver.primalSolution(observationTime + horizon);
+  };
+
+  // An early or a late observation within half a time step uses the prepared QP, and the policy starts at the observation.
+  for (const ocs2::scalar_t offset : {-0.2 * settings.dt, 0.2 * settings.dt}) {
+    const ocs2::scalar_t observationTime = nextTime + offset;
+    const ocs2::vector_t observationState = ocs2::vector_t::Random(n);
+    const auto rtiSolution = runPrepared(observationTime, observationState);
+    ASSERT_DOUBLE_EQ(rtiSolution.timeTrajectory_.front(), observationTime);
+    ASSERT_NEAR(rtiSolution.timeTrajectory_[1], nextTime + settings.dt, tol);  // the remaining nodes are the prepared ones
+    ASSERT_TRUE(rtiSolution.stateTrajectory_.front().isApprox(observationState, tol));
+    const ocs2::vector_t input = rtiSolution.controllerPtr_->computeInput(observationTime, observationState);
+    ASSERT_TRUE(input.isApprox(rtiSolution.inputTrajectory_.front(), tol));
+  }
+
+  // An observation that is later than half a time step prepares the QP again. The single step is then optimal for the observation.
+  const ocs2::scalar_t lateTime = nextTime + 0.7 * settings.dt;
+  const ocs2::vector_t lateState = ocs2::vector_t::Random(n);
+  const auto rtiSolution = runPrepared(lateTime, lateState);
+
+  settings.realTimeIteration = false;
+  ocs2::SqpSolver solver(settings, problem, zeroInitializer);
+  solver.setReferenceManager(referenceManagerPtr);
+  solver.run(0.0, initState, horizon);
+  solver.run(lateTime, lateState, lateTime + horizon);
+  const auto solution = solver.primalSolution(lateTime + horizon);
+
+  ASSERT_EQ(solution.timeTrajectory_.size(), rtiSolution.timeTrajectory_.size());
+  for (int i = 0; i < solution.timeTrajectory_.size(); i++) {
+    ASSERT_DOUBLE_EQ(solution.timeTrajectory_[i], rtiSolution.timeTrajectory_[i]);
+    ASSERT_TRUE(solution.stateTrajectory_[i].isApprox(rtiSolution.stateTrajectory_[i], tol));
+    ASSERT_TRUE(solution.inputTrajectory_[i].isApprox(rtiSolution.inputTrajectory_[i], tol));
+  }
+}